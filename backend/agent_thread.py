@@ -9,6 +9,11 @@ import openai
 from openai import OpenAI
 
 
+def now_ms():
+    """Wall clock in ms for latency trace stamps."""
+    return time.time_ns() // 1_000_000
+
+
 def run_agent_thread(input_queue: Queue, output_queue: Queue, shutdown_event: threading.Event):
     openai_client = OpenAI(api_key=os.getenv("OPENAI_API_KEY"))
     logging.info("[Agent] Agent thread started")
@@ -36,9 +41,12 @@ def run_agent_thread(input_queue: Queue, output_queue: Queue, shutdown_event: th
                })
             if type == "ASSISTANT_PROCESS_WAVE":
                 filename = task.get("fname")
+                rid = task.get("rid")
+                trace = task.get("trace") or {}
                 logging.info(f"[Agent] Processing {filename} from sender: {sender}")
                 try:
                     # --- 1. Transcribe ---
+                    trace["stt_start"] = now_ms()
                     with open(filename, "rb") as f:
                         whisper_result = openai_client.audio.transcriptions.create(
                             model="whisper-1",
@@ -46,6 +54,7 @@ def run_agent_thread(input_queue: Queue, output_queue: Queue, shutdown_event: th
                         )
                         text = whisper_result.text
 
+                    trace["stt_end"] = now_ms()
                     logging.info(f"[Whisper] Transcript: {text}")
 
                     # --- 2. LLM Processing ---
@@ -63,6 +72,7 @@ def run_agent_thread(input_queue: Queue, output_queue: Queue, shutdown_event: th
                         model="gpt-4",
                         messages=[{"role": "user", "content": prompt}]
                     )
+                    trace["llm_end"] = now_ms()
                     # --- Parse GPT-4 Response ---
                     try:
                         reply_json = json.loads(response.choices[0].message.content)
@@ -83,8 +93,14 @@ def run_agent_thread(input_queue: Queue, output_queue: Queue, shutdown_event: th
                         "content": reply,
                         "language": lang,
                         "mode": mode,
-                        "sender": str(sender)
+                        "sender": str(sender),
+                        "rid": rid,
+                        "trace": trace,
                     })
+                    if "rx" in trace:
+                        logging.info(f"[Agent] rid={rid} queue {trace['stt_start'] - trace['rx']} ms, "
+                                     f"whisper {trace['stt_end'] - trace['stt_start']} ms, "
+                                     f"gpt {trace['llm_end'] - trace['stt_end']} ms")
 
                 except openai.RateLimitError as e:
                     logging.error("[Agent] Rate limit or quota exceeded.")
@@ -2,13 +2,18 @@ import wave
 import os
 import logging
 from utils.wav_helpers import write_wav_header_placeholder, finalize_wav_file
+from handlers.frame_parser import iter_frames, ulaw_decode, FrameStats, CODEC_PCM16, CODEC_ULAW, CH_CONTROL, CH_AUDIO_UP
 
 class AudioStreamSession:
-    def __init__(self, filepath: str, sample_rate=16000, num_channels=1, bits_per_sample=16):
+    def __init__(self, filepath: str, sample_rate=16000, num_channels=1, bits_per_sample=16, framed=False, stream_id=None):
         self.filepath = filepath
         self.sample_rate = sample_rate
         self.num_channels = num_channels
         self.bits_per_sample = bits_per_sample
+        # Framed streams carry a header per binary message (see frame_parser.py),
+        # older firmware sends bare PCM
+        self.framed = framed
+        self.stats = FrameStats(stream_id) if framed else None
 
         logging.info(f"[AudioStreamSession] Initializing session: {filepath}")
         try:
@@ -30,6 +35,45 @@ class AudioStreamSession:
         except Exception as e:
             logging.exception(f"[AudioStreamSession] Failed to write audio chunk: {e}")
 
+    def write_message(self, data: bytes):
+        if not self.framed:
+            self.write_chunk(data)
+            return
+
+        for header, payload in iter_frames(data):
+            if header is None:
+                logging.warning(f"[AudioStreamSession] Dropping malformed frame data ({len(data)} byte message)")
+                return
+            if header.channel not in (CH_AUDIO_UP, CH_CONTROL):
+                logging.warning(f"[AudioStreamSession] Frame on channel {header.channel} is not uplink audio, dropped")
+                continue
+            if header.codec not in (CODEC_PCM16, CODEC_ULAW):
+                logging.warning(f"[AudioStreamSession] Unsupported codec {header.codec}, frame dropped")
+                continue
+            if self.stats.accept(header):
+                # The WAV stays PCM16 when the device degrades to mu-law
+                self.write_chunk(ulaw_decode(payload) if header.codec == CODEC_ULAW else payload)
+
+    def complete(self, announced_frames=None) -> bool:
+        """True once every frame STOP_STREAM announced has arrived (or cannot be told)."""
+        if not self.framed or announced_frames is None:
+            return True
+        return self.stats.expected_seq >= announced_frames
+
+    @property
+    def finished(self) -> bool:
+        return self.wave_file.closed
+
+    def finish(self, announced_frames=None):
+        """Close the file and return the framing summary (None for raw streams)."""
+        self.close()
+        if not self.framed:
+            return None
+        self.stats.finish(announced_frames)
+        summary = self.stats.summary()
+        logging.info(f"[AudioStreamSession] Stream summary: {summary}")
+        return summary
+
     def close(self):
         try:
             if not self.wave_file.closed:
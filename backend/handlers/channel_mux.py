@@ -0,0 +1,102 @@
+import time
+import asyncio
+import logging
+from collections import deque
+import websockets
+from handlers.frame_parser import CH_CONTROL, CH_AUDIO_DOWN, CH_TELEMETRY
+
+# Bytes a bulk channel may send per round robin turn
+CHANNEL_QUANTUM = {
+    CH_AUDIO_DOWN: 8192,
+    CH_TELEMETRY: 1024,
+}
+
+
+class ChannelMux:
+    """Single writer for one device WebSocket, mirror of the device's AudioUplink sender.
+
+    Control messages (JSON replies) go out first; the sender looks at the
+    control queue again before every write. Reply audio and telemetry share
+    the rest by deficit round robin with per-channel byte quanta, so a long
+    audio reply can neither delay a response nor be starved itself. Every
+    channel stays FIFO, so stream markers sent on the audio channel keep
+    their place among the frames.
+    """
+
+    def __init__(self, ws):
+        self.ws = ws
+        self.queues = {CH_CONTROL: deque(), CH_AUDIO_DOWN: deque(), CH_TELEMETRY: deque()}
+        self.deficit = {ch: 0 for ch in CHANNEL_QUANTUM}
+        self.wakeup = asyncio.Event()
+        self.closed = False
+        self.sent = {ch: 0 for ch in self.queues}
+        self.bytes = {ch: 0 for ch in self.queues}
+        self.control_wait_ms_max = 0.0
+        self.task = asyncio.create_task(self._run())
+
+    def send(self, channel: int, message):
+        """Queue a text (str) or binary (bytes) message, never blocks."""
+        if self.closed:
+            return False
+        self.queues[channel].append((message, time.monotonic()))
+        self.wakeup.set()
+        return True
+
+    def pending(self, channel: int) -> int:
+        return len(self.queues[channel])
+
+    def close(self):
+        self.closed = True
+        self.task.cancel()
+
+    async def _write(self, channel, item):
+        message, queued = item
+        await self.ws.send(message)
+        self.sent[channel] += 1
+        self.bytes[channel] += len(message)
+        if channel == CH_CONTROL:
+            self.control_wait_ms_max = max(self.control_wait_ms_max, (time.monotonic() - queued) * 1000)
+
+    async def _round(self):
+        """Send one control message or one round of the bulk channels. Returns False when all are empty."""
+        control = self.queues[CH_CONTROL]
+        if control:
+            await self._write(CH_CONTROL, control.popleft())
+            return True
+
+        busy = False
+        for channel, quantum in CHANNEL_QUANTUM.items():
+            queue = self.queues[channel]
+            if not queue:
+                self.deficit[channel] = 0   # Idle channels do not bank credit
+                continue
+            busy = True
+            self.deficit[channel] += quantum
+            while queue and len(queue[0][0]) <= self.deficit[channel]:
+                item = queue.popleft()
+                self.deficit[channel] -= len(item[0])
+                await self._write(channel, item)
+                if control:
+                    return True
+        return busy
+
+    async def _run(self):
+        try:
+            while True:
+                await self.wakeup.wait()
+                self.wakeup.clear()
+                while await self._round():
+                    pass
+        except websockets.exceptions.ConnectionClosed:
+            logging.info(f"[Mux] Connection closed, {sum(len(q) for q in self.queues.values())} message(s) not sent")
+            self.closed = True
+        except asyncio.CancelledError:
+            pass
+
+    def summary(self) -> dict:
+        return {
+            "sent": dict(self.sent),
+            "bytes": dict(self.bytes),
+            "pending": {ch: len(q) for ch, q in self.queues.items()},
+            "control_wait_ms_max": round(self.control_wait_ms_max, 1),
+        }
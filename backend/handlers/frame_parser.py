@@ -0,0 +1,165 @@
+import sys
+import time
+import array
+import struct
+import logging
+
+# Must match src/AudioFrame.h
+FRAME_MAGIC = 0xA5
+FRAME_VERSION = 1
+FRAME_HEADER = struct.Struct("<BBBBBBHIQ")   # magic, version, codec, flags, stream_id, channel, payload_len, seq, capture_us
+FRAME_HEADER_SIZE = FRAME_HEADER.size          # 20 bytes
+
+FLAG_START = 0x01
+
+CODEC_PCM16 = 0
+CODEC_MP3 = 1
+CODEC_ULAW = 2    # G.711 mu-law, the device switches to it under backpressure
+
+# Logical channels on the WebSocket (WsChannel); 0 in a binary frame = sender without the multiplexer
+CH_CONTROL = 0
+CH_AUDIO_UP = 1
+CH_AUDIO_DOWN = 2
+CH_TELEMETRY = 3
+
+MAX_TRACKED_MISSING = 4096
+
+
+class FrameHeader:
+    __slots__ = ("codec", "flags", "stream_id", "channel", "payload_len", "seq", "capture_us")
+
+    def __init__(self, codec, flags, stream_id, channel, payload_len, seq, capture_us):
+        self.codec = codec
+        self.flags = flags
+        self.stream_id = stream_id
+        self.channel = channel
+        self.payload_len = payload_len
+        self.seq = seq
+        self.capture_us = capture_us
+
+
+def _ulaw_to_linear(u: int) -> int:
+    u = ~u & 0xFF
+    sample = (((u & 0x0F) << 3) + 0x84) << ((u >> 4) & 0x07)
+    sample -= 0x84
+    return -sample if u & 0x80 else sample
+
+_ULAW_TABLE = [_ulaw_to_linear(u) for u in range(256)]
+
+
+def ulaw_decode(payload) -> bytes:
+    """G.711 mu-law bytes -> PCM16 little endian."""
+    pcm = array.array("h", [_ULAW_TABLE[b] for b in payload])
+    if sys.byteorder == "big":
+        pcm.byteswap()
+    return pcm.tobytes()
+
+
+def build_frame(codec: int, flags: int, stream_id: int, seq: int, capture_us: int, payload: bytes,
+                channel: int = CH_AUDIO_DOWN) -> bytes:
+    """Header + payload for one frame (downlink direction)."""
+    return FRAME_HEADER.pack(FRAME_MAGIC, FRAME_VERSION, codec, flags, stream_id & 0xFF, channel,
+                             len(payload), seq & 0xFFFFFFFF, capture_us) + payload
+
+
+def iter_frames(data: bytes):
+    """Yield (FrameHeader, payload memoryview) for every frame in a binary message.
+
+    The device coalesces queued frames into one message, so there can be
+    several back to back. Yields (None, None) once and stops on garbage.
+    """
+    view = memoryview(data)
+    offset = 0
+    while offset < len(data):
+        if len(data) - offset < FRAME_HEADER_SIZE or data[offset] != FRAME_MAGIC:
+            yield None, None
+            return
+        magic, version, codec, flags, stream_id, channel, payload_len, seq, capture_us = FRAME_HEADER.unpack_from(data, offset)
+        end = offset + FRAME_HEADER_SIZE + payload_len
+        if version != FRAME_VERSION or end > len(data):
+            yield None, None
+            return
+        yield FrameHeader(codec, flags, stream_id, channel, payload_len, seq, capture_us), view[offset + FRAME_HEADER_SIZE:end]
+        offset = end
+
+
+class FrameStats:
+    """Sequence and latency bookkeeping for one framed stream.
+
+    Latency is one-way (device capture wall clock -> arrival here), so it is
+    only as good as the NTP sync on both ends.
+    """
+
+    def __init__(self, stream_id=None):
+        self.stream_id = stream_id
+        self.expected_seq = 0
+        self.frames = 0
+        self.bytes = 0
+        self.lost = 0          # Frames skipped over by a sequence jump
+        self.gaps = 0          # Number of jumps
+        self.reordered = 0     # Arrived after a later frame (dropped, no longer counted as lost)
+        self.duplicates = 0
+        self.missing = set()   # Skipped sequence numbers, to tell late frames from duplicates
+        self.foreign = 0       # Frames for another stream id
+        self.compressed = 0    # Sent as mu-law by the device's backpressure policy
+        self.latencies_ms = []
+
+    def accept(self, header: FrameHeader) -> bool:
+        """Update counters; returns False if the frame should be dropped."""
+        if self.stream_id is not None and header.stream_id != self.stream_id:
+            self.foreign += 1
+            return False
+
+        if header.seq < self.expected_seq:
+            # Either a late frame we already skipped or a duplicate
+            if header.seq in self.missing:
+                self.missing.discard(header.seq)
+                self.lost -= 1
+                self.reordered += 1
+            else:
+                self.duplicates += 1
+            return False
+
+        if header.seq > self.expected_seq:
+            missing = header.seq - self.expected_seq
+            self.lost += missing
+            self.gaps += 1
+            if len(self.missing) < MAX_TRACKED_MISSING:
+                self.missing.update(range(self.expected_seq, header.seq))
+            logging.warning(f"[FrameParser] Stream {header.stream_id}: gap of {missing} frame(s) before seq {header.seq}")
+
+        self.expected_seq = header.seq + 1
+        self.frames += 1
+        if header.codec == CODEC_ULAW:
+            self.compressed += 1
+        self.bytes += header.payload_len
+        self.latencies_ms.append((time.time_ns() // 1000 - header.capture_us) / 1000.0)
+        return True
+
+    def finish(self, announced_frames=None):
+        """Account for frames lost at the tail (STOP_STREAM carries the frame count)."""
+        if announced_frames is not None and announced_frames > self.expected_seq:
+            self.lost += announced_frames - self.expected_seq
+            self.gaps += 1
+
+    def summary(self) -> dict:
+        lat = sorted(self.latencies_ms)
+        def pct(p):
+            return round(lat[min(len(lat) - 1, int(len(lat) * p))], 1) if lat else None
+        total = self.frames + self.lost
+        return {
+            "stream_id": self.stream_id,
+            "frames": self.frames,
+            "bytes": self.bytes,
+            "lost": self.lost,
+            "loss_percent": round(self.lost * 100.0 / total, 2) if total else 0.0,
+            "gaps": self.gaps,
+            "reordered": self.reordered,
+            "duplicates": self.duplicates,
+            "foreign": self.foreign,
+            "compressed": self.compressed,
+            "latency_ms_min": round(lat[0], 1) if lat else None,
+            "latency_ms_p50": pct(0.50),
+            "latency_ms_p95": pct(0.95),
+            "latency_ms_max": round(lat[-1], 1) if lat else None,
+        }
@@ -1,4 +1,5 @@
 import os
+import time
 import shutil
 import logging
 from fastapi import FastAPI, UploadFile, File, Form
@@ -17,7 +18,8 @@ def create_app(in_queue):
     @app.post("/upload")
     async def upload_wav(
         file: UploadFile = File(...),
-        session_id: str = Form(None)  # Get session_id from form field
+        session_id: str = Form(None),  # Get session_id from form field
+        rid: int = Form(None)  # Device request id for the latency trace
     ):
         """Upload a WAV file and process it."""
         try:
@@ -39,6 +41,8 @@ def create_app(in_queue):
                 "type": "ASSISTANT_PROCESS_WAVE",
                 "fname": path,
                 "sender": session_id if session_id else None,
+                "rid": rid,
+                "trace": {"rx": time.time_ns() // 1_000_000},
             })
 
             return JSONResponse(content={"status": "ok", "filename": filename, "size": size})
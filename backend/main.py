@@ -12,6 +12,9 @@ from uvicorn import Config, Server
 from http_server import create_app
 from agent_thread import run_agent_thread
 from handlers.audio_handler import AudioStreamSession
+from handlers.frame_parser import build_frame, FLAG_START, CODEC_PCM16, CODEC_MP3, CH_CONTROL, CH_AUDIO_DOWN
+from handlers.channel_mux import ChannelMux
+from tts_stream import stream_speech, TTS_SAMPLE_RATE, TTS_FORMAT
 
 logging.basicConfig(level=logging.INFO)
 
@@ -20,17 +23,63 @@ os.makedirs(UPLOAD_DIR, exist_ok=True)
 
 connected_clients = {}  # {websocket: last_hello_timestamp}
 stream_sessions = {}  # Map client_id -> AudioStreamSession
+downlink_clients = {}  # Map client_id -> reply audio codecs the device can play (from HELLO)
+stream_rids = {}  # Map client_id -> request id of the active stream (latency trace)
+pending_stops = {}  # Map client_id -> STOP_STREAM still waiting for the last frames
+channel_muxes = {}  # Map websocket -> ChannelMux, the only writer of that socket
+client_telemetry = {}  # Map client_id -> last TELEMETRY message
+
+STOP_GRACE_S = 2.0  # STOP_STREAM travels on the control channel and can overtake the last frames
+DOWNLINK_LEAD_MS = 2000  # Max audio sent ahead of real time (device jitter buffer holds 4 s)
+MP3_BYTES_PER_MS = 16    # Assumed 128 kbps for MP3 pacing
+downlink_stream_id = 0
 
 agent_in_queue = queue.Queue() # Queue for incoming messages from ESP32 to the agent
 agent_out_queue = queue.Queue() # Queue for outgoing messages from the agent to ESP32
 
 shutdown_event = threading.Event() # Threads signal for shutdown
 
+
+def now_ms():
+    """Wall clock in ms for latency trace stamps (only compared with other backend stamps)."""
+    return time.time_ns() // 1_000_000
+
+# ────────────── Stream Completion ──────────────
+def finish_stream(client_id, session):
+    """Close a stream session and hand the recording to the agent."""
+    stop = pending_stops.pop(client_id, {})
+    if stream_sessions.get(client_id) is session:
+        del stream_sessions[client_id]
+    if session.finished:
+        return
+    session.finish(stop.get("frames"))
+    logging.info(f"[WS] STOP_STREAM closed and saved to {session.filepath} for {client_id}")
+
+    # Send to agent for processing, wave file should be there
+    agent_in_queue.put({
+        "type": "ASSISTANT_PROCESS_WAVE",
+        "fname": session.filepath,
+        "sender": client_id,
+        "rid": stop.get("rid", stream_rids.get(client_id)),
+        "trace": {"rx": stop.get("rx", now_ms())},
+    })
+
+async def finish_stream_when_complete(client_id, session):
+    """Wait up to STOP_GRACE_S for frames still queued behind STOP_STREAM on the device."""
+    deadline = time.monotonic() + STOP_GRACE_S
+    while not session.finished and time.monotonic() < deadline:
+        if session.complete(pending_stops.get(client_id, {}).get("frames")):
+            break
+        await asyncio.sleep(0.02)
+    if not session.finished:
+        finish_stream(client_id, session)
+
 # ────────────── WebSocket Handler ──────────────
 async def handle_client(websocket):
     client_id = str(id(websocket))
     logging.info(f"[WS] Client connected: {client_id}")
     connected_clients[websocket] = asyncio.get_event_loop().time()
+    channel_muxes[websocket] = ChannelMux(websocket)
 
     try:
         async for message in websocket:
@@ -43,18 +92,39 @@ async def handle_client(websocket):
                     parsed["sender"] = client_id
                     msg_type = parsed.get("type")
 
-                    if msg_type == "START_STREAM":
+                    if msg_type == "HELLO" and parsed.get("downlink"):
+                        downlink_clients[client_id] = parsed["downlink"]
+                        logging.info(f"[WS] {client_id} accepts streamed reply audio: {parsed['downlink']}")
+
+                    if msg_type == "TELEMETRY":
+                        # Device stats, kept for inspection and not passed to the agent
+                        client_telemetry[client_id] = parsed
+                        logging.info(f"[Mux] {client_id} downlink: {channel_muxes[websocket].summary()}")
+
+                    elif msg_type == "START_STREAM":
                         # Initialize a new audio stream session
                         logging.info(f"[WS] START_STREAM initialized for {client_id}")
+                        previous = stream_sessions.get(client_id)
+                        if previous:
+                            # Previous stream still waiting for its tail: it ends here
+                            if client_id in pending_stops:
+                                finish_stream(client_id, previous)
+                            else:
+                                previous.close()
                         filepath = os.path.join(UPLOAD_DIR, f"stream_{client_id}.wav")
                         # Remove old file if it exists
                         if os.path.exists(filepath):
                             os.remove(filepath)
                             logging.info(f"[WS] Removed old stream file: {filepath}")
 
-                        # Create new audio session
-                        stream_sessions[client_id] = AudioStreamSession(filepath)
+                        # Create new audio session (framed if the device announces it)
+                        stream_sessions[client_id] = AudioStreamSession(
+                            filepath,
+                            sample_rate=parsed.get("sample_rate", 16000),
+                            framed=bool(parsed.get("framing")),
+                            stream_id=parsed.get("stream_id"))
                         parsed["filepath"] = filepath
+                        stream_rids[client_id] = parsed.get("rid")
                         # continue
 
                     elif msg_type == "STOP_STREAM":
@@ -62,17 +132,16 @@ async def handle_client(websocket):
                         logging.info(f"[WS] STOP_STREAM received for {client_id}")
                         session = stream_sessions.get(client_id)
                         if session:
-                            session.close()
-                            del stream_sessions[client_id]
-                            parsed["fname"] = session.filepath
-                            logging.info(f"[WS] STOP_STREAM closed and saved to {session.filepath} for {client_id}")
-
-                            # Send to agent for processing, wave file should be there
-                            agent_in_queue.put({
-                                "type": "ASSISTANT_PROCESS_WAVE",
-                                   "fname": session.filepath,
-                                "sender": client_id
-                             })
+                            pending_stops[client_id] = {
+                                "frames": parsed.get("frames"),
+                                "rid": parsed.get("rid", stream_rids.get(client_id)),
+                                "rx": now_ms(),
+                            }
+                            if session.complete(parsed.get("frames")):
+                                finish_stream(client_id, session)
+                            else:
+                                logging.info(f"[WS] STOP_STREAM ahead of the last frames for {client_id}, waiting")
+                                asyncio.create_task(finish_stream_when_complete(client_id, session))
                         # continue
 
                     else:
@@ -85,8 +154,11 @@ async def handle_client(websocket):
             elif isinstance(message, bytes):
                 session = stream_sessions.get(client_id)
                 if session:
-                    session.write_chunk(message)
-                    logging.debug(f"[WS] Audio chunk received from {client_id}, size: {bytes}")
+                    session.write_message(message)
+                    logging.debug(f"[WS] Audio chunk received from {client_id}, size: {len(message)}")
+                    stop = pending_stops.get(client_id)
+                    if stop and session.complete(stop.get("frames")):
+                        finish_stream(client_id, session)
                 else:
                     logging.warning(f"[WS] Binary received from {client_id} but no stream session active")
 
@@ -103,6 +175,13 @@ async def handle_client(websocket):
         logging.info(f"[WS] Client disconnected: {client_id}")
     finally:
         connected_clients.pop(websocket, None)
+        downlink_clients.pop(client_id, None)
+        stream_rids.pop(client_id, None)
+        pending_stops.pop(client_id, None)
+        client_telemetry.pop(client_id, None)
+        mux = channel_muxes.pop(websocket, None)
+        if mux:
+            mux.close()
         if client_id in stream_sessions:
             stream_sessions[client_id].close()
             del stream_sessions[client_id]
@@ -126,6 +205,75 @@ async def ping_clients():
             except websockets.exceptions.ConnectionClosed:
                 connected_clients.pop(ws, None)
 
+# ────────────── Reply Audio Downlink ──────────────
+async def stream_reply_audio(mux, text):
+    """Synthesize text and stream it to the device as framed binary messages.
+
+    The start / end markers go on the audio channel too, so they stay in
+    order with the frames while control messages pass them.
+    """
+    global downlink_stream_id
+    downlink_stream_id = (downlink_stream_id + 1) & 0xFF
+    stream_id = downlink_stream_id
+    mp3 = TTS_FORMAT == "mp3"
+    codec = CODEC_MP3 if mp3 else CODEC_PCM16
+
+    mux.send(CH_AUDIO_DOWN, json.dumps({
+        "type": "AUDIO_STREAM_START",
+        "stream_id": stream_id,
+        "codec": "mp3" if mp3 else "pcm16",
+        "sample_rate": TTS_SAMPLE_RATE,
+    }))
+
+    # OpenAI streaming is blocking, run it in a thread and hand chunks over
+    loop = asyncio.get_running_loop()
+    chunks = asyncio.Queue()
+
+    def produce():
+        try:
+            for chunk in stream_speech(text):
+                loop.call_soon_threadsafe(chunks.put_nowait, chunk)
+        except Exception as e:
+            logging.exception("[Downlink] TTS synthesis failed")
+            loop.call_soon_threadsafe(chunks.put_nowait, e)
+        finally:
+            loop.call_soon_threadsafe(chunks.put_nowait, None)
+
+    threading.Thread(target=produce, daemon=True).start()
+
+    seq = 0
+    error = False
+    sent_ms = 0.0
+    start = time.monotonic()
+    first_ms = None
+    while True:
+        chunk = await chunks.get()
+        if chunk is None:
+            break
+        if isinstance(chunk, Exception):
+            error = True
+            continue
+        if mux.closed:
+            continue  # Client gone, let the producer run out
+
+        # Pace to real time plus a lead, so the device buffer never overflows
+        ahead = sent_ms - (time.monotonic() - start) * 1000
+        if ahead > DOWNLINK_LEAD_MS:
+            await asyncio.sleep((ahead - DOWNLINK_LEAD_MS) / 1000)
+
+        flags = FLAG_START if seq == 0 else 0
+        mux.send(CH_AUDIO_DOWN, build_frame(codec, flags, stream_id, seq, time.time_ns() // 1000, chunk))
+        if first_ms is None:
+            first_ms = (time.monotonic() - start) * 1000
+        seq += 1
+        sent_ms += len(chunk) / (MP3_BYTES_PER_MS if mp3 else TTS_SAMPLE_RATE * 2 / 1000)
+
+    if mux.closed:
+        logging.info(f"[Downlink] Client gone during stream {stream_id}")
+        return
+    mux.send(CH_AUDIO_DOWN, json.dumps({"type": "AUDIO_STREAM_END", "stream_id": stream_id, "frames": seq, "error": error}))
+    logging.info(f"[Downlink] Stream {stream_id}: {seq} frames, {sent_ms:.0f} ms audio, first frame after {first_ms or 0:.0f} ms")
+
 # ────────────── Agent Dispatcher ──────────────
 async def dispatch_agent_responses():
     while not shutdown_event.is_set():
@@ -136,16 +284,24 @@ async def dispatch_agent_responses():
 
             if sender is None or sender == "" or sender == "None":
                 logging.info("[WS] Broadcasting message to all clients")
-                for ws in list(connected_clients.keys()):
-                    try:
-                        await ws.send(payload)
-                    except Exception as e:
-                        logging.warning(f"[WS] Failed to send to client: {e}")
+                for mux in list(channel_muxes.values()):
+                    mux.send(CH_CONTROL, payload)
             else:
-                for ws in list(connected_clients.keys()):
+                for ws, mux in list(channel_muxes.items()):
                     if str(id(ws)) == str(sender):
-                        await ws.send(payload)
-                        logging.info(f"[WS] Sent response {msg.get('type')} to client: {sender}")
+                        stream_audio = (msg.get("type") == "ASSISTANT_TEXT_RESPONSE"
+                                        and msg.get("content")
+                                        and ("mp3" if TTS_FORMAT == "mp3" else "pcm16") in downlink_clients.get(str(sender), []))
+                        if stream_audio:
+                            # Device plays the streamed audio instead of calling a TTS service itself
+                            msg["audio"] = "stream"
+                        if "trace" in msg:
+                            msg["trace"]["tx"] = now_ms()
+                        payload = json.dumps(msg)
+                        mux.send(CH_CONTROL, payload)
+                        logging.info(f"[WS] Queued response {msg.get('type')} for client: {sender}")
+                        if stream_audio:
+                            asyncio.create_task(stream_reply_audio(mux, msg["content"]))
                         break
         except queue.Empty:
             await asyncio.sleep(0.1)
@@ -153,14 +309,16 @@ async def dispatch_agent_responses():
 
 # ────────────── HTTP Server ──────────────
 def run_fastapi_server():
-    config = Config(app=create_app(agent_in_queue), host="0.0.0.0", port=8766, log_level="info")
+    # The device keeps its upload connection open between recordings (FileUploader.cpp reconnects after 60 s idle)
+    config = Config(app=create_app(agent_in_queue), host="0.0.0.0", port=8766, log_level="info", timeout_keep_alive=75)
     server = Server(config)
     logging.info("[HTTP] Starting FastAPI server at http://0.0.0.0:8766")
     asyncio.run(server.serve())
 
 # ────────────── Websocket Server ──────────────
 async def main():
-    server = await websockets.serve(handle_client, "0.0.0.0", 8765)
+    # Small transport buffer, so queued bulk data waits in the ChannelMux where control can pass it
+    server = await websockets.serve(handle_client, "0.0.0.0", 8765, write_limit=16384)
     logging.info("[WS] Server started at ws://0.0.0.0:8765")
 
     asyncio.create_task(ping_clients())
@@ -0,0 +1,50 @@
+import os
+import logging
+from openai import OpenAI
+
+# OpenAI TTS "pcm" output: 24 kHz, 16-bit signed little endian, mono
+TTS_SAMPLE_RATE = 24000
+TTS_MODEL = os.getenv("TTS_MODEL", "tts-1")
+TTS_VOICE = os.getenv("TTS_VOICE", "alloy")
+TTS_FORMAT = os.getenv("TTS_STREAM_FORMAT", "pcm16")   # "pcm16" or "mp3"
+
+FRAME_MS = 20
+PCM_FRAME_BYTES = TTS_SAMPLE_RATE * 2 * FRAME_MS // 1000   # 960 bytes
+MP3_CHUNK_BYTES = 1024
+
+_client = None
+
+
+def _openai():
+    global _client
+    if _client is None:
+        _client = OpenAI(api_key=os.getenv("OPENAI_API_KEY"))
+    return _client
+
+
+def stream_speech(text: str):
+    """Yield synthesized audio for text in frame-sized chunks as it is produced.
+
+    PCM is cut into exact 20 ms frames (sample aligned), MP3 into fixed-size
+    chunks (the decoder on the device resyncs on frame headers).
+    """
+    response_format = "mp3" if TTS_FORMAT == "mp3" else "pcm"
+    chunk = MP3_CHUNK_BYTES if response_format == "mp3" else PCM_FRAME_BYTES
+
+    with _openai().audio.speech.with_streaming_response.create(
+        model=TTS_MODEL,
+        voice=TTS_VOICE,
+        input=text,
+        response_format=response_format,
+    ) as response:
+        pending = b""
+        for data in response.iter_bytes(chunk_size=4096):
+            pending += data
+            while len(pending) >= chunk:
+                yield pending[:chunk]
+                pending = pending[chunk:]
+        if pending:
+            if response_format == "pcm" and len(pending) % 2:
+                pending = pending[:-1]
+            yield pending
+    logging.debug(f"[TTSStream] Finished synthesis of {len(text)} chars")
@@ -2,13 +2,28 @@
 // and receives response audio back for playback
 #include <WiFi.h>
 #include <SD_MMC.h>
-#include <ArduinoJson.h>
 #include <HTTPClient.h>
+#include <lwip/sockets.h>
+#include "esp_timer.h"
 #include "AIAssistant.h"
+#include "TTSCache.h"
+#include "AudioDownlink.h"
+#include "FileUploader.h"
+#include "RequestSpool.h"
+#include "LatencyTrace.h"
+#include "AssistantMessage.h"
+#include "EventStream.h"
 #include "GUI/GUI.h"
 
 using namespace websockets;
-WebsocketsClient client;
+
+// Plain ws:// transport that exposes its lwIP socket, so the client task can sleep in select()
+class SelectableTcpClient : public network::Esp32TcpClient {
+public:
+  int fd() const { return getSocket(); }
+};
+static std::shared_ptr<SelectableTcpClient> wsTransport = std::make_shared<SelectableTcpClient>();
+WebsocketsClient client(wsTransport);
 String senderSessionId = "";
 
 static const char* websocketURL = ENV_WEBSOCKET_URL;
@@ -18,8 +33,37 @@ static const char* uploadURL = ENV_UPLOAD_URL;
 static String currentLang = "en";
 static String currentMode = "chat";
 
+// Client task / reconnect timer
+static TaskHandle_t wsTaskHandle = nullptr;
+static TimerHandle_t reconnectTimer = nullptr;
+static uint32_t reconnectBackoffMs = WS_RECONNECT_MIN_MS;
+static volatile int64_t readyUs = 0;        // Socket became readable, 0 outside poll()
+static int64_t pingSentUs = 0;              // Keepalive ping in flight
+
+// Link stats
+static uint32_t statWakeups = 0;
+static uint32_t statIdleTimeouts = 0;
+static uint32_t statReconnects = 0;
+static uint32_t statMessages = 0;
+static uint32_t statDispatchUsLast = 0;
+static uint32_t statDispatchUsMax = 0;
+static uint64_t statDispatchUsTotal = 0;
+static uint32_t statPingRttMs = 0;
+static uint32_t statParseUsLast = 0;
+static uint32_t statParseUsMax = 0;
+static uint32_t statParseErrors = 0;
+static uint32_t statLargestMessage = 0;
+static uint32_t statWakeupsAtPrint = 0;
+static uint32_t statLastPrintMs = 0;
+
+// Parse buffer for text messages, grown as needed and reused (WebSocket task only)
+static char* parseBuf = nullptr;
+static size_t parseCap = 0;
+
 // Streaming Microphone data state
 static bool streamingWave = false;
+static uint8_t streamId = 0;        // Incremented per START_STREAM, carried in every frame
+static uint32_t frameSeq = 0;       // Next frame sequence number
 
 /*
  Web Socket
@@ -27,70 +71,109 @@ static bool streamingWave = false;
 
 void onMessageCallback(WebsocketsMessage message)
 {
-    Serial.print("Received Websocket message");
+    // Socket readable -> callback; the old 10 ms poll added up to a full period here
+    if (readyUs) {
+        const uint32_t dt = (uint32_t)(esp_timer_get_time() - readyUs);
+        statMessages++;
+        statDispatchUsLast = dt;
+        statDispatchUsTotal += dt;
+        if (dt > statDispatchUsMax) statDispatchUsMax = dt;
+    }
+
     if (message.isText())
     {
-        const String msg = message.data();
+        // The parser works in place, so it gets an owned copy; the message's buffer is const
+        const size_t len = message.length();
+        if (len > statLargestMessage) statLargestMessage = len;
+        if (len + 1 > parseCap) {
+            char* grown = (char*)realloc(parseBuf, len + 1);
+            if (!grown) {
+                statParseErrors++;
+                Serial.printf("[AI Assistant] No memory for a %u byte message\n", (unsigned)len);
+                return;
+            }
+            parseBuf = grown;
+            parseCap = len + 1;
+        }
+        char* buf = parseBuf;
+        memcpy(buf, message.c_str(), len);
+        buf[len] = '\0';
 
-        Serial.printf("[AI Assistant] MSG: %s\n", msg.c_str());
+        Serial.printf("[AI Assistant] MSG: %.*s\n", (int)len, buf);
 
-        // Check for simple HELLO or JSON
-        if (msg.startsWith("{")) {
-          // Parse JSON response
-          StaticJsonDocument<512> doc;
-          DeserializationError error = deserializeJson(doc, msg);
-          if (error) {
-            Serial.printf("[AI Assistant] Failed to parse JSON: %s\n", error.c_str());
-            return;
-          }
-
-          //  // sessions == id(ws)
-          const char* type     = doc["type"]     | "unknown";
-          const char* content  = doc["content"]  | "";
-          const char* language = doc["language"] | "";
-          const char* mode     = doc["mode"]     | "";
-          const char* sender   = doc["sender"]   | "unspecified";
-         
-          Serial.println("[AI Assistant] Received assistant message");
-
-          if (strcmp(type, "ASSISTANT_TEXT_RESPONSE") == 0) {
-              Serial.println("[AI Assistant] Agent text response received:");
-              Serial.printf("  Sender: %s\n", sender);
-              Serial.printf("  Type: %s\n", type);
-              Serial.printf("  Content: %s\n", content);
-              Serial.printf("  Language: %s\n", language);
-              Serial.printf("  Mode: %s\n", mode);
-
-              if (audio_ptr) {
-                  audio_ptr->connecttospeech(content, language);
-              } else {
-                  Serial.println("[AI Assistant] Audio pointer is null!");
-              }
-              return;
-          } else if (strcmp(type, "HELLO") == 0) {
-              Serial.printf("  Sender: %s\n", sender);
-              Serial.printf("  Type: %s\n", type);
-              Serial.println("[AI Assistant] Server acknowledged with HELLO"); 
-
-              // Set backend connection status
-              backend_connected = true;
-
-              // Save sender ID globally
-              senderSessionId = String(sender);
-              Serial.printf("[AI Assistant] Stored session ID: %s\n", senderSessionId.c_str());
-              return;
-          }
-        } else {
-          Serial.printf("[AI Assistant] Unrecognized text: %s\n", msg.c_str());
+        const int64_t t0 = esp_timer_get_time();
+        AssistantMessage msg;
+        const char* error = AssistantMessage_Parse(buf, len, &msg);
+        statParseUsLast = (uint32_t)(esp_timer_get_time() - t0);
+        if (statParseUsLast > statParseUsMax) statParseUsMax = statParseUsLast;
+
+        if (error) {
+          statParseErrors++;
+          Serial.printf("[AI Assistant] Failed to parse JSON: %s\n", error);
           return;
         }
 
-        Serial.println("Received non-binary message: " + message.data());
+        //  // sessions == id(ws)
+        const char* type     = msg.type;
+        const char* content  = msg.content;
+        const char* language = msg.language;
+        const char* mode     = msg.mode;
+        const char* sender   = msg.sender;
+
+        Serial.println("[AI Assistant] Received assistant message");
+
+        if (strcmp(type, "AUDIO_STREAM_START") == 0) {
+            AudioDownlink_Begin(msg.stream_id, msg.codec, msg.sample_rate);
+            return;
+        } else if (strcmp(type, "AUDIO_STREAM_END") == 0) {
+            AudioDownlink_End(msg.frames, msg.error);
+            return;
+        } else if (strcmp(type, "ASSISTANT_TEXT_RESPONSE") == 0) {
+            // Backend hop stamps for the latency breakdown
+            LatencyTrace_OnResponse(msg.rid, msg.trace_rx, msg.trace_stt_start,
+                                    msg.trace_stt_end, msg.trace_llm_end, msg.trace_tx);
+
+            Serial.println("[AI Assistant] Agent text response received:");
+            Serial.printf("  Sender: %s\n", sender);
+            Serial.printf("  Type: %s\n", type);
+            Serial.printf("  Content: %s (%u bytes)\n", content, (unsigned)msg.content_len);
+            Serial.printf("  Language: %s\n", language);
+            Serial.printf("  Mode: %s\n", mode);
+
+            if (strcmp(msg.audio, "stream") == 0) {
+                // Backend streams the synthesized reply right behind this message
+                AudioDownlink_SetFallbackText(content, language);
+            } else if (audio_ptr) {
+                // Served from the SD cache when possible, mixed over music if something is playing
+                TTSCache_Speak(content, language);
+            } else {
+                Serial.println("[AI Assistant] Audio pointer is null!");
+            }
+            return;
+        } else if (strcmp(type, "HELLO") == 0) {
+            Serial.printf("  Sender: %s\n", sender);
+            Serial.printf("  Type: %s\n", type);
+            Serial.println("[AI Assistant] Server acknowledged with HELLO"); 
+
+            // Set backend connection status
+            backend_connected = true;
+            EventStream_Notify(EVENT_BACKEND);
+
+            // Save sender ID globally
+            senderSessionId = String(sender);
+            Serial.printf("[AI Assistant] Stored session ID: %s\n", senderSessionId.c_str());
+
+            // Requests spooled while the backend was away can go out now
+            RequestSpool_OnBackendReady(senderSessionId.c_str());
+            return;
+        }
+
+        Serial.printf("[AI Assistant] Unhandled message type: %s\n", type);
         return;
     }
 
-    // Binary
-    uint8_t *payload = (uint8_t *)message.c_str();
+    // Binary: framed reply audio
+    const uint8_t *payload = (const uint8_t *)message.c_str();
     size_t length = message.length();
 
     if (length == 0)
@@ -99,8 +182,7 @@ void onMessageCallback(WebsocketsMessage message)
         return;
     }
 
-    Serial.printf("Received binary audio data of length: %zu bytes\n", length);
-    delay(10);
+    AudioDownlink_OnBinary(payload, length);
 }
 
 
@@ -120,50 +202,170 @@ void onEventsCallback(WebsocketsEvent event, String data)
     }
     else if (event == WebsocketsEvent::GotPong)
     {
-        Serial.println("Got a Pong!");
+        if (pingSentUs) {
+            statPingRttMs = (uint32_t)((esp_timer_get_time() - pingSentUs) / 1000);
+            pingSentUs = 0;
+        }
     }
 }
 
-// Task to handle WebSocket connection and reconnection logic
-// This runs in a separate task to avoid blocking the main loop
-void websocketConnectTask(void* parameter) {
-  int backoff = 2000;
-  const int pollIntervalMs = 10;     // call poll() every 10ms
-  const int reconnectCheckMs = 5000; // check connection every 5s
+static void reconnectTimerCallback(TimerHandle_t) {
+  // Connecting blocks, so it runs in the client task, not in the timer service task
+  if (wsTaskHandle) xTaskNotifyGive(wsTaskHandle);
+}
 
-  unsigned long lastReconnectCheck = millis();
+static void scheduleReconnect() {
+  xTimerChangePeriod(reconnectTimer, pdMS_TO_TICKS(reconnectBackoffMs), 0);
+}
+
+static void tryConnect() {
+  Serial.printf("[WebSocket] Connecting... (Backoff: %lums)\n", (unsigned long)reconnectBackoffMs);
 
+  AudioUplink_Lock();
+  bool connected = client.connect(websocketURL);
+  if (connected) {
+    client.ping();
+    pingSentUs = esp_timer_get_time();
+  }
+  AudioUplink_Unlock();
+
+  if (connected) {
+    Serial.println("[WebSocket] Connected successfully!");
+    statReconnects++;
+    // Advertise the reply audio formats the downlink can play
+    AudioUplink_SendText(R"({"type":"HELLO","downlink":["pcm16","mp3"]})");
+    reconnectBackoffMs = WS_RECONNECT_MIN_MS;
+  } else {
+    Serial.println("[WebSocket] Connect attempt failed.");
+    reconnectBackoffMs = min(reconnectBackoffMs * 2, (uint32_t)WS_RECONNECT_MAX_MS);  // exponential backoff
+    scheduleReconnect();
+  }
+}
+
+// Waits until the socket is readable or WS_IDLE_TIMEOUT_MS passes. Returns >0 readable, 0 idle, <0 broken.
+static int waitReadable() {
+  const int fd = wsTransport->fd();
+  if (fd < 0) {
+    // wss:// swaps in the library's TLS transport, which does not expose its socket
+    vTaskDelay(pdMS_TO_TICKS(WS_FALLBACK_POLL_MS));
+    return 1;
+  }
+
+  fd_set rfds;
+  FD_ZERO(&rfds);
+  FD_SET(fd, &rfds);
+  struct timeval tv = { WS_IDLE_TIMEOUT_MS / 1000, (WS_IDLE_TIMEOUT_MS % 1000) * 1000 };
+  int r = select(fd + 1, &rfds, nullptr, nullptr, &tv);
+  if (r > 0) {
+    // Readable with nothing to read: the server closed the connection
+    uint8_t b;
+    if (recv(fd, &b, 1, MSG_PEEK | MSG_DONTWAIT) == 0) return -1;
+  }
+  return r;
+}
+
+// Task to handle WebSocket connection and reconnection logic
+// Sleeps in select() on the socket while connected and on a task notification
+// from the reconnect timer while not, so an idle link costs no wakeups.
+void websocketConnectTask(void* parameter) {
   Serial.println("[WebSocket] Starting websocketConnectTask");
 
+  xTaskNotifyGive(xTaskGetCurrentTaskHandle());   // First attempt right away
+
   while (true) {
-    // Always keep polling to handle incoming data, ping/pong, etc.
-    client.poll();
-    vTaskDelay(pollIntervalMs / portTICK_PERIOD_MS);
-
-    // Reconnection check (every reconnectCheckMs)
-    if (millis() - lastReconnectCheck >= reconnectCheckMs) {
-      lastReconnectCheck = millis();
-
-      if (!client.available()) {
-        Serial.printf("[WebSocket] Disconnected. Reconnecting... (Backoff: %dms)\n", backoff);
-
-        if (client.connect(websocketURL)) {
-          Serial.println("[WebSocket] Reconnected successfully!");
-          client.send(R"({"type":"HELLO"})");
-          client.ping();
-          backoff = 2000;  // reset backoff
-        } else {
-          Serial.println("[WebSocket] Reconnect attempt failed.");
-          vTaskDelay(backoff / portTICK_PERIOD_MS);
-          backoff = min(backoff * 2, 60000);  // exponential backoff up to 60s
-        }
+    if (!client.available()) {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      statWakeups++;
+      tryConnect();
+      continue;
+    }
+
+    const int r = waitReadable();
+    statWakeups++;
+
+    AudioUplink_Lock();
+    if (r > 0) {
+      readyUs = esp_timer_get_time();
+      client.poll();
+      readyUs = 0;
+    } else if (r == 0) {
+      // Idle: keepalive ping; still no pong from the previous one means the peer is gone
+      statIdleTimeouts++;
+      if (pingSentUs) {
+        Serial.println("[WebSocket] No pong from server, closing");
+        client.close();
+      } else {
+        client.ping();
+        pingSentUs = esp_timer_get_time();
       }
+    } else {
+      client.close();
+    }
+    AudioUplink_Unlock();
+
+    if (!client.available()) {
+      Serial.println("[WebSocket] Disconnected.");
+      backend_connected = false;
+      EventStream_Notify(EVENT_BACKEND);
+      RequestSpool_OnBackendLost();
+      pingSentUs = 0;
+      reconnectBackoffMs = WS_RECONNECT_MIN_MS;
+      scheduleReconnect();
     }
   }
   vTaskDelete(NULL);  // not reached, safety
 }
 
+void AIAssistant_GetLinkStats(AssistantLinkStats* out) {
+  if (!out) return;
+  const uint32_t now = millis();
+  out->connected = client.available();
+  out->reconnects = statReconnects;
+  out->wakeups = statWakeups;
+  out->idle_timeouts = statIdleTimeouts;
+  out->messages = statMessages;
+  out->dispatch_us_last = statDispatchUsLast;
+  out->dispatch_us_max = statDispatchUsMax;
+  out->dispatch_us_avg = statMessages ? (uint32_t)(statDispatchUsTotal / statMessages) : 0;
+  out->ping_rtt_ms = statPingRttMs;
+  out->parse_us_last = statParseUsLast;
+  out->parse_us_max = statParseUsMax;
+  out->parse_errors = statParseErrors;
+  out->largest_message = statLargestMessage;
+  out->wakeups_per_min = now > statLastPrintMs && statLastPrintMs
+      ? (float)(statWakeups - statWakeupsAtPrint) * 60000.0f / (now - statLastPrintMs) : 0.0f;
+}
+
+void AIAssistant_PrintLinkStats() {
+  AssistantLinkStats s;
+  AIAssistant_GetLinkStats(&s);
+  Serial.printf("[WebSocket] connected=%d reconnects=%u wakeups=%u (%.1f/min) idle=%u msgs=%u dispatch_us last=%u avg=%u max=%u ping_rtt=%u ms parse_us last=%u max=%u errors=%u largest=%u\n",
+                s.connected, s.reconnects, s.wakeups, s.wakeups_per_min, s.idle_timeouts, s.messages,
+                s.dispatch_us_last, s.dispatch_us_avg, s.dispatch_us_max, s.ping_rtt_ms,
+                s.parse_us_last, s.parse_us_max, s.parse_errors, s.largest_message);
+  statWakeupsAtPrint = statWakeups;
+  statLastPrintMs = millis();
+  statDispatchUsMax = 0;
+  statParseUsMax = 0;
+}
 
+void AIAssistant_SendTelemetry() {
+  if (!client.available()) return;
+  AssistantLinkStats link;
+  AIAssistant_GetLinkStats(&link);
+  AudioUplinkStats up;
+  AudioUplink_GetStats(&up);
+  AudioDownlinkStats dl;
+  AudioDownlink_GetStats(&dl);
+
+  char json[320];
+  snprintf(json, sizeof(json),
+           R"({"type":"TELEMETRY","uptime_s":%lu,"heap":%u,"ping_rtt_ms":%u,"reconnects":%u,)"
+           R"("uplink":{"frames":%u,"dropped":%u,"ctrl_wait_us_max":%u},"downlink":{"frames":%u,"gaps":%u,"fallbacks":%u}})",
+           (unsigned long)(millis() / 1000), (unsigned)ESP.getFreeHeap(), link.ping_rtt_ms, link.reconnects,
+           up.frames_sent, up.dropped, up.control_wait_us_max, dl.frames, dl.gaps, dl.fallbacks);
+  AudioUplink_SendTelemetry(json);
+}
 
 void AIAssistant_Init(Audio& audio){
   audio_ptr = &audio;
@@ -173,31 +375,65 @@ void AIAssistant_Init(Audio& audio){
   client.onMessage(onMessageCallback);
   client.onEvent(onEventsCallback);
 
-  xTaskCreatePinnedToCore(websocketConnectTask, "WebSocketConnectTask", 4096, NULL, 3, NULL, 1);
+  // Sender task owns all writes to the socket
+  AudioUplink_Init(client);
+  // Jitter buffer + loopback endpoint for streamed reply audio
+  AudioDownlink_Init();
+  // Keep-alive worker for recorded file uploads
+  FileUploader_Init(uploadURL);
+  // Requests made while the backend is unreachable wait on SD
+  RequestSpool_Init();
+
+  reconnectTimer = xTimerCreate("WsReconnect", pdMS_TO_TICKS(WS_RECONNECT_MIN_MS), pdFALSE, nullptr, reconnectTimerCallback);
+  xTaskCreatePinnedToCore(websocketConnectTask, "WebSocketConnectTask", 6144, NULL, 3, &wsTaskHandle, 1);
   Serial.println("[AI Assistant] WebSocket client initialized");
 }
 
-void AIAssistant_StartStream() {
+bool AIAssistant_StartStream(uint32_t sampleRate) {
   if (client.available()) {
     streamingWave = true;
-    client.send(R"({"type":"START_STREAM"})");
-    Serial.println("[AI Assistant] Started audio stream: JSON START_STREAM sent");
-  } else {
-    Serial.println("[AI Assistant] Failed to start stream — WebSocket not available");
+    streamId++;
+    frameSeq = 0;
+
+    // Announce the binary framing so the backend parses headers instead of raw PCM
+    char json[128];
+    snprintf(json, sizeof(json),
+             R"({"type":"START_STREAM","framing":%d,"stream_id":%u,"codec":"pcm16","sample_rate":%lu,"rid":%lu})",
+             AUDIO_FRAME_VERSION, streamId, (unsigned long)sampleRate, (unsigned long)LatencyTrace_CurrentRid());
+    AudioUplink_SendText(json);
+    Serial.printf("[AI Assistant] Started audio stream %u: JSON START_STREAM queued\n", streamId);
+    return true;
   }
+  Serial.println("[AI Assistant] Failed to start stream — WebSocket not available");
+  return false;
 }
 
-void AIAssistant_SendAudioChunk(const void* buffer, size_t byteCount) {
-  if (client.available()) {
-    client.sendBinary(reinterpret_cast<const char*>(buffer), byteCount);
+void AIAssistant_SendAudioFrame(UplinkFrame* frame, size_t payloadBytes, uint64_t captureUs) {
+  if (!streamingWave) {
+    AudioUplink_ReleaseFrame(frame);
+    return;
   }
+
+  // Sequence also advances for dropped blocks, so the backend sees the loss as a gap
+  const uint32_t seq = frameSeq++;
+  if (!frame) return;
+
+  // Header goes into the space reserved in front of the samples, no copy
+  const uint8_t flags = seq == 0 ? AUDIO_FRAME_FLAG_START : 0;
+  AudioFrame_WriteHeader(frame->data, AUDIO_CODEC_PCM16, flags, streamId, WS_CH_AUDIO_UP, seq, captureUs, (uint16_t)payloadBytes);
+  AudioUplink_SubmitFrame(frame);
 }
 
 void AIAssistant_StopStream() {
   if (client.available() && streamingWave) {
-    client.send(R"({"type":"STOP_STREAM"})");
+    // Frame count lets the backend tell loss at the tail from a clean end
+    char json[128];
+    snprintf(json, sizeof(json), R"({"type":"STOP_STREAM","stream_id":%u,"frames":%lu,"rid":%lu})",
+             streamId, (unsigned long)frameSeq, (unsigned long)LatencyTrace_CurrentRid());
     streamingWave = false;
-    Serial.println("[AI Assistant] Stopped audio stream: JSON STOP_STREAM sent");
+    AudioUplink_SendText(json);   // Control channel, may overtake the last frames
+    LatencyTrace_MarkUploaded();
+    Serial.println("[AI Assistant] Stopped audio stream: JSON STOP_STREAM queued");
   } else if (!client.available()) {
     Serial.println("[AI Assistant] Cannot stop stream — WebSocket not available");
   } else if (!streamingWave) {
@@ -207,8 +443,7 @@ void AIAssistant_StopStream() {
 
 void AIAssistant_Stop() {
   if (client.available()) {
-    String json = R"({"type":"STOP_STREAM"})";
-    client.send(json);
+    AudioUplink_SendText(R"({"type":"STOP_STREAM"})");
     Serial.println("[AI Assistant] Sent [STOP] command to server");
   } else {
     Serial.println("[AI Assistant] Cannot send [STOP] — not connected to server");
@@ -219,129 +454,21 @@ void AIAssistant_Stop() {
   HTTP Client
 */
 
-void AIAssistant_UploadFile(const char* filepath) {
-  if (!SD_MMC.exists(filepath)) {
-    Serial.printf("[Upload] File not found: %s\n", filepath);
-    return;
-  }
-
-  File file = SD_MMC.open(filepath);
-  if (!file || file.isDirectory()) {
-    Serial.printf("[Upload] Failed to open: %s\n", filepath);
-    return;
-  }
-
-  const char* host = "5.9.104.22";
-  const int port = 8766;
-  const char* path = "/upload";
-  const String boundary = "----ESP32FormBoundary";
+static void onUploadDone(const char* filepath, bool ok) {
+  if (ok) LatencyTrace_MarkUploaded();
+  // Keep the request for replay instead of losing it
+  else RequestSpool_AddFile(filepath, SPOOL_KIND_UPLOAD);
+}
 
-  WiFiClient client;
-  if (!client.connect(host, port)) {
-    Serial.println("[Upload] Connection to server failed");
-    file.close();
+void AIAssistant_UploadFile(const char* filepath) {
+  // No session to answer on, or older requests still waiting: keep the order and spool it
+  if (!client.available() || RequestSpool_Depth() > 0) {
+    RequestSpool_AddFile(filepath, SPOOL_KIND_UPLOAD);
     return;
   }
-
-  // Build initial headers
-  String header = "";
-  header += "POST " + String(path) + " HTTP/1.1\r\n";
-  header += "Host: " + String(host) + "\r\n";
-  header += "Content-Type: multipart/form-data; boundary=" + boundary + "\r\n";
-
-  // Add session_id form field
-  String bodySession =
-    "--" + boundary + "\r\n" +
-    "Content-Disposition: form-data; name=\"session_id\"\r\n\r\n" +
-    senderSessionId + "\r\n";
-
-  // File part
-  String bodyStart =
-    "--" + boundary + "\r\n" +
-    "Content-Disposition: form-data; name=\"file\"; filename=\"" + String(filepath) + "\"\r\n" +
-    "Content-Type: audio/wav\r\n\r\n";
-
-  String bodyEnd = "\r\n--" + boundary + "--\r\n";
-
-  // Update content length to include session ID field
-  size_t totalLength = bodySession.length() + bodyStart.length() + file.size() + bodyEnd.length();
-  header += "Content-Length: " + String(totalLength) + "\r\n\r\n";
-
-  // Send headers and body parts
-  client.print(header);
-  client.print(bodySession);
-  client.print(bodyStart);
-
-  // Stream file content
-  uint8_t buf[512];
-  while (file.available()) {
-    size_t len = file.read(buf, sizeof(buf));
-    client.write(buf, len);
-    delay(1); // allow watchdog to breathe
+  // Handed to the upload worker, which keeps its connection to the backend open between files
+  if (!FileUploader_Enqueue(filepath, senderSessionId.c_str(), onUploadDone, LatencyTrace_CurrentRid())) {
+    Serial.printf("[Upload] Could not queue %s\n", filepath);
+    RequestSpool_AddFile(filepath, SPOOL_KIND_UPLOAD);
   }
-
-  // End body
-  client.print(bodyEnd);
-  file.close();
-
-  // Read server response
-  Serial.println("[Upload] Waiting for response...");
-  String responseHeaders;
-  String responseBody;
-  bool inBody = false;
-
-  unsigned long timeout = millis() + 5000;
-  while (!client.available() && millis() < timeout) {
-    delay(10);
-  }
-
-  while (client.available()) {
-    String line = client.readStringUntil('\n');
-    if (!inBody && line == "\r") {
-      inBody = true;
-      continue;
-    }
-
-    if (inBody) {
-      responseBody += line;
-    } else {
-      responseHeaders += line;
-    }
-  }
-
-  Serial.println("[Upload] Response Headers:");
-  Serial.println(responseHeaders);
-  Serial.println("[Upload] Response Body:");
-  Serial.println(responseBody);
-
-  // Parse JSON if possible
-  StaticJsonDocument<256> doc;
-  DeserializationError error = deserializeJson(doc, responseBody);
-  if (!error) {
-    const char* status = doc["status"];
-    const char* filename = doc["filename"];
-    int size = doc["size"];
-
-    Serial.printf("[Upload] Success: status=%s, filename=%s, size=%d\n", status, filename, size);
-  } else {
-    Serial.print("[Upload] JSON parse error: ");
-    Serial.println(error.c_str());
-  }
-
-  client.stop();
-  Serial.println("\n[Upload] Done.");
-}
-
-
-void UploadFileTask(void* param) {
-  const char* fname = (const char*)param;
-
-  Serial.printf("[Task] Uploading file in background: %s\n", fname);
-  AIAssistant_UploadFile(fname);
-  Serial.println("[Task] Upload complete.");
-
-  vPortFree((void*)fname);  // free memory allocated for filename
-  vTaskDelete(NULL);
 }
-
-
@@ -3,22 +3,59 @@
 
 #include "Audio.h"
 #include <ArduinoWebsockets.h>
+#include "AudioFrame.h"
+#include "AudioUplink.h"
 
 using namespace websockets;
 
 extern WebsocketsClient client;
 
+/*
+  The client task sleeps in select() on the WebSocket's socket and only wakes
+  for inbound data, or every WS_IDLE_TIMEOUT_MS for a keepalive ping. While
+  disconnected it waits for the reconnect timer (exponential backoff).
+*/
+#define WS_IDLE_TIMEOUT_MS   30000   // Keepalive ping when nothing arrived for this long
+#define WS_RECONNECT_MIN_MS  2000
+#define WS_RECONNECT_MAX_MS  60000
+#define WS_FALLBACK_POLL_MS  10      // Poll period when the transport has no socket to select on (wss://)
+
+struct AssistantLinkStats {
+    bool     connected;
+    uint32_t reconnects;
+    uint32_t wakeups;           // Client task wakeups
+    float    wakeups_per_min;   // Since the last PrintLinkStats
+    uint32_t idle_timeouts;     // Keepalive pings sent
+    uint32_t messages;          // Inbound messages
+    uint32_t dispatch_us_last;  // Socket readable -> message callback
+    uint32_t dispatch_us_avg;
+    uint32_t dispatch_us_max;   // Since the last PrintLinkStats
+    uint32_t ping_rtt_ms;
+    uint32_t parse_us_last;     // In-place JSON parse of a text message
+    uint32_t parse_us_max;      // Since the last PrintLinkStats
+    uint32_t parse_errors;
+    uint32_t largest_message;   // Bytes
+};
+
 // Websocket communication
 void AIAssistant_Init(Audio& audio);
-void AIAssistant_StartStream();
-void AIAssistant_SendAudioChunk(const void* buffer, size_t byteCount);
+// false when the backend is not connected (the caller spools the request instead)
+bool AIAssistant_StartStream(uint32_t sampleRate);
+// 'frame' comes from AudioUplink_AcquireFrame() with payloadBytes of PCM filled in.
+// nullptr = block dropped at capture (the sequence still advances). Never blocks.
+void AIAssistant_SendAudioFrame(UplinkFrame* frame, size_t payloadBytes, uint64_t captureUs);
 void AIAssistant_StopStream();
 void AIAssistant_Stop();
+void AIAssistant_GetLinkStats(AssistantLinkStats* out);
+void AIAssistant_PrintLinkStats();
+// Stats snapshot to the backend on the telemetry channel
+void AIAssistant_SendTelemetry();
 // void WebsocketServer_Loop();
 
 
 // HTTP communication
+// Queues the file for the upload worker (FileUploader.h), returns immediately.
+// While the backend is unreachable (or the upload fails) the file goes to the RequestSpool.
 void AIAssistant_UploadFile(const char* filepath);
-void UploadFileTask(void* param);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,319 @@
+// AlarmScheduler.cpp - Pre-warmed alarms that start on the exact second
+#include "AlarmScheduler.h"
+#include "AudioMixer.h"
+#include "StreamMonitor.h"
+#include "PCM5101.h"
+#include "MIC_MSM.h"
+#include "EventStream.h"
+#include <SD_MMC.h>
+#include <time.h>
+#include <sys/time.h>
+#include "esp_timer.h"
+
+// Anything before this is an unset clock (2024-01-01)
+#define CLOCK_VALID_EPOCH  1704067200
+
+enum {
+    NOTIFY_RESCHEDULE = 1 << 0,
+    NOTIFY_FIRED      = 1 << 1,
+    NOTIFY_RELEASED   = 1 << 2,     // Other playback took over the pre-warmed audio
+};
+
+typedef enum {
+    PREP_NONE = 0,      // Not prepared yet
+    PREP_COLD,          // Could not prepare, connect when firing
+    PREP_FILE,          // File opened and paused, muted
+    PREP_STREAM         // Stream connected and playing muted
+} PrepState;
+
+static Audio* audio_ptr = nullptr;
+static AlarmStartedCallback startedCb = nullptr;
+static TaskHandle_t schedTask = nullptr;
+static esp_timer_handle_t fireTimer = nullptr;
+
+// Pending alarm, owned by the scheduler task. The fire callback only reads it.
+static Alarm pendingAlarm;
+static time_t pendingTarget = 0;
+static volatile PrepState prep = PREP_NONE;
+static time_t lastFiredTarget = 0;
+
+// Written by the fire callback
+static volatile bool fired = false;
+static volatile bool firedWarm = false;
+static volatile int64_t fireUs = 0;
+static volatile int64_t fireWallUs = 0;
+
+// Stats
+static uint32_t statFired = 0;
+static uint32_t statPrewarmHits = 0;
+static uint32_t statColdStarts = 0;
+static uint32_t statWithinTolerance = 0;
+static int32_t  statLastOffsetMs = INT32_MIN;
+static int32_t  statWorstOffsetMs = 0;
+
+static int64_t wallClockUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+static bool isStream(const Alarm& a) {
+    return a.action_type == "radio";
+}
+
+// Next local-time occurrence of an alarm strictly after 'after', 0 if none
+static time_t nextOccurrence(const Alarm& a, time_t after) {
+    int hh = 0, mm = 0;
+    if (!a.enabled || sscanf(a.time.c_str(), "%d:%d", &hh, &mm) != 2) return 0;
+
+    struct tm now;
+    localtime_r(&after, &now);
+    for (int d = 0; d <= 7; ++d) {
+        struct tm c = now;
+        c.tm_mday += d;
+        c.tm_hour = hh;
+        c.tm_min = mm;
+        c.tm_sec = 0;
+        c.tm_isdst = -1;
+        time_t t = mktime(&c);   // Normalizes the date and fills tm_wday
+        if (t > after && a.weekdays[c.tm_wday]) return t;
+    }
+    return 0;
+}
+
+// Runs in the esp_timer task, same as audio.loop(), so it cannot race the decoder
+static void fireTimerCallback(void*) {
+    fireWallUs = wallClockUs();
+    fireUs = esp_timer_get_time();
+
+    bool warm = false;
+    if (audio_ptr) {
+        if (prep == PREP_FILE && !audio_ptr->isRunning()) {
+            AudioMixer_ArmFirstSampleProbe();
+            audio_ptr->pauseResume();
+            warm = true;
+        } else if (prep == PREP_STREAM && audio_ptr->isRunning()) {
+            AudioMixer_ArmFirstSampleProbe();
+            warm = true;
+        }
+        if (warm) audio_ptr->setVolume(GetVolume());
+    }
+    firedWarm = warm;
+    fired = true;
+
+    if (schedTask) xTaskNotify(schedTask, NOTIFY_FIRED, eSetBits);
+}
+
+// Undo a prepared action that will not fire (alarm edited / disabled)
+static void cancelPending() {
+    if (fireTimer) esp_timer_stop(fireTimer);
+    if (audio_ptr && (prep == PREP_FILE || prep == PREP_STREAM)) {
+        Serial.println("[Alarm] Pending alarm changed, dropping pre-warmed audio");
+        StreamMonitor_Stop();
+        audio_ptr->stopSong();
+        audio_ptr->setVolume(GetVolume());
+    }
+    prep = PREP_NONE;
+}
+
+static void prewarm(const Alarm& a) {
+    if (!audio_ptr) return;
+
+    if (audio_ptr->isRunning() || AudioMixer_IsVoiceActive()) {
+        // Do not cut the user's music 20 s early, interrupt it on time instead
+        Serial.println("[Alarm] Audio busy, alarm will start cold");
+        prep = PREP_COLD;
+        return;
+    }
+
+    const int64_t t0 = esp_timer_get_time();
+    MIC_SR_Stop();
+    audio_ptr->setVolume(0);
+
+    if (isStream(a)) {
+        prep = StreamMonitor_Connect(a.action_path.c_str()) ? PREP_STREAM : PREP_COLD;
+    } else {
+        StreamMonitor_Stop();
+        prep = PREP_COLD;
+        if (audio_ptr->connecttoFS(SD_MMC, a.action_path.c_str())) {
+            // Let the decoder parse the header and init, then hold it there
+            const uint32_t start = millis();
+            while (audio_ptr->getSampleRate() == 0 && audio_ptr->isRunning() && millis() - start < 2000) {
+                vTaskDelay(pdMS_TO_TICKS(5));
+            }
+            if (audio_ptr->isRunning() && audio_ptr->pauseResume()) prep = PREP_FILE;
+        }
+    }
+
+    if (prep == PREP_COLD) audio_ptr->setVolume(GetVolume());
+    Serial.printf("[Alarm] Pre-warm %s %s: %s in %lld ms\n", a.action_type.c_str(), a.action_path.c_str(),
+                  prep == PREP_COLD ? "failed" : "ready", (esp_timer_get_time() - t0) / 1000);
+}
+
+// Start the alarm action the slow way (nothing prepared)
+static void coldStart(const Alarm& a) {
+    if (!audio_ptr) return;
+    MIC_SR_Stop();
+    vTaskDelay(pdMS_TO_TICKS(5));
+    if (!isStream(a)) StreamMonitor_Stop();
+
+    AudioMixer_ArmFirstSampleProbe();
+    audio_ptr->setVolume(GetVolume());
+    bool ok = isStream(a) ? StreamMonitor_Connect(a.action_path.c_str())
+                          : audio_ptr->connecttoFS(SD_MMC, a.action_path.c_str());
+    if (!ok) Serial.printf("[Alarm] Failed to start %s %s\n", a.action_type.c_str(), a.action_path.c_str());
+}
+
+static void handleFired() {
+    const Alarm a = pendingAlarm;
+    const int64_t targetUs = (int64_t)pendingTarget * 1000000LL;
+    const bool warm = firedWarm;
+
+    lastFiredTarget = pendingTarget;
+    pendingTarget = 0;
+    fired = false;
+    statFired++;
+
+    Serial.printf("[Alarm] Triggering alarm %s (%s)\n", a.time.c_str(), warm ? "pre-warmed" : "cold");
+    if (warm) {
+        statPrewarmHits++;
+    } else {
+        coldStart(a);
+        statColdStarts++;
+    }
+    prep = PREP_NONE;
+
+    if (startedCb) startedCb(a);
+
+    // Wall clock error of the timer + timer -> first sample
+    int64_t hitUs = 0;
+    const uint32_t start = millis();
+    while ((hitUs = AudioMixer_GetFirstSampleUs()) == 0 && millis() - start < ALARM_FIRST_SAMPLE_WAIT_MS) {
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    if (!hitUs) {
+        statLastOffsetMs = INT32_MIN;
+        Serial.println("[Alarm] No audio reached I2S, start offset not measured");
+        return;
+    }
+
+    const int32_t offsetMs = (int32_t)((fireWallUs - targetUs + (hitUs - fireUs)) / 1000);
+    statLastOffsetMs = offsetMs;
+    if (abs(offsetMs) > abs(statWorstOffsetMs)) statWorstOffsetMs = offsetMs;
+    if (abs(offsetMs) <= ALARM_START_TOLERANCE_MS) statWithinTolerance++;
+    Serial.printf("[Alarm] First sample %+d ms from target (tolerance %d ms)\n", offsetMs, ALARM_START_TOLERANCE_MS);
+}
+
+// Pick the next alarm, pre-warm / arm it when due. Returns how long to sleep.
+static uint32_t planNext() {
+    if (fired) return 0;   // Notification is already pending
+
+    const int64_t nowUs = wallClockUs();
+    const time_t now = (time_t)(nowUs / 1000000LL);
+    if (now < CLOCK_VALID_EPOCH) return ALARM_SCHED_RECHECK_MS;
+
+    time_t after = now;
+    // Armed and firing right now: keep it, the notification is on its way
+    if (prep != PREP_NONE && pendingTarget && pendingTarget <= now) after = pendingTarget - 1;
+    // Never schedule the one that just fired again
+    if (after < lastFiredTarget) after = lastFiredTarget;
+    time_t target = 0;
+    int idx = -1;
+    for (size_t i = 0; i < alarm_list.size(); ++i) {
+        time_t t = nextOccurrence(alarm_list[i], after);
+        if (t && (!target || t < target)) {
+            target = t;
+            idx = (int)i;
+        }
+    }
+
+    if (target != pendingTarget) {
+        cancelPending();
+        pendingTarget = target;
+        if (idx >= 0) pendingAlarm = alarm_list[idx];
+        if (target) {
+            struct tm t;
+            localtime_r(&target, &t);
+            Serial.printf("[Alarm] Next alarm %04d-%02d-%02d %02d:%02d (%s %s)\n",
+                          t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour, t.tm_min,
+                          pendingAlarm.action_type.c_str(), pendingAlarm.action_path.c_str());
+        }
+    }
+    if (!target) return ALARM_SCHED_RECHECK_MS;
+
+    int64_t untilUs = (int64_t)target * 1000000LL - nowUs;
+    if (prep == PREP_NONE && untilUs <= (int64_t)ALARM_PREWARM_S * 1000000LL) {
+        prewarm(pendingAlarm);
+        // Pre-warm took some time, re-read the clock right before arming
+        untilUs = (int64_t)target * 1000000LL - wallClockUs();
+        esp_timer_stop(fireTimer);
+        esp_timer_start_once(fireTimer, untilUs > 0 ? untilUs : 1);
+    }
+    if (prep != PREP_NONE) return ALARM_SCHED_RECHECK_MS;   // Fire timer wakes us
+
+    int64_t waitMs = (untilUs - (int64_t)ALARM_PREWARM_S * 1000000LL) / 1000;
+    if (waitMs < 10) waitMs = 10;
+    if (waitMs > ALARM_SCHED_RECHECK_MS) waitMs = ALARM_SCHED_RECHECK_MS;
+    return (uint32_t)waitMs;
+}
+
+static void AlarmSchedulerTask(void*) {
+    while (true) {
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, pdMS_TO_TICKS(planNext()));
+        if ((bits & NOTIFY_RELEASED) && (prep == PREP_FILE || prep == PREP_STREAM)) {
+            Serial.println("[Alarm] Playback started during pre-warm, alarm will start cold");
+            prep = PREP_COLD;
+        }
+        if (bits & NOTIFY_FIRED) handleFired();
+    }
+}
+
+void AlarmScheduler_Init(Audio& audio, AlarmStartedCallback onStarted) {
+    audio_ptr = &audio;
+    startedCb = onStarted;
+
+    const esp_timer_create_args_t fire_timer_args = {
+        .callback = &fireTimerCallback,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,      // Same task as the audio tick
+        .name = "alarm_fire",
+        .skip_unhandled_events = false
+    };
+    esp_timer_create(&fire_timer_args, &fireTimer);
+
+    xTaskCreatePinnedToCore(AlarmSchedulerTask, "AlarmScheduler", 8 * 1024, nullptr, 2, &schedTask, 0);
+    Serial.printf("[Alarm] Scheduler started, pre-warm %d s ahead\n", ALARM_PREWARM_S);
+}
+
+void AlarmScheduler_Reschedule() {
+    EventStream_AlarmsChanged();
+    if (schedTask) xTaskNotify(schedTask, NOTIFY_RESCHEDULE, eSetBits);
+}
+
+void AlarmScheduler_OnPlaybackStarted() {
+    if (prep != PREP_FILE && prep != PREP_STREAM) return;
+    // Unmute right away, the new playback must not wait for the scheduler task
+    if (audio_ptr) audio_ptr->setVolume(GetVolume());
+    if (schedTask) xTaskNotify(schedTask, NOTIFY_RELEASED, eSetBits);
+}
+
+void AlarmScheduler_GetStats(AlarmSchedulerStats* out) {
+    if (!out) return;
+    out->next_epoch = pendingTarget;
+    out->prewarmed = (prep == PREP_FILE || prep == PREP_STREAM);
+    out->fired = statFired;
+    out->prewarm_hits = statPrewarmHits;
+    out->cold_starts = statColdStarts;
+    out->within_tolerance = statWithinTolerance;
+    out->last_offset_ms = statLastOffsetMs;
+    out->worst_offset_ms = statWorstOffsetMs;
+}
+
+void AlarmScheduler_PrintStats() {
+    AlarmSchedulerStats s;
+    AlarmScheduler_GetStats(&s);
+    Serial.printf("[Alarm] next=%ld prewarmed=%d fired=%u warm=%u cold=%u within_tol=%u last_offset=%dms worst=%dms\n",
+                  (long)s.next_epoch, s.prewarmed, s.fired, s.prewarm_hits, s.cold_starts,
+                  s.within_tolerance, s.last_offset_ms == INT32_MIN ? 0 : s.last_offset_ms, s.worst_offset_ms);
+}
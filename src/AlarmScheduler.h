@@ -0,0 +1,55 @@
+#ifndef ALARM_SCHEDULER_H
+#define ALARM_SCHEDULER_H
+
+#include <Arduino.h>
+#include "Audio.h"
+#include "GUI/AlarmScreen.h"
+
+/*
+  Alarm scheduler with pre-warmed audio
+
+  The next alarm is computed from the wall clock (NTP / RTC seeded).
+  ALARM_PREWARM_S before it, the action is prepared:
+    - mp3 / sound: file opened and decoded up to the first frame, then paused
+    - radio:       stream connected and playing muted, so the input buffer
+                   is full and the decoder running when the alarm fires
+  An esp_timer one-shot fires on the exact second, in the same timer task as
+  the audio tick, and only resumes / unmutes. Everything slow (screen switch,
+  backlight) happens afterwards in the scheduler task.
+
+  If something else is playing at pre-warm time, or starts during the pre-warm
+  window, the alarm falls back to a cold start when it fires (same as before).
+
+  Start accuracy is measured as target time -> first music block handed to
+  I2S (via the mixer's audio_process_i2s hook; the DMA queue adds a few ms).
+*/
+
+#define ALARM_PREWARM_S              20      // Prepare the alarm action this far ahead
+#define ALARM_START_TOLERANCE_MS     50      // First sample within +/- this of the target
+#define ALARM_SCHED_RECHECK_MS       30000   // Re-evaluate alarms at least this often
+#define ALARM_FIRST_SAMPLE_WAIT_MS   3000    // Give up measuring after this
+
+typedef void (*AlarmStartedCallback)(const Alarm& alarm);
+
+struct AlarmSchedulerStats {
+    time_t   next_epoch;         // Next alarm (0 = none)
+    bool     prewarmed;          // Next alarm's audio is prepared
+    uint32_t fired;
+    uint32_t prewarm_hits;       // Alarms started from a prepared source
+    uint32_t cold_starts;        // Alarms that had to connect at fire time
+    uint32_t within_tolerance;   // Alarms whose first sample was within tolerance
+    int32_t  last_offset_ms;     // First sample - target (last alarm, INT32_MIN = not measured)
+    int32_t  worst_offset_ms;    // Largest |offset| seen
+};
+
+// Call after Audio_Init() and GUI_Init(); onStarted runs after the alarm audio has started
+void AlarmScheduler_Init(Audio& audio, AlarmStartedCallback onStarted);
+void AlarmScheduler_Reschedule();   // Alarm list changed
+// Call before starting other playback: a muted pre-warm gives way, the volume is restored at once
+// and the alarm will start cold
+void AlarmScheduler_OnPlaybackStarted();
+
+void AlarmScheduler_GetStats(AlarmSchedulerStats* out);
+void AlarmScheduler_PrintStats();
+
+#endif
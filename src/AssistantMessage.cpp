@@ -0,0 +1,353 @@
+// AssistantMessage.cpp - Single pass, in-place field extraction for assistant WebSocket JSON
+#include "AssistantMessage.h"
+#include <string.h>
+
+namespace {
+
+enum FieldKind : uint8_t { F_STR, F_U32, F_I64, F_BOOL, F_OBJ };
+
+struct Field {
+    const char* key;
+    uint8_t     keyLen;
+    FieldKind   kind;
+    size_t      offset;         // Member of AssistantMessage
+    size_t      lenOffset;      // F_STR: member that receives the length, 0 = none
+};
+
+#define FIELD(key, kind, member)  { key, sizeof(key) - 1, kind, offsetof(AssistantMessage, member), 0 }
+
+const Field traceFields[] = {
+    FIELD("rx",        F_I64, trace_rx),
+    FIELD("stt_start", F_I64, trace_stt_start),
+    FIELD("stt_end",   F_I64, trace_stt_end),
+    FIELD("llm_end",   F_I64, trace_llm_end),
+    FIELD("tx",        F_I64, trace_tx),
+};
+
+const Field topFields[] = {
+    FIELD("type",        F_STR,  type),
+    FIELD("sender",      F_STR,  sender),
+    { "content", 7, F_STR, offsetof(AssistantMessage, content), offsetof(AssistantMessage, content_len) },
+    FIELD("language",    F_STR,  language),
+    FIELD("mode",        F_STR,  mode),
+    FIELD("audio",       F_STR,  audio),
+    FIELD("codec",       F_STR,  codec),
+    FIELD("stream_id",   F_U32,  stream_id),
+    FIELD("sample_rate", F_U32,  sample_rate),
+    FIELD("frames",      F_U32,  frames),
+    FIELD("error",       F_BOOL, error),
+    FIELD("rid",         F_U32,  rid),
+    FIELD("trace",       F_OBJ,  trace_rx),     // Parsed with traceFields
+};
+
+#define COUNT(a)  (sizeof(a) / sizeof((a)[0]))
+
+struct Scanner {
+    char*       p;
+    char*       end;
+    const char* err;
+
+    char peek() const { return p < end ? *p : '\0'; }
+
+    bool fail(const char* why) {
+        if (!err) err = why;
+        return false;
+    }
+
+    void skipWs() {
+        while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) p++;
+    }
+
+    bool expect(char c) {
+        skipWs();
+        if (peek() != c) return fail("unexpected character");
+        p++;
+        return true;
+    }
+};
+
+int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool readHex4(Scanner& s, const char* r, uint32_t* out) {
+    if (s.end - r < 4) return s.fail("truncated \\u escape");
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) {
+        const int d = hexDigit(r[i]);
+        if (d < 0) return s.fail("bad \\u escape");
+        v = (v << 4) | d;
+    }
+    *out = v;
+    return true;
+}
+
+char* putUtf8(char* w, uint32_t cp) {
+    if (cp < 0x80) {
+        *w++ = (char)cp;
+    } else if (cp < 0x800) {
+        *w++ = (char)(0xC0 | (cp >> 6));
+        *w++ = (char)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *w++ = (char)(0xE0 | (cp >> 12));
+        *w++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *w++ = (char)(0x80 | (cp & 0x3F));
+    } else {
+        *w++ = (char)(0xF0 | (cp >> 18));
+        *w++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+        *w++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+        *w++ = (char)(0x80 | (cp & 0x3F));
+    }
+    return w;
+}
+
+// At the opening quote. With 'decode' the body is unescaped in place and NUL-terminated,
+// without it the string is only skipped and 'str'/'len' give the raw body.
+bool scanString(Scanner& s, bool decode, char** str, size_t* len) {
+    s.p++;                              // Opening quote
+    char* const start = s.p;
+
+    if (!decode) {
+        for (char* r = start; r < s.end; ) {
+            char* q = static_cast<char*>(memchr(r, '"', s.end - r));
+            if (!q) break;
+            // Escaped if preceded by an odd number of backslashes
+            size_t bs = 0;
+            while (q - bs > start && q[-1 - (ptrdiff_t)bs] == '\\') bs++;
+            if ((bs & 1) == 0) {
+                *str = start;
+                *len = q - start;
+                s.p = q + 1;
+                return true;
+            }
+            r = q + 1;
+        }
+        return s.fail("unterminated string");
+    }
+
+    char* w = start;
+    char* r = start;
+    while (r < s.end) {
+        // Plain run up to the next quote or backslash; only moved once an escape shrank the string
+        char* q = r;
+        while (q < s.end && *q != '"' && *q != '\\') q++;
+        if (w != r) memmove(w, r, q - r);
+        w += q - r;
+        r = q;
+        if (r >= s.end) break;
+
+        if (*r == '"') {
+            *w = '\0';                  // Never past the closing quote
+            *str = start;
+            *len = w - start;
+            s.p = r + 1;
+            return true;
+        }
+
+        // Escape sequence
+        if (++r >= s.end) break;
+        switch (*r) {
+            case '"':  *w++ = '"';  r++; break;
+            case '\\': *w++ = '\\'; r++; break;
+            case '/':  *w++ = '/';  r++; break;
+            case 'b':  *w++ = '\b'; r++; break;
+            case 'f':  *w++ = '\f'; r++; break;
+            case 'n':  *w++ = '\n'; r++; break;
+            case 'r':  *w++ = '\r'; r++; break;
+            case 't':  *w++ = '\t'; r++; break;
+            case 'u': {
+                uint32_t cp;
+                if (!readHex4(s, r + 1, &cp)) return false;
+                r += 5;
+                // Characters outside the BMP come as a surrogate pair of escapes
+                if (cp >= 0xD800 && cp < 0xDC00 && s.end - r >= 6 && r[0] == '\\' && r[1] == 'u') {
+                    uint32_t lo;
+                    if (!readHex4(s, r + 2, &lo)) return false;
+                    if (lo >= 0xDC00 && lo < 0xE000) {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        r += 6;
+                    }
+                }
+                if (cp >= 0xD800 && cp < 0xE000) cp = 0xFFFD;   // Lone surrogate
+                w = putUtf8(w, cp);
+                break;
+            }
+            default:
+                return s.fail("bad escape");
+        }
+    }
+    return s.fail("unterminated string");
+}
+
+// Integer part only; a fraction or exponent is consumed and ignored
+bool scanNumber(Scanner& s, int64_t* out) {
+    bool neg = false;
+    if (s.peek() == '-') {
+        neg = true;
+        s.p++;
+    }
+    if (!(s.peek() >= '0' && s.peek() <= '9')) return s.fail("bad number");
+
+    int64_t v = 0;
+    while (s.peek() >= '0' && s.peek() <= '9') v = v * 10 + (*s.p++ - '0');
+    if (s.peek() == '.') {
+        s.p++;
+        while (s.peek() >= '0' && s.peek() <= '9') s.p++;
+    }
+    if (s.peek() == 'e' || s.peek() == 'E') {
+        s.p++;
+        if (s.peek() == '+' || s.peek() == '-') s.p++;
+        while (s.peek() >= '0' && s.peek() <= '9') s.p++;
+    }
+    *out = neg ? -v : v;
+    return true;
+}
+
+bool scanLiteral(Scanner& s, const char* word, size_t len) {
+    if ((size_t)(s.end - s.p) < len || memcmp(s.p, word, len) != 0) return s.fail("bad literal");
+    s.p += len;
+    return true;
+}
+
+bool skipValue(Scanner& s, int depth);
+
+bool skipContainer(Scanner& s, int depth, char close) {
+    if (depth > ASSISTANT_MSG_MAX_DEPTH) return s.fail("nesting too deep");
+    s.p++;
+    s.skipWs();
+    if (s.peek() == close) {
+        s.p++;
+        return true;
+    }
+    while (true) {
+        s.skipWs();
+        if (close == '}') {
+            char* key;
+            size_t keyLen;
+            if (s.peek() != '"' || !scanString(s, false, &key, &keyLen) || !s.expect(':')) return s.fail("bad key");
+        }
+        if (!skipValue(s, depth)) return false;
+        s.skipWs();
+        const char c = s.peek();
+        s.p++;
+        if (c == close) return true;
+        if (c != ',') return s.fail("expected , or end of container");
+    }
+}
+
+bool skipValue(Scanner& s, int depth) {
+    s.skipWs();
+    char* str;
+    size_t len;
+    int64_t num;
+    switch (s.peek()) {
+        case '"': return scanString(s, false, &str, &len);
+        case '{': return skipContainer(s, depth + 1, '}');
+        case '[': return skipContainer(s, depth + 1, ']');
+        case 't': return scanLiteral(s, "true", 4);
+        case 'f': return scanLiteral(s, "false", 5);
+        case 'n': return scanLiteral(s, "null", 4);
+        default:  return scanNumber(s, &num);
+    }
+}
+
+bool parseObject(Scanner& s, const Field* fields, size_t count, AssistantMessage* out, int depth);
+
+// Value of a wanted field; a value of another JSON type keeps the default, like ArduinoJson's '|'
+bool parseField(Scanner& s, const Field& f, AssistantMessage* out, int depth) {
+    s.skipWs();
+    uint8_t* const base = reinterpret_cast<uint8_t*>(out);
+    const char c = s.peek();
+
+    switch (f.kind) {
+        case F_STR:
+            if (c == '"') {
+                char* str;
+                size_t len;
+                if (!scanString(s, true, &str, &len)) return false;
+                *reinterpret_cast<const char**>(base + f.offset) = str;
+                if (f.lenOffset) *reinterpret_cast<size_t*>(base + f.lenOffset) = len;
+                return true;
+            }
+            break;
+        case F_U32:
+        case F_I64:
+            if (c == '-' || (c >= '0' && c <= '9')) {
+                int64_t v;
+                if (!scanNumber(s, &v)) return false;
+                if (f.kind == F_U32) *reinterpret_cast<uint32_t*>(base + f.offset) = (uint32_t)v;
+                else *reinterpret_cast<int64_t*>(base + f.offset) = v;
+                return true;
+            }
+            break;
+        case F_BOOL:
+            if (c == 't' || c == 'f') {
+                *reinterpret_cast<bool*>(base + f.offset) = c == 't';
+                return c == 't' ? scanLiteral(s, "true", 4) : scanLiteral(s, "false", 5);
+            }
+            break;
+        case F_OBJ:
+            if (c == '{') return parseObject(s, traceFields, COUNT(traceFields), out, depth + 1);
+            break;
+    }
+    return skipValue(s, depth);
+}
+
+bool parseObject(Scanner& s, const Field* fields, size_t count, AssistantMessage* out, int depth) {
+    if (depth > ASSISTANT_MSG_MAX_DEPTH) return s.fail("nesting too deep");
+    if (!s.expect('{')) return false;
+    s.skipWs();
+    if (s.peek() == '}') {
+        s.p++;
+        return true;
+    }
+
+    while (true) {
+        s.skipWs();
+        char* key;
+        size_t keyLen;
+        if (s.peek() != '"' || !scanString(s, false, &key, &keyLen)) return s.fail("bad key");
+        if (!s.expect(':')) return false;
+
+        // Keys we look for never contain escapes, compare the raw bytes
+        const Field* match = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            if (fields[i].keyLen == keyLen && memcmp(fields[i].key, key, keyLen) == 0) {
+                match = &fields[i];
+                break;
+            }
+        }
+        if (match ? !parseField(s, *match, out, depth) : !skipValue(s, depth)) return false;
+
+        s.skipWs();
+        const char c = s.peek();
+        s.p++;
+        if (c == '}') return true;
+        if (c != ',') return s.fail("expected , or }");
+    }
+}
+
+}  // namespace
+
+const char* AssistantMessage_Parse(char* json, size_t len, AssistantMessage* out) {
+    if (!json || !out) return "no input";
+
+    *out = {};
+    out->type = "unknown";
+    out->sender = "unspecified";
+    out->content = "";
+    out->language = "";
+    out->mode = "";
+    out->audio = "";
+    out->codec = "pcm16";
+    out->sample_rate = 24000;
+
+    Scanner s = { json, json + len, nullptr };
+    s.skipWs();
+    if (s.peek() != '{') return "not an object";
+    if (!parseObject(s, topFields, COUNT(topFields), out, 1)) return s.err ? s.err : "invalid";
+    return nullptr;
+}
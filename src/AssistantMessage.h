@@ -0,0 +1,57 @@
+#ifndef ASSISTANT_MESSAGE_H
+#define ASSISTANT_MESSAGE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  In-place parser for the JSON messages the backend sends on the assistant
+  WebSocket
+
+  The message is scanned once, straight in the receive buffer. Only the
+  fields listed in AssistantMessage are extracted, everything else
+  (unknown keys, nested objects, arrays) is skipped without being copied.
+  Wanted strings are unescaped in place and NUL-terminated where their
+  closing quote was (an unescaped string is never longer than its JSON
+  form), so the returned pointers point into the buffer and stay valid as
+  long as it does.
+
+  No heap and no document pool: the memory needed is the same for a 50 byte
+  HELLO and a 20 kB GPT answer, and a long "content" is never truncated.
+
+  Plain C/C++ without Arduino headers, so tools/json_bench.cpp can build it
+  on the host.
+*/
+
+#define ASSISTANT_MSG_MAX_DEPTH  8      // Nesting deeper than this is rejected
+
+struct AssistantMessage {
+    // Strings point into the parsed buffer; absent fields get the defaults below
+    const char* type;           // "unknown"
+    const char* sender;         // "unspecified"
+    const char* content;        // ""
+    size_t      content_len;
+    const char* language;       // ""
+    const char* mode;           // ""
+    const char* audio;          // "" ("stream" when reply audio follows)
+    const char* codec;          // "pcm16"
+
+    uint32_t stream_id;
+    uint32_t sample_rate;       // 24000
+    uint32_t frames;
+    bool     error;
+    uint32_t rid;
+
+    // trace: backend hop stamps in ms, 0 when missing
+    int64_t  trace_rx;
+    int64_t  trace_stt_start;
+    int64_t  trace_stt_end;
+    int64_t  trace_llm_end;
+    int64_t  trace_tx;
+};
+
+// Parses 'len' bytes at 'json' (a top-level object) and rewrites them in place.
+// Returns nullptr on success, otherwise a short reason; 'out' is only complete on success.
+const char* AssistantMessage_Parse(char* json, size_t len, AssistantMessage* out);
+
+#endif
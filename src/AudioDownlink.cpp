@@ -0,0 +1,327 @@
+// AudioDownlink.cpp - Jitter buffer and loopback playback for streamed reply audio
+#include "AudioDownlink.h"
+#include <WiFi.h>
+#include "AudioMixer.h"
+#include "TTSCache.h"
+#include "Metrics.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+typedef enum {
+    DL_IDLE = 0,
+    DL_BUFFERING,       // Collecting DOWNLINK_PREBUFFER_MS before playback
+    DL_PLAYING          // Decoder connected to the loopback endpoint
+} DownlinkState;
+
+static WiFiServer server(DOWNLINK_PORT);
+
+// Jitter buffer: single producer (WebSocket task), single consumer (loopback task).
+// wr/rd are free-running byte counters, index = counter % ringSize.
+static uint8_t* ring = nullptr;
+static uint32_t ringSize = 0;
+static volatile uint32_t wr = 0;
+static volatile uint32_t rd = 0;
+static portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+
+static volatile DownlinkState state = DL_IDLE;
+static volatile bool ended = false;
+static volatile uint32_t generation = 0;    // Bumped per stream, stale loopback connections bail out
+static uint8_t curStream = 0;
+static uint32_t expectSeq = 0;
+static bool curMp3 = false;
+static uint32_t curRate = 0;
+static uint32_t bytesPerMs = 1;
+static int64_t beginUs = 0;
+static volatile uint32_t lastDataMs = 0;
+static uint32_t framesThisStream = 0;
+static bool firstAudioServed = false;
+
+static String fallbackText;
+static String fallbackLang;
+
+// Stats
+static uint32_t statStreams = 0;
+static uint32_t statFrames = 0;
+static uint64_t statBytes = 0;
+static uint32_t statGaps = 0;
+static uint32_t statOverruns = 0;
+static uint32_t statUnderruns = 0;
+static Metric* mUnderruns = nullptr;
+static uint32_t statFirstFrameMs = 0;
+static uint32_t statFirstAudioMs = 0;
+static uint32_t statFallbacks = 0;
+
+static inline uint32_t ringFill() {
+    portENTER_CRITICAL(&ringMux);
+    uint32_t n = wr - rd;
+    portEXIT_CRITICAL(&ringMux);
+    return n;
+}
+
+static void ringReset() {
+    portENTER_CRITICAL(&ringMux);
+    wr = rd = 0;
+    portEXIT_CRITICAL(&ringMux);
+}
+
+static void ringWrite(const uint8_t* data, uint32_t len) {
+    const uint32_t space = ringSize - ringFill();
+    if (len > space) {
+        statOverruns += len - space;
+        len = space;
+    }
+    uint32_t pos = wr % ringSize;
+    uint32_t first = min(len, ringSize - pos);
+    memcpy(ring + pos, data, first);
+    memcpy(ring, data + first, len - first);
+
+    portENTER_CRITICAL(&ringMux);
+    wr += len;
+    portEXIT_CRITICAL(&ringMux);
+}
+
+static uint32_t ringRead(uint8_t* out, uint32_t maxLen) {
+    uint32_t len = min(ringFill(), maxLen);
+    uint32_t pos = rd % ringSize;
+    uint32_t first = min(len, ringSize - pos);
+    memcpy(out, ring + pos, first);
+    memcpy(out + first, ring, len - first);
+
+    portENTER_CRITICAL(&ringMux);
+    rd += len;
+    portEXIT_CRITICAL(&ringMux);
+    return len;
+}
+
+static void startPlayback() {
+    state = DL_PLAYING;
+    char url[64];
+    snprintf(url, sizeof(url), "http://127.0.0.1:%d/downlink/%lu.%s", DOWNLINK_PORT,
+             (unsigned long)generation, curMp3 ? "mp3" : "wav");
+    Serial.printf("[Downlink] Starting playback after %lld ms, %u ms buffered\n",
+                  (esp_timer_get_time() - beginUs) / 1000, ringFill() / bytesPerMs);
+    if (!AudioMixer_PlayVoiceHost(url)) {
+        Serial.println("[Downlink] Decoder failed to connect to loopback");
+        state = DL_IDLE;
+    }
+}
+
+static void writeChunk(WiFiClient& c, const uint8_t* data, size_t len) {
+    c.printf("%X\r\n", (unsigned)len);
+    c.write(data, len);
+    c.print("\r\n");
+}
+
+static void writeWavHeader(WiFiClient& c, uint32_t rate) {
+    // Open-ended PCM16 mono WAV, the chunked stream end terminates it
+    uint8_t h[44];
+    const uint32_t dataSize = 0x7FFFFFFF;
+    const uint32_t byteRate = rate * 2;
+    memcpy(h, "RIFF", 4);
+    *(uint32_t*)(h + 4) = dataSize + 36;
+    memcpy(h + 8, "WAVEfmt ", 8);
+    *(uint32_t*)(h + 16) = 16;
+    *(uint16_t*)(h + 20) = 1;           // PCM
+    *(uint16_t*)(h + 22) = 1;           // Mono
+    *(uint32_t*)(h + 24) = rate;
+    *(uint32_t*)(h + 28) = byteRate;
+    *(uint16_t*)(h + 32) = 2;           // Block align
+    *(uint16_t*)(h + 34) = 16;          // Bits per sample
+    memcpy(h + 36, "data", 4);
+    *(uint32_t*)(h + 40) = dataSize;
+    writeChunk(c, h, sizeof(h));
+}
+
+// Serve the jitter buffer to the local decoder until the stream ends
+static void serveClient(WiFiClient& c) {
+    // Skip the request, there is only one resource
+    const uint32_t t0 = millis();
+    while (c.connected() && millis() - t0 < 1000) {
+        String line = c.readStringUntil('\n');
+        if (line == "\r" || line.isEmpty()) break;
+    }
+
+    const uint32_t gen = generation;
+    if (state != DL_PLAYING) {
+        c.print("HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+        c.stop();
+        return;
+    }
+
+    c.setNoDelay(true);
+    c.printf("HTTP/1.1 200 OK\r\nContent-Type: %s\r\nTransfer-Encoding: chunked\r\nConnection: close\r\n\r\n",
+             curMp3 ? "audio/mpeg" : "audio/wav");
+    if (!curMp3) writeWavHeader(c, curRate);
+
+    uint8_t buf[1024];
+    bool starving = false;
+    while (c.connected() && gen == generation) {
+        uint32_t n = ringRead(buf, sizeof(buf));
+        if (n) {
+            if (!firstAudioServed) {
+                firstAudioServed = true;
+                statFirstAudioMs = (uint32_t)((esp_timer_get_time() - beginUs) / 1000);
+            }
+            writeChunk(c, buf, n);
+            starving = false;
+            continue;
+        }
+        if (ended) break;
+        if (!starving) {
+            statUnderruns++;
+            Metrics_Add(mUnderruns);
+            starving = true;
+        }
+        if (millis() - lastDataMs > DOWNLINK_IDLE_TIMEOUT_MS) {
+            Serial.println("[Downlink] Stream stalled, closing");
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+
+    c.print("0\r\n\r\n");
+    c.stop();
+    if (gen == generation) state = DL_IDLE;
+}
+
+static void AudioDownlinkServerTask(void*) {
+    server.begin();
+    while (true) {
+        WiFiClient c = server.available();
+        if (!c) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+            continue;
+        }
+        // Loopback only, the decoder on this device is the only consumer
+        if (c.remoteIP() != IPAddress(127, 0, 0, 1)) {
+            c.stop();
+            continue;
+        }
+        serveClient(c);
+    }
+}
+
+void AudioDownlink_Init() {
+    mUnderruns = Metrics_Counter("audio_underruns_total", "Audio buffer underruns", "source=\"downlink\"");
+    // Worst case 24 kHz PCM16 mono (OpenAI TTS "pcm")
+    ringSize = 24000 * 2 * DOWNLINK_BUFFER_MS / 1000;
+    ring = (uint8_t*)heap_caps_malloc(ringSize, MALLOC_CAP_SPIRAM);
+    if (!ring) {
+        Serial.println("[Downlink] Failed to allocate jitter buffer, downlink disabled");
+        ringSize = 0;
+        return;
+    }
+    xTaskCreatePinnedToCore(AudioDownlinkServerTask, "DownlinkServer", 4096, nullptr, 3, nullptr, 1);
+    Serial.printf("[Downlink] Loopback on port %d, jitter buffer %u bytes\n", DOWNLINK_PORT, ringSize);
+}
+
+void AudioDownlink_SetFallbackText(const char* text, const char* lang) {
+    fallbackText = text ? text : "";
+    fallbackLang = lang ? lang : "en";
+}
+
+void AudioDownlink_Begin(uint8_t streamId, const char* codec, uint32_t sampleRate) {
+    if (!ring) return;
+    if (state == DL_PLAYING) AudioMixer_StopVoice();
+
+    generation++;               // Drops a loopback connection still serving the old stream
+    ringReset();
+    curStream = streamId;
+    expectSeq = 0;
+    curMp3 = codec && strcmp(codec, "mp3") == 0;
+    curRate = sampleRate ? sampleRate : 24000;
+    bytesPerMs = curMp3 ? DOWNLINK_MP3_BYTES_MS : curRate * 2 / 1000;
+    beginUs = esp_timer_get_time();
+    lastDataMs = millis();
+    framesThisStream = 0;
+    firstAudioServed = false;
+    ended = false;
+    state = DL_BUFFERING;
+    statStreams++;
+
+    Serial.printf("[Downlink] Stream %u started: %s %lu Hz\n", streamId, curMp3 ? "mp3" : "pcm16", (unsigned long)curRate);
+}
+
+void AudioDownlink_OnBinary(const uint8_t* data, size_t len) {
+    if (state == DL_IDLE || !ring) return;
+
+    // One message can hold several frames back to back
+    size_t off = 0;
+    while (off + AUDIO_FRAME_HEADER_SIZE <= len) {
+        AudioFrameHeader h;
+        memcpy(&h, data + off, sizeof(h));
+        if (h.magic != AUDIO_FRAME_MAGIC || h.version != AUDIO_FRAME_VERSION ||
+            off + AUDIO_FRAME_HEADER_SIZE + h.payload_len > len) {
+            Serial.printf("[Downlink] Malformed frame at offset %u, rest of message dropped\n", (unsigned)off);
+            return;
+        }
+        off += AUDIO_FRAME_HEADER_SIZE;
+
+        // Channel 0 is a backend from before the multiplexer
+        const bool downlink = h.channel == WS_CH_AUDIO_DOWN || h.channel == WS_CH_CONTROL;
+        if (downlink && h.stream_id == curStream && h.seq >= expectSeq) {
+            if (h.seq > expectSeq) statGaps++;
+            expectSeq = h.seq + 1;
+
+            if (framesThisStream++ == 0) statFirstFrameMs = (uint32_t)((esp_timer_get_time() - beginUs) / 1000);
+            ringWrite(data + off, h.payload_len);
+            statFrames++;
+            statBytes += h.payload_len;
+            lastDataMs = millis();
+        }
+        off += h.payload_len;
+    }
+
+    if (state == DL_BUFFERING && ringFill() >= DOWNLINK_PREBUFFER_MS * bytesPerMs) startPlayback();
+}
+
+void AudioDownlink_End(uint32_t frames, bool error) {
+    if (state == DL_IDLE) return;
+    if (frames > expectSeq) statGaps++;
+    ended = true;
+
+    if (framesThisStream == 0) {
+        // Nothing arrived, speak the text instead
+        state = DL_IDLE;
+        if (!fallbackText.isEmpty()) {
+            Serial.printf("[Downlink] No audio received (%s), falling back to text TTS\n", error ? "backend error" : "empty stream");
+            statFallbacks++;
+            TTSCache_Speak(fallbackText.c_str(), fallbackLang.c_str());
+        }
+        fallbackText = "";
+        return;
+    }
+    fallbackText = "";
+
+    // Short reply that never reached the prebuffer threshold
+    if (state == DL_BUFFERING) startPlayback();
+    Serial.printf("[Downlink] Stream %u ended: %u frames, first frame %u ms, first audio %u ms\n",
+                  curStream, framesThisStream, statFirstFrameMs, statFirstAudioMs);
+}
+
+bool AudioDownlink_IsActive() {
+    return state != DL_IDLE;
+}
+
+void AudioDownlink_GetStats(AudioDownlinkStats* out) {
+    if (!out) return;
+    out->streams = statStreams;
+    out->frames = statFrames;
+    out->bytes = statBytes;
+    out->gaps = statGaps;
+    out->overruns = statOverruns;
+    out->underruns = statUnderruns;
+    out->fill_ms = ringFill() / bytesPerMs;
+    out->first_frame_ms = statFirstFrameMs;
+    out->first_audio_ms = statFirstAudioMs;
+    out->fallbacks = statFallbacks;
+    out->active = state != DL_IDLE;
+}
+
+void AudioDownlink_PrintStats() {
+    AudioDownlinkStats s;
+    AudioDownlink_GetStats(&s);
+    Serial.printf("[Downlink] streams=%u frames=%u bytes=%llu gaps=%u overruns=%u underruns=%u fill=%ums first_frame=%ums first_audio=%ums fallbacks=%u\n",
+                  s.streams, s.frames, s.bytes, s.gaps, s.overruns, s.underruns, s.fill_ms,
+                  s.first_frame_ms, s.first_audio_ms, s.fallbacks);
+}
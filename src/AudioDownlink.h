@@ -0,0 +1,57 @@
+#ifndef AUDIO_DOWNLINK_H
+#define AUDIO_DOWNLINK_H
+
+#include <Arduino.h>
+#include "AudioFrame.h"
+
+/*
+  Streaming reply audio from the backend (WebSocket downlink)
+
+  The backend announces a stream with AUDIO_STREAM_START (codec, sample
+  rate), sends the synthesized audio as framed binary messages (same header
+  as the uplink, see AudioFrame.h) and closes it with AUDIO_STREAM_END.
+
+  Frames go into a PSRAM jitter buffer. As soon as DOWNLINK_PREBUFFER_MS is
+  buffered (or the stream already ended) playback starts through the mixer:
+  the voice decoder connects to a loopback HTTP endpoint on this device,
+  which serves the jitter buffer as a chunked WAV / MP3 stream. So the first
+  words play while the rest of the answer is still being synthesized, with
+  no second round trip to a TTS service.
+
+  If the backend reports a TTS error before any audio arrived, the reply
+  text is spoken the old way (TTSCache_Speak).
+*/
+
+#define DOWNLINK_PORT            8081
+#define DOWNLINK_BUFFER_MS       4000    // Jitter buffer capacity (at 24 kHz PCM16 = 192 KB)
+#define DOWNLINK_PREBUFFER_MS    160     // Buffered before playback starts
+#define DOWNLINK_MP3_BYTES_MS    16      // Assumed 128 kbps for MP3 buffer math
+#define DOWNLINK_IDLE_TIMEOUT_MS 5000    // Give up on a stream that stops delivering
+
+struct AudioDownlinkStats {
+    uint32_t streams;
+    uint32_t frames;
+    uint64_t bytes;
+    uint32_t gaps;                // Sequence jumps
+    uint32_t overruns;            // Bytes dropped, jitter buffer full
+    uint32_t underruns;           // Times the decoder caught up with the network
+    uint32_t fill_ms;             // Current jitter buffer fill
+    uint32_t first_frame_ms;      // START -> first frame (last stream)
+    uint32_t first_audio_ms;      // START -> first bytes handed to the decoder (last stream)
+    uint32_t fallbacks;           // Replies spoken via text TTS instead
+    bool     active;
+};
+
+void AudioDownlink_Init();
+
+// Called from the WebSocket message callback
+void AudioDownlink_Begin(uint8_t streamId, const char* codec, uint32_t sampleRate);
+void AudioDownlink_OnBinary(const uint8_t* data, size_t len);
+void AudioDownlink_End(uint32_t frames, bool error);
+void AudioDownlink_SetFallbackText(const char* text, const char* lang);
+
+bool AudioDownlink_IsActive();
+void AudioDownlink_GetStats(AudioDownlinkStats* out);
+void AudioDownlink_PrintStats();
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef AUDIO_FRAME_H
+#define AUDIO_FRAME_H
+
+#include <Arduino.h>
+#include <sys/time.h>
+
+/*
+  Binary audio framing on the assistant WebSocket
+
+  A binary message carries one or more frames back to back, each a header
+  followed by its payload (the uplink sender coalesces queued frames into
+  one message, see AudioUplink.h). A reader walks the message using
+  payload_len. The frame layout:
+
+    off  size  field
+     0    1    magic        AUDIO_FRAME_MAGIC
+     1    1    version      AUDIO_FRAME_VERSION
+     2    1    codec        AudioFrameCodec
+     3    1    flags        AUDIO_FRAME_FLAG_*
+     4    1    stream_id    Incremented for every START_STREAM
+     5    1    channel      WsChannel the frame travels on (0 = legacy sender)
+     6    2    payload_len  Bytes after the header
+     8    4    seq          Per-stream frame counter, starts at 0
+    12    8    capture_us   Wall clock (NTP) of the first sample, us since epoch
+
+  All fields little endian. The header is 20 bytes, so a payload that follows
+  it stays 4-byte aligned. Senders reserve AUDIO_FRAME_HEADER_SIZE bytes in
+  front of their sample buffer and fill the header in place, the payload is
+  never copied.
+
+  The channel byte lets both ends tell bulk traffic apart on the one
+  WebSocket. Text messages carry no header: they are control (JSON) unless
+  their type says TELEMETRY. Each side's writer serves control first and
+  shares the rest of the link between the bulk channels by byte budget.
+*/
+
+#define AUDIO_FRAME_MAGIC        0xA5
+#define AUDIO_FRAME_VERSION      1
+
+#define AUDIO_FRAME_FLAG_START   0x01   // First frame of a stream
+
+// Logical channels multiplexed over the assistant WebSocket
+typedef enum : uint8_t {
+    WS_CH_CONTROL    = 0,       // JSON control messages, strict priority
+    WS_CH_AUDIO_UP   = 1,       // Microphone frames, device -> backend
+    WS_CH_AUDIO_DOWN = 2,       // Reply audio frames, backend -> device
+    WS_CH_TELEMETRY  = 3,       // Periodic stats, lowest share of the link
+} WsChannel;
+
+typedef enum : uint8_t {
+    AUDIO_CODEC_PCM16 = 0,      // Signed 16-bit little endian, mono
+    AUDIO_CODEC_MP3   = 1,      // MPEG audio frames (downlink only)
+    AUDIO_CODEC_ULAW  = 2,      // G.711 mu-law, one byte per sample (uplink under backpressure)
+} AudioFrameCodec;
+
+struct __attribute__((packed)) AudioFrameHeader {
+    uint8_t  magic;
+    uint8_t  version;
+    uint8_t  codec;
+    uint8_t  flags;
+    uint8_t  stream_id;
+    uint8_t  channel;
+    uint16_t payload_len;
+    uint32_t seq;
+    uint64_t capture_us;
+};
+
+#define AUDIO_FRAME_HEADER_SIZE  sizeof(AudioFrameHeader)
+
+static_assert(AUDIO_FRAME_HEADER_SIZE == 20, "AudioFrameHeader layout changed");
+
+// Wall clock in microseconds since epoch (what capture_us carries)
+static inline uint64_t AudioFrame_NowUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (uint64_t)tv.tv_sec * 1000000ULL + tv.tv_usec;
+}
+
+// Fill the header at the start of 'frame'; the payload must already be at frame + AUDIO_FRAME_HEADER_SIZE
+static inline void AudioFrame_WriteHeader(uint8_t* frame, uint8_t codec, uint8_t flags, uint8_t streamId,
+                                          uint8_t channel, uint32_t seq, uint64_t captureUs, uint16_t payloadLen) {
+    AudioFrameHeader* h = reinterpret_cast<AudioFrameHeader*>(frame);
+    h->magic = AUDIO_FRAME_MAGIC;
+    h->version = AUDIO_FRAME_VERSION;
+    h->codec = codec;
+    h->flags = flags;
+    h->stream_id = streamId;
+    h->channel = channel;
+    h->payload_len = payloadLen;
+    h->seq = seq;
+    h->capture_us = captureUs;
+}
+
+#endif
@@ -0,0 +1,352 @@
+// AudioMixer.cpp - Mixes a voice/TTS stream over music with automatic ducking
+#include "AudioMixer.h"
+#include "PCM5101.h"
+#include "AlarmScheduler.h"
+#include "StreamMonitor.h"
+#include "Metrics.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+// The voice decoder gets its own I2S port so it never touches the DAC channel.
+// Its TX channel is allocated but never enabled: every block is intercepted in
+// audio_process_i2s() and *continueI2S is cleared. The ESP32-S3 has only two I2S
+// controllers and the microphone needs one, so the decoder exists only while a
+// voice is mixed: created by beginMixedVoice(), deleted by AudioMixer_Loop().
+static Audio* voice = nullptr;
+static Audio* music_ptr = nullptr;
+static SemaphoreHandle_t voiceMutex = nullptr;  // Guards 'voice' (create, calls, delete)
+
+// Task inside a voice decoder call, so audio_process_i2s() and the shared audio info
+// callback know which decoder is talking; the music decoder may run on another task meanwhile.
+static volatile TaskHandle_t voiceCaller = nullptr;
+
+// Voice ring buffer (interleaved stereo int16, PSRAM).
+// head/tail are free-running frame counters, index = counter % ringFrames.
+static int16_t* ring = nullptr;
+static uint32_t ringFrames = 0;
+static uint32_t head = 0;
+static uint32_t tail = 0;
+static uint32_t phase = 0;              // Q16 fractional read position
+static uint32_t voiceRate = 0;          // Sample rate of data in the ring
+
+static volatile bool voiceMixed = false;    // A voice stream is routed through the mixer
+static volatile bool resetPending = false;  // Flush ring before the next voice stream
+
+// Gains in Q15 (32768 = 1.0)
+static int32_t musicGain = 32768;
+static int32_t voiceGain = 0;
+
+// Stats
+static uint32_t statBlocks = 0;
+static uint32_t statFrames = 0;
+static uint32_t statMixUsLast = 0;
+static uint32_t statMixUsMax = 0;
+static uint64_t statMixUsTotal = 0;
+static int64_t  statWindowStartUs = 0;
+static uint32_t statOverruns = 0;
+static uint32_t statUnderruns = 0;
+static Metric* mUnderruns = nullptr;
+static uint32_t statVoiceLatencyMs = 0;
+static int64_t  voiceRequestUs = 0;
+
+// Voice timing (assistant latency trace): playback requested / first voice sample output
+static volatile int64_t voiceStartRequestUs = 0;
+static volatile int64_t voiceHeardUs = 0;
+static volatile bool voiceDirect = false;   // Last voice went straight to the main decoder
+
+// First-sample probe (alarm start accuracy)
+static volatile bool probeArmed = false;
+static volatile int64_t probeHitUs = 0;
+
+static inline uint32_t ringFill() { return head - tail; }
+static inline uint32_t ringFree() { return ringFrames - ringFill(); }
+
+static void pushVoice(const int16_t* buf, int32_t frames) {
+    if (!ring || !voice) return;
+    voiceRate = voice->getSampleRate();
+    for (int32_t i = 0; i < frames; ++i) {
+        if (ringFree() == 0) {
+            statOverruns += frames - i;
+            return;
+        }
+        int16_t* dst = &ring[(head % ringFrames) * 2];
+        dst[0] = buf[2 * i];
+        dst[1] = buf[2 * i + 1];
+        head++;
+    }
+}
+
+static inline int32_t rampTowards(int32_t gain, int32_t target, int32_t step) {
+    if (gain < target) return (gain + step > target) ? target : gain + step;
+    if (gain > target) return (gain - step < target) ? target : gain - step;
+    return gain;
+}
+
+static inline int16_t clip16(int32_t s) {
+    if (s > 32767) return 32767;
+    if (s < -32768) return -32768;
+    return (int16_t)s;
+}
+
+static void mixBlock(int16_t* out, int32_t frames) {
+    const int64_t t0 = esp_timer_get_time();
+
+    const uint32_t musicRate = music_ptr ? music_ptr->getSampleRate() : 0;
+    if (musicRate == 0) return;
+
+    const bool voiceOn = voiceMixed;
+    const int32_t musicTarget = voiceOn ? (int32_t)(MIXER_DUCK_GAIN * 32768) : 32768;
+    const int32_t voiceTarget = voiceOn ? 32768 : 0;
+
+    // Nothing to do: not ducked and no voice fading out
+    if (!voiceOn && musicGain == 32768 && voiceGain == 0) return;
+
+    int32_t rampStep = 32768 / (int32_t)((musicRate * MIXER_RAMP_MS) / 1000 + 1);
+    if (rampStep < 1) rampStep = 1;
+
+    // Q16 step through the voice ring, resamples voice to the music rate
+    const uint32_t step = voiceRate ? (uint32_t)(((uint64_t)voiceRate << 16) / musicRate) : 0x10000;
+    bool starved = false;
+
+    for (int32_t i = 0; i < frames; ++i) {
+        musicGain = rampTowards(musicGain, musicTarget, rampStep);
+        voiceGain = rampTowards(voiceGain, voiceTarget, rampStep);
+
+        int32_t vl = 0, vr = 0;
+        if (ringFill() >= 2) {
+            const int16_t* a = &ring[(tail % ringFrames) * 2];
+            const int16_t* b = &ring[((tail + 1) % ringFrames) * 2];
+            // Q15, so a full-scale delta (+-65535) times frac stays within int32
+            const int32_t frac = (int32_t)((phase & 0xFFFF) >> 1);
+            vl = a[0] + (((b[0] - a[0]) * frac) >> 15);
+            vr = a[1] + (((b[1] - a[1]) * frac) >> 15);
+            phase += step;
+            // Voice faster than 2x the music rate steps over more than one frame: never past head
+            uint32_t advance = phase >> 16;
+            if (advance > ringFill()) advance = ringFill();
+            tail += advance;
+            phase &= 0xFFFF;
+
+            if (voiceRequestUs) {
+                voiceHeardUs = esp_timer_get_time();
+                statVoiceLatencyMs = (uint32_t)((voiceHeardUs - voiceRequestUs) / 1000);
+                voiceRequestUs = 0;
+            }
+        } else if (voiceOn && voice && voice->isRunning()) {
+            starved = true;
+        }
+
+        out[2 * i]     = clip16((out[2 * i]     * musicGain + vl * voiceGain) >> 15);
+        out[2 * i + 1] = clip16((out[2 * i + 1] * musicGain + vr * voiceGain) >> 15);
+    }
+
+    if (starved) {
+        statUnderruns++;
+        Metrics_Add(mUnderruns);
+    }
+
+    const uint32_t dt = (uint32_t)(esp_timer_get_time() - t0);
+    statBlocks++;
+    statFrames += frames;
+    statMixUsLast = dt;
+    statMixUsTotal += dt;
+    if (dt > statMixUsMax) statMixUsMax = dt;
+}
+
+// ESP32-audioI2S hook, called with every decoded block before it is written to I2S
+void audio_process_i2s(int16_t* outBuff, int32_t validSamples, bool* continueI2S) {
+    if (AudioMixer_IsVoiceCall()) {
+        // Voice decoder: capture and keep it off the DAC
+        pushVoice(outBuff, validSamples);
+        *continueI2S = false;
+        return;
+    }
+    if (voiceDirect && !voiceHeardUs && validSamples > 0) {
+        voiceHeardUs = esp_timer_get_time();
+    }
+    if (probeArmed && validSamples > 0) {
+        probeHitUs = esp_timer_get_time();
+        probeArmed = false;
+    }
+    // Rebuffering: keep the decoder (and its socket reader) running, write silence
+    if (StreamMonitor_IsHolding()) memset(outBuff, 0, validSamples * 2 * sizeof(int16_t));
+    mixBlock(outBuff, validSamples);
+    *continueI2S = true;
+}
+
+void AudioMixer_Init(Audio& music) {
+    music_ptr = &music;
+    voiceMutex = xSemaphoreCreateMutex();
+    mUnderruns = Metrics_Counter("audio_underruns_total", "Audio buffer underruns", "source=\"voice\"");
+
+    // Worst case 48 kHz stereo
+    ringFrames = 48000 * MIXER_VOICE_BUFFER_MS / 1000;
+    ring = (int16_t*)heap_caps_malloc(ringFrames * 2 * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+    if (!ring) {
+        Serial.println("[Mixer] Failed to allocate voice buffer, mixing disabled");
+        ringFrames = 0;
+    }
+    statWindowStartUs = esp_timer_get_time();
+    Serial.printf("[Mixer] Initialized, voice buffer %u frames\n", ringFrames);
+}
+
+void AudioMixer_Loop() {
+    if (resetPending) {
+        tail = head;
+        phase = 0;
+        resetPending = false;
+    }
+    if (!voice) return;
+    if (xSemaphoreTake(voiceMutex, 0) != pdTRUE) return;   // A voice is being started, never stall the tick
+
+    if (!voiceMixed) {
+        // Done with the decoder: give its I2S controller back
+        delete voice;
+        voice = nullptr;
+        xSemaphoreGive(voiceMutex);
+        return;
+    }
+
+    // Decode only while there is room, the voice decoder is not paced by I2S
+    if (voice->isRunning() && ringFree() > ringFrames / 2) {
+        voiceCaller = xTaskGetCurrentTaskHandle();
+        voice->loop();
+        voiceCaller = nullptr;
+    }
+
+    // Voice finished and drained, or music went away under it
+    if ((!voice->isRunning() && ringFill() < 2) || !music_ptr->isRunning()) {
+        voiceCaller = xTaskGetCurrentTaskHandle();
+        if (voice->isRunning()) voice->stopSong();
+        voiceCaller = nullptr;
+        voiceMixed = false;
+        Serial.println("[Mixer] Voice stream finished, unducking music");
+    }
+    xSemaphoreGive(voiceMutex);
+}
+
+bool AudioMixer_IsVoiceCall() {
+    return voiceCaller && voiceCaller == xTaskGetCurrentTaskHandle();
+}
+
+// Prepare the voice decoder; returns false if voice should go straight to the DAC.
+// On true the caller holds voiceMutex and must hand it to endMixedVoice().
+static bool beginMixedVoice() {
+    voiceRequestUs = esp_timer_get_time();
+    voiceStartRequestUs = voiceRequestUs;
+    voiceHeardUs = 0;
+    voiceDirect = !ring || !music_ptr || !music_ptr->isRunning();
+    if (voiceDirect) {
+        AlarmScheduler_OnPlaybackStarted();     // Voice replaces the music decoder's source
+        return false;
+    }
+
+    xSemaphoreTake(voiceMutex, portMAX_DELAY);
+    voiceMixed = false;
+    if (!voice) voice = new Audio(I2S_NUM_1);
+    voiceCaller = xTaskGetCurrentTaskHandle();
+    if (voice->isRunning()) voice->stopSong();
+    resetPending = true;
+    voice->setVolume(GetVolume());
+    return true;
+}
+
+static bool endMixedVoice(bool ok) {
+    voiceCaller = nullptr;
+    voiceMixed = ok;        // Not mixed: AudioMixer_Loop() deletes the decoder
+    xSemaphoreGive(voiceMutex);
+    return ok;
+}
+
+bool AudioMixer_Speak(const char* text, const char* lang) {
+    if (!beginMixedVoice()) {
+        return music_ptr && music_ptr->connecttospeech(text, lang);
+    }
+    bool ok = endMixedVoice(voice->connecttospeech(text, lang));
+    Serial.printf("[Mixer] Speak over music: %s\n", ok ? "started" : "failed");
+    return ok;
+}
+
+bool AudioMixer_PlayVoiceFile(fs::FS& fs, const char* path) {
+    if (!beginMixedVoice()) {
+        return music_ptr && music_ptr->connecttoFS(fs, path);
+    }
+    bool ok = endMixedVoice(voice->connecttoFS(fs, path));
+    Serial.printf("[Mixer] Voice file over music %s: %s\n", path, ok ? "started" : "failed");
+    return ok;
+}
+
+bool AudioMixer_PlayVoiceHost(const char* url) {
+    if (!beginMixedVoice()) {
+        return music_ptr && music_ptr->connecttohost(url);
+    }
+    bool ok = endMixedVoice(voice->connecttohost(url));
+    Serial.printf("[Mixer] Voice stream over music %s: %s\n", url, ok ? "started" : "failed");
+    return ok;
+}
+
+void AudioMixer_StopVoice() {
+    voiceMixed = false;
+    resetPending = true;
+    if (!voiceMutex) return;
+    xSemaphoreTake(voiceMutex, portMAX_DELAY);
+    if (voice && voice->isRunning()) {
+        voiceCaller = xTaskGetCurrentTaskHandle();
+        voice->stopSong();
+        voiceCaller = nullptr;
+    }
+    xSemaphoreGive(voiceMutex);
+}
+
+bool AudioMixer_IsVoiceActive() {
+    return voiceMixed;
+}
+
+void AudioMixer_ArmFirstSampleProbe() {
+    probeHitUs = 0;
+    probeArmed = true;
+}
+
+int64_t AudioMixer_GetFirstSampleUs() {
+    return probeHitUs;
+}
+
+void AudioMixer_GetVoiceTiming(int64_t* requestedUs, int64_t* heardUs) {
+    if (requestedUs) *requestedUs = voiceStartRequestUs;
+    if (heardUs) *heardUs = voiceHeardUs;
+}
+
+void AudioMixer_GetStats(AudioMixerStats* out, bool reset) {
+    if (!out) return;
+    const int64_t now = esp_timer_get_time();
+    const int64_t window = now - statWindowStartUs;
+    const uint32_t rate = voiceRate ? voiceRate : 1;
+
+    out->blocks = statBlocks;
+    out->frames = statFrames;
+    out->mix_us_last = statMixUsLast;
+    out->mix_us_max = statMixUsMax;
+    out->cpu_percent = window > 0 ? (float)statMixUsTotal * 100.0f / (float)window : 0.0f;
+    out->voice_fill_ms = ringFill() * 1000 / rate;
+    out->voice_latency_ms = statVoiceLatencyMs;
+    out->voice_overruns = statOverruns;
+    out->voice_underruns = statUnderruns;
+    out->voice_active = voiceMixed;
+    out->ducked = musicGain < 32768;
+
+    if (reset) {
+        statBlocks = 0;
+        statFrames = 0;
+        statMixUsMax = 0;
+        statMixUsTotal = 0;
+        statWindowStartUs = now;
+    }
+}
+
+void AudioMixer_PrintStats() {
+    AudioMixerStats s;
+    AudioMixer_GetStats(&s, true);
+    Serial.printf("[Mixer] blocks=%u frames=%u mix_us last=%u max=%u cpu=%.2f%% voice: active=%d fill=%ums latency=%ums overruns=%u underruns=%u\n",
+                  s.blocks, s.frames, s.mix_us_last, s.mix_us_max, s.cpu_percent,
+                  s.voice_active, s.voice_fill_ms, s.voice_latency_ms, s.voice_overruns, s.voice_underruns);
+}
@@ -0,0 +1,65 @@
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include "Audio.h"
+#include "FS.h"
+
+/*
+  Two-stream software mixer
+
+  Music is decoded by the main Audio instance (the one that owns the DAC),
+  voice/TTS by a second Audio instance whose output never reaches I2S.
+  The voice decoder's PCM is captured into a ring buffer and summed into
+  the music output in audio_process_i2s(), with per-channel gain ramps.
+  Music is ducked automatically while voice is playing.
+
+  When no music is running there is nothing to mix into, so voice is
+  played directly on the main instance (same as before the mixer).
+
+  The voice decoder holds the second I2S controller, which the microphone
+  also needs, so it is created for each mixed voice and deleted once the
+  voice has finished. Both decoders report through the one static
+  Audio::audio_info_callback; AudioMixer_IsVoiceCall() tells the callback
+  the event came from the voice decoder.
+*/
+
+#define MIXER_DUCK_GAIN        0.25f   // Music gain while voice is active
+#define MIXER_RAMP_MS          60      // Gain ramp duration (duck / unduck)
+#define MIXER_VOICE_BUFFER_MS  500     // Voice ring buffer depth
+
+struct AudioMixerStats {
+    uint32_t blocks;            // Mixed I2S blocks since last reset
+    uint32_t frames;            // Mixed stereo frames since last reset
+    uint32_t mix_us_last;       // Time spent in the last mix block
+    uint32_t mix_us_max;        // Worst mix block
+    float    cpu_percent;       // Mix time / wall time since last reset
+    uint32_t voice_fill_ms;     // Current voice buffer fill
+    uint32_t voice_latency_ms;  // Request -> first voice sample mixed (last voice)
+    uint32_t voice_overruns;    // Voice samples dropped (ring full)
+    uint32_t voice_underruns;   // Mix blocks that ran out of voice mid-stream
+    bool     voice_active;
+    bool     ducked;
+};
+
+void AudioMixer_Init(Audio& music);
+void AudioMixer_Loop();         // Called from the audio tick after music.loop()
+
+// Voice sources. Mixed over music if music is running, otherwise played directly.
+bool AudioMixer_Speak(const char* text, const char* lang);
+bool AudioMixer_PlayVoiceFile(fs::FS& fs, const char* path);
+bool AudioMixer_PlayVoiceHost(const char* url);
+void AudioMixer_StopVoice();
+bool AudioMixer_IsVoiceActive();
+bool AudioMixer_IsVoiceCall();  // The calling task is inside the voice decoder (audio callbacks)
+
+// Timestamp (esp_timer us) of the first music block handed to I2S after arming, 0 = not yet
+void AudioMixer_ArmFirstSampleProbe();
+int64_t AudioMixer_GetFirstSampleUs();
+
+// Last voice request: when playback was requested and when its first sample went out (0 = not yet)
+void AudioMixer_GetVoiceTiming(int64_t* requestedUs, int64_t* heardUs);
+
+void AudioMixer_GetStats(AudioMixerStats* out, bool reset = false);
+void AudioMixer_PrintStats();
+
+#endif
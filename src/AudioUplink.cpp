@@ -0,0 +1,407 @@
+// AudioUplink.cpp - Sender task, channel scheduling, frame pool, write coalescing and backpressure policy for the assistant WebSocket
+#include "AudioUplink.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+using namespace websockets;
+
+struct UplinkText {
+    char* text;             // malloc'd, freed by the sender
+    int64_t queuedUs;
+};
+
+static WebsocketsClient* client_ptr = nullptr;
+static SemaphoreHandle_t wsMutex = nullptr;
+static TaskHandle_t senderTask = nullptr;
+static QueueHandle_t freeQueue = nullptr;   // Pool of UplinkFrame*
+static QueueHandle_t audioQueue = nullptr;  // UplinkFrame* FIFO
+static QueueHandle_t ctrlQueue = nullptr;   // UplinkText FIFO, strict priority
+static QueueHandle_t telemQueue = nullptr;  // UplinkText FIFO
+static uint8_t* writeBuf = nullptr;
+
+// Round robin deficits of the bulk channels (sender task only)
+static int32_t audioDeficit = 0;
+static int32_t telemDeficit = 0;
+
+// Backpressure policy
+static volatile uint8_t stage = UPLINK_STAGE_NORMAL;
+static uint32_t stageChangedMs = 0;
+static portMUX_TYPE stageMux = portMUX_INITIALIZER_UNLOCKED;
+static const uint32_t stageEnterMs[] = { 0, UPLINK_COALESCE_AT_MS, UPLINK_COMPRESS_AT_MS,
+                                         UPLINK_DROP_SILENT_AT_MS, UPLINK_DROP_OLDEST_AT_MS };
+
+// Stats
+static uint32_t statQueuePeak = 0;
+static uint32_t statFramesSent = 0;
+static uint32_t statWrites = 0;
+static uint32_t statTextsSent = 0;
+static uint32_t statCtrlWaitUsLast = 0;
+static uint32_t statCtrlWaitUsMax = 0;
+static uint32_t statTelemSent = 0;
+static uint32_t statTelemDropped = 0;
+static uint64_t statBytesSent = 0;
+static uint32_t statPoolExhausted = 0;
+static uint32_t statDropped = 0;
+static uint32_t statSendUsLast = 0;
+static uint32_t statSendUsMax = 0;
+static uint8_t  statStagePeak = 0;
+static uint32_t statStageChanges = 0;
+static uint32_t statPressureWrites = 0;
+static uint32_t statCompressed = 0;
+static uint64_t statBytesSaved = 0;
+static uint32_t statSilentDropped = 0;
+static uint32_t statOldestDropped = 0;
+
+static inline size_t frameBytes(const UplinkFrame* f) {
+    return AUDIO_FRAME_HEADER_SIZE + f->payloadLen;
+}
+
+// G.711 mu-law
+static uint8_t linearToUlaw(int16_t pcm) {
+    const int BIAS = 0x84;
+    const int CLIP = 32635;
+    const int sign = (pcm >> 8) & 0x80;
+    int v = sign ? -(int)pcm : pcm;
+    if (v > CLIP) v = CLIP;
+    v += BIAS;
+    int exponent = 7;
+    for (int mask = 0x4000; (v & mask) == 0 && exponent > 0; mask >>= 1) exponent--;
+    const int mantissa = (v >> (exponent + 3)) & 0x0F;
+    return (uint8_t)~(sign | (exponent << 4) | mantissa);
+}
+
+static inline bool compressible(const UplinkFrame* f) {
+    return reinterpret_cast<const AudioFrameHeader*>(f->data)->codec == AUDIO_CODEC_PCM16;
+}
+
+// Bytes the frame takes in the write buffer at the current stage
+static inline size_t wireBytes(const UplinkFrame* f, bool compress) {
+    return compress && compressible(f) ? AUDIO_FRAME_HEADER_SIZE + f->payloadLen / 2 : frameBytes(f);
+}
+
+// Copies the frame into 'dst', mu-law encoded when 'compress'; returns the bytes written
+static size_t putFrame(uint8_t* dst, const UplinkFrame* f, bool compress) {
+    if (!compress || !compressible(f)) {
+        memcpy(dst, f->data, frameBytes(f));
+        return frameBytes(f);
+    }
+    AudioFrameHeader h;
+    memcpy(&h, f->data, sizeof(h));
+    const size_t samples = f->payloadLen / 2;
+    h.codec = AUDIO_CODEC_ULAW;
+    h.payload_len = samples;
+    memcpy(dst, &h, sizeof(h));
+
+    const int16_t* pcm = reinterpret_cast<const int16_t*>(f->data + AUDIO_FRAME_HEADER_SIZE);
+    uint8_t* out = dst + AUDIO_FRAME_HEADER_SIZE;
+    for (size_t i = 0; i < samples; ++i) out[i] = linearToUlaw(pcm[i]);
+
+    statCompressed++;
+    statBytesSaved += f->payloadLen - samples;
+    return AUDIO_FRAME_HEADER_SIZE + samples;
+}
+
+static inline uint32_t backlogMs() {
+    return audioQueue ? uxQueueMessagesWaiting(audioQueue) * UPLINK_FRAME_MS : 0;
+}
+
+// Steps up as soon as the backlog crosses a threshold, down one stage at a time
+// once it stayed under half the current threshold for UPLINK_STAGE_HOLD_MS
+static void updateStage() {
+    const uint32_t backlog = backlogMs();
+    const uint32_t now = millis();
+
+    portENTER_CRITICAL(&stageMux);
+    uint8_t next = stage;
+    while (next < UPLINK_STAGE_MAX && backlog >= stageEnterMs[next + 1]) next++;
+    if (next == stage && stage > UPLINK_STAGE_NORMAL) {
+        if (backlog >= stageEnterMs[stage] / 2) stageChangedMs = now;      // Still under pressure
+        else if (now - stageChangedMs >= UPLINK_STAGE_HOLD_MS) next = stage - 1;
+    }
+    const bool changed = next != stage;
+    if (changed) {
+        stage = next;
+        stageChangedMs = now;
+        statStageChanges++;
+        if (next > statStagePeak) statStagePeak = next;
+    }
+    portEXIT_CRITICAL(&stageMux);
+
+    if (changed) Serial.printf("[Uplink] Backlog %u ms, stage %u\n", backlog, next);
+}
+
+// Drops the oldest queued frame to make room; false when nothing is queued
+static bool dropOldest() {
+    UplinkFrame* oldest;
+    if (xQueueReceive(audioQueue, &oldest, 0) != pdTRUE) return false;
+    statOldestDropped++;
+    xQueueSend(freeQueue, &oldest, 0);
+    return true;
+}
+
+static inline void wakeSender() {
+    if (senderTask) xTaskNotifyGive(senderTask);
+}
+
+static void writeBinary(size_t len, uint32_t frames) {
+    const int64_t t0 = esp_timer_get_time();
+    AudioUplink_Lock();
+    bool ok = client_ptr->available() && client_ptr->sendBinary(reinterpret_cast<const char*>(writeBuf), len);
+    AudioUplink_Unlock();
+    const uint32_t dt = (uint32_t)(esp_timer_get_time() - t0);
+
+    statSendUsLast = dt;
+    if (dt > statSendUsMax) statSendUsMax = dt;
+    if (ok) {
+        statFramesSent += frames;
+        statWrites++;
+        statBytesSent += len;
+    } else {
+        statDropped += frames;
+    }
+}
+
+static bool writeText(const UplinkText& item) {
+    AudioUplink_Lock();
+    bool ok = client_ptr->available() && client_ptr->send(item.text);
+    AudioUplink_Unlock();
+    if (ok) statBytesSent += strlen(item.text);
+    return ok;
+}
+
+// Sends one control message if any is waiting
+static bool sendControl() {
+    UplinkText item;
+    if (xQueueReceive(ctrlQueue, &item, 0) != pdTRUE) return false;
+
+    if (writeText(item)) {
+        statTextsSent++;
+        const uint32_t waited = (uint32_t)(esp_timer_get_time() - item.queuedUs);
+        statCtrlWaitUsLast = waited;
+        if (waited > statCtrlWaitUsMax) statCtrlWaitUsMax = waited;
+    } else {
+        Serial.printf("[Uplink] Dropped control message, not connected: %s\n", item.text);
+    }
+    free(item.text);
+    return true;
+}
+
+// One round robin turn of the audio channel: coalesce what is queued, within the deficit
+static void sendAudio() {
+    if (!uxQueueMessagesWaiting(audioQueue)) {
+        audioDeficit = 0;       // Idle channels do not bank credit
+        return;
+    }
+    updateStage();
+    const uint8_t st = stage;
+    const bool compress = st >= UPLINK_STAGE_COMPRESS;
+    const size_t limit = st >= UPLINK_STAGE_COALESCE ? UPLINK_COALESCE_PRESSURE_BYTES : UPLINK_COALESCE_MAX_BYTES;
+    audioDeficit += max((size_t)UPLINK_AUDIO_QUANTUM, limit);
+
+    const size_t budget = min((size_t)audioDeficit, limit);
+    size_t len = 0;
+    uint32_t frames = 0;
+    // Never wait for more frames, only take the ones already waiting. The capture task
+    // may drop the oldest frame concurrently, so take first and put back what does not fit.
+    UplinkFrame* frame;
+    while (xQueueReceive(audioQueue, &frame, 0) == pdTRUE) {
+        if (len + wireBytes(frame, compress) > budget) {
+            xQueueSendToFront(audioQueue, &frame, 0);
+            break;
+        }
+        len += putFrame(writeBuf + len, frame, compress);
+        frames++;
+        xQueueSend(freeQueue, &frame, 0);
+    }
+    if (!frames) return;
+
+    audioDeficit -= len;
+    if (len > UPLINK_COALESCE_MAX_BYTES) statPressureWrites++;
+    writeBinary(len, frames);
+}
+
+// One round robin turn of the telemetry channel
+static void sendTelemetry() {
+    UplinkText item;
+    if (xQueuePeek(telemQueue, &item, 0) != pdTRUE) {
+        telemDeficit = 0;
+        return;
+    }
+    telemDeficit += UPLINK_TELEMETRY_QUANTUM;
+
+    while (xQueuePeek(telemQueue, &item, 0) == pdTRUE && (int32_t)strlen(item.text) <= telemDeficit) {
+        xQueueReceive(telemQueue, &item, 0);
+        telemDeficit -= strlen(item.text);
+        if (writeText(item)) statTelemSent++;
+        else statTelemDropped++;
+        free(item.text);
+        if (uxQueueMessagesWaiting(ctrlQueue)) return;
+    }
+}
+
+static void AudioUplinkTask(void*) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Drain all channels before sleeping again; control is looked at before every write
+        while (true) {
+            if (sendControl()) continue;
+            if (!uxQueueMessagesWaiting(audioQueue) && !uxQueueMessagesWaiting(telemQueue)) break;
+
+            sendAudio();
+            if (uxQueueMessagesWaiting(ctrlQueue)) continue;
+            sendTelemetry();
+        }
+    }
+}
+
+void AudioUplink_Init(WebsocketsClient& client) {
+    client_ptr = &client;
+    wsMutex = xSemaphoreCreateMutex();
+    freeQueue = xQueueCreate(UPLINK_POOL_FRAMES, sizeof(UplinkFrame*));
+    audioQueue = xQueueCreate(UPLINK_POOL_FRAMES, sizeof(UplinkFrame*));
+    ctrlQueue = xQueueCreate(UPLINK_CONTROL_QUEUE, sizeof(UplinkText));
+    telemQueue = xQueueCreate(UPLINK_TELEMETRY_QUEUE, sizeof(UplinkText));
+    writeBuf = (uint8_t*)heap_caps_malloc(UPLINK_COALESCE_PRESSURE_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    UplinkFrame* pool = (UplinkFrame*)heap_caps_malloc(UPLINK_POOL_FRAMES * sizeof(UplinkFrame), MALLOC_CAP_SPIRAM);
+    if (!pool || !writeBuf) {
+        Serial.println("[Uplink] Failed to allocate frame pool, audio uplink disabled");
+        return;
+    }
+    for (int i = 0; i < UPLINK_POOL_FRAMES; ++i) {
+        UplinkFrame* f = &pool[i];
+        xQueueSend(freeQueue, &f, 0);
+    }
+
+    xTaskCreatePinnedToCore(AudioUplinkTask, "AudioUplinkTask", 4096, nullptr, 3, &senderTask, 1);
+    Serial.printf("[Uplink] Sender started, pool %d x %u bytes\n", UPLINK_POOL_FRAMES, (unsigned)sizeof(UplinkFrame));
+}
+
+UplinkFrame* AudioUplink_AcquireFrame() {
+    UplinkFrame* f = nullptr;
+    if (!freeQueue) return nullptr;
+    if (xQueueReceive(freeQueue, &f, 0) != pdTRUE) {
+        // Last stage: the newest audio matters more than the oldest
+        if (UPLINK_STAGE_MAX < UPLINK_STAGE_DROP_OLDEST || !dropOldest() || xQueueReceive(freeQueue, &f, 0) != pdTRUE) {
+            statPoolExhausted++;
+            return nullptr;
+        }
+    }
+    f->payloadLen = 0;
+    f->silent = false;
+    return f;
+}
+
+bool AudioUplink_SubmitFrame(UplinkFrame* frame) {
+    if (!frame) return false;
+    frame->payloadLen = reinterpret_cast<AudioFrameHeader*>(frame->data)->payload_len;
+
+    updateStage();
+    if (stage >= UPLINK_STAGE_DROP_SILENT && frame->silent) {
+        // The backend sees the skipped sequence number as a gap
+        statSilentDropped++;
+        AudioUplink_ReleaseFrame(frame);
+        return false;
+    }
+    if (stage >= UPLINK_STAGE_DROP_OLDEST) {
+        while (backlogMs() >= UPLINK_DROP_OLDEST_AT_MS && dropOldest()) {}
+    }
+
+    if (xQueueSend(audioQueue, &frame, 0) != pdTRUE) {
+        statDropped++;
+        AudioUplink_ReleaseFrame(frame);
+        return false;
+    }
+    uint32_t depth = uxQueueMessagesWaiting(audioQueue);
+    if (depth > statQueuePeak) statQueuePeak = depth;
+    wakeSender();
+    return true;
+}
+
+void AudioUplink_ReleaseFrame(UplinkFrame* frame) {
+    if (frame && freeQueue) xQueueSend(freeQueue, &frame, 0);
+}
+
+bool AudioUplink_SendText(const char* text) {
+    if (!ctrlQueue || !text) return false;
+    UplinkText item = { strdup(text), esp_timer_get_time() };
+    if (!item.text) return false;
+    // Control messages are rare and must not be lost, allow a short wait
+    if (xQueueSend(ctrlQueue, &item, pdMS_TO_TICKS(100)) != pdTRUE) {
+        Serial.printf("[Uplink] Control queue full, dropped: %s\n", text);
+        free(item.text);
+        return false;
+    }
+    wakeSender();
+    return true;
+}
+
+bool AudioUplink_SendTelemetry(const char* text) {
+    if (!telemQueue || !text) return false;
+    UplinkText item = { strdup(text), esp_timer_get_time() };
+    if (!item.text) return false;
+    if (xQueueSend(telemQueue, &item, 0) != pdTRUE) {
+        statTelemDropped++;
+        free(item.text);
+        return false;
+    }
+    wakeSender();
+    return true;
+}
+
+void AudioUplink_Lock() {
+    if (wsMutex) xSemaphoreTake(wsMutex, portMAX_DELAY);
+}
+
+void AudioUplink_Unlock() {
+    if (wsMutex) xSemaphoreGive(wsMutex);
+}
+
+void AudioUplink_GetStats(AudioUplinkStats* out, bool reset) {
+    if (!out) return;
+    out->queue_depth = audioQueue ? uxQueueMessagesWaiting(audioQueue) : 0;
+    out->queue_peak = statQueuePeak;
+    out->pool_free = freeQueue ? uxQueueMessagesWaiting(freeQueue) : 0;
+    out->frames_sent = statFramesSent;
+    out->writes = statWrites;
+    out->texts_sent = statTextsSent;
+    out->control_wait_us_last = statCtrlWaitUsLast;
+    out->control_wait_us_max = statCtrlWaitUsMax;
+    out->telemetry_sent = statTelemSent;
+    out->telemetry_dropped = statTelemDropped;
+    out->bytes_sent = statBytesSent;
+    out->pool_exhausted = statPoolExhausted;
+    out->dropped = statDropped;
+    out->send_us_last = statSendUsLast;
+    out->send_us_max = statSendUsMax;
+    out->stage = stage;
+    out->stage_peak = statStagePeak;
+    out->stage_changes = statStageChanges;
+    out->backlog_ms = backlogMs();
+    out->pressure_writes = statPressureWrites;
+    out->frames_compressed = statCompressed;
+    out->bytes_saved = statBytesSaved;
+    out->silent_dropped = statSilentDropped;
+    out->oldest_dropped = statOldestDropped;
+
+    if (reset) {
+        statQueuePeak = 0;
+        statSendUsMax = 0;
+        statCtrlWaitUsMax = 0;
+        statStagePeak = stage;
+    }
+}
+
+void AudioUplink_PrintStats() {
+    AudioUplinkStats s;
+    AudioUplink_GetStats(&s, true);
+    Serial.printf("[Uplink] queue=%u peak=%u pool_free=%u frames=%u writes=%u (%.2f frames/write) control=%u wait_us last=%u max=%u telemetry=%u dropped=%u bytes=%llu pool_exhausted=%u dropped=%u send_us last=%u max=%u\n",
+                  s.queue_depth, s.queue_peak, s.pool_free, s.frames_sent, s.writes,
+                  s.writes ? (float)s.frames_sent / s.writes : 0.0f, s.texts_sent,
+                  s.control_wait_us_last, s.control_wait_us_max, s.telemetry_sent, s.telemetry_dropped,
+                  s.bytes_sent, s.pool_exhausted, s.dropped, s.send_us_last, s.send_us_max);
+    Serial.printf("[Uplink] stage=%u peak=%u changes=%u backlog=%u ms pressure_writes=%u compressed=%u (saved %llu bytes) silent_dropped=%u oldest_dropped=%u\n",
+                  s.stage, s.stage_peak, s.stage_changes, s.backlog_ms, s.pressure_writes,
+                  s.frames_compressed, s.bytes_saved, s.silent_dropped, s.oldest_dropped);
+}
@@ -0,0 +1,136 @@
+#ifndef AUDIO_UPLINK_H
+#define AUDIO_UPLINK_H
+
+#include <Arduino.h>
+#include <ArduinoWebsockets.h>
+#include "AudioFrame.h"
+
+/*
+  WebSocket uplink sender
+
+  A dedicated task owns the write side of the assistant WebSocket. Producers
+  never touch the socket, they hand their message to one of the logical
+  channels (see WsChannel in AudioFrame.h):
+    - Control (HELLO, START_STREAM, STOP_STREAM, ...): JSON text, strict
+      priority. The sender checks for control between every write, so a
+      STOP_STREAM waits for at most one write in flight, not for the audio
+      backlog in front of it.
+    - Audio: take a buffer from a fixed pool, fill the payload in place,
+      submit it. Neither call blocks; if the pool is empty the block is
+      dropped and counted.
+    - Telemetry: periodic stats text, dropped when its queue is full.
+
+  Audio and telemetry share what control leaves by deficit round robin: each
+  round a channel with data earns its byte quantum and sends while its
+  deficit covers the next message, so neither bulk channel can starve the
+  other. Since control can overtake the last frames of a stream, the backend
+  finishes a stream once STOP_STREAM's frame count has arrived.
+
+  The sender coalesces audio frames that are already queued (up to the
+  channel's deficit and UPLINK_COALESCE_MAX_BYTES) into one binary message,
+  i.e. one TCP write. It never waits for more frames, so a fast link still
+  gets one write per frame and a slow one automatically batches. Buffers go
+  back to the pool right after the copy into the write buffer.
+
+  Backpressure: when Wi-Fi is slow the writes block and frames pile up in
+  the audio queue. lwIP does not report its send buffer occupancy through
+  the socket API, so the queued audio (in ms) is the pressure signal; it
+  only grows while the socket buffer is full. The policy degrades in
+  stages as the backlog crosses each threshold:
+    1. Coalesce: writes up to UPLINK_COALESCE_PRESSURE_BYTES
+    2. Compress: frames go out as G.711 mu-law (AUDIO_CODEC_ULAW), half the bytes
+    3. Drop silent: frames the capture VAD marked as silence are not sent
+    4. Drop oldest: the oldest queued frame makes room, so the backlog and
+       the pool stay bounded and capture always gets a buffer
+  A stage is left again after the backlog stayed below half its threshold
+  for UPLINK_STAGE_HOLD_MS. Every decision is counted in AudioUplinkStats.
+
+  All other socket users (poll, connect, ping) take AudioUplink_Lock().
+*/
+
+#define UPLINK_FRAME_MS            20      // Frame duration produced by the capture task
+#define UPLINK_FRAME_MAX_MS        40      // Pool buffer capacity
+#define UPLINK_FRAME_MAX_BYTES     (16000 * 2 * UPLINK_FRAME_MAX_MS / 1000)   // 16 kHz mono PCM16
+#define UPLINK_POOL_FRAMES         32      // ~640 ms of 20 ms frames in flight
+#define UPLINK_COALESCE_MAX_BYTES  4096    // Largest single binary write
+#define UPLINK_CONTROL_QUEUE       8
+#define UPLINK_TELEMETRY_QUEUE     4
+#define UPLINK_AUDIO_QUANTUM       4096    // Bytes per round robin turn
+#define UPLINK_TELEMETRY_QUANTUM   512
+
+// Degradation policy (backlog = queued audio)
+#define UPLINK_STAGE_MAX                 UPLINK_STAGE_DROP_OLDEST   // Highest stage the policy may use
+#define UPLINK_COALESCE_AT_MS            100
+#define UPLINK_COMPRESS_AT_MS            200
+#define UPLINK_DROP_SILENT_AT_MS         300
+#define UPLINK_DROP_OLDEST_AT_MS         400     // Also the backlog kept in the last stage
+#define UPLINK_STAGE_HOLD_MS             1000    // Minimum time before stepping back down
+#define UPLINK_COALESCE_PRESSURE_BYTES   8192
+#define UPLINK_VAD_NOISE_RATIO           3.0f    // Capture: silent when block RMS < noise floor * ratio
+
+enum UplinkStage : uint8_t {
+    UPLINK_STAGE_NORMAL = 0,
+    UPLINK_STAGE_COALESCE,
+    UPLINK_STAGE_COMPRESS,
+    UPLINK_STAGE_DROP_SILENT,
+    UPLINK_STAGE_DROP_OLDEST,
+};
+
+struct UplinkFrame {
+    uint16_t payloadLen;
+    bool     silent;            // Set by the capture VAD, droppable under pressure
+    uint8_t  data[AUDIO_FRAME_HEADER_SIZE + UPLINK_FRAME_MAX_BYTES] __attribute__((aligned(4)));
+};
+
+struct AudioUplinkStats {
+    uint32_t queue_depth;       // Audio frames waiting for the sender now
+    uint32_t queue_peak;        // Highest depth since last reset
+    uint32_t pool_free;         // Frame buffers available
+    uint32_t frames_sent;
+    uint32_t writes;            // Binary messages written (frames_sent / writes = coalescing factor)
+    uint32_t texts_sent;        // Control messages
+    uint32_t control_wait_us_last;  // Control queued -> written
+    uint32_t control_wait_us_max;
+    uint32_t telemetry_sent;
+    uint32_t telemetry_dropped;
+    uint64_t bytes_sent;
+    uint32_t pool_exhausted;    // Acquire failed, block dropped at capture
+    uint32_t dropped;           // Submitted but not sent (queue full / disconnected)
+    uint32_t send_us_last;
+    uint32_t send_us_max;
+
+    // Backpressure policy
+    uint8_t  stage;             // UplinkStage now
+    uint8_t  stage_peak;        // Since last reset
+    uint32_t stage_changes;
+    uint32_t backlog_ms;        // Queued audio now
+    uint32_t pressure_writes;   // Writes larger than UPLINK_COALESCE_MAX_BYTES
+    uint32_t frames_compressed;
+    uint64_t bytes_saved;       // By compression
+    uint32_t silent_dropped;
+    uint32_t oldest_dropped;
+};
+
+void AudioUplink_Init(websockets::WebsocketsClient& client);
+
+// Audio producers (never block)
+UplinkFrame* AudioUplink_AcquireFrame();
+static inline int16_t* AudioUplink_Samples(UplinkFrame* f) {
+    return reinterpret_cast<int16_t*>(f->data + AUDIO_FRAME_HEADER_SIZE);
+}
+bool AudioUplink_SubmitFrame(UplinkFrame* frame);   // Takes ownership, header and 'silent' must be filled
+void AudioUplink_ReleaseFrame(UplinkFrame* frame);  // Give back an unsent buffer
+
+// Control message, sent ahead of queued audio and telemetry
+bool AudioUplink_SendText(const char* text);
+// Telemetry message, lowest share of the link; never blocks
+bool AudioUplink_SendTelemetry(const char* text);
+
+// Serialize other users of the socket with the sender
+void AudioUplink_Lock();
+void AudioUplink_Unlock();
+
+void AudioUplink_GetStats(AudioUplinkStats* out, bool reset = false);
+void AudioUplink_PrintStats();
+
+#endif
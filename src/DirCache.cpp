@@ -0,0 +1,370 @@
+// DirCache.cpp - PSRAM snapshots of SD directories, dropped by the write paths
+#include "DirCache.h"
+#include <algorithm>
+#include <SD_MMC.h>
+#include "Metrics.h"
+#include "esp_heap_caps.h"
+
+struct DirItem {
+    uint32_t nameOff;           // Into DirSnapshot::names
+    uint32_t size;
+    bool     isDir;
+};
+
+struct DirSnapshot {
+    char     path[DIRCACHE_PATH_MAX];   // Normalized, no trailing '/' except for the root
+    uint32_t refs;              // Cache slot counts as one while cached
+    uint32_t lastUse;
+    uint32_t count;
+    DirItem* items;             // Dirs first, then A-Z (PSRAM)
+    char*    names;             // NUL-terminated names back to back (PSRAM)
+    uint32_t bytes;
+};
+
+#define TOO_BIG_MEMO 4              // Directories known to exceed DIRCACHE_MAX_ENTRIES
+#define MISSING_MEMO 4              // Paths known not to be directories (e.g. no /html on the card)
+
+static DirSnapshot* slots[DIRCACHE_MAX_DIRS] = {};
+static char tooBig[TOO_BIG_MEMO][DIRCACHE_PATH_MAX] = {};     // Not rescanned until invalidated
+static uint8_t tooBigNext = 0;
+static char missing[MISSING_MEMO][DIRCACHE_PATH_MAX] = {};    // Valid while the generation is unchanged
+static uint32_t missingGen[MISSING_MEMO] = {};
+static uint8_t missingNext = 0;
+static SemaphoreHandle_t cacheMutex = nullptr;
+static Metric* mScans = nullptr;
+static uint32_t useClock = 0;
+static uint32_t generation = 0;     // Bumped by every invalidation, scans started before do not get cached
+
+static DirCacheStats stats = {};
+
+static void normalize(const char* in, char* out, size_t outLen) {
+    if (!in || !*in) in = "/";
+    if (in[0] != '/') {
+        out[0] = '/';
+        strlcpy(out + 1, in, outLen - 1);
+    } else {
+        strlcpy(out, in, outLen);
+    }
+    size_t n = strlen(out);
+    while (n > 1 && out[n - 1] == '/') out[--n] = '\0';
+}
+
+static void freeSnapshot(DirSnapshot* s) {
+    free(s->items);
+    free(s->names);
+    free(s);
+}
+
+// Caller holds cacheMutex
+static void unref(DirSnapshot* s) {
+    if (--s->refs == 0) freeSnapshot(s);
+}
+
+// Caller holds cacheMutex
+static void dropSlot(int i) {
+    DirSnapshot* s = slots[i];
+    slots[i] = nullptr;
+    stats.dirs--;
+    stats.entries -= s->count;
+    stats.bytes -= s->bytes;
+    unref(s);
+}
+
+static bool itemLess(const char* names, const DirItem& a, const DirItem& b) {
+    if (a.isDir != b.isDir) return a.isDir;
+    return strcmp(names + a.nameOff, names + b.nameOff) < 0;
+}
+
+// Walks the card; nullptr if not a directory ('absent' set) or too big ('big' set)
+static DirSnapshot* scan(const char* path, bool* big, bool* absent) {
+    *big = false;
+    *absent = false;
+    File root = SD_MMC.open(path);
+    if (!root || !root.isDirectory()) {
+        *absent = true;
+        return nullptr;
+    }
+
+    DirSnapshot* s = (DirSnapshot*)calloc(1, sizeof(DirSnapshot));
+    if (!s) {
+        root.close();
+        return nullptr;
+    }
+    strlcpy(s->path, path, sizeof(s->path));
+
+    uint32_t itemCap = 64, nameCap = 2048, nameLen = 0;
+    s->items = (DirItem*)heap_caps_malloc(itemCap * sizeof(DirItem), MALLOC_CAP_SPIRAM);
+    s->names = (char*)heap_caps_malloc(nameCap, MALLOC_CAP_SPIRAM);
+    bool ok = s->items && s->names;
+
+    while (ok) {
+        File entry = root.openNextFile();
+        if (!entry) break;
+        if (s->count >= DIRCACHE_MAX_ENTRIES) {
+            ok = false;
+            *big = true;
+            break;
+        }
+
+        const char* base = strrchr(entry.name(), '/');
+        base = base ? base + 1 : entry.name();
+        const uint32_t len = strlen(base) + 1;
+
+        if (s->count == itemCap) {
+            itemCap *= 2;
+            DirItem* grown = (DirItem*)heap_caps_realloc(s->items, itemCap * sizeof(DirItem), MALLOC_CAP_SPIRAM);
+            if (!grown) ok = false;
+            else s->items = grown;
+        }
+        if (ok && nameLen + len > nameCap) {
+            while (nameLen + len > nameCap) nameCap *= 2;
+            char* grown = (char*)heap_caps_realloc(s->names, nameCap, MALLOC_CAP_SPIRAM);
+            if (!grown) ok = false;
+            else s->names = grown;
+        }
+        if (ok) {
+            memcpy(s->names + nameLen, base, len);
+            DirItem& it = s->items[s->count++];
+            it.nameOff = nameLen;
+            it.isDir = entry.isDirectory();
+            it.size = it.isDir ? 0 : entry.size();
+            nameLen += len;
+        }
+        entry.close();
+    }
+    root.close();
+
+    if (!ok) {
+        freeSnapshot(s);
+        return nullptr;
+    }
+
+    const char* names = s->names;
+    std::sort(s->items, s->items + s->count, [names](const DirItem& a, const DirItem& b) { return itemLess(names, a, b); });
+    s->bytes = sizeof(DirSnapshot) + itemCap * sizeof(DirItem) + nameCap;
+    return s;
+}
+
+void DirCache_Init() {
+    if (!cacheMutex) cacheMutex = xSemaphoreCreateMutex();
+    mScans = Metrics_Counter("sd_dir_scans_total", "Directories read from the card (directory cache misses)");
+}
+
+// DirCache_Acquire(); 'absent' tells a path that is not a directory from an uncacheable one
+static const DirSnapshot* acquire(const char* dir, bool* absent) {
+    *absent = false;
+    if (!cacheMutex) return nullptr;
+    char path[DIRCACHE_PATH_MAX];
+    normalize(dir, path, sizeof(path));
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    for (int i = 0; i < DIRCACHE_MAX_DIRS; ++i) {
+        if (slots[i] && strcmp(slots[i]->path, path) == 0) {
+            DirSnapshot* s = slots[i];
+            s->refs++;
+            s->lastUse = ++useClock;
+            stats.hits++;
+            xSemaphoreGive(cacheMutex);
+            return s;
+        }
+    }
+    for (int i = 0; i < TOO_BIG_MEMO; ++i) {
+        if (strcmp(tooBig[i], path) == 0) {
+            xSemaphoreGive(cacheMutex);
+            return nullptr;
+        }
+    }
+    // Any invalidation may have created it, so a missing directory is only trusted until the next one
+    for (int i = 0; i < MISSING_MEMO; ++i) {
+        if (missingGen[i] == generation && strcmp(missing[i], path) == 0) {
+            stats.hits++;
+            xSemaphoreGive(cacheMutex);
+            *absent = true;
+            return nullptr;
+        }
+    }
+    stats.misses++;
+    const uint32_t gen = generation;
+    xSemaphoreGive(cacheMutex);
+
+    // Scan without the lock, other directories stay readable meanwhile
+    const uint32_t startMs = millis();
+    bool big;
+    DirSnapshot* s = scan(path, &big, absent);
+    if (!s) {
+        if (big) {
+            xSemaphoreTake(cacheMutex, portMAX_DELAY);
+            stats.uncacheable++;
+            strlcpy(tooBig[tooBigNext], path, DIRCACHE_PATH_MAX);
+            tooBigNext = (tooBigNext + 1) % TOO_BIG_MEMO;
+            xSemaphoreGive(cacheMutex);
+        } else if (*absent) {
+            xSemaphoreTake(cacheMutex, portMAX_DELAY);
+            if (gen == generation) {
+                strlcpy(missing[missingNext], path, DIRCACHE_PATH_MAX);
+                missingGen[missingNext] = gen;
+                missingNext = (missingNext + 1) % MISSING_MEMO;
+            }
+            xSemaphoreGive(cacheMutex);
+        }
+        return nullptr;
+    }
+    const uint32_t ms = millis() - startMs;
+    Metrics_Add(mScans);
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    stats.scan_ms_last = ms;
+    if (ms > stats.scan_ms_max) stats.scan_ms_max = ms;
+    s->refs = 1;                        // The caller
+    s->lastUse = ++useClock;
+
+    // Someone else scanned the same directory meanwhile: use theirs
+    for (int i = 0; i < DIRCACHE_MAX_DIRS; ++i) {
+        if (slots[i] && strcmp(slots[i]->path, path) == 0) {
+            freeSnapshot(s);
+            s = slots[i];
+            s->refs++;
+            xSemaphoreGive(cacheMutex);
+            return s;
+        }
+    }
+
+    // Only cache what no write path can have changed during the scan
+    if (gen == generation) {
+        int slot = -1;
+        for (int i = 0; i < DIRCACHE_MAX_DIRS && slot < 0; ++i) {
+            if (!slots[i]) slot = i;
+        }
+        if (slot < 0) {
+            slot = 0;
+            for (int i = 1; i < DIRCACHE_MAX_DIRS; ++i) {
+                if (slots[i]->lastUse < slots[slot]->lastUse) slot = i;
+            }
+            dropSlot(slot);
+            stats.evictions++;
+        }
+        slots[slot] = s;
+        s->refs++;                      // The slot
+        stats.dirs++;
+        stats.entries += s->count;
+        stats.bytes += s->bytes;
+    }
+    xSemaphoreGive(cacheMutex);
+    return s;
+}
+
+const DirSnapshot* DirCache_Acquire(const char* dir) {
+    bool absent;
+    return acquire(dir, &absent);
+}
+
+void DirCache_Release(const DirSnapshot* snap) {
+    if (!snap) return;
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    unref(const_cast<DirSnapshot*>(snap));
+    xSemaphoreGive(cacheMutex);
+}
+
+size_t DirCache_Count(const DirSnapshot* snap) {
+    return snap ? snap->count : 0;
+}
+
+DirCacheEntry DirCache_At(const DirSnapshot* snap, size_t index) {
+    const DirItem& it = snap->items[index];
+    return { snap->names + it.nameOff, it.size, it.isDir };
+}
+
+size_t DirCache_UpperBound(const DirSnapshot* snap, const char* name, bool isDir) {
+    size_t lo = 0, hi = snap->count;
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const DirItem& it = snap->items[mid];
+        // Is the item at 'mid' ordered after (isDir, name)?
+        const bool after = it.isDir != isDir ? isDir : strcmp(snap->names + it.nameOff, name) > 0;
+        if (after) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+static bool findIn(const DirSnapshot* snap, const char* name, bool isDir, DirCacheEntry* out) {
+    const size_t i = DirCache_UpperBound(snap, name, isDir);
+    if (i == 0) return false;
+    const DirItem& it = snap->items[i - 1];
+    if (it.isDir != isDir || strcmp(snap->names + it.nameOff, name) != 0) return false;
+    if (out) *out = { nullptr, it.size, it.isDir };
+    return true;
+}
+
+bool DirCache_Lookup(const char* dir, const char* name, DirCacheEntry* out) {
+    bool absent;
+    const DirSnapshot* snap = acquire(dir, &absent);
+    if (snap) {
+        const bool found = findIn(snap, name, false, out) || findIn(snap, name, true, out);
+        DirCache_Release(snap);
+        return found;
+    }
+    if (absent) return false;
+
+    // Uncacheable directory
+    String path = String(dir);
+    if (!path.endsWith("/")) path += "/";
+    File f = SD_MMC.open((path + name).c_str());
+    if (!f) return false;
+    if (out) *out = { nullptr, f.isDirectory() ? 0 : (uint32_t)f.size(), f.isDirectory() };
+    f.close();
+    return true;
+}
+
+void DirCache_Invalidate(const char* path, bool tree) {
+    if (!cacheMutex || !path) return;
+    char p[DIRCACHE_PATH_MAX];
+    normalize(path, p, sizeof(p));
+
+    // Directory holding 'path'
+    char parent[DIRCACHE_PATH_MAX];
+    strlcpy(parent, p, sizeof(parent));
+    char* slash = strrchr(parent, '/');
+    if (slash == parent) parent[1] = '\0';
+    else if (slash) *slash = '\0';
+    const size_t plen = strlen(p);
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    generation++;
+    for (int i = 0; i < TOO_BIG_MEMO; ++i) {
+        if (strcmp(tooBig[i], parent) == 0 || (tree && strncmp(tooBig[i], p, plen) == 0)) tooBig[i][0] = '\0';
+    }
+    for (int i = 0; i < DIRCACHE_MAX_DIRS; ++i) {
+        if (!slots[i]) continue;
+        const char* sp = slots[i]->path;
+        bool drop = strcmp(sp, parent) == 0;
+        if (tree && !drop) {
+            drop = strncmp(sp, p, plen) == 0 && (sp[plen] == '\0' || sp[plen] == '/' || plen == 1);
+        }
+        if (drop) {
+            dropSlot(i);
+            stats.invalidations++;
+        }
+    }
+    xSemaphoreGive(cacheMutex);
+}
+
+uint32_t DirCache_Generation() {
+    return generation;
+}
+
+void DirCache_GetStats(DirCacheStats* out) {
+    if (!out) return;
+    if (cacheMutex) xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    *out = stats;
+    if (cacheMutex) xSemaphoreGive(cacheMutex);
+}
+
+void DirCache_PrintStats() {
+    DirCacheStats st;
+    DirCache_GetStats(&st);
+    const uint32_t lookups = st.hits + st.misses;
+    Serial.printf("[DirCache] %u dirs, %u entries, %u KB PSRAM; hits %u, misses %u (%.1f %% hit), invalidated %u, evicted %u, uncacheable %u, scan last %u ms, max %u ms\n",
+                  st.dirs, st.entries, st.bytes / 1024, st.hits, st.misses, lookups ? st.hits * 100.0f / lookups : 0.0f,
+                  st.invalidations, st.evictions, st.uncacheable, st.scan_ms_last, st.scan_ms_max);
+}
@@ -0,0 +1,80 @@
+#ifndef DIR_CACHE_H
+#define DIR_CACHE_H
+
+#include <Arduino.h>
+
+/*
+  Directory metadata cache in PSRAM
+
+  The first listing of a directory walks it on the SD card once and keeps
+  every entry's name, size and type in PSRAM, sorted directories first then
+  A-Z. Later listings (/listfiles, the MP3 player list, File_Search) read the
+  snapshot instead of opening a File per entry, and name lookups are a
+  binary search.
+
+  Nothing expires by time: the code paths that change the card (web upload,
+  delete, move, mkdir, rmdir, recordings, the TTS cache and request spool)
+  call DirCache_Invalidate() with the path they touched, which drops exactly
+  the directory holding it (and, for directory moves and removals, the
+  subtree). Changes made behind the firmware's back, e.g. with the card in a
+  PC, need a reboot.
+
+  Readers hold a reference-counted snapshot, so a listing streamed to a slow
+  client never blocks the cache; a snapshot invalidated while held is freed
+  by its last reader. Directories with more than DIRCACHE_MAX_ENTRIES entries
+  are not cached and callers fall back to walking the card. A directory
+  that does not exist (the web UI's /html on a card without one) is
+  remembered too, until the next invalidation anywhere, so lookups in it
+  do not touch the card.
+*/
+
+#define DIRCACHE_MAX_DIRS     16      // Cached directories, least recently used dropped first
+#define DIRCACHE_MAX_ENTRIES  4096    // Bigger directories are always read from the card
+#define DIRCACHE_PATH_MAX     128
+
+struct DirCacheEntry {
+    const char* name;           // Without trailing '/', valid while the snapshot is held
+    uint32_t size;              // 0 for directories
+    bool isDir;
+};
+
+struct DirCacheStats {
+    uint32_t hits;
+    uint32_t misses;            // Scans of the card
+    uint32_t invalidations;     // Directories dropped by a write path
+    uint32_t evictions;         // Dropped to make room
+    uint32_t uncacheable;       // Too many entries
+    uint32_t dirs;              // Cached right now
+    uint32_t entries;
+    uint32_t bytes;             // PSRAM in use
+    uint32_t scan_ms_last;
+    uint32_t scan_ms_max;
+};
+
+struct DirSnapshot;
+
+void DirCache_Init();
+
+// Snapshot of 'dir', scanned on a miss. nullptr if 'dir' is not a directory or is too big to cache.
+const DirSnapshot* DirCache_Acquire(const char* dir);
+void DirCache_Release(const DirSnapshot* snap);
+
+size_t DirCache_Count(const DirSnapshot* snap);
+DirCacheEntry DirCache_At(const DirSnapshot* snap, size_t index);
+// Index of the first entry ordered after (isDir, name), DirCache_Count() if none
+size_t DirCache_UpperBound(const DirSnapshot* snap, const char* name, bool isDir);
+
+// Looks up one name in 'dir' (the card itself for uncacheable directories). 'out' gets size and
+// type, its name is nullptr since the snapshot is released before returning.
+bool DirCache_Lookup(const char* dir, const char* name, DirCacheEntry* out = nullptr);
+
+// 'path' was created, changed or removed: drops its directory. With 'tree', 'path' is a directory
+// that was removed or moved and its own snapshot and all below it are dropped too.
+void DirCache_Invalidate(const char* path, bool tree = false);
+// Changes with every invalidation; lets other caches (WebAssets) notice that the card was written
+uint32_t DirCache_Generation();
+
+void DirCache_GetStats(DirCacheStats* out);
+void DirCache_PrintStats();
+
+#endif
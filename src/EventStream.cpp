@@ -0,0 +1,310 @@
+// EventStream.cpp - Server-Sent Events with the device state for the web UI
+#include "EventStream.h"
+#include <ArduinoJson.h>
+#include "PCM5101.h"
+#include "LVGL_ST77916.h"
+#include "AlarmScheduler.h"
+#include "Metrics.h"
+#include "GUI/GUI.h"
+
+struct DeviceState {
+    uint8_t volume;
+    bool backlight;
+    bool backend;
+    bool ringing;
+    time_t alarmNext;
+    uint32_t alarmRev;
+    char station[EVENTS_TEXT_MAX];
+    char title[EVENTS_TEXT_MAX];
+};
+
+struct Subscriber {
+    bool used;
+    httpd_req_t* req;                   // Detached copy, completed by the sender task
+    uint32_t pending;                   // Topics changed since the last send
+    TaskHandle_t task;
+};
+
+static TaskHandle_t eventTask = nullptr;
+static SemaphoreHandle_t evMutex = nullptr;    // Guards 'published' and the subscriber table
+static DeviceState published = {};
+static Subscriber subscribers[EVENTS_MAX_SUBSCRIBERS];
+
+// Set by producers on their own tasks, read when sampling
+static portMUX_TYPE inputMux = portMUX_INITIALIZER_UNLOCKED;
+static char inStation[EVENTS_TEXT_MAX] = "";
+static char inTitle[EVENTS_TEXT_MAX] = "";
+static bool inRinging = false;
+static uint32_t inAlarmRev = 0;
+
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static EventStreamStats stats = {};
+static Metric* mSubscribers = nullptr;
+static Metric* mSent = nullptr;
+
+static void sample(DeviceState* s) {
+    s->volume = GetVolume();
+    s->backlight = backlight_on;
+    s->backend = backend_connected;
+    AlarmSchedulerStats al;
+    AlarmScheduler_GetStats(&al);
+    s->alarmNext = al.next_epoch;
+    portENTER_CRITICAL(&inputMux);
+    s->ringing = inRinging;
+    s->alarmRev = inAlarmRev;
+    memcpy(s->station, inStation, sizeof(s->station));
+    memcpy(s->title, inTitle, sizeof(s->title));
+    portEXIT_CRITICAL(&inputMux);
+}
+
+static uint32_t changedTopics(const DeviceState& a, const DeviceState& b) {
+    uint32_t topics = 0;
+    if (a.volume != b.volume) topics |= EVENT_VOLUME;
+    if (strcmp(a.station, b.station) || strcmp(a.title, b.title)) topics |= EVENT_NOWPLAYING;
+    if (a.ringing != b.ringing || a.alarmNext != b.alarmNext || a.alarmRev != b.alarmRev) topics |= EVENT_ALARM;
+    if (a.backlight != b.backlight) topics |= EVENT_BACKLIGHT;
+    if (a.backend != b.backend) topics |= EVENT_BACKEND;
+    return topics;
+}
+
+// Sleeps until notified or EVENTS_SAMPLE_MS, lets a burst settle, then publishes what changed
+static void EventTask(void*) {
+    DeviceState next;
+    for (;;) {
+        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENTS_SAMPLE_MS))) {
+            vTaskDelay(pdMS_TO_TICKS(EVENTS_COALESCE_MS));
+            ulTaskNotifyTake(pdTRUE, 0);        // Notifies during the wait are covered by this sample
+        }
+        sample(&next);
+
+        xSemaphoreTake(evMutex, portMAX_DELAY);
+        const uint32_t topics = changedTopics(published, next);
+        if (topics) {
+            published = next;
+            for (Subscriber& s : subscribers) {
+                if (!s.used) continue;
+                s.pending |= topics;
+                xTaskNotifyGive(s.task);
+            }
+        }
+        xSemaphoreGive(evMutex);
+
+        if (topics) {
+            portENTER_CRITICAL(&statsMux);
+            stats.published += __builtin_popcount(topics);
+            portEXIT_CRITICAL(&statsMux);
+        }
+    }
+}
+
+// One "event: <name>\ndata: <json>\n\n" block; 0 if the topic is unknown
+static size_t formatEvent(char* buf, size_t cap, uint32_t topic, const DeviceState& st) {
+    StaticJsonDocument<256> doc;
+    const char* name;
+    switch (topic) {
+        case EVENT_VOLUME:
+            name = "volume";
+            doc["volume"] = st.volume;
+            doc["max"] = Volume_MAX;
+            break;
+        case EVENT_NOWPLAYING:
+            name = "nowplaying";
+            doc["station"] = (const char*)st.station;
+            doc["title"] = (const char*)st.title;
+            break;
+        case EVENT_ALARM:
+            name = "alarm";
+            doc["ringing"] = st.ringing;
+            doc["next"] = (uint32_t)st.alarmNext;
+            doc["rev"] = st.alarmRev;
+            break;
+        case EVENT_BACKLIGHT:
+            name = "backlight";
+            doc["on"] = st.backlight;
+            break;
+        case EVENT_BACKEND:
+            name = "backend";
+            doc["connected"] = st.backend;
+            break;
+        default:
+            return 0;
+    }
+    size_t len = snprintf(buf, cap, "event: %s\ndata: ", name);
+    len += serializeJson(doc, buf + len, cap - len);
+    len += snprintf(buf + len, cap - len, "\n\n");
+    return len < cap ? len : cap - 1;
+}
+
+static void SenderTask(void* arg) {
+    Subscriber& s = *static_cast<Subscriber*>(arg);
+    char buf[5 * EVENTS_TEXT_MAX];                // Both texts fully escaped fit
+    DeviceState st;
+    {
+        HttpRequest req(s.req);
+        req.setHeader("Cache-Control", "no-store");
+        bool ok = req.beginChunked(200, "text/event-stream") == ESP_OK &&
+                  req.sendChunk("retry: " + String(EVENTS_RETRY_MS) + "\n\n") == ESP_OK;
+
+        while (ok) {
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(EVENTS_KEEPALIVE_MS));
+            xSemaphoreTake(evMutex, portMAX_DELAY);
+            const uint32_t topics = s.pending;
+            s.pending = 0;
+            if (topics) st = published;
+            xSemaphoreGive(evMutex);
+
+            if (!topics) {
+                ok = req.sendChunk(": keepalive\n\n") == ESP_OK;
+                portENTER_CRITICAL(&statsMux);
+                stats.keepalives++;
+                portEXIT_CRITICAL(&statsMux);
+                continue;
+            }
+            for (uint32_t bit = 1; ok && bit <= EVENT_ALL; bit <<= 1) {
+                if (!(topics & bit)) continue;
+                const size_t len = formatEvent(buf, sizeof(buf), bit, st);
+                ok = req.sendChunk(buf, len) == ESP_OK;
+                if (!ok) break;
+                portENTER_CRITICAL(&statsMux);
+                stats.sent++;
+                portEXIT_CRITICAL(&statsMux);
+                Metrics_Add(mSent);
+            }
+        }
+    }
+
+    // Only a failed send ends a subscription, so the connection is closed rather than reused
+    httpd_req_t* r = s.req;
+    xSemaphoreTake(evMutex, portMAX_DELAY);
+    s.used = false;
+    s.req = nullptr;
+    portENTER_CRITICAL(&statsMux);
+    stats.subscribers--;
+    Metrics_Set(mSubscribers, stats.subscribers);
+    portEXIT_CRITICAL(&statsMux);
+    xSemaphoreGive(evMutex);
+
+    httpd_handle_t hd = r->handle;
+    const int fd = httpd_req_to_sockfd(r);
+    httpd_req_async_handler_complete(r);
+    httpd_sess_trigger_close(hd, fd);
+    vTaskDelete(nullptr);
+}
+
+// Copies 'text' without control characters, which would only bloat the JSON
+static void setText(char* dst, const char* text, uint32_t topic) {
+    char clean[EVENTS_TEXT_MAX];
+    size_t n = 0;
+    const char* p = text ? text : "";
+    for (; *p && n < sizeof(clean) - 1; ++p) {
+        clean[n++] = (uint8_t)*p < 0x20 ? ' ' : *p;
+    }
+    if (*p) {                                   // Cut short: do not leave half a UTF-8 sequence
+        while (n && ((uint8_t)clean[n - 1] & 0xC0) == 0x80) n--;
+        if (n && (uint8_t)clean[n - 1] >= 0xC0) n--;
+    }
+    clean[n] = '\0';
+    portENTER_CRITICAL(&inputMux);
+    memcpy(dst, clean, n + 1);
+    portEXIT_CRITICAL(&inputMux);
+    EventStream_Notify(topic);
+}
+
+void EventStream_Init() {
+    if (evMutex) return;
+    evMutex = xSemaphoreCreateMutex();
+    sample(&published);
+    mSubscribers = Metrics_Gauge("events_subscribers", "Clients connected to /events");
+    mSent = Metrics_Counter("events_sent_total", "Server-sent events delivered to /events clients");
+    xTaskCreatePinnedToCore(EventTask, "EventStream", EVENTS_TASK_STACK, nullptr, EVENTS_TASK_PRIORITY, &eventTask, 0);
+}
+
+esp_err_t EventStream_Serve(HttpRequest& req) {
+    if (!evMutex) return req.send(503, "text/plain", "Event stream not ready");
+
+    xSemaphoreTake(evMutex, portMAX_DELAY);
+    Subscriber* s = nullptr;
+    for (Subscriber& c : subscribers) {
+        if (!c.used) {
+            s = &c;
+            break;
+        }
+    }
+    if (!s) {
+        xSemaphoreGive(evMutex);
+        portENTER_CRITICAL(&statsMux);
+        stats.rejected++;
+        portEXIT_CRITICAL(&statsMux);
+        req.setHeader("Retry-After", "10");
+        return req.send(503, "text/plain", "Too many event subscribers");
+    }
+
+    httpd_req_t* copy = nullptr;
+    if (httpd_req_async_handler_begin(req.raw(), &copy) != ESP_OK) {
+        xSemaphoreGive(evMutex);
+        return req.send(500, "text/plain", "Could not detach request");
+    }
+
+    s->used = true;
+    s->req = copy;
+    s->pending = EVENT_ALL;                     // Full state first
+    if (xTaskCreatePinnedToCore(SenderTask, "EventSubscriber", EVENTS_SENDER_STACK, s, EVENTS_TASK_PRIORITY, &s->task, 0) != pdPASS) {
+        s->used = false;
+        xSemaphoreGive(evMutex);
+        httpd_req_async_handler_complete(copy);
+        return ESP_FAIL;
+    }
+
+    portENTER_CRITICAL(&statsMux);
+    stats.sessions++;
+    if (++stats.subscribers > stats.subscribers_peak) stats.subscribers_peak = stats.subscribers;
+    Metrics_Set(mSubscribers, stats.subscribers);
+    portEXIT_CRITICAL(&statsMux);
+    xSemaphoreGive(evMutex);
+    xTaskNotifyGive(s->task);
+    return ESP_OK;
+}
+
+void EventStream_Notify(uint32_t topics) {
+    if (!topics || !eventTask) return;
+    portENTER_CRITICAL(&statsMux);
+    stats.notifies++;
+    portEXIT_CRITICAL(&statsMux);
+    xTaskNotifyGive(eventTask);
+}
+
+void EventStream_SetStation(const char* name) {
+    setText(inStation, name, EVENT_NOWPLAYING);
+}
+
+void EventStream_SetTitle(const char* title) {
+    setText(inTitle, title, EVENT_NOWPLAYING);
+}
+
+void EventStream_SetAlarmRinging(bool ringing) {
+    portENTER_CRITICAL(&inputMux);
+    inRinging = ringing;
+    portEXIT_CRITICAL(&inputMux);
+    EventStream_Notify(EVENT_ALARM);
+}
+
+void EventStream_AlarmsChanged() {
+    portENTER_CRITICAL(&inputMux);
+    inAlarmRev++;
+    portEXIT_CRITICAL(&inputMux);
+    EventStream_Notify(EVENT_ALARM);
+}
+
+void EventStream_GetStats(EventStreamStats* out) {
+    if (!out) return;
+    portENTER_CRITICAL(&statsMux);
+    *out = stats;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void EventStream_PrintStats() {
+    EventStreamStats st;
+    EventStream_GetStats(&st);
+    Serial.printf("[EventStream] subscribers %u (peak %u), sessions %u, rejected %u, notifies %u -> published %u, sent %u, keepalives %u\n",
+                  st.subscribers, st.subscribers_peak, st.sessions, st.rejected, st.notifies, st.published, st.sent, st.keepalives);
+}
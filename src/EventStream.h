@@ -0,0 +1,81 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+#include "HttpRequest.h"
+
+/*
+  Live device state for the web UI as Server-Sent Events (GET /events)
+
+  Instead of polling /volume, /status and /alarms, a page opens one
+  EventSource and gets a named event whenever a piece of state changes:
+
+    volume      {"volume":12,"max":21}
+    nowplaying  {"station":"...","title":"..."}       ICY name / stream title, ID3 title
+    alarm       {"ringing":false,"next":1760853600,"rev":3}   rev counts alarm list changes
+    backlight   {"on":true}
+    backend     {"connected":true}
+
+  Every subscriber first gets the full state, so a reconnect needs no
+  replay. Producers only call EventStream_Notify() (or the setters below);
+  the event task then waits EVENTS_COALESCE_MS, samples the state and
+  publishes what differs from the last publish, so a burst (a volume
+  slider drag, ID3 tags arriving together) becomes one event. The state is
+  also sampled every EVENTS_SAMPLE_MS to catch changes made without a
+  notify.
+
+  Each subscriber has a sender task and a bitmask of changed topics rather
+  than a queue: a slow client skips intermediate values and only ever
+  gets the latest one, so it cannot stall the others or grow memory.
+  Requests are detached from the httpd task like /stream, and each holds
+  one of HTTP_MAX_SOCKETS; a comment line goes out every
+  EVENTS_KEEPALIVE_MS so dead clients are noticed.
+*/
+
+#define EVENTS_MAX_SUBSCRIBERS  3
+#define EVENTS_COALESCE_MS      150       // Settle time after a notify before publishing
+#define EVENTS_SAMPLE_MS        500       // State sampled at least this often
+#define EVENTS_KEEPALIVE_MS     15000
+#define EVENTS_RETRY_MS         3000      // Client reconnect delay, sent as "retry:"
+#define EVENTS_TEXT_MAX         128       // Station name / title kept
+#define EVENTS_TASK_STACK       3072
+#define EVENTS_SENDER_STACK     4096
+#define EVENTS_TASK_PRIORITY    1
+
+// Topics, one named event each
+#define EVENT_VOLUME      0x01
+#define EVENT_NOWPLAYING  0x02
+#define EVENT_ALARM       0x04
+#define EVENT_BACKLIGHT   0x08
+#define EVENT_BACKEND     0x10
+#define EVENT_ALL         0x1F
+
+struct EventStreamStats {
+    uint32_t subscribers;       // Connected now
+    uint32_t subscribers_peak;
+    uint32_t sessions;          // Subscribers served since boot
+    uint32_t rejected;          // No free slot
+    uint32_t notifies;          // Change notifications from producers
+    uint32_t published;         // Topic changes published after coalescing
+    uint32_t sent;              // Events sent, all subscribers
+    uint32_t keepalives;
+};
+
+void EventStream_Init();
+
+// Takes over 'req' (GET /events, run inline in the httpd task) and returns at once; a sender
+// task answers it. A full subscriber table is answered here with 503.
+esp_err_t EventStream_Serve(HttpRequest& req);
+
+// Something in 'topics' may have changed. Cheap, callable from any task (not from an ISR).
+void EventStream_Notify(uint32_t topics);
+// State that is not kept anywhere else; nullptr or "" clears
+void EventStream_SetStation(const char* name);
+void EventStream_SetTitle(const char* title);
+void EventStream_SetAlarmRinging(bool ringing);
+void EventStream_AlarmsChanged();                  // Alarm list saved or reloaded, bumps "rev"
+
+void EventStream_GetStats(EventStreamStats* out);
+void EventStream_PrintStats();
+
+#endif
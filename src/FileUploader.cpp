@@ -0,0 +1,330 @@
+// FileUploader.cpp - Keep-alive chunked HTTP upload worker for recorded WAV files
+#include "FileUploader.h"
+#include <limits.h>
+#include <WiFi.h>
+#include <SD_MMC.h>
+#include <ArduinoJson.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+#define CHUNK_HDR_RESERVE 8      // "%X\r\n" for up to 0xFFFFF bytes
+#define BOUNDARY "----ESP32FormBoundary"
+
+struct UploadJob {
+    char path[UPLOADER_PATH_MAX];
+    char session[UPLOADER_SESSION_MAX];
+    int64_t enqueuedUs;
+    FileUploaderDoneCallback done;
+    uint32_t rid;
+};
+
+enum UploadResult { UPLOAD_OK, UPLOAD_FAILED, UPLOAD_STALE };
+
+static QueueHandle_t jobQueue = nullptr;
+static uint8_t* sendBuf = nullptr;           // CHUNK_HDR_RESERVE + UPLOADER_CHUNK_BYTES + 2, PSRAM
+static WiFiClient conn;
+static uint32_t connLastUsedMs = 0;
+
+static char host[64] = "";
+static uint16_t port = 80;
+static char path[64] = "/upload";
+
+// Stats
+static FileUploaderStats stats = {};
+static uint64_t statSendMsTotal = 0;
+
+static bool parseUrl(const char* url) {
+    if (!url || strncmp(url, "http://", 7) != 0) return false;
+    const char* p = url + 7;
+    const char* slash = strchr(p, '/');
+    const char* colon = strchr(p, ':');
+    const char* hostEnd = slash ? slash : p + strlen(p);
+    if (colon && colon < hostEnd) {
+        port = (uint16_t)atoi(colon + 1);
+        hostEnd = colon;
+    }
+    size_t n = hostEnd - p;
+    if (n == 0 || n >= sizeof(host)) return false;
+    memcpy(host, p, n);
+    host[n] = '\0';
+    if (slash) strlcpy(path, slash, sizeof(path));
+    return true;
+}
+
+static bool writeAll(const uint8_t* data, size_t len) {
+    return conn.write(data, len) == len;
+}
+
+// Sends data as one chunk. 'data' must be sendBuf + CHUNK_HDR_RESERVE with two spare bytes after it,
+// so chunk size line, data and CRLF go out in a single write.
+static bool writeChunk(size_t len) {
+    char hdr[CHUNK_HDR_RESERVE + 1];
+    int hl = snprintf(hdr, sizeof(hdr), "%X\r\n", (unsigned)len);
+    uint8_t* start = sendBuf + CHUNK_HDR_RESERVE - hl;
+    memcpy(start, hdr, hl);
+    sendBuf[CHUNK_HDR_RESERVE + len] = '\r';
+    sendBuf[CHUNK_HDR_RESERVE + len + 1] = '\n';
+    return writeAll(start, hl + len + 2);
+}
+
+// Reads one header line (without CRLF). Returns length, -1 on timeout / close.
+static int readLine(char* buf, size_t size, uint32_t deadline) {
+    size_t n = 0;
+    while ((int32_t)(deadline - millis()) > 0) {
+        if (!conn.available()) {
+            if (!conn.connected()) return -1;
+            vTaskDelay(pdMS_TO_TICKS(1));
+            continue;
+        }
+        int c = conn.read();
+        if (c < 0) continue;
+        if (c == '\n') {
+            if (n > 0 && buf[n - 1] == '\r') n--;
+            buf[n] = '\0';
+            return (int)n;
+        }
+        if (n < size - 1) buf[n++] = (char)c;
+    }
+    return -1;
+}
+
+static bool ensureConnected(bool* reused) {
+    if (conn.connected() && millis() - connLastUsedMs < UPLOADER_KEEPALIVE_MS) {
+        *reused = true;
+        stats.last_connect_ms = 0;
+        return true;
+    }
+    conn.stop();
+    *reused = false;
+
+    const int64_t t0 = esp_timer_get_time();
+    if (!conn.connect(host, port, UPLOADER_CONNECT_TIMEOUT_MS)) {
+        Serial.printf("[Upload] Connection to %s:%u failed\n", host, port);
+        return false;
+    }
+    conn.setNoDelay(true);
+    stats.connects++;
+    stats.last_connect_ms = (uint32_t)((esp_timer_get_time() - t0) / 1000);
+    return true;
+}
+
+static UploadResult sendRequest(File& file, const UploadJob& job, bool reused) {
+    uint8_t* body = sendBuf + CHUNK_HDR_RESERVE;
+
+    // Request head and the multipart preamble (first chunk) in one write
+    int headLen = snprintf((char*)sendBuf, UPLOADER_CHUNK_BYTES,
+        "POST %s HTTP/1.1\r\n"
+        "Host: %s\r\n"
+        "Connection: keep-alive\r\n"
+        "Transfer-Encoding: chunked\r\n"
+        "Content-Type: multipart/form-data; boundary=" BOUNDARY "\r\n\r\n",
+        path, host);
+    char preamble[512];
+    int preLen = snprintf(preamble, sizeof(preamble),
+        "--" BOUNDARY "\r\n"
+        "Content-Disposition: form-data; name=\"session_id\"\r\n\r\n"
+        "%s\r\n",
+        job.session);
+    if (job.rid) {
+        preLen += snprintf(preamble + preLen, sizeof(preamble) - preLen,
+            "--" BOUNDARY "\r\n"
+            "Content-Disposition: form-data; name=\"rid\"\r\n\r\n"
+            "%lu\r\n",
+            (unsigned long)job.rid);
+    }
+    preLen += snprintf(preamble + preLen, sizeof(preamble) - preLen,
+        "--" BOUNDARY "\r\n"
+        "Content-Disposition: form-data; name=\"file\"; filename=\"%s\"\r\n"
+        "Content-Type: audio/wav\r\n\r\n",
+        job.path);
+    headLen += snprintf((char*)sendBuf + headLen, UPLOADER_CHUNK_BYTES - headLen, "%X\r\n%s\r\n", preLen, preamble);
+
+    const int64_t sendStart = esp_timer_get_time();
+    if (!writeAll(sendBuf, headLen)) return reused ? UPLOAD_STALE : UPLOAD_FAILED;
+
+    // File content, one chunk per buffer
+    size_t sent = 0;
+    while (true) {
+        size_t n = file.read(body, UPLOADER_CHUNK_BYTES);
+        if (n == 0) break;
+        if (!writeChunk(n)) {
+            Serial.printf("[Upload] Write failed after %u bytes\n", (unsigned)sent);
+            return (reused && sent == 0) ? UPLOAD_STALE : UPLOAD_FAILED;
+        }
+        sent += n;
+    }
+
+    // Closing boundary + terminating chunk
+    int tailLen = snprintf((char*)sendBuf, UPLOADER_CHUNK_BYTES,
+        "%X\r\n\r\n--" BOUNDARY "--\r\n\r\n0\r\n\r\n", (unsigned)(strlen(BOUNDARY) + 8));
+    if (!writeAll(sendBuf, tailLen)) return UPLOAD_FAILED;
+    const int64_t sendEnd = esp_timer_get_time();
+
+    // Status line
+    char line[256];
+    const uint32_t deadline = millis() + UPLOADER_RESPONSE_TIMEOUT_MS;
+    if (readLine(line, sizeof(line), deadline) < 0) {
+        Serial.println("[Upload] No response from server");
+        // Nothing came back on a reused connection: the server had already closed it
+        return reused ? UPLOAD_STALE : UPLOAD_FAILED;
+    }
+    const uint32_t responseMs = (uint32_t)((esp_timer_get_time() - sendEnd) / 1000);
+    int status = 0;
+    sscanf(line, "HTTP/%*s %d", &status);
+
+    // Headers
+    int contentLength = -1;
+    bool keepAlive = true;
+    while (true) {
+        int n = readLine(line, sizeof(line), deadline);
+        if (n < 0) return UPLOAD_FAILED;
+        if (n == 0) break;
+        if (strncasecmp(line, "Content-Length:", 15) == 0) contentLength = atoi(line + 15);
+        else if (strncasecmp(line, "Connection:", 11) == 0 && strcasestr(line + 11, "close")) keepAlive = false;
+    }
+    // Without a length the body runs to the end of the connection
+    if (contentLength < 0) keepAlive = false;
+
+    // Body: read all of it so the connection stays usable
+    char resp[256];
+    size_t respLen = 0;
+    int remaining = contentLength < 0 ? INT_MAX : contentLength;
+    while (remaining > 0 && (int32_t)(deadline - millis()) > 0) {
+        if (!conn.available()) {
+            if (!conn.connected()) break;
+            vTaskDelay(pdMS_TO_TICKS(1));
+            continue;
+        }
+        int c = conn.read();
+        if (c < 0) continue;
+        if (respLen < sizeof(resp) - 1) resp[respLen++] = (char)c;
+        remaining--;
+    }
+    resp[respLen] = '\0';
+    if (remaining > 0 && contentLength >= 0) keepAlive = false;
+    if (!keepAlive) conn.stop();
+    connLastUsedMs = millis();
+
+    const uint32_t sendMs = (uint32_t)((sendEnd - sendStart) / 1000);
+    const uint32_t totalMs = (uint32_t)((esp_timer_get_time() - job.enqueuedUs) / 1000);
+    stats.last_bytes = sent;
+    stats.last_send_ms = sendMs;
+    stats.last_response_ms = responseMs;
+    stats.last_total_ms = totalMs;
+    if (totalMs > stats.max_total_ms) stats.max_total_ms = totalMs;
+    stats.last_kbps = sendMs ? sent / sendMs : 0;   // bytes/ms == kB/s
+
+    if (status < 200 || status >= 300) {
+        Serial.printf("[Upload] Server returned %d: %s\n", status, resp);
+        return UPLOAD_FAILED;
+    }
+
+    stats.bytes += sent;
+    statSendMsTotal += sendMs;
+    stats.avg_kbps = statSendMsTotal ? (uint32_t)(stats.bytes / statSendMsTotal) : 0;
+
+    StaticJsonDocument<256> doc;
+    DeserializationError error = deserializeJson(doc, resp);
+    if (!error) {
+        Serial.printf("[Upload] Success: status=%s, filename=%s, size=%d\n",
+                      (const char*)(doc["status"] | "?"), (const char*)(doc["filename"] | "?"), (int)(doc["size"] | 0));
+    }
+    return UPLOAD_OK;
+}
+
+static bool uploadFile(const UploadJob& job) {
+    File file = SD_MMC.open(job.path);
+    if (!file || file.isDirectory()) {
+        Serial.printf("[Upload] Failed to open: %s\n", job.path);
+        stats.failures++;
+        return false;
+    }
+
+    UploadResult result = UPLOAD_FAILED;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool reused = false;
+        if (!ensureConnected(&reused)) break;
+        if (reused) stats.reused++;
+
+        result = sendRequest(file, job, reused);
+        if (result != UPLOAD_STALE) break;
+
+        // Server closed the idle connection under us, send again on a new one
+        stats.retries++;
+        conn.stop();
+        file.seek(0);
+    }
+    file.close();
+
+    if (result == UPLOAD_OK) {
+        stats.uploads++;
+        Serial.printf("[Upload] %s: %u bytes, connect %u ms, send %u ms (%u kB/s), response %u ms, total %u ms\n",
+                      job.path, stats.last_bytes, stats.last_connect_ms, stats.last_send_ms,
+                      stats.last_kbps, stats.last_response_ms, stats.last_total_ms);
+    } else {
+        stats.failures++;
+        conn.stop();
+        Serial.printf("[Upload] Upload of %s failed\n", job.path);
+    }
+    return result == UPLOAD_OK;
+}
+
+static void FileUploaderTask(void*) {
+    UploadJob job;
+    while (true) {
+        if (xQueueReceive(jobQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+        bool ok = false;
+        if (WiFi.status() != WL_CONNECTED) {
+            Serial.printf("[Upload] WiFi not connected, dropped %s\n", job.path);
+            stats.failures++;
+        } else {
+            ok = uploadFile(job);
+        }
+        if (job.done) job.done(job.path, ok);
+    }
+}
+
+void FileUploader_Init(const char* url) {
+    if (!parseUrl(url)) {
+        Serial.printf("[Upload] Invalid upload URL '%s', uploads disabled\n", url ? url : "");
+        return;
+    }
+    sendBuf = (uint8_t*)heap_caps_malloc(CHUNK_HDR_RESERVE + UPLOADER_CHUNK_BYTES + 2, MALLOC_CAP_SPIRAM);
+    jobQueue = xQueueCreate(UPLOADER_QUEUE_LEN, sizeof(UploadJob));
+    if (!sendBuf || !jobQueue) {
+        Serial.println("[Upload] Failed to allocate upload buffer, uploads disabled");
+        return;
+    }
+    xTaskCreatePinnedToCore(FileUploaderTask, "FileUploaderTask", 6144, nullptr, 1, nullptr, 1);
+    Serial.printf("[Upload] Worker started for http://%s:%u%s\n", host, port, path);
+}
+
+bool FileUploader_Enqueue(const char* filePath, const char* sessionId, FileUploaderDoneCallback done, uint32_t rid) {
+    if (!jobQueue || !filePath) return false;
+    UploadJob job;
+    strlcpy(job.path, filePath, sizeof(job.path));
+    strlcpy(job.session, sessionId ? sessionId : "", sizeof(job.session));
+    job.enqueuedUs = esp_timer_get_time();
+    job.done = done;
+    job.rid = rid;
+    if (xQueueSend(jobQueue, &job, 0) != pdTRUE) {
+        Serial.printf("[Upload] Queue full, dropped %s\n", filePath);
+        stats.failures++;
+        return false;
+    }
+    return true;
+}
+
+void FileUploader_GetStats(FileUploaderStats* out) {
+    if (!out) return;
+    *out = stats;
+    out->queued = jobQueue ? uxQueueMessagesWaiting(jobQueue) : 0;
+}
+
+void FileUploader_PrintStats() {
+    FileUploaderStats s;
+    FileUploader_GetStats(&s);
+    Serial.printf("[Upload] queued=%u uploads=%u failures=%u retries=%u connects=%u reused=%u bytes=%llu avg=%u kB/s last: %u bytes %u kB/s total=%u ms max=%u ms\n",
+                  s.queued, s.uploads, s.failures, s.retries, s.connects, s.reused, s.bytes, s.avg_kbps,
+                  s.last_bytes, s.last_kbps, s.last_total_ms, s.max_total_ms);
+}
@@ -0,0 +1,57 @@
+#ifndef FILE_UPLOADER_H
+#define FILE_UPLOADER_H
+
+#include <Arduino.h>
+
+/*
+  Recorded WAV upload to the backend (HTTP POST multipart/form-data)
+
+  One long-lived worker task owns a keep-alive connection to the host in
+  ENV_UPLOAD_URL and uploads queued files one after another. The body is
+  sent with chunked transfer encoding straight from the SD card through a
+  PSRAM buffer, one TCP write per UPLOADER_CHUNK_BYTES, so no Content-Length
+  pass over the file and no per-write delays are needed.
+
+  The response is read completely (Content-Length) so the connection can be
+  reused for the next upload. A reused connection that turns out to be
+  closed by the server is retried once on a fresh connection.
+*/
+
+#define UPLOADER_QUEUE_LEN        4
+#define UPLOADER_CHUNK_BYTES      16384   // File bytes per chunk / TCP write (PSRAM)
+#define UPLOADER_KEEPALIVE_MS     60000   // Reconnect instead of reusing a connection idle for longer
+#define UPLOADER_CONNECT_TIMEOUT_MS 3000
+#define UPLOADER_RESPONSE_TIMEOUT_MS 10000
+#define UPLOADER_PATH_MAX         96
+#define UPLOADER_SESSION_MAX      64
+
+struct FileUploaderStats {
+    uint32_t queued;            // Waiting in the queue right now
+    uint32_t uploads;           // Completed with HTTP 2xx
+    uint32_t failures;
+    uint32_t retries;           // Reused connection was stale, sent again
+    uint32_t connects;          // New TCP connections
+    uint32_t reused;            // Uploads sent on an existing connection
+    uint64_t bytes;             // File bytes uploaded
+    uint32_t last_bytes;
+    uint32_t last_kbps;         // File bytes / send time, last upload (kB/s)
+    uint32_t avg_kbps;          // Over all uploads
+    uint32_t last_connect_ms;   // 0 when the connection was reused
+    uint32_t last_send_ms;      // First to last body byte
+    uint32_t last_response_ms;  // Last body byte to status line
+    uint32_t last_total_ms;     // Enqueue to response
+    uint32_t max_total_ms;
+};
+
+// Called from the worker when a queued file is done (or could not be sent)
+typedef void (*FileUploaderDoneCallback)(const char* path, bool ok);
+
+void FileUploader_Init(const char* url);
+// Copies path and session id; returns false if the queue is full (the callback is not called then).
+// A non-zero rid is sent as form field for the backend latency trace.
+bool FileUploader_Enqueue(const char* path, const char* sessionId, FileUploaderDoneCallback done = nullptr, uint32_t rid = 0);
+
+void FileUploader_GetStats(FileUploaderStats* out);
+void FileUploader_PrintStats();
+
+#endif
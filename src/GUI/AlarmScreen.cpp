@@ -2,6 +2,10 @@
 #include "AlarmScreen.h"
 #include <SD_MMC.h>
 #include <ArduinoJson.h>
+#include "StreamMonitor.h"
+#include "AlarmScheduler.h"
+#include "EventStream.h"
+#include "DirCache.h"
 
 
 #define ALARM_FILE "/alarms.json" // Path to the alarm file on SD card
@@ -63,6 +67,7 @@ void LoadAlarms() {
     }
 
     file.close();
+    AlarmScheduler_Reschedule();
 }
 
 void SaveAlarms() {
@@ -87,6 +92,9 @@ void SaveAlarms() {
     }
     serializeJson(doc, file);
     file.close();
+    DirCache_Invalidate(ALARM_FILE);
+
+    AlarmScheduler_Reschedule();
 }
 
 /*
@@ -356,8 +364,10 @@ void GUI_CreateAlarmActiveScreen() {
         Serial.println("Alarm stopped.");
         if (audio_ptr) {
             audio_ptr->stopSong(); // Stop audio playback
+            StreamMonitor_Stop();
         }
         alarm_active = false;
+        EventStream_SetAlarmRinging(false);
         GUI_SwitchToScreen(GUI_CreateMainScreen, &main_screen);
     }, LV_EVENT_CLICKED, NULL);
     Serial.println("GUI_CreateAlarmActiveScreen created");
@@ -1,6 +1,7 @@
 #include "GUI.h"
 #include "AssistantScreen.h"
 #include "MIC_MSM.h"
+#include "LatencyTrace.h"
 
 
 void GUI_CreateAssistantScreen() {
@@ -30,6 +31,7 @@ void GUI_CreateAssistantScreen() {
         filename = generateRotatingFileName();
         lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
 
+        LatencyTrace_Start(false);
         MIC_StartRecording(filename.c_str(), 16000, 1, 16, false);
     }, LV_EVENT_PRESSED, NULL);
 
@@ -37,23 +39,12 @@ void GUI_CreateAssistantScreen() {
     lv_obj_add_event_cb(speak_btn, [](lv_event_t* e) {
         lv_obj_t* btn = (lv_obj_t*)lv_event_get_target(e);
         Serial.println("Stop and play recording...");
+        LatencyTrace_MarkRelease();
         MIC_StopRecording();
         lv_obj_set_style_bg_color(btn, lv_palette_darken(LV_PALETTE_LIGHT_BLUE, 2), 0);
         delay(10);
 
-        // Copy filename for task
-        char* fname = (char*)pvPortMalloc(filename.length() + 1);
-        strcpy(fname, filename.c_str());
-
-        xTaskCreatePinnedToCore(
-            UploadFileTask,
-            "UploadFileTask",
-            8192,
-            fname,
-            1,
-            NULL,
-            1
-        );
+        AIAssistant_UploadFile(filename.c_str());
     }, LV_EVENT_RELEASED, NULL);
 
     // --- STREAM button ---
@@ -72,12 +63,14 @@ void GUI_CreateAssistantScreen() {
         Serial.printf("[STREAM] Start streaming: %s\n", filename.c_str());
         lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_RED), 0);
 
+        LatencyTrace_Start(true);
         MIC_StartRecording(filename.c_str(), 16000, 1, 16, true);
     }, LV_EVENT_PRESSED, NULL);
 
     lv_obj_add_event_cb(stream_btn, [](lv_event_t* e) {
         lv_obj_t* btn = (lv_obj_t*)lv_event_get_target(e);
         Serial.println("[STREAM] Stop streaming");
+        LatencyTrace_MarkRelease();
         MIC_StopRecording();
         lv_obj_set_style_bg_color(btn, lv_palette_main(LV_PALETTE_GREEN), 0);
     }, LV_EVENT_RELEASED, NULL);
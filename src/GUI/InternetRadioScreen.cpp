@@ -1,6 +1,8 @@
 #include "GUI.h"
 #include "InternetRadioScreen.h"
 #include "SD_Card.h"
+#include "StreamMonitor.h"
+#include "AlarmScheduler.h"
 
 void GUI_CreateInternetRadioScreen() {
     if (internet_radio_screen) return;
@@ -39,7 +41,8 @@ void GUI_CreateInternetRadioScreen() {
             const char* url = static_cast<const char*>(lv_event_get_user_data(e));
             Serial.printf("Playing: %s\n", url);
             if (audio_ptr) {
-                audio_ptr->connecttohost(url);
+                AlarmScheduler_OnPlaybackStarted();
+                StreamMonitor_Connect(url);
                 GUI_SwitchToScreen(GUI_CreateMainScreen, &main_screen);
             }
         }, LV_EVENT_CLICKED, url_copy);
@@ -1,6 +1,8 @@
 #include "GUI.h"
 #include "MP3PlayerScreen.h"
 #include "SD_Card.h"
+#include "StreamMonitor.h"
+#include "AlarmScheduler.h"
 
 void GUI_CreateSDCardMP3Screen() {
     if (sdcard_mp3_screen) return;
@@ -41,6 +43,8 @@ void GUI_CreateSDCardMP3Screen() {
             std::string* path = static_cast<std::string*>(lv_event_get_user_data(e));
             Serial.printf("Playing file: %s\n", path->c_str());
 
+            StreamMonitor_Stop();
+            AlarmScheduler_OnPlaybackStarted();
             if (audio_ptr && !audio_ptr->connecttoFS(SD_MMC, path->c_str())) {
                 Serial.println("Failed to play MP3 file");
             }
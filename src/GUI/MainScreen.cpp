@@ -2,6 +2,7 @@
 #include "GUI.h"
 #include "PCM5101.h"
 #include "MIC_MSM.h" 
+#include "StreamMonitor.h"
 
 
 void GUI_CreateMainScreen() {
@@ -70,6 +71,7 @@ void GUI_CreateMainScreen() {
     lv_obj_set_pos(btn_stop, 260, 160);
     lv_obj_add_event_cb(btn_stop, [](lv_event_t* e) {
         if (audio_ptr) audio_ptr->stopSong();
+        StreamMonitor_Stop();
         GUI_ClearMessage();
     }, LV_EVENT_CLICKED, nullptr);
     lv_obj_set_style_radius(btn_stop, LV_RADIUS_CIRCLE, 0);
@@ -1,25 +1,19 @@
 #include "GUI.h"
 #include "WifiDiscoveryScreen.h"
 #include "WifiPasswordScreen.h"
+#include "Settings.h"
 
 char ssid_list[MAX_SSID_LIST][MAX_SSID_LEN];
 int ssid_count = -1;
 
 lv_obj_t *wifi_list = nullptr;
 
-void store_wifi_ssid_to_eeprom(const String& ssid) {
-    for (int i = 0; i < 64; i++) {
-        EEPROM.write(EEPROM_WIFI_SSID_ADDR + i, i < ssid.length() ? ssid[i] : 0);
-    }
+void store_wifi_ssid(const String& ssid) {
+    Settings_SetWifiSSID(ssid);
 }
 
-void read_wifi_ssid_from_eeprom(String& ssid) {
-    ssid.clear();
-    for (int i = 0; i < 64; i++) {
-        char c = EEPROM.read(EEPROM_WIFI_SSID_ADDR + i);
-        if (c == '\0') break;
-        ssid += c;
-    }
+void read_wifi_ssid(String& ssid) {
+    ssid = Settings_GetWifiSSID();
 }
 
 struct WiFiScanContext {
@@ -60,8 +54,8 @@ void WiFiScanTask(void* param) {
                 const char *selected_ssid = lv_label_get_text(lv_obj_get_child(btn, 0));
 
                 Serial.printf("Selected SSID: %s\n", selected_ssid);
-                // Store selected SSID to EEPROM
-                store_wifi_ssid_to_eeprom(selected_ssid);
+                // Store selected SSID in settings
+                store_wifi_ssid(selected_ssid);
                 
                 lv_obj_t *msg = lv_label_create(lv_scr_act());
                 lv_label_set_text_fmt(msg, "Selected: %s\nSaved", selected_ssid);
@@ -82,7 +76,7 @@ void WiFiScanTask(void* param) {
         Serial.printf("Reconnecting to %s...\n", ctx->prev_ssid.c_str());
 
         String stored_pass;
-        read_wifi_password_from_eeprom(stored_pass);
+        read_wifi_password(stored_pass);
         WiFi.begin(ctx->prev_ssid.c_str(), stored_pass.c_str());
 
         unsigned long start = millis();
@@ -111,8 +105,6 @@ void StartWiFiScanTask() {
 }
 
 void GUI_CreateWifiDiscoveryScreen() {
-    EEPROM.begin(EEPROM_SIZE);
-
     if (!wifi_discovery_screen) {
         Serial.println("Creating GUI_CreateWifiDiscoveryScreen");
 
@@ -3,7 +3,6 @@
 
 #include <lvgl.h>
 #include <WiFi.h>
-#include <EEPROM.h>
 #include "../config.h" 
 
 #define MAX_SSID_LIST 20
@@ -15,8 +14,8 @@ extern "C" {
 // Create wifi discovery screen
 void GUI_CreateWifiDiscoveryScreen();
 void GUI_UpdateWifiDiscoveryScreen(const struct tm& rtcTime);
-void store_wifi_ssid_to_eeprom(const String& ssid);
-void read_wifi_ssid_from_eeprom(String& ssid);
+void store_wifi_ssid(const String& ssid);
+void read_wifi_ssid(String& ssid);
 
 #ifdef __cplusplus
 }
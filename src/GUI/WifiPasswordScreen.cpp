@@ -1,5 +1,6 @@
 #include "GUI.h"
 #include "WifiPasswordScreen.h"
+#include "Settings.h"
 
 
 lv_obj_t* pass_label = nullptr;
@@ -43,37 +44,30 @@ void update_pass_label() {
     lv_label_set_text(pass_label, masked.c_str());
 }
 
-void store_wifi_password_to_eeprom(const String& pass) {
-    for (int i = 0; i < EEPROM_SIZE; i++) {
-        EEPROM.write(EEPROM_WIFI_PASS_ADDR + i, i < pass.length() ? pass[i] : 0);
-    }
-    EEPROM.commit();
+void store_wifi_password(const String& pass) {
+    Settings_SetWifiPassword(pass);
+    Settings_Flush();  // credentials are committed right away
 }
 
-void read_wifi_password_from_eeprom(String& out_buf) {
-    char buf[EEPROM_SIZE] = {0};
-    for (int i = 0; i < EEPROM_SIZE; i++) {
-        buf[i] = EEPROM.read(EEPROM_WIFI_PASS_ADDR + i);
-        if (buf[i] == '\0') break;
-    }
-    out_buf = String(buf);
+void read_wifi_password(String& out_buf) {
+    out_buf = Settings_GetWifiPassword();
 }
 
-void ConnectToWiFiFromEEPROM() {
+void ConnectToWiFiFromSettings() {
     lv_label_set_text(status_label, "Connecting...");
 
-    // Read SSID and password from EEPROM
+    // Read SSID and password from settings
     String current_pass;
-    read_wifi_password_from_eeprom(current_pass);
+    read_wifi_password(current_pass);
     if (current_pass.isEmpty()) {
-        Serial.println("No password stored in EEPROM.");
+        Serial.println("No password stored in settings.");
         lv_label_set_text(status_label, "No password stored.");
         return;
     }
     String current_ssid;
-    read_wifi_ssid_from_eeprom(current_ssid);
+    read_wifi_ssid(current_ssid);
     if (current_ssid.isEmpty()) {
-        Serial.println("No SSID stored in EEPROM.");
+        Serial.println("No SSID stored in settings.");
         lv_label_set_text(status_label, "No SSID stored.");
         return;
     }
@@ -167,7 +161,6 @@ void GUI_CreateWifiPasswordScreen() {
     if (wifi_password_screen) return;
     Serial.println("Creating GUI_CreateWifiPasswordScreen");
 
-    EEPROM.begin(EEPROM_SIZE);
     wifi_password_screen = lv_obj_create(NULL);
     lv_obj_t* screen = wifi_password_screen;
 
@@ -235,8 +228,8 @@ void GUI_CreateWifiPasswordScreen() {
     lv_label_set_text(enter_label, "ENTER");
     lv_obj_center(enter_label);
     lv_obj_add_event_cb(enter_btn, [](lv_event_t* e) {
-        store_wifi_password_to_eeprom(current_pass);
-        ConnectToWiFiFromEEPROM();
+        store_wifi_password(current_pass);
+        ConnectToWiFiFromSettings();
     }, LV_EVENT_CLICKED, NULL);
 
     // --- Status label ---
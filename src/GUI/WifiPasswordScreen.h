@@ -1,7 +1,6 @@
 #pragma once
 
 #include <lvgl.h>
-#include <EEPROM.h>
 #include "../config.h" 
 
 #define NUM_CHARS 38
@@ -12,8 +11,8 @@ extern "C" {
 
 // Create wifi password screen
 void GUI_CreateWifiPasswordScreen();
-void read_wifi_password_from_eeprom(String& out_buf);
-void store_wifi_password_to_eeprom(const String& pass);
+void read_wifi_password(String& out_buf);
+void store_wifi_password(const String& pass);
 
 #ifdef __cplusplus
 }
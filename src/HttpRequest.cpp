@@ -0,0 +1,405 @@
+// HttpRequest.cpp - WebServer-style arguments and responses for esp_http_server handlers
+#include "HttpRequest.h"
+#include <time.h>
+#include <algorithm>
+#include "esp_heap_caps.h"
+#include "Metrics.h"
+
+#define FILE_CHUNK_FALLBACK 4096    // Buffer for sendFile() when the request has no scratch buffer
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static String urlDecode(const char* s, size_t len) {
+    String out;
+    out.reserve(len);
+    for (size_t i = 0; i < len; ++i) {
+        char c = s[i];
+        if (c == '+') {
+            c = ' ';
+        } else if (c == '%' && i + 2 < len) {
+            const int hi = hexValue(s[i + 1]);
+            const int lo = hexValue(s[i + 2]);
+            if (hi >= 0 && lo >= 0) {
+                c = (char)((hi << 4) | lo);
+                i += 2;
+            }
+        }
+        out += c;
+    }
+    return out;
+}
+
+// "a=1&b=x%20y" into decoded pairs
+static void parseForm(const char* s, size_t len, std::vector<std::pair<String, String>>& out) {
+    size_t i = 0;
+    while (i < len) {
+        size_t end = i;
+        while (end < len && s[end] != '&') end++;
+        size_t eq = i;
+        while (eq < end && s[eq] != '=') eq++;
+        if (end > i) {
+            String name = urlDecode(s + i, eq - i);
+            String value = eq < end ? urlDecode(s + eq + 1, end - eq - 1) : String();
+            out.emplace_back(name, value);
+        }
+        i = end + 1;
+    }
+}
+
+String HttpRequest::path() const {
+    const char* q = strchr(req_->uri, '?');
+    return q ? String(req_->uri).substring(0, q - req_->uri) : String(req_->uri);
+}
+
+String HttpRequest::header(const char* name) const {
+    const size_t len = httpd_req_get_hdr_value_len(req_, name);
+    if (len == 0) return String();
+    String value;
+    value.reserve(len);
+    char* buf = (char*)malloc(len + 1);
+    if (!buf) return String();
+    if (httpd_req_get_hdr_value_str(req_, name, buf, len + 1) == ESP_OK) value = buf;
+    free(buf);
+    return value;
+}
+
+int HttpRequest::read(char* buf, size_t len) {
+    int retries = 0;
+    while (true) {
+        const int n = httpd_req_recv(req_, buf, len);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT && ++retries <= HTTP_RECV_RETRIES) continue;
+        return n;
+    }
+}
+
+bool HttpRequest::loadBody() {
+    if (bodyLoaded_) return true;
+    bodyLoaded_ = true;
+    if (req_->content_len == 0) return true;
+    if (req_->content_len > HTTP_BODY_MAX) return false;
+    if (header("Content-Type").startsWith("multipart/")) return false;
+
+    char* buf = (char*)malloc(req_->content_len + 1);
+    if (!buf) return false;
+    size_t got = 0;
+    while (got < req_->content_len) {
+        const int n = read(buf + got, req_->content_len - got);
+        if (n <= 0) break;
+        got += n;
+    }
+    buf[got] = '\0';
+    body_ = buf;
+    free(buf);
+    return got == req_->content_len;
+}
+
+void HttpRequest::loadArgs() {
+    if (argsLoaded_) return;
+    argsLoaded_ = true;
+
+    const size_t qlen = httpd_req_get_url_query_len(req_);
+    if (qlen) {
+        char* q = (char*)malloc(qlen + 1);
+        if (q) {
+            if (httpd_req_get_url_query_str(req_, q, qlen + 1) == ESP_OK) parseForm(q, strlen(q), args_);
+            free(q);
+        }
+    }
+
+    if (req_->method == HTTP_POST && header("Content-Type").startsWith("application/x-www-form-urlencoded") && loadBody()) {
+        parseForm(body_.c_str(), body_.length(), args_);
+    }
+}
+
+bool HttpRequest::hasArg(const char* name) {
+    if (strcmp(name, "plain") == 0) return loadBody() && body_.length() > 0;
+    loadArgs();
+    for (const auto& a : args_) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+String HttpRequest::arg(const char* name) {
+    if (strcmp(name, "plain") == 0) return loadBody() ? body_ : String();
+    loadArgs();
+    for (const auto& a : args_) {
+        if (a.first == name) return a.second;
+    }
+    return String();
+}
+
+void HttpRequest::setHeader(const char* name, const String& value) {
+    if (hdrCount_ >= HTTP_EXTRA_HEADERS_MAX) return;
+    hdrName_[hdrCount_] = name;
+    hdrValue_[hdrCount_] = value;
+    hdrCount_++;
+}
+
+// httpd keeps the pointers until the response is sent, the strings live in this object
+void HttpRequest::applyHeaders() {
+    for (uint8_t i = 0; i < hdrCount_; ++i) {
+        httpd_resp_set_hdr(req_, hdrName_[i].c_str(), hdrValue_[i].c_str());
+    }
+}
+
+esp_err_t HttpRequest::send(int code, const char* type, const String& body) {
+    return send(code, type, body.c_str(), body.length());
+}
+
+esp_err_t HttpRequest::send(int code, const char* type, const char* data, size_t len) {
+    status_ = code;
+    httpd_resp_set_status(req_, statusText(code));
+    httpd_resp_set_type(req_, type);
+    applyHeaders();
+    const esp_err_t err = httpd_resp_send(req_, data, len);
+    if (err == ESP_OK) bytesSent_ += len;
+    return err;
+}
+
+esp_err_t HttpRequest::beginChunked(int code, const char* type) {
+    status_ = code;
+    httpd_resp_set_status(req_, statusText(code));
+    httpd_resp_set_type(req_, type);
+    applyHeaders();
+    return ESP_OK;
+}
+
+esp_err_t HttpRequest::sendChunk(const char* data, size_t len) {
+    if (len == 0) return ESP_OK;            // A zero length chunk would end the response
+    const esp_err_t err = httpd_resp_send_chunk(req_, data, len);
+    if (err == ESP_OK) bytesSent_ += len;
+    return err;
+}
+
+esp_err_t HttpRequest::endChunked() {
+    return httpd_resp_send_chunk(req_, nullptr, 0);
+}
+
+bool HttpRequest::beginRaw(int code, const char* type, int64_t length) {
+    status_ = code;
+    String head;
+    head.reserve(160);
+    head += "HTTP/1.1 ";
+    head += statusText(code);
+    head += "\r\nContent-Type: ";
+    head += type;
+    head += "\r\n";
+    for (uint8_t i = 0; i < hdrCount_; ++i) {
+        head += hdrName_[i] + ": " + hdrValue_[i] + "\r\n";
+    }
+    if (length >= 0) {
+        head += "Content-Length: " + String((unsigned long long)length) + "\r\n\r\n";
+    } else {
+        head += "Connection: close\r\n\r\n";
+    }
+    const uint64_t before = bytesSent_;
+    const bool ok = write(head.c_str(), head.length());
+    bytesSent_ = before;                    // Body bytes only
+    return ok;
+}
+
+bool HttpRequest::write(const void* data, size_t len) {
+    const char* p = static_cast<const char*>(data);
+    int retries = 0;
+    while (len > 0) {
+        const int n = httpd_send(req_, p, len);
+        if (n == HTTPD_SOCK_ERR_TIMEOUT && ++retries <= HTTP_RECV_RETRIES) continue;
+        if (n <= 0) return false;
+        retries = 0;
+        p += n;
+        len -= n;
+        bytesSent_ += n;
+    }
+    return true;
+}
+
+// Scratch buffer of the worker, or a temporary one the caller frees (differs from scratch_)
+uint8_t* HttpRequest::fileBuffer(size_t* len) {
+    if (scratch_) {
+        *len = scratchLen_;
+        return scratch_;
+    }
+    *len = FILE_CHUNK_FALLBACK;
+    return (uint8_t*)heap_caps_malloc(FILE_CHUNK_FALLBACK, MALLOC_CAP_SPIRAM);
+}
+
+bool HttpRequest::sendSpan(File& file, uint64_t from, uint64_t len, uint8_t* buf, size_t bufLen) {
+    static Metric* const mRead = Metrics_Counter("sd_read_bytes_total", "Bytes read from the card", "reader=\"http\"");
+    if (!file.seek(from)) return false;
+    while (len > 0) {
+        const size_t n = file.read(buf, len < bufLen ? len : bufLen);
+        if (n == 0) return false;           // Short read, the Content-Length can no longer be met
+        Metrics_Add(mRead, n);
+        if (!write(buf, n)) return false;
+        len -= n;
+    }
+    return true;
+}
+
+bool HttpRequest::sendFile(File& file, const char* type) {
+    size_t bufLen;
+    uint8_t* buf = fileBuffer(&bufLen);
+    if (!buf) {
+        send(500, "text/plain", "Out of memory");
+        return false;
+    }
+
+    const size_t size = file.size();
+    const bool ok = beginRaw(200, type, size) && sendSpan(file, 0, size, buf, bufLen);
+    if (buf != scratch_) free(buf);
+    return ok;
+}
+
+struct ByteRange {
+    uint64_t first;
+    uint64_t last;                          // Inclusive
+};
+
+// "bytes=0-99,200-,-500" against 'size'. Returns the number of satisfiable ranges, sorted and
+// merged, or -1 if the header is malformed or asks for too many (then it is ignored).
+static int parseRanges(const String& header, uint64_t size, ByteRange* out) {
+    if (!header.startsWith("bytes=")) return -1;
+    const char* p = header.c_str() + 6;
+    int n = 0;
+    while (*p) {
+        while (*p == ' ' || *p == ',') p++;
+        if (!*p) break;
+        char* end;
+        uint64_t first, last;
+        if (*p == '-') {                    // Suffix: the last N bytes
+            const uint64_t count = strtoull(p + 1, &end, 10);
+            if (end == p + 1) return -1;
+            if (count == 0 || size == 0) { p = end; continue; }
+            first = count >= size ? 0 : size - count;
+            last = size - 1;
+        } else {
+            first = strtoull(p, &end, 10);
+            if (end == p || *end != '-') return -1;
+            p = end + 1;
+            last = strtoull(p, &end, 10);
+            if (end == p) last = UINT64_MAX;
+            else if (last < first) return -1;
+            if (first >= size) { p = end; continue; }
+            if (last >= size) last = size - 1;
+        }
+        p = end;
+        while (*p == ' ') p++;
+        if (*p && *p != ',') return -1;
+        if (n == HTTP_MAX_RANGES) return -1;
+        out[n++] = { first, last };
+    }
+
+    std::sort(out, out + n, [](const ByteRange& a, const ByteRange& b) { return a.first < b.first; });
+    int merged = 0;
+    for (int i = 0; i < n; ++i) {
+        if (merged && out[i].first <= out[merged - 1].last + 1) {
+            if (out[i].last > out[merged - 1].last) out[merged - 1].last = out[i].last;
+        } else {
+            out[merged++] = out[i];
+        }
+    }
+    return merged;
+}
+
+bool HttpRequest::sendFileRanges(File& file, const char* type) {
+    const uint64_t size = file.size();
+    const time_t mtime = file.getLastWrite();
+
+    char etag[32];
+    snprintf(etag, sizeof(etag), "\"%llx-%lx\"", (unsigned long long)size, (unsigned long)mtime);
+    char lastModified[40];
+    struct tm tmv;
+    gmtime_r(&mtime, &tmv);
+    strftime(lastModified, sizeof(lastModified), "%a, %d %b %Y %H:%M:%S GMT", &tmv);
+    setHeader("Accept-Ranges", "bytes");
+    setHeader("ETag", etag);
+    setHeader("Last-Modified", lastModified);
+
+    // If-Range: only a range of the same file version, otherwise the whole file
+    const String range = header("Range");
+    const String ifRange = header("If-Range");
+    const bool sameVersion = ifRange.isEmpty() || ifRange == etag || ifRange == lastModified;
+    ByteRange ranges[HTTP_MAX_RANGES];
+    const int count = range.isEmpty() || !sameVersion ? -1 : parseRanges(range, size, ranges);
+    if (count < 0) return sendFile(file, type);
+    if (count == 0) {
+        setHeader("Content-Range", "bytes */" + String((unsigned long long)size));
+        send(416, "text/plain", "Range not satisfiable");
+        return true;
+    }
+
+    size_t bufLen;
+    uint8_t* buf = fileBuffer(&bufLen);
+    if (!buf) {
+        send(500, "text/plain", "Out of memory");
+        return false;
+    }
+
+    bool ok;
+    if (count == 1) {
+        const uint64_t len = ranges[0].last - ranges[0].first + 1;
+        setHeader("Content-Range", "bytes " + String((unsigned long long)ranges[0].first) + "-" +
+                                   String((unsigned long long)ranges[0].last) + "/" + String((unsigned long long)size));
+        ok = beginRaw(206, type, len) && sendSpan(file, ranges[0].first, len, buf, bufLen);
+    } else {
+        // multipart/byteranges: the part headers are built first for the Content-Length
+        char boundary[32];
+        snprintf(boundary, sizeof(boundary), "BYTERANGES_%08lx", (unsigned long)esp_random());
+        String parts[HTTP_MAX_RANGES];
+        const String tail = String("\r\n--") + boundary + "--\r\n";
+        uint64_t total = tail.length();
+        for (int i = 0; i < count; ++i) {
+            parts[i] = String("\r\n--") + boundary + "\r\nContent-Type: " + type + "\r\nContent-Range: bytes " +
+                       String((unsigned long long)ranges[i].first) + "-" + String((unsigned long long)ranges[i].last) +
+                       "/" + String((unsigned long long)size) + "\r\n\r\n";
+            total += parts[i].length() + (ranges[i].last - ranges[i].first + 1);
+        }
+        const String multipartType = String("multipart/byteranges; boundary=") + boundary;
+        ok = beginRaw(206, multipartType.c_str(), total);
+        for (int i = 0; ok && i < count; ++i) {
+            ok = write(parts[i].c_str(), parts[i].length()) &&
+                 sendSpan(file, ranges[i].first, ranges[i].last - ranges[i].first + 1, buf, bufLen);
+        }
+        ok = ok && write(tail.c_str(), tail.length());
+    }
+
+    if (buf != scratch_) free(buf);
+    return ok;
+}
+
+const char* HttpRequest::statusText(int code) {
+    switch (code) {
+        case 200: return "200 OK";
+        case 204: return "204 No Content";
+        case 206: return "206 Partial Content";
+        case 304: return "304 Not Modified";
+        case 400: return "400 Bad Request";
+        case 404: return "404 Not Found";
+        case 405: return "405 Method Not Allowed";
+        case 413: return "413 Payload Too Large";
+        case 416: return "416 Range Not Satisfiable";
+        case 503: return "503 Service Unavailable";
+        default:  return "500 Internal Server Error";
+    }
+}
+
+String HttpRequest::contentTypeFor(const String& path) {
+    if (path.endsWith(".html")) return "text/html";
+    if (path.endsWith(".css")) return "text/css";
+    if (path.endsWith(".js")) return "application/javascript";
+    if (path.endsWith(".json")) return "application/json";
+    if (path.endsWith(".jpg") || path.endsWith(".jpeg")) return "image/jpeg";
+    if (path.endsWith(".png")) return "image/png";
+    if (path.endsWith(".gif")) return "image/gif";
+    if (path.endsWith(".svg")) return "image/svg+xml";
+    if (path.endsWith(".ico")) return "image/x-icon";
+    if (path.endsWith(".mp3")) return "audio/mpeg";
+    if (path.endsWith(".wav")) return "audio/wav";
+    return "text/plain";
+}
@@ -0,0 +1,106 @@
+#ifndef HTTP_REQUEST_H
+#define HTTP_REQUEST_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <vector>
+#include <esp_http_server.h>
+
+/*
+  Request/response wrapper around an esp_http_server request
+
+  Gives the route handlers the calls they used with the Arduino WebServer
+  (hasArg/arg/send) on top of httpd. Arguments come from the query string
+  and, for application/x-www-form-urlencoded POSTs, from the body; both are
+  decoded on first use. arg("plain") is the raw body, as in WebServer.
+  Bodies of other types (multipart uploads) are left alone and read by the
+  handler with read().
+
+  Responses are either complete (send), chunked (beginChunked/sendChunk/
+  endChunked) or raw (beginRaw/write) where the handler writes status line
+  and headers itself, e.g. to stream a file with a Content-Length.
+  sendFile() streams an open file through the scratch buffer of the worker
+  running the request (or a temporary PSRAM buffer). sendFileRanges() also
+  answers a "Range: bytes=..." header: one range as 206 with Content-Range,
+  several as multipart/byteranges, each read after a seek, so a player can
+  jump into an MP3 and a download can resume without resending the start.
+
+  The wrapper lives on the stack of whichever task runs the handler: the
+  httpd task for quick routes, a worker (HttpServer.cpp) for long ones.
+*/
+
+#define HTTP_BODY_MAX          16384   // Largest form/JSON body read into memory
+#define HTTP_EXTRA_HEADERS_MAX 6       // setHeader() slots per response
+#define HTTP_RECV_RETRIES      5       // Receive timeouts tolerated in read()
+#define HTTP_MAX_RANGES        8       // Ranges honoured in one request, more get the whole file
+
+class HttpRequest {
+public:
+    HttpRequest(httpd_req_t* req, uint8_t* scratch = nullptr, size_t scratchLen = 0)
+        : req_(req), scratch_(scratch), scratchLen_(scratchLen) {}
+
+    httpd_req_t* raw() const { return req_; }
+    int method() const { return req_->method; }
+    String path() const;                    // URI without the query string
+    size_t contentLength() const { return req_->content_len; }
+
+    bool hasArg(const char* name);
+    String arg(const char* name);           // "" when missing
+    String header(const char* name) const;  // "" when missing
+
+    // Body bytes not consumed by arg(); returns bytes read, 0 at the end, < 0 on error
+    int read(char* buf, size_t len);
+
+    // Complete response
+    void setHeader(const char* name, const String& value);
+    esp_err_t send(int code, const char* type, const String& body);
+    esp_err_t send(int code, const char* type, const char* data, size_t len);
+
+    // Chunked response, status and headers go out with the first chunk
+    esp_err_t beginChunked(int code, const char* type);
+    esp_err_t sendChunk(const char* data, size_t len);
+    esp_err_t sendChunk(const String& s) { return sendChunk(s.c_str(), s.length()); }
+    esp_err_t endChunked();
+
+    // Raw response: status line and headers written here, then the body with write().
+    // length < 0 sends "Connection: close"; the handler then returns ESP_FAIL.
+    bool beginRaw(int code, const char* type, int64_t length);
+    bool write(const void* data, size_t len);
+
+    // Whole file with Content-Length; false if the client went away
+    bool sendFile(File& file, const char* type);
+    // Same, but honours Range/If-Range (206, multipart/byteranges, 416) and sends
+    // Accept-Ranges, ETag and Last-Modified
+    bool sendFileRanges(File& file, const char* type);
+
+    int status() const { return status_; }
+    uint64_t bytesSent() const { return bytesSent_; }
+
+    static const char* statusText(int code);
+    static String contentTypeFor(const String& path);
+
+private:
+    void loadArgs();
+    bool loadBody();
+    void applyHeaders();
+    uint8_t* fileBuffer(size_t* len);
+    bool sendSpan(File& file, uint64_t from, uint64_t len, uint8_t* buf, size_t bufLen);
+
+    httpd_req_t* req_;
+    uint8_t* scratch_;
+    size_t scratchLen_;
+
+    std::vector<std::pair<String, String>> args_;
+    bool argsLoaded_ = false;
+    String body_;
+    bool bodyLoaded_ = false;
+
+    String hdrName_[HTTP_EXTRA_HEADERS_MAX];
+    String hdrValue_[HTTP_EXTRA_HEADERS_MAX];
+    uint8_t hdrCount_ = 0;
+
+    int status_ = 0;
+    uint64_t bytesSent_ = 0;
+};
+
+#endif
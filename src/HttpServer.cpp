@@ -1,26 +1,191 @@
 #include <vector>
+#include <algorithm>
 #include <WiFi.h>
 #include <time.h>
-#include "ESP_I2S.h"
 #include "HttpServer.h"
 #include "SD_Card.h"
 #include <SD.h>
 #include "FS.h"
 #include "PCM5101.h"
 #include "MIC_MSM.h"
+#include "AudioMixer.h"
+#include "TTSCache.h"
+#include "StreamMonitor.h"
+#include "Settings.h"
+#include "AlarmScheduler.h"
+#include "AudioUplink.h"
+#include "AudioDownlink.h"
+#include "FileUploader.h"
+#include "RequestSpool.h"
+#include "LatencyTrace.h"
+#include "HttpRequest.h"
+#include "DirCache.h"
+#include "WebAssets.h"
+#include "SdWriter.h"
+#include "MicStream.h"
+#include "EventStream.h"
+#include "Metrics.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include <unistd.h>
 
 #include <ArduinoJson.h>
 #include "GUI/AlarmScreen.h"
 
-WebServer server(80);
+#define UPLOAD_BUFFER_BYTES 16384     // Multipart parse buffer (PSRAM)
+#define UPLOAD_FIELD_MAX    256       // Longest non-file form field kept
+
+#define LISTFILES_NAME_MAX    256     // Longest entry name listed (FAT long names)
+#define LISTFILES_SORT_BATCH  64      // Fewest entries kept per sorted pass (PSRAM)
+#define LISTFILES_SORT_MAX    8192    // Most entries per sorted pass (~2 MB), one pass up to twice DIRCACHE_MAX_ENTRIES
+#define LISTFILES_PSRAM_SHARE 2       // A sorted pass takes at most 1/N of the largest free PSRAM block
+#define LISTFILES_FLUSH_BYTES 1024    // Listing output per chunk
+#define LISTFILES_NAME_COLUMN 40      // Plain text: size column
+
+typedef esp_err_t (*HttpHandler)(HttpRequest& req);
+
+static httpd_handle_t server = nullptr;
+static QueueHandle_t asyncQueue = nullptr;     // httpd_req_t* copies waiting for a worker
 static Audio* audio_ptr = nullptr;
-static File uploadFile;
+static SemaphoreHandle_t playMutex = nullptr;  // One playback start at a time across the workers
 static unsigned long bootMillis = millis();
-static I2SClass streamI2S;
+
+// Stats
+static HttpServerStats stats = {};
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Exported on /metrics
+static const uint32_t durationBoundsMs[] = { 5, 20, 50, 100, 250, 1000, 5000 };
+static Metric* mRequests[4];                   // 2xx..5xx
+static Metric* mDuration[2];                   // inline, worker
+static Metric* mBytesSent = nullptr;
+static Metric* mRejected = nullptr;
+static Metric* mOpenSockets = nullptr;
+static Metric* mWorkersBusy = nullptr;
+
+static void registerMetrics() {
+    static const char* const classes[4] = { "code=\"2xx\"", "code=\"3xx\"", "code=\"4xx\"", "code=\"5xx\"" };
+    for (int i = 0; i < 4; ++i) mRequests[i] = Metrics_Counter("http_requests_total", "Requests handled, by status class", classes[i]);
+    mDuration[0] = Metrics_Histogram("http_request_duration_ms", "Handler time", durationBoundsMs, 7, "mode=\"inline\"");
+    mDuration[1] = Metrics_Histogram("http_request_duration_ms", "Handler time", durationBoundsMs, 7, "mode=\"worker\"");
+    mBytesSent = Metrics_Counter("http_response_bytes_total", "Response body bytes sent");
+    mRejected = Metrics_Counter("http_rejected_total", "Long requests answered 503, no worker free");
+    mOpenSockets = Metrics_Gauge("http_open_sockets", "Open client connections");
+    mWorkersBusy = Metrics_Gauge("http_workers_busy", "Workers running a request");
+}
+
+/* Request dispatch */
+
+static void accountRequest(const HttpRequest& req, int64_t startUs, bool async) {
+    const uint32_t ms = (uint32_t)((esp_timer_get_time() - startUs) / 1000);
+    portENTER_CRITICAL(&statsMux);
+    stats.requests++;
+    if (async) {
+        stats.async_requests++;
+        if (ms > stats.async_ms_max) stats.async_ms_max = ms;
+    } else if (ms > stats.inline_ms_max) {
+        stats.inline_ms_max = ms;
+    }
+    if (req.status() == 206) stats.partial++;
+    if (req.status() >= 500) stats.server_errors++;
+    else if (req.status() >= 400) stats.client_errors++;
+    stats.bytes_sent += req.bytesSent();
+    portEXIT_CRITICAL(&statsMux);
+
+    const int cls = req.status() / 100 - 2;
+    Metrics_Add(mRequests[cls < 0 ? 0 : cls > 3 ? 3 : cls]);
+    Metrics_Observe(mDuration[async ? 1 : 0], ms);
+    Metrics_Add(mBytesSent, (uint32_t)req.bytesSent());
+}
+
+// Quick routes: run in the httpd task
+static esp_err_t runInline(httpd_req_t* r) {
+    const int64_t startUs = esp_timer_get_time();
+    HttpRequest req(r);
+    const esp_err_t err = reinterpret_cast<HttpHandler>(r->user_ctx)(req);
+    accountRequest(req, startUs, false);
+    return err;
+}
+
+// Long routes: detach the request and hand it to a worker, the httpd task returns to the other sockets
+static esp_err_t runAsync(httpd_req_t* r) {
+    httpd_req_t* copy = nullptr;
+    // The httpd task is the only producer, so a free slot seen here is still free below
+    if (uxQueueSpacesAvailable(asyncQueue) == 0 || httpd_req_async_handler_begin(r, &copy) != ESP_OK) {
+        portENTER_CRITICAL(&statsMux);
+        stats.rejected++;
+        portEXIT_CRITICAL(&statsMux);
+        Metrics_Add(mRejected);
+        HttpRequest req(r);
+        req.setHeader("Retry-After", "1");
+        return req.send(503, "text/plain", "Server busy, try again");
+    }
+    xQueueSend(asyncQueue, &copy, 0);
+    return ESP_OK;
+}
+
+static void workerTask(void*) {
+    uint8_t* scratch = (uint8_t*)heap_caps_malloc(HTTP_WORKER_CHUNK, MALLOC_CAP_SPIRAM);
+    httpd_req_t* r;
+    for (;;) {
+        if (xQueueReceive(asyncQueue, &r, portMAX_DELAY) != pdTRUE) continue;
+
+        portENTER_CRITICAL(&statsMux);
+        if (++stats.active_workers > stats.workers_peak) stats.workers_peak = stats.active_workers;
+        Metrics_Set(mWorkersBusy, stats.active_workers);
+        portEXIT_CRITICAL(&statsMux);
+
+        const int64_t startUs = esp_timer_get_time();
+        esp_err_t err;
+        {
+            HttpRequest req(r, scratch, scratch ? HTTP_WORKER_CHUNK : 0);
+            err = reinterpret_cast<HttpHandler>(r->user_ctx)(req);
+            accountRequest(req, startUs, true);
+        }
+
+        // ESP_FAIL closes the connection, as it does for inline handlers
+        httpd_handle_t hd = r->handle;
+        const int fd = httpd_req_to_sockfd(r);
+        httpd_req_async_handler_complete(r);
+        if (err != ESP_OK) httpd_sess_trigger_close(hd, fd);
+
+        portENTER_CRITICAL(&statsMux);
+        stats.active_workers--;
+        Metrics_Set(mWorkersBusy, stats.active_workers);
+        portEXIT_CRITICAL(&statsMux);
+    }
+}
+
+static void on(const char* uri, httpd_method_t method, HttpHandler handler, bool async = false) {
+    httpd_uri_t route = {};
+    route.uri = uri;
+    route.method = method;
+    route.handler = async ? runAsync : runInline;
+    route.user_ctx = reinterpret_cast<void*>(handler);
+    if (httpd_register_uri_handler(server, &route) != ESP_OK) {
+        Serial.printf("[HTTP] Failed to register %s\n", uri);
+    }
+}
+
+static esp_err_t onSocketOpen(httpd_handle_t, int) {
+    portENTER_CRITICAL(&statsMux);
+    stats.open_sockets++;
+    Metrics_Set(mOpenSockets, stats.open_sockets);
+    portEXIT_CRITICAL(&statsMux);
+    return ESP_OK;
+}
+
+static void onSocketClose(httpd_handle_t, int fd) {
+    portENTER_CRITICAL(&statsMux);
+    if (stats.open_sockets) stats.open_sockets--;
+    Metrics_Set(mOpenSockets, stats.open_sockets);
+    portEXIT_CRITICAL(&statsMux);
+    close(fd);                                  // With a close_fn set, httpd leaves this to us
+}
 
 /* Helpers */
-static bool readJsonBody(JsonDocument &doc) {
-    String body = server.arg("plain");
+static bool readJsonBody(HttpRequest& req, JsonDocument &doc) {
+    String body = req.arg("plain");
     DeserializationError err = deserializeJson(doc, body);
     if (err) {
         Serial.printf("[/alarms] JSON parse error: %s\n", err.c_str());
@@ -29,9 +194,9 @@ static bool readJsonBody(JsonDocument &doc) {
     return true;
 }
 
-static void sendJsonOk(const String &msg = "{}") { server.send(200, "application/json", msg); }
-static void sendBadRequest(const char* m) { server.send(400, "text/plain", m); }
-static void sendNotFound(const char* m) { server.send(404, "text/plain", m); }
+static esp_err_t sendJsonOk(HttpRequest& req, const String &msg = "{}") { return req.send(200, "application/json", msg); }
+static esp_err_t sendBadRequest(HttpRequest& req, const char* m) { return req.send(400, "text/plain", m); }
+static esp_err_t sendNotFound(HttpRequest& req, const char* m) { return req.send(404, "text/plain", m); }
 
 static void alarm_to_json(const Alarm &a, JsonObject out) {
     out["time"] = a.time;
@@ -83,368 +248,692 @@ bool deleteRecursive(String path) {
 }
 
 
+// One directory entry as the listing handler sees it
+struct ListEntry {
+    char name[LISTFILES_NAME_MAX];      // Directories end with '/'
+    uint32_t size;
+    bool isDir;
+};
+
+// Dirs first, then by name
+static bool listEntryLess(const ListEntry& a, const ListEntry& b) {
+    if (a.isDir != b.isDir) return a.isDir;
+    return strcmp(a.name, b.name) < 0;
+}
+
+// Calls fn for every entry of 'dir' matching 'ext' until it returns false. Returns false if 'dir' is not a directory.
+template <typename Fn>
+static bool forEachEntry(const String& dir, const String& ext, Fn fn) {
+    File root = SD_MMC.open(dir.c_str());
+    if (!root || !root.isDirectory()) return false;
+
+    ListEntry e;
+    while (true) {
+        File entry = root.openNextFile();
+        if (!entry) break;
+        e.isDir = entry.isDirectory();
+        e.size = e.isDir ? 0 : entry.size();
+        const char* base = strrchr(entry.name(), '/');
+        strlcpy(e.name, base ? base + 1 : entry.name(), sizeof(e.name) - 1);
+        entry.close();
+
+        // Add trailing slash to directory names
+        if (e.isDir) strlcat(e.name, "/", sizeof(e.name));
+        if (!ext.isEmpty() && !String(e.name).endsWith(ext)) continue;
+        if (!fn(e)) break;
+    }
+    root.close();
+    return true;
+}
+
+static void jsonEscapeTo(String& out, const char* s) {
+    for (; *s; ++s) {
+        const char c = *s;
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((uint8_t)c < 0x20) {
+            char esc[8];
+            snprintf(esc, sizeof(esc), "\\u%04x", c);
+            out += esc;
+        } else {
+            out += c;
+        }
+    }
+}
+
+// Chunked output of the listing, flushed every LISTFILES_FLUSH_BYTES
+class ListWriter {
+public:
+    ListWriter(HttpRequest& req, bool json) : req_(req), json_(json) { buf_.reserve(LISTFILES_FLUSH_BYTES + LISTFILES_NAME_MAX + 64); }
+
+    void raw(const String& s) {
+        buf_ += s;
+        flushIfFull();
+    }
+
+    void entry(const ListEntry& e) {
+        if (json_) {
+            buf_ += count_ ? ",\n  {\"name\":\"" : "\n  {\"name\":\"";
+            jsonEscapeTo(buf_, e.name);
+            buf_ += "\", \"size\":" + String(e.size) + ", \"isDir\":" + (e.isDir ? "true" : "false") + "}";
+        } else {
+            buf_ += "  ";
+            buf_ += e.name;
+            for (int pad = LISTFILES_NAME_COLUMN - (int)strlen(e.name); pad > 0; --pad) buf_ += ' ';
+            buf_ += "   " + String(e.size) + " bytes\n";
+        }
+        count_++;
+        flushIfFull();
+    }
+
+    bool ok() const { return ok_; }
+    uint32_t count() const { return count_; }
+
+    esp_err_t finish() {
+        flush();
+        return ok_ ? req_.endChunked() : ESP_FAIL;
+    }
+
+private:
+    void flushIfFull() {
+        if (buf_.length() >= LISTFILES_FLUSH_BYTES) flush();
+    }
+    void flush() {
+        if (ok_ && buf_.length()) ok_ = req_.sendChunk(buf_) == ESP_OK;
+        buf_ = "";
+    }
+
+    HttpRequest& req_;
+    bool json_;
+    String buf_;
+    uint32_t count_ = 0;
+    bool ok_ = true;
+};
+
+// GET /listfiles?path=&ext=&type=json|plain&sort=name|none&offset=&limit=&after=
+// Streamed with chunked encoding while the directory is read. Sorted output (the default) comes
+// from the DirCache snapshot, or for a directory too big for the cache from passes that each keep
+// the next 'batchCap' entries after a cursor in a bounded heap. batchCap is sized from free PSRAM
+// (a page only needs offset + limit + 1), so a few thousand files take one pass; past that every
+// pass re-reads the directory, and an unpaged sorted listing of a huge directory is slow. A page
+// continues with offset=next_offset, or after=next_after which skips the passes over earlier entries.
+static esp_err_t handleListFiles(HttpRequest& req) {
+    String dir = req.hasArg("path") ? req.arg("path") : String("/");
+    String ext = req.arg("ext");
+    String responseType = req.hasArg("type") ? req.arg("type") : String("plain");
+    String sort = req.hasArg("sort") ? req.arg("sort") : String("name");
+    const uint32_t offset = req.hasArg("offset") ? (uint32_t)req.arg("offset").toInt() : 0;
+    const uint32_t limit = req.hasArg("limit") ? (uint32_t)req.arg("limit").toInt() : 0;    // 0 = all
+    const String after = req.arg("after");
+    const bool paged = req.hasArg("offset") || req.hasArg("limit") || req.hasArg("after");
+
+    ext.toLowerCase();
+    responseType.toLowerCase();
+    const bool json = responseType == "json";
+    const bool sorted = sort != "none";
+
+    // Cached snapshot (already sorted) when the directory is not too big for the cache
+    const DirSnapshot* snap = DirCache_Acquire(dir.c_str());
+    const bool cached = snap != nullptr;
+    if (!snap) {
+        File probe = SD_MMC.open(dir.c_str());
+        if (!probe || !probe.isDirectory()) {
+            return req.send(404, "text/plain", "Directory not found: " + dir);
+        }
+        probe.close();
+    }
+
+    ListEntry* batch = nullptr;
+    size_t batchCap = 0;
+    if (sorted && !snap) {
+        batchCap = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) / LISTFILES_PSRAM_SHARE / sizeof(ListEntry);
+        if (batchCap > LISTFILES_SORT_MAX) batchCap = LISTFILES_SORT_MAX;
+        if (limit && batchCap > (size_t)offset + limit + 1) batchCap = (size_t)offset + limit + 1;
+        if (batchCap < LISTFILES_SORT_BATCH) batchCap = LISTFILES_SORT_BATCH;
+        batch = (ListEntry*)heap_caps_malloc(batchCap * sizeof(ListEntry), MALLOC_CAP_SPIRAM);
+        if (!batch) return req.send(500, "text/plain", "Memory allocation failed");
+    }
+
+    req.beginChunked(200, json ? "application/json" : "text/plain");
+    ListWriter out(req, json);
+    if (json) {
+        // Unpaged requests keep the plain array the web UI reads
+        if (paged) {
+            String head = "{\"path\":\"";
+            jsonEscapeTo(head, dir.c_str());
+            out.raw(head + "\", \"offset\":" + String(offset) + ", \"entries\":[");
+        } else {
+            out.raw("[");
+        }
+    } else {
+        out.raw("Files in " + dir + (ext.length() > 0 ? " (." + ext + ")" : "") + ":\n\n");
+    }
+
+    uint32_t skipped = 0;
+    bool more = false;                  // Entries left after this page
+    ListEntry last = {};
+    auto wanted = [&](const ListEntry& e) -> bool {    // Applies offset/limit, false once the page is full
+        if (skipped < offset) {
+            skipped++;
+            return true;
+        }
+        if (limit && out.count() >= limit) {
+            more = true;
+            return false;
+        }
+        out.entry(e);
+        last = e;
+        return out.ok();
+    };
+
+    if (snap) {
+        // A cursor is found by binary search instead of skipping the entries before it
+        size_t i = 0;
+        if (after.length()) {
+            const bool afterDir = after.endsWith("/");
+            const String key = afterDir ? after.substring(0, after.length() - 1) : after;
+            i = DirCache_UpperBound(snap, key.c_str(), afterDir);
+        }
+        ListEntry e;
+        for (const size_t n = DirCache_Count(snap); i < n; ++i) {
+            const DirCacheEntry c = DirCache_At(snap, i);
+            strlcpy(e.name, c.name, sizeof(e.name) - 1);
+            if (c.isDir) strlcat(e.name, "/", sizeof(e.name));
+            if (!ext.isEmpty() && !String(e.name).endsWith(ext)) continue;
+            e.size = c.size;
+            e.isDir = c.isDir;
+            if (!wanted(e)) break;
+        }
+        DirCache_Release(snap);
+    } else if (!sorted) {
+        forEachEntry(dir, ext, wanted);
+    } else {
+        // The cursor: the largest entry already handed out
+        ListEntry cursor = {};
+        bool haveCursor = false;
+        if (after.length()) {
+            strlcpy(cursor.name, after.c_str(), sizeof(cursor.name));
+            cursor.isDir = after.endsWith("/");
+            haveCursor = true;
+        }
+
+        bool done = false;
+        while (!done && out.ok()) {
+            // Smallest batchCap entries after the cursor, max-heap on listEntryLess
+            size_t n = 0;
+            forEachEntry(dir, ext, [&](const ListEntry& e) {
+                if (haveCursor && !listEntryLess(cursor, e)) return true;
+                if (n < batchCap) {
+                    batch[n++] = e;
+                    std::push_heap(batch, batch + n, listEntryLess);
+                } else if (listEntryLess(e, batch[0])) {
+                    std::pop_heap(batch, batch + n, listEntryLess);
+                    batch[n - 1] = e;
+                    std::push_heap(batch, batch + n, listEntryLess);
+                }
+                return true;
+            });
+            std::sort_heap(batch, batch + n, listEntryLess);
+
+            for (size_t i = 0; i < n && !done; ++i) {
+                if (!wanted(batch[i])) done = true;
+            }
+            if (n < batchCap) done = true;                      // Nothing after this batch
+            if (n) {
+                cursor = batch[n - 1];
+                haveCursor = true;
+            }
+        }
+        free(batch);
+    }
+
+    if (json) {
+        if (paged) {
+            String tail = "\n], \"next_offset\":";
+            tail += more ? String(offset + out.count()) : String("null");
+            tail += ", \"next_after\":";
+            if (more && (sorted || cached)) {
+                tail += "\"";
+                jsonEscapeTo(tail, last.name);
+                tail += "\"";
+            } else {
+                tail += "null";
+            }
+            out.raw(tail + "}");
+        } else {
+            out.raw("\n]");
+        }
+    } else if (more) {
+        out.raw("\n(more: offset=" + String(offset + out.count()) + (sorted || cached ? String(", after=") + last.name : String()) + ")\n");
+    }
+    return out.finish();
+}
+
+// Multipart upload streamed to SD as it arrives, the card written by the SdWriter task while the
+// next piece is received. The target directory is the "path" argument; the web UI sends that
+// field after the file, so the file is moved once the body is complete.
+static esp_err_t handleUpload(HttpRequest& req) {
+    String contentType = req.header("Content-Type");
+    int b = contentType.indexOf("boundary=");
+    if (!contentType.startsWith("multipart/form-data") || b < 0) {
+        return req.send(400, "text/plain", "Expected multipart/form-data");
+    }
+    String boundary = contentType.substring(b + 9);
+    int semi = boundary.indexOf(';');
+    if (semi >= 0) boundary = boundary.substring(0, semi);
+    boundary.trim();
+    if (boundary.startsWith("\"") && boundary.endsWith("\"") && boundary.length() >= 2) {
+        boundary = boundary.substring(1, boundary.length() - 1);
+    }
+    const String delim = "\r\n--" + boundary;    // Every boundary but the first is preceded by CRLF
+    const size_t dlen = delim.length();
+
+    const size_t cap = UPLOAD_BUFFER_BYTES;
+    char* buf = (char*)heap_caps_malloc(cap, MALLOC_CAP_SPIRAM);
+    if (!buf) return req.send(500, "text/plain", "Out of memory");
+
+    enum { PREAMBLE, AFTER_DELIM, HEADERS, BODY, DONE } state = PREAMBLE;
+    memcpy(buf, "\r\n", 2);                   // So the first boundary matches 'delim' as well
+    size_t len = 2;
+    bool eof = false;
+    bool failed = false;
+
+    String dir = req.hasArg("path") ? req.arg("path") : String("/");
+    String fieldName, fileName, fieldValue, writtenPath;
+    SdUpload* file = nullptr;
+    SdWriterResult result = {};
+
+    while (state != DONE && !failed) {
+        // Top up the buffer
+        if (!eof && len < cap) {
+            const int n = req.read(buf + len, cap - len);
+            if (n < 0) {
+                failed = true;
+                break;
+            }
+            if (n == 0) eof = true;
+            len += n;
+        }
+
+        size_t used = 0;
+        bool progress = true;
+        while (progress && !failed && state != DONE) {
+            progress = false;
+            char* p = buf + used;
+            const size_t avail = len - used;
+
+            if (state == PREAMBLE || state == BODY) {
+                char* hit = (char*)memmem(p, avail, delim.c_str(), dlen);
+                // Data before the boundary; without one, all but a possible partial boundary at the end
+                const size_t dataLen = hit ? hit - p : (avail >= dlen ? avail - (dlen - 1) : 0);
+                if (state == BODY && dataLen) {
+                    if (file) {
+                        if (!SdWriter_Write(file, p, dataLen)) failed = true;
+                    } else if (fileName.isEmpty() && fieldValue.length() + dataLen <= UPLOAD_FIELD_MAX) {
+                        fieldValue.concat(p, dataLen);
+                    }
+                }
+                used += dataLen;
+                if (hit) {
+                    used += dlen;
+                    if (state == BODY) {
+                        if (file) {
+                            if (!SdWriter_Close(file, &result)) failed = true;
+                            file = nullptr;
+                            Serial.printf("[HTTP] Upload %s: %llu bytes in %u ms, %.2f MB/s (SD %.2f MB/s)\n", writtenPath.c_str(),
+                                          (unsigned long long)result.bytes, result.ms, result.mbps, result.sd_mbps);
+                        } else if (fieldName == "path") {
+                            dir = fieldValue;
+                        }
+                    }
+                    state = AFTER_DELIM;
+                }
+                progress = hit || dataLen;
+            } else if (state == AFTER_DELIM) {
+                if (avail >= 2) {
+                    state = (p[0] == '-' && p[1] == '-') ? DONE : HEADERS;
+                    used += 2;                  // "--" closes the body, otherwise CRLF before the part headers
+                    progress = true;
+                }
+            } else if (state == HEADERS) {
+                char* end = (char*)memmem(p, avail, "\r\n\r\n", 4);
+                if (end) {
+                    String headers;
+                    headers.concat(p, end - p);
+                    used += end - p + 4;
+                    auto param = [&headers](const char* key) -> String {
+                        int k = headers.indexOf(key);
+                        if (k < 0) return String();
+                        k += strlen(key);
+                        int q = headers.indexOf('"', k);
+                        return q < 0 ? String() : headers.substring(k, q);
+                    };
+                    fieldName = param(" name=\"");
+                    fileName = param("filename=\"");
+                    fieldValue = "";
+
+                    int slash = fileName.lastIndexOf('/');
+                    if (slash < 0) slash = fileName.lastIndexOf('\\');
+                    if (slash >= 0) fileName = fileName.substring(slash + 1);
+
+                    if (!fileName.isEmpty() && !file && writtenPath.isEmpty()) {
+                        String target = dir.startsWith("/") ? dir : "/" + dir;
+                        if (!target.endsWith("/")) target += "/";
+                        writtenPath = target + fileName;
+                        // Content-Length covers the whole form, a bit more than the file
+                        file = SdWriter_Open(writtenPath.c_str(), req.contentLength());
+                        if (!file) {
+                            Serial.printf("[HTTP] Failed to open %s for writing\n", writtenPath.c_str());
+                            failed = true;
+                        }
+                    }
+                    state = BODY;
+                    progress = true;
+                } else if (avail >= cap) {
+                    failed = true;              // Part headers larger than the buffer
+                }
+            }
+        }
+
+        memmove(buf, buf + used, len - used);
+        len -= used;
+        if (eof && state != DONE && !progress) failed = true;   // Body ended inside a part
+    }
+
+    if (file) SdWriter_Close(file);
+    free(buf);
+    if (failed || writtenPath.isEmpty()) {
+        if (!writtenPath.isEmpty()) {
+            SD_MMC.remove(writtenPath.c_str());
+            DirCache_Invalidate(writtenPath.c_str());
+        }
+        return req.send(failed ? 500 : 400, "text/plain", failed ? "Upload failed" : "No file in upload");
+    }
+    DirCache_Invalidate(writtenPath.c_str());
+
+    // A "path" field after the file: move it there
+    String target = dir.startsWith("/") ? dir : "/" + dir;
+    if (!target.endsWith("/")) target += "/";
+    const String finalPath = target + writtenPath.substring(writtenPath.lastIndexOf('/') + 1);
+    if (finalPath != writtenPath) {
+        SD_MMC.remove(finalPath.c_str());
+        const bool moved = SD_MMC.rename(writtenPath.c_str(), finalPath.c_str());
+        DirCache_Invalidate(writtenPath.c_str());
+        DirCache_Invalidate(finalPath.c_str());
+        if (!moved) {
+            return req.send(500, "text/plain", "Uploaded, but could not move to " + finalPath);
+        }
+    }
+    return req.send(200, "text/plain", "Upload complete");
+}
+
 void HttpServer_Begin(Audio& audio)
 {
     audio_ptr = &audio;
-    static File uploadFile;
+    registerMetrics();
+    MicStream_Init();
+    EventStream_Init();
+
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.server_port = HTTP_PORT;
+    config.max_open_sockets = HTTP_MAX_SOCKETS;
+    config.max_uri_handlers = HTTP_MAX_URI_HANDLERS;
+    config.stack_size = HTTP_TASK_STACK;
+    config.task_priority = HTTP_TASK_PRIORITY;
+    config.core_id = 0;
+    config.lru_purge_enable = true;         // A new client closes the least recently used idle connection
+    config.uri_match_fn = httpd_uri_match_wildcard;
+    config.open_fn = onSocketOpen;
+    config.close_fn = onSocketClose;
+
+    if (httpd_start(&server, &config) != ESP_OK) {
+        Serial.println("[HTTP] Failed to start server");
+        return;
+    }
+
+    asyncQueue = xQueueCreate(HTTP_ASYNC_QUEUE, sizeof(httpd_req_t*));
+    playMutex = xSemaphoreCreateMutex();
+    for (int i = 0; i < HTTP_ASYNC_WORKERS; ++i) {
+        char name[16];
+        snprintf(name, sizeof(name), "HttpWorker%d", i);
+        xTaskCreatePinnedToCore(workerTask, name, HTTP_WORKER_STACK, nullptr, HTTP_TASK_PRIORITY, nullptr, 0);
+    }
 
-    server.on("/backlight", HTTP_POST, []() {
-        if (server.hasArg("on")) {
-            String value = server.arg("on");
+    on("/backlight", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (req.hasArg("on")) {
+            String value = req.arg("on");
             value.toLowerCase();
 
             bool turnOn = (value == "1" || value == "true" || value == "on");
             LCD_SetBacklight(turnOn);
 
-            server.send(200, "text/plain", "Backlight " + String(turnOn ? "ON" : "OFF"));
+            return req.send(200, "text/plain", "Backlight " + String(turnOn ? "ON" : "OFF"));
         } else {
-            server.send(400, "text/plain", "Missing 'on' parameter (use: 1, true, on)");
+            return req.send(400, "text/plain", "Missing 'on' parameter (use: 1, true, on)");
         }
     });
 
     // Get volume
-    server.on("/volume", HTTP_GET, []() {
-        server.send(200, "text/plain", String(GetVolume()));
+    on("/volume", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        return req.send(200, "text/plain", String(GetVolume()));
     });
 
     // Set volume
-    server.on("/volume", HTTP_POST, []() {
-        if (server.hasArg("value")) {
-            int vol = server.arg("value").toInt();
+    on("/volume", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (req.hasArg("value")) {
+            int vol = req.arg("value").toInt();
             vol = constrain(vol, 0, 21);
             SetVolume(vol);
-            server.send(200, "text/plain", "Volume set to " + String(vol));
+            return req.send(200, "text/plain", "Volume set to " + String(vol));
         } else {
-            server.send(400, "text/plain", "Missing 'value' parameter");
+            return req.send(400, "text/plain", "Missing 'value' parameter");
         }
     });
 
     // Play URL
-    server.on("/play", HTTP_POST, []() {
-        if (server.hasArg("url")) {
-            String url = server.arg("url");
-            audio_ptr->connecttohost(url.c_str());
-            server.send(200, "text/plain", "Playing: " + url);
+    on("/play", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (req.hasArg("url")) {
+            String url = req.arg("url");
+            xSemaphoreTake(playMutex, portMAX_DELAY);
+            AlarmScheduler_OnPlaybackStarted();
+            StreamMonitor_Connect(url.c_str());
+            xSemaphoreGive(playMutex);
+            return req.send(200, "text/plain", "Playing: " + url);
         } else {
-            server.send(400, "text/plain", "Missing 'url' parameter");
+            return req.send(400, "text/plain", "Missing 'url' parameter");
         }
-    });
+    }, true);
 
     // Stop playig 
-    server.on("/stop", HTTP_POST, []() {
+    on("/stop", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         audio_ptr->stopSong();
-        server.send(200, "text/plain", "Playback stopped");
+        StreamMonitor_Stop();
+        return req.send(200, "text/plain", "Playback stopped");
     });
 
     // Speech
-    server.on("/speech", HTTP_POST, []() {
-        if (server.hasArg("text") && server.hasArg("lang")) {
-            String text = server.arg("text");
-            String lang = server.arg("lang");
-            if (audio_ptr->connecttospeech(text.c_str(), lang.c_str())) {
-                server.send(200, "text/plain", "Speaking: " + text);
+    on("/speech", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (req.hasArg("text") && req.hasArg("lang")) {
+            String text = req.arg("text");
+            String lang = req.arg("lang");
+            xSemaphoreTake(playMutex, portMAX_DELAY);
+            const bool ok = TTSCache_Speak(text.c_str(), lang.c_str());
+            xSemaphoreGive(playMutex);
+            if (ok) {
+                return req.send(200, "text/plain", "Speaking: " + text);
             } else {
-                server.send(500, "text/plain", "Failed to play speech");
+                return req.send(500, "text/plain", "Failed to play speech");
             }
         } else {
-            server.send(400, "text/plain", "Missing 'text' or 'lang' parameter");
+            return req.send(400, "text/plain", "Missing 'text' or 'lang' parameter");
         }
-    });
+    }, true);
 
     // Play file
-    server.on("/playfile", HTTP_POST, []() {
-        if (server.hasArg("path")) {
-            String path = server.arg("path");
+    on("/playfile", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (req.hasArg("path")) {
+            String path = req.arg("path");
 
             // Just try to open the file to verify existence
             File f = SD_MMC.open(path.c_str());
             if (!f || f.isDirectory()) {
-                server.send(404, "text/plain", "File not found: " + path);
-                return;
+                return req.send(404, "text/plain", "File not found: " + path);
             }
             f.close();
 
-            if (audio_ptr->connecttoFS(SD_MMC, path.c_str())) {
-                server.send(200, "text/plain", "Playing file: " + path);
+            xSemaphoreTake(playMutex, portMAX_DELAY);
+            StreamMonitor_Stop();
+            AlarmScheduler_OnPlaybackStarted();
+            const bool ok = audio_ptr->connecttoFS(SD_MMC, path.c_str());
+            xSemaphoreGive(playMutex);
+            if (ok) {
+                return req.send(200, "text/plain", "Playing file: " + path);
             } else {
-                server.send(500, "text/plain", "Failed to play file: " + path);
+                return req.send(500, "text/plain", "Failed to play file: " + path);
             }
         } else {
-            server.send(400, "text/plain", "Missing 'path' parameter");
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
-    });
-
-    // Upload file
-    server.on("/upload", HTTP_POST,
-        []() {
-            server.send(200, "text/plain", "Upload complete");
-        },
-        []() {
-            HTTPUpload& upload = server.upload();
-
-            static String targetPath = "/";
-
-            if (upload.status == UPLOAD_FILE_START) {
-                // Determine the directory path from the POST argument (form field)
-                if (server.hasArg("path")) {
-                    targetPath = server.arg("path");
-                    if (!targetPath.startsWith("/")) targetPath = "/" + targetPath;
-                    if (!targetPath.endsWith("/")) targetPath += "/";
-                } else {
-                    targetPath = "/";
-                }
+    }, true);
 
-                String fullPath = targetPath + upload.filename;
-                Serial.printf("Upload Start, full path: %s\n", fullPath.c_str());
-
-                uploadFile = SD_MMC.open(fullPath.c_str(), FILE_WRITE);
-                if (!uploadFile) {
-                    Serial.println("Failed to open file for writing");
-                }
-
-            } else if (upload.status == UPLOAD_FILE_WRITE) {
-                if (uploadFile) uploadFile.write(upload.buf, upload.currentSize);
-
-            } else if (upload.status == UPLOAD_FILE_END) {
-                if (uploadFile) {
-                    uploadFile.close();
-                    Serial.println("Upload finished");
-                }
-            }
-        }
-    );
+    // Upload file (multipart/form-data)
+    on("/upload", HTTP_POST, handleUpload, true);
 
-    server.on("/delete", HTTP_POST, []() {
-        if (!server.hasArg("path")) {
-            server.send(400, "text/plain", "Missing 'path' parameter");
-            return;
+    on("/delete", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("path")) {
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
 
-        String path = server.arg("path");
+        String path = req.arg("path");
         if (!path.startsWith("/")) path = "/" + path;
 
         if (!SD_MMC.exists(path.c_str())) {
-            server.send(404, "text/plain", "File not found: " + path);
-            return;
+            return req.send(404, "text/plain", "File not found: " + path);
         }
 
-        if (SD_MMC.remove(path.c_str()) || SD_MMC.rmdir(path.c_str())) {
-            server.send(200, "text/plain", "Deleted: " + path);
+        const bool deleted = SD_MMC.remove(path.c_str()) || SD_MMC.rmdir(path.c_str());
+        DirCache_Invalidate(path.c_str(), true);
+        if (deleted) {
+            return req.send(200, "text/plain", "Deleted: " + path);
         } else {
-            server.send(500, "text/plain", "Failed to delete: " + path);
+            return req.send(500, "text/plain", "Failed to delete: " + path);
         }
     });
 
-    // List files and folders with sorting (dirs first, A-Z)
-    server.on("/listfiles", HTTP_GET, []() {
-        String dir = "/";
-        String ext = "";
-        String responseType = "plain";
-
-        if (server.hasArg("path")) dir = server.arg("path");
-        if (server.hasArg("ext")) ext = server.arg("ext");
-        if (server.hasArg("type")) responseType = server.arg("type");
-
-        ext.toLowerCase();
-        responseType.toLowerCase();
-
-        File root = SD_MMC.open(dir.c_str());
-        if (!root || !root.isDirectory()) {
-            server.send(404, "text/plain", "Directory not found: " + dir);
-            return;
-        }
-
-        struct Entry {
-            String name;
-            size_t size;
-            bool isDir;
-        };
-        std::vector<Entry>* entries = new(std::nothrow) std::vector<Entry>();
-        if (!entries) {
-            server.send(500, "text/plain", "Memory allocation failed");
-            root.close();
-            return;
-        }
-
-        root.rewindDirectory();
-        while (true) {
-            File entry = root.openNextFile();
-            if (!entry) break;
-
-            String name = String(entry.name());
-            bool isDir = entry.isDirectory();
-            size_t size = isDir ? 0 : entry.size();
-
-            // Add trailing slash to directory names
-            if (isDir && !name.endsWith("/")) name += "/";
-
-            if (ext.isEmpty() || name.endsWith(ext)) {
-                entries->push_back({name, size, isDir});
-            }
-
-            entry.close();
-        }
-        root.close();
-
-        // Sort: Directories first, A-Z
-        std::sort(entries->begin(), entries->end(), [](const Entry& a, const Entry& b) {
-            if (a.isDir != b.isDir) return a.isDir > b.isDir; // dirs first
-            return a.name.compareTo(b.name) < 0; // then sort by name A-Z
-        });
-
-        if (responseType == "json") {
-            String json = "[\n";
-            for (size_t i = 0; i < entries->size(); ++i) {
-                const auto& e = (*entries)[i];
-                json += "  {\"name\":\"" + e.name + "\", \"size\":" + String(e.size) + ", \"isDir\":" + (e.isDir ? "true" : "false") + "}";
-                if (i < entries->size() - 1) json += ",";
-                json += "\n";
-            }
-            json += "]";
-            delete entries;
-            server.send(200, "application/json", json);
-            return;
-        }
-
-        // Plain text
-        size_t maxNameLen = 0;
-        for (const auto& e : *entries) {
-            if (e.name.length() > maxNameLen)
-                maxNameLen = e.name.length();
-        }
-
-        String response = "Files in " + dir + (ext.length() > 0 ? " (." + ext + ")" : "") + ":\n\n";
-        for (const auto& e : *entries) {
-            String name = e.name;
-            size_t size = e.size;
-
-            int padding = maxNameLen - name.length();
-            response += "  " + name;
-            for (int i = 0; i < padding; ++i) response += " ";
-            response += "   " + String(size) + " bytes\n";
-        }
-
-        delete entries;
-        server.send(200, "text/plain", response);
-    });
+    // List files and folders, streamed and paginated (dirs first, A-Z)
+    on("/listfiles", HTTP_GET, handleListFiles, true);
 
     // Make directory
-    server.on("/mkdir", HTTP_POST, []() {
-        if (!server.hasArg("path")) {
-            server.send(400, "text/plain", "Missing 'path' parameter");
-            return;
+    on("/mkdir", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("path")) {
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
-        String path = server.arg("path");
+        String path = req.arg("path");
         if (!path.startsWith("/")) path = "/" + path;
 
-        if (SD_MMC.mkdir(path.c_str())) {
-            server.send(200, "text/plain", "Directory created: " + path);
+        const bool created = SD_MMC.mkdir(path.c_str());
+        DirCache_Invalidate(path.c_str());
+        if (created) {
+            return req.send(200, "text/plain", "Directory created: " + path);
         } else {
-            server.send(500, "text/plain", "Failed to create directory: " + path);
+            return req.send(500, "text/plain", "Failed to create directory: " + path);
         }
     });
 
     // Remove directory
-    server.on("/rmdir", HTTP_POST, []() {
-        if (!server.hasArg("path")) {
-            server.send(400, "text/plain", "Missing 'path' parameter");
-            return;
+    on("/rmdir", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("path")) {
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
 
-        String path = server.arg("path");
+        String path = req.arg("path");
         if (!path.startsWith("/")) path = "/" + path;
 
         if (!SD_MMC.exists(path.c_str())) {
-            server.send(404, "text/plain", "Directory does not exist: " + path);
-            return;
+            return req.send(404, "text/plain", "Directory does not exist: " + path);
         }
 
-        if (deleteRecursive(path)) {
-            server.send(200, "text/plain", "Directory deleted: " + path);
+        const bool deleted = deleteRecursive(path);
+        DirCache_Invalidate(path.c_str(), true);     // Also when only part of the tree went
+        if (deleted) {
+            return req.send(200, "text/plain", "Directory deleted: " + path);
         } else {
-            server.send(500, "text/plain", "Failed to delete: " + path);
+            return req.send(500, "text/plain", "Failed to delete: " + path);
         }
-    });
+    }, true);
 
     // Move file
-    server.on("/move", HTTP_POST, []() {
-        if (!server.hasArg("from") || !server.hasArg("to")) {
-            server.send(400, "text/plain", "Missing 'from' or 'to' parameter");
-            return;
+    on("/move", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("from") || !req.hasArg("to")) {
+            return req.send(400, "text/plain", "Missing 'from' or 'to' parameter");
         }
 
-        String from = server.arg("from");
-        String to = server.arg("to");
+        String from = req.arg("from");
+        String to = req.arg("to");
         if (!from.startsWith("/")) from = "/" + from;
         if (!to.startsWith("/")) to = "/" + to;
 
         if (!SD_MMC.exists(from.c_str())) {
-            server.send(404, "text/plain", "Source does not exist: " + from);
-            return;
+            return req.send(404, "text/plain", "Source does not exist: " + from);
         }
 
-        if (SD_MMC.rename(from.c_str(), to.c_str())) {
-            server.send(200, "text/plain", "Moved: " + from + " → " + to);
+        const bool moved = SD_MMC.rename(from.c_str(), to.c_str());
+        DirCache_Invalidate(from.c_str(), true);
+        DirCache_Invalidate(to.c_str(), true);
+        if (moved) {
+            return req.send(200, "text/plain", "Moved: " + from + " → " + to);
         } else {
-            server.send(500, "text/plain", "Failed to move file");
+            return req.send(500, "text/plain", "Failed to move file");
         }
     });
 
     // Download file
-    server.on("/download", HTTP_GET, []() {
-        if (!server.hasArg("path")) {
-            server.send(400, "text/plain", "Missing 'path' parameter");
-            return;
+    on("/download", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("path")) {
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
 
-        String path = server.arg("path");
+        String path = req.arg("path");
         if (!path.startsWith("/")) path = "/" + path;
 
         File file = SD_MMC.open(path.c_str(), FILE_READ);
         if (!file || file.isDirectory()) {
-            server.send(404, "text/plain", "File not found or is a directory: " + path);
-            return;
+            return req.send(404, "text/plain", "File not found or is a directory: " + path);
         }
 
-        String contentType = "application/octet-stream";
-        server.streamFile(file, contentType);
+        bool ok = req.sendFileRanges(file, "application/octet-stream");     // Resumable
         file.close();
-    });
+        return ok ? ESP_OK : ESP_FAIL;
+    }, true);
 
     // Preview file
-    server.on("/preview", HTTP_GET, []() {
-        if (!server.hasArg("path")) {
-            server.send(400, "text/plain", "Missing 'path' parameter");
-            return;
+    on("/preview", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        if (!req.hasArg("path")) {
+            return req.send(400, "text/plain", "Missing 'path' parameter");
         }
 
-        String path = server.arg("path");
+        String path = req.arg("path");
         if (!path.startsWith("/")) path = "/" + path;
 
         File file = SD_MMC.open(path.c_str(), FILE_READ);
         if (!file || file.isDirectory()) {
-            server.send(404, "text/plain", "File not found or is a directory: " + path);
-            return;
+            return req.send(404, "text/plain", "File not found or is a directory: " + path);
         }
 
         // Infer content type
-        String contentType = "text/plain";  // default
-        if (path.endsWith(".html")) contentType = "text/html";
-        else if (path.endsWith(".css")) contentType = "text/css";
-        else if (path.endsWith(".js")) contentType = "application/javascript";
-        else if (path.endsWith(".jpg") || path.endsWith(".jpeg")) contentType = "image/jpeg";
-        else if (path.endsWith(".png")) contentType = "image/png";
-        else if (path.endsWith(".gif")) contentType = "image/gif";
-        else if (path.endsWith(".svg")) contentType = "image/svg+xml";
-        else if (path.endsWith(".mp3")) contentType = "audio/mpeg";
-
-        server.streamFile(file, contentType);
+        String contentType = HttpRequest::contentTypeFor(path);
+        bool ok = req.sendFileRanges(file, contentType.c_str());           // Seeking in the audio player
         file.close();
-    });
+        return ok ? ESP_OK : ESP_FAIL;
+    }, true);
+
 
+    // Metrics for scraping: Prometheus text, or JSON with ?format=json
+    on("/metrics", HTTP_GET, Metrics_Serve);
 
     // Load ESP status
-    server.on("/status", HTTP_GET, []() {
+    on("/status", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
         String response;
 
         // WiFi Info
@@ -492,19 +981,167 @@ void HttpServer_Begin(Audio& audio)
         response += "Chip ID: " + String((uint32_t)ESP.getEfuseMac(), HEX) + "\n";
         response += "CPU Freq: " + String(ESP.getCpuFreqMHz()) + " MHz\n";
 
-        server.send(200, "text/plain", response);
+        // Audio mixer
+        AudioMixerStats mix;
+        AudioMixer_GetStats(&mix);
+        response += "\n[Audio Mixer]\n";
+        response += "Voice active: " + String(mix.voice_active ? "yes" : "no") + (mix.ducked ? " (music ducked)" : "") + "\n";
+        response += "Mix time: last " + String(mix.mix_us_last) + " us, max " + String(mix.mix_us_max) + " us\n";
+        response += "Mix CPU: " + String(mix.cpu_percent, 2) + " %\n";
+        response += "Voice buffer: " + String(mix.voice_fill_ms) + " ms\n";
+        response += "Voice latency: " + String(mix.voice_latency_ms) + " ms\n";
+        response += "Voice overruns/underruns: " + String(mix.voice_overruns) + "/" + String(mix.voice_underruns) + "\n";
+
+        // Settings store
+        response += "\n[Settings]\n";
+        response += "Flash writes: " + String(Settings_GetFlashWrites()) + "\n";
+        response += "Coalesced writes: " + String(Settings_GetCoalescedWrites()) + "\n";
+
+        // Assistant WebSocket
+        AssistantLinkStats ws;
+        AIAssistant_GetLinkStats(&ws);
+        response += "\n[Assistant Link]\n";
+        response += "Connected: " + String(ws.connected ? "yes" : "no") + ", connects: " + String(ws.reconnects) + ", ping RTT: " + String(ws.ping_rtt_ms) + " ms\n";
+        response += "Client task wakeups: " + String(ws.wakeups) + " (" + String(ws.wakeups_per_min, 1) + "/min), keepalive pings: " + String(ws.idle_timeouts) + "\n";
+        response += "Inbound messages: " + String(ws.messages) + ", dispatch latency: last " + String(ws.dispatch_us_last) + " us, avg " + String(ws.dispatch_us_avg) + " us, max " + String(ws.dispatch_us_max) + " us\n";
+        response += "JSON parse: last " + String(ws.parse_us_last) + " us, max " + String(ws.parse_us_max) + " us, errors: " + String(ws.parse_errors) + ", largest message: " + String(ws.largest_message) + " bytes\n";
+
+        // Assistant latency (details at /latency)
+        LatencyTraceStats lt;
+        LatencyTrace_GetStats(&lt);
+        response += "\n[Assistant Latency]\n";
+        response += "Requests: " + String(lt.started) + ", completed: " + String(lt.completed) + ", abandoned: " + String(lt.abandoned) + "\n";
+        response += "Release -> first audio: p50 " + String(lt.total_p50_ms) + " ms, p95 " + String(lt.total_p95_ms) + " ms (last " + String(lt.history) + ")\n";
+        response += "Last: upload " + String(lt.last.upload_ms) + ", network " + String(lt.last.network_ms) + ", queue " + String(lt.last.queue_ms) + ", whisper " + String(lt.last.stt_ms) + ", gpt " + String(lt.last.llm_ms) + ", tts " + String(lt.last.tts_ms) + ", play " + String(lt.last.play_ms) + " = " + String(lt.last.total_ms) + " ms\n";
+
+        // Assistant uplink
+        AudioUplinkStats up;
+        AudioUplink_GetStats(&up);
+        response += "\n[Audio Uplink]\n";
+        response += "Send queue: " + String(up.queue_depth) + " (peak " + String(up.queue_peak) + "), pool free: " + String(up.pool_free) + "/" + String(UPLINK_POOL_FRAMES) + "\n";
+        response += "Frames sent: " + String(up.frames_sent) + " in " + String(up.writes) + " writes\n";
+        response += "Control: " + String(up.texts_sent) + " sent, wait last " + String(up.control_wait_us_last) + " us, max " + String(up.control_wait_us_max) + " us\n";
+        response += "Telemetry: " + String(up.telemetry_sent) + " sent, " + String(up.telemetry_dropped) + " dropped\n";
+        response += "Dropped: " + String(up.dropped) + ", pool exhausted: " + String(up.pool_exhausted) + "\n";
+        response += "Write time: last " + String(up.send_us_last) + " us, max " + String(up.send_us_max) + " us\n";
+        response += "Backpressure stage: " + String(up.stage) + " (peak " + String(up.stage_peak) + ", " + String(up.stage_changes) + " changes), backlog: " + String(up.backlog_ms) + " ms\n";
+        response += "Degraded: " + String(up.pressure_writes) + " large writes, " + String(up.frames_compressed) + " frames mu-law (" + String((uint32_t)(up.bytes_saved / 1024)) + " KB saved), " + String(up.silent_dropped) + " silent dropped, " + String(up.oldest_dropped) + " oldest dropped\n";
+
+        // Assistant reply audio
+        AudioDownlinkStats dl;
+        AudioDownlink_GetStats(&dl);
+        response += "\n[Audio Downlink]\n";
+        response += "Streams: " + String(dl.streams) + (dl.active ? " (active)" : "") + ", frames: " + String(dl.frames) + ", gaps: " + String(dl.gaps) + "\n";
+        response += "Jitter buffer: " + String(dl.fill_ms) + " ms, overruns: " + String(dl.overruns) + " bytes, decoder caught up: " + String(dl.underruns) + "\n";
+        response += "Last reply: first frame " + String(dl.first_frame_ms) + " ms, first audio " + String(dl.first_audio_ms) + " ms\n";
+        response += "Text TTS fallbacks: " + String(dl.fallbacks) + "\n";
+
+        // Recording uploads
+        FileUploaderStats ul;
+        FileUploader_GetStats(&ul);
+        response += "\n[Uploader]\n";
+        response += "Uploads: " + String(ul.uploads) + ", failures: " + String(ul.failures) + ", queued: " + String(ul.queued) + "\n";
+        response += "Connections: " + String(ul.connects) + " opened, " + String(ul.reused) + " reused, " + String(ul.retries) + " stale retries\n";
+        response += "Throughput: last " + String(ul.last_kbps) + " kB/s (" + String(ul.last_bytes) + " bytes), avg " + String(ul.avg_kbps) + " kB/s\n";
+        response += "Last upload: connect " + String(ul.last_connect_ms) + " ms, send " + String(ul.last_send_ms) + " ms, response " + String(ul.last_response_ms) + " ms, total " + String(ul.last_total_ms) + " ms (max " + String(ul.max_total_ms) + " ms)\n";
+
+        // Requests waiting for the backend
+        RequestSpoolStats sp;
+        RequestSpool_GetStats(&sp);
+        response += "\n[Request Spool]\n";
+        response += "Waiting: " + String(sp.depth) + " (" + String((uint32_t)(sp.bytes / 1024)) + " KB), oldest: " + String(sp.oldest_age_s) + " s" + (sp.replaying ? ", replaying\n" : "\n");
+        response += "Spooled: " + String(sp.spooled) + ", replayed: " + String(sp.replayed) + ", replay failures: " + String(sp.replay_failures) + "\n";
+        response += "Dropped: " + String(sp.expired) + " expired, " + String(sp.evicted) + " spool full\n";
+
+        // Alarm scheduler
+        AlarmSchedulerStats al;
+        AlarmScheduler_GetStats(&al);
+        response += "\n[Alarm Scheduler]\n";
+        if (al.next_epoch) {
+            struct tm nt;
+            localtime_r(&al.next_epoch, &nt);
+            char nbuf[20];
+            strftime(nbuf, sizeof(nbuf), "%Y-%m-%d %H:%M", &nt);
+            response += "Next alarm: " + String(nbuf) + (al.prewarmed ? " (pre-warmed)\n" : "\n");
+        } else {
+            response += "Next alarm: none\n";
+        }
+        response += "Fired: " + String(al.fired) + " (pre-warmed " + String(al.prewarm_hits) + ", cold " + String(al.cold_starts) + ")\n";
+        response += "Start offset: last ";
+        response += al.last_offset_ms == INT32_MIN ? String("n/a") : String(al.last_offset_ms) + " ms";
+        response += ", worst " + String(al.worst_offset_ms) + " ms, within " + String(ALARM_START_TOLERANCE_MS) + " ms: " + String(al.within_tolerance) + "\n";
+
+        // Web server
+        HttpServerStats hs;
+        HttpServer_GetStats(&hs);
+        response += "\n[HTTP Server]\n";
+        response += "Requests: " + String(hs.requests) + " (" + String(hs.async_requests) + " on workers), rejected busy: " + String(hs.rejected) + ", 206: " + String(hs.partial) + ", 4xx/5xx: " + String(hs.client_errors) + "/" + String(hs.server_errors) + "\n";
+        response += "Open sockets: " + String(hs.open_sockets) + "/" + String(HTTP_MAX_SOCKETS) + ", workers busy: " + String(hs.active_workers) + "/" + String(HTTP_ASYNC_WORKERS) + " (peak " + String(hs.workers_peak) + ")\n";
+        response += "Longest handler: inline " + String(hs.inline_ms_max) + " ms, worker " + String(hs.async_ms_max) + " ms, sent: " + String((uint32_t)(hs.bytes_sent / 1024)) + " KB\n";
+
+        // Web uploads to SD
+        SdWriterStats sw;
+        SdWriter_GetStats(&sw);
+        response += "\n[Uploads]\n";
+        response += "Files: " + String(sw.uploads) + " (" + String(sw.failures) + " failed, " + String(sw.active) + " running), " + String((uint32_t)(sw.bytes / 1024)) + " KB, preallocated: " + String(sw.preallocated) + "\n";
+        response += "Throughput: last " + String(sw.last_mbps, 2) + " MB/s, avg " + String(sw.avg_mbps, 2) + " MB/s (last " + String(SDWRITER_RATE_WINDOW) + "), SD writes " + String(sw.sd_mbps, 2) + " MB/s, waits for SD: " + String(sw.stalls) + "\n";
+
+        // Microphone listeners on /stream
+        MicStreamStats ms;
+        MicStream_GetStats(&ms);
+        response += "\n[Mic Stream]\n";
+        response += "Listeners: " + String(ms.listeners) + "/" + String(MICSTREAM_MAX_LISTENERS) + " (peak " + String(ms.listeners_peak) + "), sessions: " + String(ms.sessions) + ", rejected: " + String(ms.rejected) + ", microphone " + (ms.paused ? "in use by the assistant" : ms.capturing ? "on" : "off") + "\n";
+        response += "Captured: " + String((uint32_t)(ms.captured_bytes / 1024)) + " KB, sent: " + String((uint32_t)(ms.sent_bytes / 1024)) + " KB, dropped blocks: " + String(ms.dropped_blocks) + ", kicked: " + String(ms.kicked) + ", preempted: " + String(ms.preempted) + ", I2S errors: " + String(ms.i2s_errors) + "\n";
+
+        // Server-sent events for the web UI
+        EventStreamStats ev;
+        EventStream_GetStats(&ev);
+        response += "\n[Events]\n";
+        response += "Subscribers: " + String(ev.subscribers) + "/" + String(EVENTS_MAX_SUBSCRIBERS) + " (peak " + String(ev.subscribers_peak) + "), sessions: " + String(ev.sessions) + ", rejected: " + String(ev.rejected) + "\n";
+        response += "Notifies: " + String(ev.notifies) + ", published: " + String(ev.published) + ", sent: " + String(ev.sent) + ", keepalives: " + String(ev.keepalives) + "\n";
+
+        // SD directory cache
+        DirCacheStats dc;
+        DirCache_GetStats(&dc);
+        const uint32_t dcLookups = dc.hits + dc.misses;
+        response += "\n[Directory Cache]\n";
+        response += "Directories: " + String(dc.dirs) + "/" + String(DIRCACHE_MAX_DIRS) + ", entries: " + String(dc.entries) + ", PSRAM: " + String(dc.bytes / 1024) + " KB\n";
+        response += "Hits/Misses: " + String(dc.hits) + "/" + String(dc.misses) + " (" + String(dcLookups ? dc.hits * 100.0f / dcLookups : 0.0f, 1) + " % hit)\n";
+        response += "Invalidated: " + String(dc.invalidations) + ", evicted: " + String(dc.evictions) + ", too big: " + String(dc.uncacheable) + ", scan: last " + String(dc.scan_ms_last) + " ms, max " + String(dc.scan_ms_max) + " ms\n";
+
+        // Static web UI files
+        WebAssetStats wa;
+        WebAssets_GetStats(&wa);
+        response += "\n[Web Assets]\n";
+        response += "Requests: " + String(wa.requests) + " (" + String(wa.page_views) + " page views, " + String(wa.embedded) + " built-in), 304: " + String(wa.not_modified) + ", gzip: " + String(wa.gzip) + "\n";
+        response += "PSRAM hits/misses: " + String(wa.cache_hits) + "/" + String(wa.cache_misses) + ", cached: " + String(wa.entries) + " files, " + String(wa.cached_bytes / 1024) + "/" + String(WEBASSET_CACHE_BYTES / 1024) + " KB, evicted: " + String(wa.evictions) + "\n";
+        response += "SD reads: " + String(wa.sd_reads) + " (" + String(wa.sd_reads_per_view, 1) + " per page view, " + String((uint32_t)(wa.sd_bytes / 1024)) + " KB), serve: avg " + String(wa.serve_us_avg) + " us, max " + String(wa.serve_us_max) + " us\n";
+
+        // TTS cache
+        TTSCacheStats tts;
+        TTSCache_GetStats(&tts);
+        uint32_t ttsLookups = tts.hits + tts.misses;
+        response += "\n[TTS Cache]\n";
+        response += "Hits/Misses: " + String(tts.hits) + "/" + String(tts.misses);
+        response += " (" + String(ttsLookups ? tts.hits * 100.0f / ttsLookups : 0.0f, 1) + " % hit)\n";
+        response += "Bypassed: " + String(tts.bypassed) + "\n";
+        response += "Entries: " + String(tts.entries) + ", " + String((uint32_t)tts.bytes_cached) + " bytes\n";
+        response += "Bytes saved: " + String((uint32_t)tts.bytes_saved) + "\n";
+        response += "Evictions: " + String(tts.evictions) + ", fetch failures: " + String(tts.fetch_failures) + "\n";
+
+        return req.send(200, "text/plain", response);
     });
 
     // Endpoint to trigger srmodels.bin flashing
-    server.on("/update_srmodels", HTTP_POST, []() {
+    on("/update_srmodels", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         bool force = false;
-        if (server.hasArg("force")) {
-            String f = server.arg("force");
+        if (req.hasArg("force")) {
+            String f = req.arg("force");
             f.toLowerCase();
             force = (f == "1" || f == "true" || f == "yes");
         }
 
-        server.send(200, "text/plain", "Update started. Please wait 30s...");
+        req.send(200, "text/plain", "Update started. Please wait 30s...");
 
         xTaskCreatePinnedToCore(
             [](void* param) {
@@ -520,14 +1157,14 @@ void HttpServer_Begin(Audio& audio)
             NULL,
             1
         );
+        return ESP_OK;
     });
 
     // Get stations
-    server.on("/stations", HTTP_GET, []() {
+    on("/stations", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
         File file = SD_MMC.open("/internet_stations.txt", FILE_READ);
         if (!file || file.isDirectory()) {
-            server.send(404, "application/json", "[]");
-            return;
+            return req.send(404, "application/json", "[]");
         }
 
         String json = "[\n";
@@ -541,105 +1178,43 @@ void HttpServer_Begin(Audio& audio)
             int sep = line.indexOf('|');
             if (sep <= 0 || sep >= line.length() - 1) continue;
 
+            // Optional third field: lower-bitrate fallback URL
+            int sep2 = line.indexOf('|', sep + 1);
             String name = line.substring(0, sep);
-            String url = line.substring(sep + 1);
+            String url = sep2 > 0 ? line.substring(sep + 1, sep2) : line.substring(sep + 1);
+            String fallback = sep2 > 0 ? line.substring(sep2 + 1) : "";
 
             if (!first) json += ",\n";
-            json += "  {\"name\":\"" + name + "\", \"url\":\"" + url + "\"}";
+            json += "  {\"name\":\"" + name + "\", \"url\":\"" + url + "\"";
+            if (!fallback.isEmpty()) json += ", \"fallback\":\"" + fallback + "\"";
+            json += "}";
             first = false;
         }
 
         json += "\n]";
         file.close();
 
-        server.send(200, "application/json", json);
+        return req.send(200, "application/json", json);
     });
 
-    // Stream I2S microphone data
-    server.on("/stream", HTTP_GET, []() {
-        WiFiClient client = server.client();
-        if (!client.connected()) return;
-
-        const uint32_t sampleRate = 16000;
-        const uint16_t bitsPerSample = 16;
-        const uint8_t channels = 1;
-
-        // Send HTTP headers
-        client.print("HTTP/1.1 200 OK\r\n");
-        client.print("Content-Type: application/octet-stream\r\n");
-        client.print("Connection: close\r\n\r\n");
-
-        // Start I2S
-        streamI2S.setPins(I2S_PIN_BCK, I2S_PIN_WS, I2S_PIN_DOUT, I2S_PIN_DIN);
-        streamI2S.setTimeout(1000);
-
-        Serial.println("[STREAM] Initializing I2S...");
-
-        if (!streamI2S.begin(I2S_MODE_STD, sampleRate, I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO, I2S_STD_SLOT_RIGHT)) {
-            Serial.println("[ERR] I2S begin failed");
-            client.stop();
-            return;
-        }
-
-        if (!streamI2S.configureRX(sampleRate, I2S_DATA_BIT_WIDTH_32BIT, I2S_SLOT_MODE_MONO, I2S_RX_TRANSFORM_32_TO_16)) {
-            Serial.println("[ERR] configureRX failed");
-            streamI2S.end();
-            client.stop();
-            return;
-        }
-        Serial.println("[STREAM] Microphone PCM stream started");
-
-        uint8_t buffer[512];
-        size_t bytesRead = 0;
-        uint32_t totalBytes = 0;
-        unsigned long startTime = millis();
-        const unsigned long maxDuration = 60000; // 60s
-
-        while (client.connected()) {
-                bytesRead = streamI2S.readBytes((char *)buffer, sizeof(buffer));
-                if (bytesRead > 0) {
-                    // Apply dynamic compression
-                    int16_t *samples = (int16_t *)buffer;
-                    size_t sampleCount = bytesRead / 2;
-
-                    for (size_t i = 0; i < sampleCount; i++) {
-                        float s = samples[i] / 32768.0f;
-
-                        // Soft compression
-                        if (fabsf(s) < 0.25f) {
-                            s *= 2.5f; // boost quiet
-                        } else if (fabsf(s) < 0.5f) {
-                            s *= 1.5f;
-                        } else if (fabsf(s) > 0.9f) {
-                            s *= 0.8f; // limit loud
-                        }
-
-                        // Clamp to [-1, 1] and convert back
-                        if (s > 1.0f) s = 1.0f;
-                        if (s < -1.0f) s = -1.0f;
-
-                        samples[i] = (int16_t)(s * 32767);
-                    }
-
-                    client.write(buffer, bytesRead);
-                    totalBytes += bytesRead;
-                }
+    // Radio stream health: buffer fill, jitter, underruns, reconnects, throughput per station
+    on("/streamstats", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        return req.send(200, "application/json", StreamMonitor_ToJson());
+    });
 
-            delay(1);  // Avoid starving WiFi stack
+    // Per-request assistant latency breakdown, rolling histogram
+    on("/latency", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        return req.send(200, "application/json", LatencyTrace_ToJson());
+    });
 
-            if (millis() - startTime > maxDuration) {
-                Serial.printf("[STREAM] Timeout (%lu ms), sent %lu bytes\n", millis() - startTime, totalBytes);
-                break;
-            }
-        }
+    // Live microphone as WAV (or "format=pcm"), several listeners; detaches from httpd, no worker held
+    on("/stream", HTTP_GET, MicStream_Serve);
 
-        streamI2S.end();
-        client.stop();
-        Serial.println("[STREAM] Stream ended and cleaned up");
-    });
+    // Server-Sent Events with volume, now playing, alarm, backlight and backend changes for the web UI
+    on("/events", HTTP_GET, EventStream_Serve);
 
     // GET /alarms  -> returns array of alarms (with indices as array order)
-    server.on("/alarms", HTTP_GET, []() {
+    on("/alarms", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
         DynamicJsonDocument doc(4096);
         JsonArray arr = doc.to<JsonArray>();
         for (size_t i = 0; i < alarm_list.size(); ++i) {
@@ -649,33 +1224,33 @@ void HttpServer_Begin(Audio& audio)
         }
         String out;
         serializeJson(arr, out);
-        server.send(200, "application/json", out);
+        return req.send(200, "application/json", out);
     });
 
     // POST /alarms/add  (Content-Type: application/json)
     // Body: { "time":"07:30", "weekdays":[0,1,1,1,1,1,0], "action":{ "type":"mp3","path":"/music/.."}, "enabled":true }
-    server.on("/alarms/add", HTTP_POST, []() {
+    on("/alarms/add", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         DynamicJsonDocument doc(1024);
-        if (!readJsonBody(doc) || !doc.is<JsonObject>()) {
-            return sendBadRequest("Bad JSON");
+        if (!readJsonBody(req, doc) || !doc.is<JsonObject>()) {
+            return sendBadRequest(req, "Bad JSON");
         }
         Alarm a = json_to_alarm(doc.as<JsonObject>());
         alarm_list.push_back(a);
         SaveAlarms();
         String out = String("{\"ok\":true,\"index\":") + String((int)alarm_list.size() - 1) + "}";
-        server.send(200, "application/json", out);
+        return req.send(200, "application/json", out);
     });
 
     // POST /alarms/update  (Content-Type: application/json)
     // Body: { "index": 0,  [any fields to change: time, weekdays, action:{type,path}, enabled ] }
-    server.on("/alarms/update", HTTP_POST, []() {
+    on("/alarms/update", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         DynamicJsonDocument doc(2048);
-        if (!readJsonBody(doc) || !doc.is<JsonObject>()) {
-            return sendBadRequest("Bad JSON");
+        if (!readJsonBody(req, doc) || !doc.is<JsonObject>()) {
+            return sendBadRequest(req, "Bad JSON");
         }
         int index = doc["index"] | -1;
         if (index < 0 || index >= (int)alarm_list.size()) {
-            return sendNotFound("Invalid index");
+            return sendNotFound(req, "Invalid index");
         }
         Alarm &a = alarm_list[index];
         if (doc.containsKey("time")) a.time = (const char*)doc["time"];
@@ -694,66 +1269,51 @@ void HttpServer_Begin(Audio& audio)
         if (doc.containsKey("enabled")) a.enabled = (bool)doc["enabled"];
 
         SaveAlarms();
-        sendJsonOk("{\"ok\":true}");
+        return sendJsonOk(req, "{\"ok\":true}");
     });
 
     // POST /alarms/delete  (form or JSON)  index=#
-    server.on("/alarms/delete", HTTP_POST, []() {
+    on("/alarms/delete", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         int index = -1;
-        if (server.hasArg("index")) {
-            index = server.arg("index").toInt();
+        if (req.hasArg("index")) {
+            index = req.arg("index").toInt();
         } else {
             DynamicJsonDocument doc(256);
-            if (!readJsonBody(doc) || !doc.is<JsonObject>()) return sendBadRequest("Bad request");
+            if (!readJsonBody(req, doc) || !doc.is<JsonObject>()) return sendBadRequest(req, "Bad request");
             index = doc["index"] | -1;
         }
-        if (index < 0 || index >= (int)alarm_list.size()) return sendNotFound("Invalid index");
+        if (index < 0 || index >= (int)alarm_list.size()) return sendNotFound(req, "Invalid index");
         alarm_list.erase(alarm_list.begin() + index);
         SaveAlarms();
-        sendJsonOk("{\"ok\":true}");
+        return sendJsonOk(req, "{\"ok\":true}");
     });
 
     // POST /alarms/reload -> reload alarms from /alarms.json on SD
-    server.on("/alarms/reload", HTTP_POST, []() {
+    on("/alarms/reload", HTTP_POST, [](HttpRequest& req) -> esp_err_t {
         LoadAlarms();
-        sendJsonOk("{\"ok\":true}");
+        return sendJsonOk(req, "{\"ok\":true}");
     });
 
-    // Serve any static file from SDCARD /html/ if it exists and is requested via GET
-    server.onNotFound([]() {
-        if (server.method() != HTTP_GET) {
-            server.send(405, "text/plain", "Method Not Allowed");
-            return;
-        }
-
-        String uri = server.uri();
-        if (uri == "/") uri = "/index.html"; // default fallback
-
-        String path = "/html" + uri;
-
-        File file = SD_MMC.open(path);
-        if (!file || file.isDirectory()) {
-            server.send(404, "text/plain", "File not found: " + path);
-            return;
-        }
-
-        String contentType = "text/plain";
-        if (path.endsWith(".html")) contentType = "text/html";
-        else if (path.endsWith(".css")) contentType = "text/css";
-        else if (path.endsWith(".js")) contentType = "application/javascript";
-        else if (path.endsWith(".json")) contentType = "application/json";
-        else if (path.endsWith(".png")) contentType = "image/png";
-        else if (path.endsWith(".jpg") || path.endsWith(".jpeg")) contentType = "image/jpeg";
-        else if (path.endsWith(".ico")) contentType = "image/x-icon";
-
-        server.streamFile(file, contentType);
-        file.close();
-    });
+    // Serve any static file from SDCARD /html/ (gzip variant, ETag/304, PSRAM cache: see WebAssets.h).
+    // Registered last: the wildcard only catches what no route above matched, other methods get 405.
+    on("/*", HTTP_GET, [](HttpRequest& req) -> esp_err_t {
+        return WebAssets_Serve(req, req.path());
+    }, true);
+}
 
-    // Start server
-    server.begin();
+void HttpServer_GetStats(HttpServerStats* out) {
+    if (!out) return;
+    portENTER_CRITICAL(&statsMux);
+    *out = stats;
+    portEXIT_CRITICAL(&statsMux);
 }
 
-void HttpServer_Loop() {
-    server.handleClient();
+void HttpServer_PrintStats() {
+    HttpServerStats st;
+    HttpServer_GetStats(&st);
+    Serial.printf("[HTTP] %u requests (%u on workers, %u rejected), 4xx %u, 5xx %u, sockets %u, workers %u (peak %u)\n",
+                  st.requests, st.async_requests, st.rejected, st.client_errors, st.server_errors,
+                  st.open_sockets, st.active_workers, st.workers_peak);
+    Serial.printf("[HTTP] Longest handler: inline %u ms, worker %u ms, sent %u KB\n",
+                  st.inline_ms_max, st.async_ms_max, (uint32_t)(st.bytes_sent / 1024));
 }
@@ -1,12 +1,56 @@
 #ifndef HTTP_SERVER_H
 #define HTTP_SERVER_H
 
-
-#include <WebServer.h>
 #include "Audio.h"
 #include "LVGL_ST77916.h"
 
+/*
+  Web API and web UI on port 80 (esp_http_server)
+
+  httpd runs its own task and multiplexes all connections with select(),
+  so a client that is slow to send or receive no longer holds up the
+  others. Quick routes (volume, stop, alarms, /status) run inline in the
+  httpd task; they only touch RAM or a small file and the alarm edits
+  stay serialized. Routes that can take long - starting playback (the
+  connect resolves a host and opens a socket or a file), file transfers,
+  directory listings, static pages from SD, the microphone stream - are
+  handed off with httpd_req_async_handler_begin() to a small pool of
+  worker tasks and the httpd task goes straight back to the other sockets.
+
+  When every worker is busy and the hand-off queue is full, a long route is
+  answered with 503 at once instead of being queued behind a 60 s stream.
+  Counters are under [HTTP Server] in /status; tools/http_bench.py measures
+  requests/s and latency with and without a long transfer running.
+*/
+
+#define HTTP_PORT              80
+#define HTTP_MAX_SOCKETS       7       // Open connections; lwIP sockets are shared with the audio links
+#define HTTP_TASK_STACK        8192
+#define HTTP_TASK_PRIORITY     1       // Below the GUI task
+#define HTTP_ASYNC_WORKERS     3       // Concurrent long requests
+#define HTTP_ASYNC_QUEUE       2       // Long requests waiting for a worker before 503
+#define HTTP_WORKER_STACK      8192
+#define HTTP_WORKER_CHUNK      8192    // Per worker file buffer (PSRAM)
+#define HTTP_MAX_URI_HANDLERS  40
+
+struct HttpServerStats {
+    uint32_t requests;          // Handled, inline and on workers
+    uint32_t async_requests;    // Ran on a worker
+    uint32_t rejected;          // 503, no worker free
+    uint32_t partial;           // 206 responses (Range)
+    uint32_t client_errors;     // 4xx responses
+    uint32_t server_errors;     // 5xx responses
+    uint32_t active_workers;
+    uint32_t workers_peak;
+    uint32_t inline_ms_max;     // Longest handler in the httpd task (blocks the other sockets)
+    uint32_t async_ms_max;      // Longest worker request
+    uint32_t open_sockets;
+    uint64_t bytes_sent;        // Response bodies
+};
+
 void HttpServer_Begin(Audio& audio);
-void HttpServer_Loop();
 
-#endif
\ No newline at end of file
+void HttpServer_GetStats(HttpServerStats* out);
+void HttpServer_PrintStats();
+
+#endif
@@ -2,6 +2,7 @@
 #include "Touch_CST816.h"
 #include "MIC_MSM.h"
 #include "GUI/GUI.h"
+#include "EventStream.h"
 
 Arduino_GFX* gfx;
 
@@ -31,6 +32,7 @@ void LCD_SetBacklight(bool on) {
     pinMode(LCD_BL, OUTPUT);
     digitalWrite(LCD_BL, on ? HIGH : LOW);
     backlight_on = on;
+    EventStream_Notify(EVENT_BACKLIGHT);
     // if true,  reset the last touch time
     // to prevent the screen from going off
     if (on) {
@@ -0,0 +1,247 @@
+// LatencyTrace.cpp - Per-request latency breakdown of the voice assistant, press to first audio
+#include "LatencyTrace.h"
+#include <algorithm>
+#include <ArduinoJson.h>
+#include "esp_timer.h"
+#include "AudioMixer.h"
+
+// Histogram upper bounds (ms) of release -> first audio; the last bucket is open-ended
+static const uint32_t histBoundsMs[] = { 1000, 1500, 2000, 3000, 4000, 6000, 8000 };
+#define HIST_BUCKETS (sizeof(histBoundsMs) / sizeof(histBoundsMs[0]) + 1)
+
+enum TracePhase : uint8_t { TRACE_IDLE, TRACE_CAPTURE, TRACE_RESPONSE, TRACE_AUDIO };
+
+struct OpenTrace {
+    uint32_t rid;
+    bool     stream;
+    uint8_t  phase;
+    int64_t  pressUs;
+    int64_t  releaseUs;
+    int64_t  uploadedUs;
+    int64_t  responseUs;
+    uint32_t serverMs;      // Backend rx -> tx
+    uint32_t sttMs;
+    uint32_t llmMs;
+};
+
+static portMUX_TYPE traceMux = portMUX_INITIALIZER_UNLOCKED;
+static OpenTrace cur = {};
+static uint32_t nextRid = 0;
+
+static LatencyBreakdown history[LATENCY_HISTORY];
+static uint32_t historyCount = 0;       // Valid entries
+static uint32_t historyNext = 0;        // Next slot to write
+
+static uint32_t statStarted = 0;
+static uint32_t statCompleted = 0;
+static uint32_t statAbandoned = 0;
+
+static inline uint32_t msBetween(int64_t fromUs, int64_t toUs) {
+    return (fromUs && toUs > fromUs) ? (uint32_t)((toUs - fromUs) / 1000) : 0;
+}
+
+// Close the open trace if its answer became audible or it timed out (caller holds traceMux)
+static void checkOpenTrace() {
+    const int64_t now = esp_timer_get_time();
+
+    if (cur.phase == TRACE_RESPONSE) {
+        if (now - cur.releaseUs > (int64_t)LATENCY_RESPONSE_TIMEOUT_MS * 1000) {
+            cur.phase = TRACE_IDLE;
+            statAbandoned++;
+        }
+        return;
+    }
+    if (cur.phase != TRACE_AUDIO) return;
+
+    int64_t requestedUs, heardUs;
+    AudioMixer_GetVoiceTiming(&requestedUs, &heardUs);
+    if (requestedUs < cur.responseUs || heardUs < requestedUs || !heardUs) {
+        if (now - cur.responseUs > (int64_t)LATENCY_AUDIO_TIMEOUT_MS * 1000) {
+            cur.phase = TRACE_IDLE;
+            statAbandoned++;
+        }
+        return;
+    }
+
+    LatencyBreakdown b = {};
+    b.rid = cur.rid;
+    b.stream = cur.stream;
+    b.capture_ms = msBetween(cur.pressUs, cur.releaseUs);
+    b.upload_ms = msBetween(cur.releaseUs, cur.uploadedUs);
+    const uint32_t roundTrip = msBetween(cur.releaseUs, cur.responseUs);
+    const uint32_t accounted = b.upload_ms + cur.serverMs;
+    b.network_ms = roundTrip > accounted ? roundTrip - accounted : 0;
+    b.stt_ms = cur.sttMs;
+    b.llm_ms = cur.llmMs;
+    b.queue_ms = cur.serverMs > cur.sttMs + cur.llmMs ? cur.serverMs - cur.sttMs - cur.llmMs : 0;
+    b.tts_ms = msBetween(cur.responseUs, requestedUs);
+    b.play_ms = msBetween(requestedUs, heardUs);
+    b.total_ms = msBetween(cur.releaseUs, heardUs);
+
+    history[historyNext] = b;
+    historyNext = (historyNext + 1) % LATENCY_HISTORY;
+    if (historyCount < LATENCY_HISTORY) historyCount++;
+    statCompleted++;
+    cur.phase = TRACE_IDLE;
+}
+
+uint32_t LatencyTrace_Start(bool stream) {
+    portENTER_CRITICAL(&traceMux);
+    checkOpenTrace();
+    if (cur.phase != TRACE_IDLE) statAbandoned++;   // Pressed again before the last answer played
+    if (nextRid == 0) nextRid = (esp_random() & 0x7FFF) << 16;  // Boot-unique prefix
+    cur = {};
+    cur.rid = ++nextRid;
+    cur.stream = stream;
+    cur.phase = TRACE_CAPTURE;
+    cur.pressUs = esp_timer_get_time();
+    statStarted++;
+    const uint32_t rid = cur.rid;
+    portEXIT_CRITICAL(&traceMux);
+    return rid;
+}
+
+uint32_t LatencyTrace_CurrentRid() {
+    portENTER_CRITICAL(&traceMux);
+    const uint32_t rid = cur.phase == TRACE_IDLE ? 0 : cur.rid;
+    portEXIT_CRITICAL(&traceMux);
+    return rid;
+}
+
+void LatencyTrace_MarkRelease() {
+    portENTER_CRITICAL(&traceMux);
+    if (cur.phase == TRACE_CAPTURE) {
+        cur.releaseUs = esp_timer_get_time();
+        cur.phase = TRACE_RESPONSE;
+    }
+    portEXIT_CRITICAL(&traceMux);
+}
+
+void LatencyTrace_MarkUploaded() {
+    portENTER_CRITICAL(&traceMux);
+    if (cur.phase == TRACE_RESPONSE && !cur.uploadedUs) cur.uploadedUs = esp_timer_get_time();
+    portEXIT_CRITICAL(&traceMux);
+}
+
+void LatencyTrace_OnResponse(uint32_t rid, int64_t rx, int64_t sttStart, int64_t sttEnd, int64_t llmEnd, int64_t tx) {
+    portENTER_CRITICAL(&traceMux);
+    if (cur.phase == TRACE_RESPONSE && rid == cur.rid) {
+        cur.responseUs = esp_timer_get_time();
+        if (!cur.uploadedUs) cur.uploadedUs = cur.releaseUs;
+        cur.serverMs = (rx && tx > rx) ? (uint32_t)(tx - rx) : 0;
+        cur.sttMs = (sttStart && sttEnd > sttStart) ? (uint32_t)(sttEnd - sttStart) : 0;
+        cur.llmMs = (sttEnd && llmEnd > sttEnd) ? (uint32_t)(llmEnd - sttEnd) : 0;
+        cur.phase = TRACE_AUDIO;
+    }
+    portEXIT_CRITICAL(&traceMux);
+}
+
+// Snapshot of the rolling window, oldest first
+static uint32_t copyHistory(LatencyBreakdown* out) {
+    portENTER_CRITICAL(&traceMux);
+    checkOpenTrace();
+    const uint32_t n = historyCount;
+    for (uint32_t i = 0; i < n; ++i) {
+        out[i] = history[(historyNext + LATENCY_HISTORY - n + i) % LATENCY_HISTORY];
+    }
+    portEXIT_CRITICAL(&traceMux);
+    return n;
+}
+
+static uint32_t percentile(uint32_t* sorted, uint32_t n, uint32_t pct) {
+    if (n == 0) return 0;
+    uint32_t idx = (n * pct + 99) / 100;
+    return sorted[idx ? idx - 1 : 0];
+}
+
+static void fillStats(const LatencyBreakdown* snap, uint32_t n, LatencyTraceStats* out) {
+    uint32_t totals[LATENCY_HISTORY];
+    for (uint32_t i = 0; i < n; ++i) totals[i] = snap[i].total_ms;
+    std::sort(totals, totals + n);
+
+    *out = {};
+    out->started = statStarted;
+    out->completed = statCompleted;
+    out->abandoned = statAbandoned;
+    out->history = n;
+    out->total_p50_ms = percentile(totals, n, 50);
+    out->total_p95_ms = percentile(totals, n, 95);
+    if (n) out->last = snap[n - 1];
+}
+
+void LatencyTrace_GetStats(LatencyTraceStats* out) {
+    if (!out) return;
+    LatencyBreakdown snap[LATENCY_HISTORY];
+    fillStats(snap, copyHistory(snap), out);
+}
+
+String LatencyTrace_ToJson() {
+    LatencyBreakdown snap[LATENCY_HISTORY];
+    const uint32_t n = copyHistory(snap);
+
+    LatencyTraceStats st;
+    fillStats(snap, n, &st);
+
+    DynamicJsonDocument doc(2048 + n * 320);
+    doc["started"] = st.started;
+    doc["completed"] = st.completed;
+    doc["abandoned"] = st.abandoned;
+    doc["total_p50_ms"] = st.total_p50_ms;
+    doc["total_p95_ms"] = st.total_p95_ms;
+
+    // Average share of each hop over the window
+    uint64_t sum[9] = {};
+    uint32_t hist[HIST_BUCKETS] = {};
+    JsonArray recent = doc.createNestedArray("recent");
+    for (uint32_t i = 0; i < n; ++i) {
+        const LatencyBreakdown& b = snap[i];
+        JsonObject o = recent.createNestedObject();
+        o["rid"] = b.rid;
+        o["mode"] = b.stream ? "stream" : "upload";
+        o["capture_ms"] = b.capture_ms;
+        o["upload_ms"] = b.upload_ms;
+        o["network_ms"] = b.network_ms;
+        o["queue_ms"] = b.queue_ms;
+        o["stt_ms"] = b.stt_ms;
+        o["llm_ms"] = b.llm_ms;
+        o["tts_ms"] = b.tts_ms;
+        o["play_ms"] = b.play_ms;
+        o["total_ms"] = b.total_ms;
+
+        const uint32_t v[9] = { b.capture_ms, b.upload_ms, b.network_ms, b.queue_ms, b.stt_ms,
+                                b.llm_ms, b.tts_ms, b.play_ms, b.total_ms };
+        for (int k = 0; k < 9; ++k) sum[k] += v[k];
+
+        size_t bucket = 0;
+        while (bucket < HIST_BUCKETS - 1 && b.total_ms >= histBoundsMs[bucket]) bucket++;
+        hist[bucket]++;
+    }
+
+    static const char* names[9] = { "capture_ms", "upload_ms", "network_ms", "queue_ms", "stt_ms",
+                                     "llm_ms", "tts_ms", "play_ms", "total_ms" };
+    JsonObject avg = doc.createNestedObject("avg");
+    for (int k = 0; k < 9; ++k) avg[names[k]] = n ? (uint32_t)(sum[k] / n) : 0;
+
+    // Buckets of release -> first audio: "<1000", "<1500", ... ">=8000"
+    JsonArray h = doc.createNestedArray("histogram");
+    for (size_t i = 0; i < HIST_BUCKETS; ++i) {
+        JsonObject o = h.createNestedObject();
+        if (i < HIST_BUCKETS - 1) o["lt_ms"] = histBoundsMs[i];
+        else o["ge_ms"] = histBoundsMs[HIST_BUCKETS - 2];
+        o["count"] = hist[i];
+    }
+
+    String out;
+    serializeJson(doc, out);
+    return out;
+}
+
+void LatencyTrace_PrintStats() {
+    LatencyTraceStats s;
+    LatencyTrace_GetStats(&s);
+    const LatencyBreakdown& b = s.last;
+    Serial.printf("[Latency] traces=%u completed=%u abandoned=%u p50=%u ms p95=%u ms last rid=%u: capture=%u upload=%u net=%u queue=%u stt=%u llm=%u tts=%u play=%u total=%u ms\n",
+                  s.started, s.completed, s.abandoned, s.total_p50_ms, s.total_p95_ms, b.rid,
+                  b.capture_ms, b.upload_ms, b.network_ms, b.queue_ms, b.stt_ms, b.llm_ms,
+                  b.tts_ms, b.play_ms, b.total_ms);
+}
@@ -0,0 +1,70 @@
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <Arduino.h>
+
+/*
+  End-to-end assistant latency, from SPEAK press to the first audible answer
+
+  Each press starts a trace with a request id (rid). The rid goes out in
+  START_STREAM / STOP_STREAM (or as a form field with the upload), the
+  backend carries it through agent_in_queue and returns it in
+  ASSISTANT_TEXT_RESPONSE together with its own hop stamps:
+
+    trace.rx         STOP_STREAM / upload received
+    trace.stt_start  Whisper request
+    trace.stt_end    transcript back, GPT request
+    trace.llm_end    GPT answer
+    trace.tx         response handed to the WebSocket
+
+  Backend stamps are only compared with each other (its clock), device
+  stamps only with each other (esp_timer), so no clock sync is needed.
+  The network share is what is left of release -> response after the
+  upload and the backend time.
+
+  A trace completes when the mixer outputs the first sample of the answer.
+  The last LATENCY_HISTORY traces are kept for averages, percentiles and a
+  histogram of release -> first audio, served as JSON at /latency.
+*/
+
+#define LATENCY_HISTORY              32
+#define LATENCY_RESPONSE_TIMEOUT_MS  60000   // No response this long after release: trace abandoned
+#define LATENCY_AUDIO_TIMEOUT_MS     30000   // No audio this long after the response: trace abandoned
+
+struct LatencyBreakdown {
+    uint32_t rid;
+    bool     stream;            // WebSocket stream (else WAV upload)
+    uint32_t capture_ms;        // Press -> release (user speaking)
+    uint32_t upload_ms;         // Release -> audio delivered (upload done / STOP_STREAM sent)
+    uint32_t network_ms;        // Rest of release -> response not spent in upload or backend
+    uint32_t queue_ms;          // Backend time outside Whisper / GPT (queueing, dispatch)
+    uint32_t stt_ms;            // Whisper
+    uint32_t llm_ms;            // GPT
+    uint32_t tts_ms;            // Response -> playback requested (downlink prebuffer, cache lookup)
+    uint32_t play_ms;           // Playback requested -> first sample out (TTS fetch, decode)
+    uint32_t total_ms;          // Release -> first sample out
+};
+
+struct LatencyTraceStats {
+    uint32_t started;
+    uint32_t completed;
+    uint32_t abandoned;         // No response / no audio
+    uint32_t history;           // Traces in the rolling window
+    uint32_t total_p50_ms;
+    uint32_t total_p95_ms;
+    LatencyBreakdown last;
+};
+
+// Device side hops
+uint32_t LatencyTrace_Start(bool stream);       // SPEAK / STREAM pressed, returns the new rid
+uint32_t LatencyTrace_CurrentRid();             // 0 when no trace is open
+void LatencyTrace_MarkRelease();
+void LatencyTrace_MarkUploaded();
+// ASSISTANT_TEXT_RESPONSE with the backend stamps in ms (0 = missing)
+void LatencyTrace_OnResponse(uint32_t rid, int64_t rx, int64_t sttStart, int64_t sttEnd, int64_t llmEnd, int64_t tx);
+
+void LatencyTrace_GetStats(LatencyTraceStats* out);
+String LatencyTrace_ToJson();
+void LatencyTrace_PrintStats();
+
+#endif
@@ -1,4 +1,7 @@
 #include "MIC_MSM.h"
+#include "RequestSpool.h"
+#include "DirCache.h"
+#include "MicStream.h"
 // English wakeword : Hi ESP！！！！
 
 #include "esp_dsp.h"
@@ -16,6 +19,8 @@ static TaskHandle_t micTaskHandle = nullptr;
 static File wavFile;
 static volatile bool isRecording = false;
 static bool streamToServer = false;  // Stream to server via WebSocket or save to SD card file
+static bool recordToSpool = false;   // Stream requested while offline: record into the request spool
+static char spoolPath[32];
 
 static uint32_t sampleRate;
 static uint8_t channels;
@@ -228,10 +233,14 @@ static void finalizeWavFile(File &file) {
 // Clean I2S shutdown
 
 static void MIC_RecordTask(void *parameter) {
-    int32_t rawBuffer[256];           // 32-bit input from ICS-43434
-    float floatSamples[256];          // Float samples for DSP
-    float filtered[256];              // Filtered output
-    int16_t finalSamples[256];        // Final 16-bit output for WAV
+    int32_t rawBuffer[MIC_BLOCK_SAMPLES];       // 32-bit input from ICS-43434
+    float floatSamples[MIC_BLOCK_SAMPLES];      // Float samples for DSP
+    float filtered[MIC_BLOCK_SAMPLES];          // Filtered output
+    int16_t wavSamples[MIC_BLOCK_SAMPLES];      // Final 16-bit output for WAV
+
+    // One uplink frame per block when streaming
+    size_t blockSamples = sampleRate * UPLINK_FRAME_MS / 1000;
+    if (blockSamples == 0 || blockSamples > MIC_BLOCK_SAMPLES) blockSamples = MIC_BLOCK_SAMPLES;
 
     Serial.println("[MIC] Recording task with bandpass + AGC started");
 
@@ -251,18 +260,17 @@ static void MIC_RecordTask(void *parameter) {
     float agcRelease = 0.001f;
     uint32_t totalSize = 0;
 
-    // Streaming
-    // Add this near top of function:
-    // Optional streaming buffer
-    // int16_t* streamBuffer = (int16_t*)heap_caps_malloc(2048 * sizeof(int16_t), MALLOC_CAP_SPIRAM);
-    // int16_t streamBuffer[2048];   // 2048 * 2B (int16_t) = 4096 Bytes
-    // size_t streamOffset = 0;
+    // Energy VAD for the uplink: noise floor follows quiet blocks fast and loud ones slowly
+    float noiseFloor = 0.0f;
 
     while (isRecording) {
-        size_t bytesRead = i2s.readBytes((char *)rawBuffer, sizeof(rawBuffer));
+        size_t bytesRead = i2s.readBytes((char *)rawBuffer, blockSamples * sizeof(int32_t));
         size_t sampleCount = bytesRead / sizeof(int32_t);
         if (sampleCount == 0) continue;
 
+        // Wall clock of the first sample in this block
+        const uint64_t captureUs = AudioFrame_NowUs() - (uint64_t)sampleCount * 1000000ULL / sampleRate;
+
         // Convert to float (assuming 24-bit left-justified in 32-bit)
         for (size_t i = 0; i < sampleCount; ++i) {
             floatSamples[i] = (float)(rawBuffer[i] >> 8);
@@ -278,6 +286,10 @@ static void MIC_RecordTask(void *parameter) {
         }
         float rms = sqrtf(sumSquares / sampleCount);
 
+        if (noiseFloor == 0.0f || rms < noiseFloor) noiseFloor = rms;
+        else noiseFloor += 0.0005f * (rms - noiseFloor);
+        const bool silent = rms < noiseFloor * UPLINK_VAD_NOISE_RATIO;
+
         // AGC gain update
         if (rms > 0.0f) {
             float desiredGain = targetLevel / rms;
@@ -290,6 +302,11 @@ static void MIC_RecordTask(void *parameter) {
         // Apply AGC gain
         dsps_mulc_f32_ae32(filtered, filtered, sampleCount, agcGain, 1, 1);
 
+        // Streaming: convert straight into a pooled uplink frame (no copy).
+        // Pool empty means the network is behind; the block is dropped, capture never waits.
+        UplinkFrame* frame = streamToServer ? AudioUplink_AcquireFrame() : nullptr;
+        int16_t* finalSamples = frame ? AudioUplink_Samples(frame) : wavSamples;
+
         // Convert to int16 safely
         for (size_t i = 0; i < sampleCount; ++i) {
             float s = filtered[i];
@@ -299,33 +316,9 @@ static void MIC_RecordTask(void *parameter) {
         }
 
         if (streamToServer) {
-            // Send to WebSocket queue or buffer here
-            AIAssistant_SendAudioChunk(finalSamples, sampleCount * sizeof(int16_t));
-
-            /*
-            // Check if adding the new samples would overflow the buffer
-            if (streamOffset + sampleCount >= 1024) {
-                // Fill up remaining space
-                size_t spaceLeft = 1024 - streamOffset;
-                memcpy(&streamBuffer[streamOffset], finalSamples, spaceLeft * sizeof(int16_t));
-
-                // Send full buffer
-                AIAssistant_SendAudioChunk(streamBuffer, 1024 * sizeof(int16_t));
-                totalSize += 1024 * sizeof(int16_t);
-                streamOffset = 0;
-
-                // Copy remaining samples to start of buffer
-                size_t remaining = sampleCount - spaceLeft;
-                if (remaining > 0) {
-                    memcpy(&streamBuffer[streamOffset], &finalSamples[spaceLeft], remaining * sizeof(int16_t));
-                    streamOffset += remaining;
-                }
-            } else {
-                // Enough space, just copy in
-                memcpy(&streamBuffer[streamOffset], finalSamples, sampleCount * sizeof(int16_t));
-                streamOffset += sampleCount;
-            }
-            */
+            // Hand over to the uplink sender task; silence may be dropped under backpressure
+            if (frame) frame->silent = silent;
+            AIAssistant_SendAudioFrame(frame, sampleCount * sizeof(int16_t), captureUs);
 
         } else {
             // Write to WAV file on SD card
@@ -337,7 +330,6 @@ static void MIC_RecordTask(void *parameter) {
         vTaskDelay(pdMS_TO_TICKS(10));
     }
     // Cleanup
-    // heap_caps_free(streamBuffer);
 
     i2s.end();
     delay(50);
@@ -345,20 +337,17 @@ static void MIC_RecordTask(void *parameter) {
     new (&i2s) I2SClass();
 
     Serial.printf("[MIC] Recording task ended, %d bytes\n", totalSize);
+    MicStream_Resume();
 
     if (streamToServer) {
-        // Flush buffer
-        /*
-        if (streamOffset > 0) {
-            AIAssistant_SendAudioChunk(streamBuffer, streamOffset * sizeof(int16_t));
-            totalSize += streamOffset * sizeof(int16_t);
-            streamOffset = 0;
-        }*/
         AIAssistant_StopStream();
     } else {
       finalizeWavFile(wavFile);
       wavFile.flush();
+      String recorded = wavFile.path();
       wavFile.close();
+      DirCache_Invalidate(recorded.c_str());      // Final size
+      if (recordToSpool) RequestSpool_Commit(spoolPath, SPOOL_KIND_STREAM);
     }
     delay(200);
     vTaskDelete(nullptr);
@@ -374,6 +363,9 @@ void MIC_StartRecording(const char* filename, uint32_t rate, uint8_t ch, uint16_
 
   Serial.printf("[MIC] Starting recording: %s at %luHz, %dch, %dbit, stream:%d \n", filename, rate, ch, bits, stream);
 
+  // /stream listeners read the same pins: end them and keep new ones out until the task ends
+  MicStream_Pause();
+
   // Configure and start ESP_I2S
   i2s.setPins(I2S_PIN_BCK, I2S_PIN_WS, I2S_PIN_DOUT, I2S_PIN_DIN);  // Only DOUT or DIN needed
   i2s.setTimeout(1000);  // Optional, useful for .readBytes()
@@ -381,6 +373,7 @@ void MIC_StartRecording(const char* filename, uint32_t rate, uint8_t ch, uint16_
   // Select 32bit data format, Mono, right channel
   if (!i2s.begin(I2S_MODE_STD, rate, I2S_DATA_BIT_WIDTH_32BIT, I2S_SLOT_MODE_MONO, I2S_STD_SLOT_RIGHT)) {
     Serial.println("[ERR] I2S begin() failed");
+    MicStream_Resume();
     return;
   }
 
@@ -394,22 +387,33 @@ void MIC_StartRecording(const char* filename, uint32_t rate, uint8_t ch, uint16_
   channels = ch;
   bitsPerSample = bits;
 
+  // Backend unreachable: record the request into the spool, it is replayed as an upload later
+  recordToSpool = stream && !AIAssistant_StartStream(rate) && RequestSpool_ReservePath(spoolPath, sizeof(spoolPath));
+  if (recordToSpool) {
+    Serial.printf("[MIC] Backend offline, spooling stream to %s\n", spoolPath);
+    filename = spoolPath;
+    stream = false;
+    streamToServer = false;
+  }
+
   if (stream) {
     // WebSocket stream
-    AIAssistant_StartStream();
     Serial.println("[MIC] Start streaming via websocket");
   }else{
     // WAV recording
     if (!SD_MMC.begin()) {
       Serial.println("[ERR] SD_MMC mount failed");
+      MicStream_Resume();
       return;
     }
 
     // Remove old file if it exists
     SD_MMC.remove(filename);
     wavFile = SD_MMC.open(filename, FILE_WRITE);
+    DirCache_Invalidate(filename);
     if (!wavFile) {
       Serial.println("[ERR] Failed to open file for writing");
+      MicStream_Resume();
       return;
     }
 
@@ -424,7 +428,7 @@ void MIC_StartRecording(const char* filename, uint32_t rate, uint8_t ch, uint16_
   BaseType_t result = xTaskCreatePinnedToCore(
     MIC_RecordTask,       // Task function
     "MIC_RecordTask",     // Name
-    8192,                 // Stack size
+    10240,                // Stack size (20 ms DSP blocks)
     NULL,                 // Parameters
     2,                    // Priority
     &micTaskHandle,       // Out handle
@@ -435,6 +439,7 @@ void MIC_StartRecording(const char* filename, uint32_t rate, uint8_t ch, uint16_
     Serial.println("[ERR] Failed to start MIC_RecordTask");
     wavFile.close();
     isRecording = false;
+    MicStream_Resume();
   }
 }
 
@@ -14,6 +14,8 @@
 #define I2S_PIN_DOUT  -1   // Not used (we're not sending)
 #define I2S_PIN_DIN   39   // Data line (input from mic to ESP32)
 
+#define MIC_BLOCK_SAMPLES  320  // Samples per DSP block (20 ms at 16 kHz = one uplink frame)
+
 
 void MIC_SR_Start();
 void MIC_SR_Stop();
@@ -0,0 +1,311 @@
+// Metrics.cpp - Lock-free metric registry, rendered as Prometheus text or JSON
+#include "Metrics.h"
+#include <WiFi.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+#define METRICS_FLUSH_BYTES 1024
+
+static Metric registry[METRICS_MAX];
+static std::atomic<uint32_t> registered{0};        // Entries below are complete
+static portMUX_TYPE registerMux = portMUX_INITIALIZER_UNLOCKED;
+
+static MetricsCollector collectors[METRICS_COLLECTORS];
+static std::atomic<uint32_t> collectorCount{0};
+
+static bool sameLabels(const char* a, const char* b) {
+    if (!a || !b) return a == b;
+    return strcmp(a, b) == 0;
+}
+
+static Metric* registerMetric(const char* name, const char* help, MetricType type, const char* labels,
+                              const uint32_t* bounds, uint8_t nbounds) {
+    Metric* m = nullptr;
+    portENTER_CRITICAL(&registerMux);
+    const uint32_t n = registered.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < n; ++i) {
+        if (strcmp(registry[i].name, name) == 0 && sameLabels(registry[i].labels, labels)) {
+            m = &registry[i];
+            break;
+        }
+    }
+    if (!m && n < METRICS_MAX) {
+        m = &registry[n];
+        m->name = name;
+        m->help = help;
+        m->labels = labels;
+        m->type = type;
+        m->bounds = bounds;
+        m->nbounds = nbounds > METRICS_HIST_BUCKETS ? METRICS_HIST_BUCKETS : nbounds;
+        registered.store(n + 1, std::memory_order_release);
+    }
+    portEXIT_CRITICAL(&registerMux);
+    if (!m) Serial.printf("[Metrics] Registry full, %s not exported\n", name);
+    return m;
+}
+
+Metric* Metrics_Counter(const char* name, const char* help, const char* labels) {
+    return registerMetric(name, help, METRIC_COUNTER, labels, nullptr, 0);
+}
+
+Metric* Metrics_Gauge(const char* name, const char* help, const char* labels) {
+    return registerMetric(name, help, METRIC_GAUGE, labels, nullptr, 0);
+}
+
+Metric* Metrics_Histogram(const char* name, const char* help, const uint32_t* bounds, uint8_t nbounds, const char* labels) {
+    return registerMetric(name, help, METRIC_HISTOGRAM, labels, bounds, nbounds);
+}
+
+void Metrics_AddCollector(MetricsCollector fn) {
+    portENTER_CRITICAL(&registerMux);
+    const uint32_t n = collectorCount.load(std::memory_order_relaxed);
+    if (n < METRICS_COLLECTORS) {
+        collectors[n] = fn;
+        collectorCount.store(n + 1, std::memory_order_release);
+    }
+    portEXIT_CRITICAL(&registerMux);
+}
+
+void Metrics_Observe(Metric* m, uint32_t v) {
+    if (!m) return;
+    uint8_t i = 0;
+    while (i < m->nbounds && v > m->bounds[i]) i++;
+    m->buckets[i].fetch_add(1, std::memory_order_relaxed);
+    m->sum.fetch_add(v, std::memory_order_relaxed);
+}
+
+// --- Output ----------------------------------------------------------------
+
+static const char* typeName(MetricType t) {
+    return t == METRIC_COUNTER ? "counter" : t == METRIC_GAUGE ? "gauge" : "histogram";
+}
+
+static String number(double v) {
+    char buf[32];
+    if (v == (double)(int64_t)v) snprintf(buf, sizeof(buf), "%lld", (long long)v);
+    else snprintf(buf, sizeof(buf), "%.3f", v);
+    return String(buf);
+}
+
+// Text goes out as HTTP chunks of about METRICS_FLUSH_BYTES
+class ChunkedText {
+public:
+    explicit ChunkedText(HttpRequest& req) : req_(req) { buf_.reserve(METRICS_FLUSH_BYTES + 256); }
+    void add(const String& s) {
+        buf_ += s;
+        if (buf_.length() >= METRICS_FLUSH_BYTES) flush();
+    }
+    void flush() {
+        if (ok_ && buf_.length()) ok_ = req_.sendChunk(buf_) == ESP_OK;
+        buf_ = "";
+    }
+    bool ok() const { return ok_; }
+
+private:
+    HttpRequest& req_;
+    String buf_;
+    bool ok_ = true;
+};
+
+class PromWriter : public MetricsWriter {
+public:
+    explicit PromWriter(ChunkedText& out) : out_(out) {}
+
+    void family(const char* name, const char* help, MetricType type) {
+        if (last_ && strcmp(last_, name) == 0) return;
+        last_ = name;
+        out_.add(String("# HELP ") + name + " " + help + "\n# TYPE " + name + " " + typeName(type) + "\n");
+    }
+
+    void sample(const char* name, const char* help, MetricType type, const char* labels, double value) override {
+        family(name, help, type);
+        out_.add(String(name) + (labels ? String("{") + labels + "}" : String()) + " " + number(value) + "\n");
+    }
+
+    void histogram(const Metric& m) {
+        family(m.name, m.help, METRIC_HISTOGRAM);
+        const String prefix = m.labels ? String(m.labels) + "," : String();
+        uint64_t cumulative = 0;
+        for (uint8_t i = 0; i <= m.nbounds; ++i) {
+            cumulative += m.buckets[i].load(std::memory_order_relaxed);
+            const String le = i < m.nbounds ? String(m.bounds[i]) : String("+Inf");
+            out_.add(String(m.name) + "_bucket{" + prefix + "le=\"" + le + "\"} " + String((unsigned long long)cumulative) + "\n");
+        }
+        const String labels = m.labels ? String("{") + m.labels + "}" : String();
+        out_.add(String(m.name) + "_sum" + labels + " " + String(m.sum.load(std::memory_order_relaxed)) + "\n");
+        out_.add(String(m.name) + "_count" + labels + " " + String((unsigned long long)cumulative) + "\n");
+    }
+
+private:
+    ChunkedText& out_;
+    const char* last_ = nullptr;
+};
+
+class JsonWriter : public MetricsWriter {
+public:
+    explicit JsonWriter(ChunkedText& out) : out_(out) {}
+
+    void sample(const char* name, const char* help, MetricType type, const char* labels, double value) override {
+        out_.add(head(name, type, labels) + ",\"value\":" + number(value) + "}");
+    }
+
+    void histogram(const Metric& m) {
+        String s = head(m.name, METRIC_HISTOGRAM, m.labels) + ",\"buckets\":[";
+        uint64_t cumulative = 0;
+        for (uint8_t i = 0; i <= m.nbounds; ++i) {
+            cumulative += m.buckets[i].load(std::memory_order_relaxed);
+            if (i) s += ",";
+            s += "[" + (i < m.nbounds ? String(m.bounds[i]) : String("\"+Inf\"")) + "," + String((unsigned long long)cumulative) + "]";
+        }
+        s += "],\"sum\":" + String(m.sum.load(std::memory_order_relaxed)) + ",\"count\":" + String((unsigned long long)cumulative) + "}";
+        out_.add(s);
+    }
+
+private:
+    // 'a="x",b="y"' -> {"a":"x","b":"y"}; label values here never contain quotes or commas
+    static String labelsJson(const char* labels) {
+        String s = "{";
+        if (labels) {
+            s += "\"";
+            for (const char* p = labels; *p; ++p) {
+                if (*p == '=') s += "\":";
+                else if (*p == ',') s += ",\"";
+                else s += *p;
+            }
+        }
+        return s + "}";
+    }
+
+    String head(const char* name, MetricType type, const char* labels) {
+        String s = first_ ? "\n" : ",\n";
+        first_ = false;
+        return s + "{\"name\":\"" + name + "\",\"type\":\"" + typeName(type) + "\",\"labels\":" + labelsJson(labels);
+    }
+
+    ChunkedText& out_;
+    bool first_ = true;
+};
+
+// Registered series, grouped by family (a family may have been registered from several modules)
+template <typename Writer>
+static void writeRegistry(Writer& w) {
+    const uint32_t n = registered.load(std::memory_order_acquire);
+    bool done[METRICS_MAX] = {};
+    for (uint32_t i = 0; i < n; ++i) {
+        if (done[i]) continue;
+        for (uint32_t j = i; j < n; ++j) {
+            const Metric& m = registry[j];
+            if (done[j] || strcmp(m.name, registry[i].name) != 0) continue;
+            done[j] = true;
+            if (m.type == METRIC_HISTOGRAM) {
+                w.histogram(m);
+            } else {
+                const uint32_t v = m.value.load(std::memory_order_relaxed);
+                w.sample(m.name, m.help, m.type, m.labels, m.type == METRIC_GAUGE ? (double)(int32_t)v : (double)v);
+            }
+        }
+    }
+}
+
+// --- System collectors -----------------------------------------------------
+
+static void collectHeap(MetricsWriter& w) {
+    static const struct { uint32_t caps; const char* label; } kinds[] = {
+        { MALLOC_CAP_INTERNAL, "caps=\"internal\"" },
+        { MALLOC_CAP_SPIRAM,   "caps=\"psram\"" },
+        { MALLOC_CAP_DMA,      "caps=\"dma\"" },
+    };
+    for (const auto& k : kinds) w.sample("esp_heap_free_bytes", "Free heap", METRIC_GAUGE, k.label, heap_caps_get_free_size(k.caps));
+    for (const auto& k : kinds) w.sample("esp_heap_min_free_bytes", "Lowest free heap since boot", METRIC_GAUGE, k.label, heap_caps_get_minimum_free_size(k.caps));
+    for (const auto& k : kinds) w.sample("esp_heap_largest_free_block_bytes", "Largest allocatable block", METRIC_GAUGE, k.label, heap_caps_get_largest_free_block(k.caps));
+    for (const auto& k : kinds) w.sample("esp_heap_total_bytes", "Heap size", METRIC_GAUGE, k.label, heap_caps_get_total_size(k.caps));
+    w.sample("esp_uptime_seconds", "Time since boot", METRIC_COUNTER, nullptr, esp_timer_get_time() / 1000000);
+}
+
+static void collectTasks(MetricsWriter& w) {
+    UBaseType_t n = uxTaskGetNumberOfTasks() + 4;
+    TaskStatus_t* tasks = (TaskStatus_t*)heap_caps_malloc(n * sizeof(TaskStatus_t), MALLOC_CAP_SPIRAM);
+    if (!tasks) return;
+    uint32_t totalRunTime = 0;
+    n = uxTaskGetSystemState(tasks, n, &totalRunTime);
+
+    // Label values, made unique: "IDLE", "IDLE#2"
+    String* labels = new String[n];
+    for (UBaseType_t i = 0; i < n; ++i) {
+        int seen = 1;
+        for (UBaseType_t j = 0; j < i; ++j) {
+            if (strcmp(tasks[j].pcTaskName, tasks[i].pcTaskName) == 0) seen++;
+        }
+        labels[i] = String("task=\"") + tasks[i].pcTaskName + (seen > 1 ? String("#") + String(seen) : String()) + "\"";
+    }
+
+    for (UBaseType_t i = 0; i < n; ++i) {
+        w.sample("esp_task_stack_free_bytes", "Stack high-water mark, bytes never used", METRIC_GAUGE,
+                 labels[i].c_str(), tasks[i].usStackHighWaterMark);
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    // Share of one core since the previous scrape (the first one: since boot)
+    static TaskHandle_t lastHandle[METRICS_TASKS_MAX];
+    static uint32_t lastRunTime[METRICS_TASKS_MAX];
+    static uint32_t lastCount = 0;
+    static uint32_t lastTotal = 0;
+    const uint32_t elapsed = totalRunTime - lastTotal;
+    uint32_t count = 0;
+    for (UBaseType_t i = 0; i < n; ++i) {
+        uint32_t prev = 0;
+        for (uint32_t j = 0; j < lastCount; ++j) {
+            if (lastHandle[j] == tasks[i].xHandle) {
+                prev = lastRunTime[j];
+                break;
+            }
+        }
+        const uint32_t ran = tasks[i].ulRunTimeCounter - prev;
+        w.sample("esp_task_cpu_percent", "CPU time since the previous scrape, percent of one core", METRIC_GAUGE,
+                 labels[i].c_str(), elapsed ? ran * 100.0 / elapsed : 0.0);
+        if (count < METRICS_TASKS_MAX) {
+            lastHandle[count] = tasks[i].xHandle;
+            lastRunTime[count] = tasks[i].ulRunTimeCounter;
+            count++;
+        }
+    }
+    lastCount = count;
+    lastTotal = totalRunTime;
+#endif
+
+    delete[] labels;
+    free(tasks);
+}
+
+static void collectWifi(MetricsWriter& w) {
+    const bool connected = WiFi.status() == WL_CONNECTED;
+    w.sample("wifi_connected", "Station connected", METRIC_GAUGE, nullptr, connected ? 1 : 0);
+    if (connected) w.sample("wifi_rssi_dbm", "Signal strength of the access point", METRIC_GAUGE, nullptr, WiFi.RSSI());
+}
+
+static const MetricsCollector systemCollectors[] = { collectHeap, collectTasks, collectWifi };
+
+esp_err_t Metrics_Serve(HttpRequest& req) {
+    const bool json = req.arg("format") == "json";
+    ChunkedText out(req);
+    req.setHeader("Cache-Control", "no-store");
+    req.beginChunked(200, json ? "application/json" : "text/plain; version=0.0.4");
+
+    const uint32_t ncollectors = collectorCount.load(std::memory_order_acquire);
+    if (json) {
+        JsonWriter w(out);
+        out.add("{\"uptime_ms\":" + String((unsigned long long)(esp_timer_get_time() / 1000)) + ",\"metrics\":[");
+        for (MetricsCollector c : systemCollectors) c(w);
+        writeRegistry(w);
+        for (uint32_t i = 0; i < ncollectors; ++i) collectors[i](w);
+        out.add("\n]}\n");
+    } else {
+        PromWriter w(out);
+        for (MetricsCollector c : systemCollectors) c(w);
+        writeRegistry(w);
+        for (uint32_t i = 0; i < ncollectors; ++i) collectors[i](w);
+    }
+    out.flush();
+    if (!out.ok()) return ESP_FAIL;
+    return req.endChunked();
+}
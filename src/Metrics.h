@@ -0,0 +1,74 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "HttpRequest.h"
+
+/*
+  Machine-readable device metrics for fleet scraping
+
+  GET /metrics returns the Prometheus text exposition format,
+  GET /metrics?format=json the same samples as JSON. /status stays the
+  human-readable page.
+
+  Subsystems register counters, gauges and histograms once at init and
+  update them on their hot paths with relaxed 32-bit atomics: no lock, no
+  allocation, safe from any task. Series of one family differ in their
+  labels (e.g. http_requests_total{code="2xx"}). Counters are 32 bit and
+  wrap, which Prometheus treats as a counter reset.
+
+  Values that are sampled rather than counted (heap by capability, largest
+  free block, task stack high-water marks, per-task CPU, Wi-Fi RSSI) are
+  produced by collectors that run only while a scrape renders.
+*/
+
+#define METRICS_MAX           64      // Registered series
+#define METRICS_COLLECTORS    8
+#define METRICS_HIST_BUCKETS  8       // Upper bounds per histogram, +Inf comes on top
+#define METRICS_TASKS_MAX     32      // Tasks tracked for CPU share
+
+enum MetricType : uint8_t { METRIC_COUNTER, METRIC_GAUGE, METRIC_HISTOGRAM };
+
+struct Metric {
+    const char* name;           // Static strings, "http_requests_total"
+    const char* help;
+    const char* labels;         // 'code="2xx"' or nullptr
+    MetricType type;
+    std::atomic<uint32_t> value;                // Counter, or gauge as int32
+    // Histogram
+    const uint32_t* bounds;
+    uint8_t nbounds;
+    std::atomic<uint32_t> buckets[METRICS_HIST_BUCKETS + 1];    // Not cumulative, the last is +Inf
+    std::atomic<uint32_t> sum;
+};
+
+// Output for collectors; samples of one family must be written one after another
+class MetricsWriter {
+public:
+    virtual ~MetricsWriter() {}
+    virtual void sample(const char* name, const char* help, MetricType type, const char* labels, double value) = 0;
+};
+
+typedef void (*MetricsCollector)(MetricsWriter& out);
+
+// Registration returns the existing series for the same name and labels; nullptr when full.
+// The update calls accept nullptr, so a failed registration only loses that series.
+Metric* Metrics_Counter(const char* name, const char* help, const char* labels = nullptr);
+Metric* Metrics_Gauge(const char* name, const char* help, const char* labels = nullptr);
+// 'bounds' ascending, static, at most METRICS_HIST_BUCKETS
+Metric* Metrics_Histogram(const char* name, const char* help, const uint32_t* bounds, uint8_t nbounds, const char* labels = nullptr);
+void Metrics_AddCollector(MetricsCollector fn);
+
+inline void Metrics_Add(Metric* m, uint32_t n = 1) {
+    if (m) m->value.fetch_add(n, std::memory_order_relaxed);
+}
+inline void Metrics_Set(Metric* m, int32_t v) {
+    if (m) m->value.store((uint32_t)v, std::memory_order_relaxed);
+}
+void Metrics_Observe(Metric* m, uint32_t v);
+
+// Answers /metrics: every series and collector, chunked; "format=json" for JSON
+esp_err_t Metrics_Serve(HttpRequest& req);
+
+#endif
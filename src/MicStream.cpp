@@ -0,0 +1,362 @@
+// MicStream.cpp - One microphone capture fanned out to several HTTP listeners
+#include "MicStream.h"
+#include <atomic>
+#include "ESP_I2S.h"
+#include "MIC_MSM.h"
+#include "Metrics.h"
+#include "esp_heap_caps.h"
+
+#define RING_BYTES MICSTREAM_RING_BYTES   // Positions are free-running uint32 counters modulo this
+
+struct Listener {
+    bool used;
+    httpd_req_t* req;                   // Detached copy, completed by the sender task
+    uint8_t* ring;                      // RING_BYTES, PSRAM
+    std::atomic<uint32_t> head;         // Bytes queued, written by the capture task only
+    std::atomic<uint32_t> tail;         // Bytes sent, written by the sender task only
+    bool pcm;
+    uint32_t limitBytes;                // Stream ends here, at most MICSTREAM_MAX_SECONDS
+    bool openEnded;                     // No "seconds=": header announces no length
+    uint32_t fullSinceMs;               // Ring full since, 0 if not
+    volatile bool kicked;
+    TaskHandle_t task;
+};
+
+static I2SClass streamI2S;
+static Listener listeners[MICSTREAM_MAX_LISTENERS];
+static SemaphoreHandle_t micMutex = nullptr;   // Guards the listener table, 'capturing' and 'paused'
+static bool capturing = false;
+static bool paused = false;
+
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static MicStreamStats stats = {};
+static Metric* mListeners = nullptr;
+static Metric* mDropped = nullptr;
+
+static bool beginI2S() {
+    streamI2S.setPins(I2S_PIN_BCK, I2S_PIN_WS, I2S_PIN_DOUT, I2S_PIN_DIN);
+    streamI2S.setTimeout(1000);
+    if (!streamI2S.begin(I2S_MODE_STD, MICSTREAM_SAMPLE_RATE, I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO, I2S_STD_SLOT_RIGHT)) {
+        Serial.println("[MicStream] I2S begin failed");
+        return false;
+    }
+    if (!streamI2S.configureRX(MICSTREAM_SAMPLE_RATE, I2S_DATA_BIT_WIDTH_32BIT, I2S_SLOT_MODE_MONO, I2S_RX_TRANSFORM_32_TO_16)) {
+        Serial.println("[MicStream] configureRX failed");
+        streamI2S.end();
+        return false;
+    }
+    return true;
+}
+
+// Soft compression: boost quiet passages, limit loud ones
+static void compress(int16_t* samples, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        float s = samples[i] / 32768.0f;
+        if (fabsf(s) < 0.25f) {
+            s *= 2.5f;
+        } else if (fabsf(s) < 0.5f) {
+            s *= 1.5f;
+        } else if (fabsf(s) > 0.9f) {
+            s *= 0.8f;
+        }
+        if (s > 1.0f) s = 1.0f;
+        if (s < -1.0f) s = -1.0f;
+        samples[i] = (int16_t)(s * 32767);
+    }
+}
+
+// Caller holds micMutex. Never blocks: a full ring drops the block for this listener only.
+static void push(Listener& l, const uint8_t* data, size_t len) {
+    const uint32_t head = l.head.load(std::memory_order_relaxed);
+    if (head >= l.limitBytes) return;
+    if (len > l.limitBytes - head) len = l.limitBytes - head;
+    const uint32_t used = head - l.tail.load(std::memory_order_acquire);
+    if (used + len > RING_BYTES) {
+        const uint32_t now = millis();
+        if (!l.fullSinceMs) {
+            l.fullSinceMs = now;
+        } else if (!l.kicked && now - l.fullSinceMs > MICSTREAM_STALL_MS) {
+            l.kicked = true;
+            portENTER_CRITICAL(&statsMux);
+            stats.kicked++;
+            portEXIT_CRITICAL(&statsMux);
+            xTaskNotifyGive(l.task);
+        }
+        portENTER_CRITICAL(&statsMux);
+        stats.dropped_blocks++;
+        portEXIT_CRITICAL(&statsMux);
+        Metrics_Add(mDropped);
+        return;
+    }
+    l.fullSinceMs = 0;
+
+    const size_t off = head % RING_BYTES;
+    const size_t first = len < RING_BYTES - off ? len : RING_BYTES - off;
+    memcpy(l.ring + off, data, first);
+    memcpy(l.ring, data + first, len - first);
+    l.head.store(head + len, std::memory_order_release);
+    xTaskNotifyGive(l.task);
+}
+
+static void captureTask(void*) {
+    uint8_t block[MICSTREAM_BLOCK_BYTES];
+    for (;;) {
+        const size_t n = streamI2S.readBytes((char*)block, sizeof(block));
+        if (n == 0) {
+            portENTER_CRITICAL(&statsMux);
+            stats.i2s_errors++;
+            portEXIT_CRITICAL(&statsMux);
+        } else {
+            compress((int16_t*)block, n / 2);
+        }
+
+        xSemaphoreTake(micMutex, portMAX_DELAY);
+        int active = 0;
+        for (Listener& l : listeners) {
+            if (!l.used || l.kicked) continue;
+            active++;
+            if (n) push(l, block, n);
+        }
+        // Paused: release the microphone now, kicked senders still stuck in a send do not hold it
+        if (!active || paused) {
+            capturing = false;
+            streamI2S.end();
+            portENTER_CRITICAL(&statsMux);
+            stats.capturing = false;
+            portEXIT_CRITICAL(&statsMux);
+            xSemaphoreGive(micMutex);
+            Serial.println(paused ? "[MicStream] Microphone released to the assistant" : "[MicStream] Last listener left, microphone stopped");
+            vTaskDelete(nullptr);
+        }
+        xSemaphoreGive(micMutex);
+
+        portENTER_CRITICAL(&statsMux);
+        stats.captured_bytes += n;
+        portEXIT_CRITICAL(&statsMux);
+    }
+}
+
+// 44-byte PCM WAV header; 'dataBytes' 0 announces an open-ended stream
+static void wavHeader(uint8_t* h, uint32_t dataBytes) {
+    const uint32_t data = dataBytes ? dataBytes : 0xFFFFFFFF;
+    const uint32_t riff = dataBytes ? dataBytes + 36 : 0xFFFFFFFF;
+    const uint32_t byteRate = MICSTREAM_SAMPLE_RATE * 2;
+    auto le32 = [](uint8_t* p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; };
+    auto le16 = [](uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; };
+    memcpy(h, "RIFF", 4);       le32(h + 4, riff);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    le32(h + 16, 16);           le16(h + 20, 1);        // PCM
+    le16(h + 22, 1);            le32(h + 24, MICSTREAM_SAMPLE_RATE);
+    le32(h + 28, byteRate);     le16(h + 32, 2);        le16(h + 34, 16);
+    memcpy(h + 36, "data", 4);  le32(h + 40, data);
+}
+
+static void senderTask(void* arg) {
+    Listener& l = *static_cast<Listener*>(arg);
+    bool ok;
+    {
+        HttpRequest req(l.req);
+        req.setHeader("Cache-Control", "no-store");
+        if (l.pcm) {
+            req.setHeader("X-Audio-Format", "s16le;rate=" + String(MICSTREAM_SAMPLE_RATE) + ";channels=1");
+            ok = req.beginChunked(200, "application/octet-stream") == ESP_OK;
+        } else {
+            uint8_t header[44];
+            wavHeader(header, l.openEnded ? 0 : l.limitBytes);
+            ok = req.beginChunked(200, "audio/wav") == ESP_OK && req.sendChunk((const char*)header, sizeof(header)) == ESP_OK;
+        }
+
+        while (ok && !l.kicked) {
+            const uint32_t head = l.head.load(std::memory_order_acquire);
+            const uint32_t tail = l.tail.load(std::memory_order_relaxed);
+            if (head == tail) {
+                if (tail >= l.limitBytes) break;        // All requested seconds sent
+                ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(200));
+                continue;
+            }
+            const size_t off = tail % RING_BYTES;
+            const size_t n = head - tail < RING_BYTES - off ? head - tail : RING_BYTES - off;
+            ok = req.sendChunk((const char*)l.ring + off, n) == ESP_OK;
+            l.tail.store(tail + n, std::memory_order_release);
+            portENTER_CRITICAL(&statsMux);
+            stats.sent_bytes += n;
+            portEXIT_CRITICAL(&statsMux);
+        }
+        if (ok && !l.kicked) ok = req.endChunked() == ESP_OK;
+        else ok = false;
+    }
+
+    httpd_req_t* r = l.req;
+    uint8_t* ring = l.ring;
+    xSemaphoreTake(micMutex, portMAX_DELAY);
+    l.used = false;
+    l.req = nullptr;
+    l.ring = nullptr;
+    portENTER_CRITICAL(&statsMux);
+    stats.listeners--;
+    Metrics_Set(mListeners, stats.listeners);
+    portEXIT_CRITICAL(&statsMux);
+    xSemaphoreGive(micMutex);
+    heap_caps_free(ring);
+
+    // A stream cut short closes the connection, a finished one stays usable
+    httpd_handle_t hd = r->handle;
+    const int fd = httpd_req_to_sockfd(r);
+    httpd_req_async_handler_complete(r);
+    if (!ok) httpd_sess_trigger_close(hd, fd);
+    Serial.println("[MicStream] Listener left");
+    vTaskDelete(nullptr);
+}
+
+void MicStream_Init() {
+    if (micMutex) return;
+    micMutex = xSemaphoreCreateMutex();
+    mListeners = Metrics_Gauge("mic_stream_listeners", "Clients listening to /stream");
+    mDropped = Metrics_Counter("mic_stream_dropped_blocks_total", "Microphone blocks dropped for a listener with a full buffer");
+}
+
+esp_err_t MicStream_Serve(HttpRequest& req) {
+    const bool pcm = req.arg("format") == "pcm";
+    long seconds = req.arg("seconds").toInt();
+    if (seconds > MICSTREAM_MAX_SECONDS) seconds = MICSTREAM_MAX_SECONDS;
+    if (!micMutex) return req.send(503, "text/plain", "Microphone stream not ready");
+
+    xSemaphoreTake(micMutex, portMAX_DELAY);
+    if (paused) {
+        xSemaphoreGive(micMutex);
+        portENTER_CRITICAL(&statsMux);
+        stats.rejected++;
+        portEXIT_CRITICAL(&statsMux);
+        req.setHeader("Retry-After", "10");
+        return req.send(503, "text/plain", "Microphone in use by the assistant");
+    }
+    Listener* l = nullptr;
+    for (Listener& c : listeners) {
+        if (!c.used) {
+            l = &c;
+            break;
+        }
+    }
+    if (!l) {
+        xSemaphoreGive(micMutex);
+        portENTER_CRITICAL(&statsMux);
+        stats.rejected++;
+        portEXIT_CRITICAL(&statsMux);
+        req.setHeader("Retry-After", "5");
+        return req.send(503, "text/plain", "Too many listeners");
+    }
+
+    uint8_t* ring = (uint8_t*)heap_caps_malloc(RING_BYTES, MALLOC_CAP_SPIRAM);
+    if (!ring) {
+        xSemaphoreGive(micMutex);
+        return req.send(500, "text/plain", "Out of memory");
+    }
+    const bool startCapture = !capturing;
+    if (startCapture && !beginI2S()) {
+        xSemaphoreGive(micMutex);
+        heap_caps_free(ring);
+        return req.send(500, "text/plain", "I2S begin failed");
+    }
+
+    httpd_req_t* copy = nullptr;
+    if (httpd_req_async_handler_begin(req.raw(), &copy) != ESP_OK) {
+        if (startCapture) streamI2S.end();
+        xSemaphoreGive(micMutex);
+        heap_caps_free(ring);
+        return req.send(500, "text/plain", "Could not detach request");
+    }
+
+    l->used = true;
+    l->req = copy;
+    l->ring = ring;
+    l->head.store(0);
+    l->tail.store(0);
+    l->pcm = pcm;
+    l->openEnded = seconds <= 0;
+    l->limitBytes = (uint32_t)(l->openEnded ? MICSTREAM_MAX_SECONDS : seconds) * MICSTREAM_SAMPLE_RATE * 2;
+    l->fullSinceMs = 0;
+    l->kicked = false;
+    if (xTaskCreatePinnedToCore(senderTask, "MicListener", MICSTREAM_SENDER_STACK, l, MICSTREAM_TASK_PRIORITY, &l->task, 0) != pdPASS) {
+        l->used = false;
+        if (startCapture) streamI2S.end();
+        xSemaphoreGive(micMutex);
+        heap_caps_free(ring);
+        httpd_req_async_handler_complete(copy);
+        return ESP_FAIL;
+    }
+    if (startCapture) {
+        capturing = true;
+        xTaskCreatePinnedToCore(captureTask, "MicCapture", MICSTREAM_CAPTURE_STACK, nullptr, MICSTREAM_TASK_PRIORITY, nullptr, 0);
+        Serial.println("[MicStream] Microphone started");
+    }
+
+    portENTER_CRITICAL(&statsMux);
+    stats.sessions++;
+    stats.capturing = true;
+    if (++stats.listeners > stats.listeners_peak) stats.listeners_peak = stats.listeners;
+    Metrics_Set(mListeners, stats.listeners);
+    portEXIT_CRITICAL(&statsMux);
+    xSemaphoreGive(micMutex);
+
+    Serial.printf("[MicStream] Listener joined (%s%s)\n", pcm ? "pcm" : "wav",
+                  seconds > 0 ? (", " + String(seconds) + " s").c_str() : "");
+    return ESP_OK;
+}
+
+void MicStream_Pause() {
+    if (!micMutex) return;
+    xSemaphoreTake(micMutex, portMAX_DELAY);
+    paused = true;
+    uint32_t ended = 0;
+    for (Listener& l : listeners) {
+        if (!l.used || l.kicked) continue;
+        l.kicked = true;
+        ended++;
+        xTaskNotifyGive(l.task);
+    }
+    xSemaphoreGive(micMutex);
+    portENTER_CRITICAL(&statsMux);
+    stats.preempted += ended;
+    stats.paused = true;
+    portEXIT_CRITICAL(&statsMux);
+
+    // The capture task ends I2S itself after its current read (one block), without waiting for the senders
+    const uint32_t start = millis();
+    for (;;) {
+        xSemaphoreTake(micMutex, portMAX_DELAY);
+        const bool busy = capturing;
+        xSemaphoreGive(micMutex);
+        if (!busy) break;
+        if (millis() - start > MICSTREAM_RELEASE_MS) {
+            Serial.println("[MicStream] Microphone not released in time");
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    if (ended) Serial.printf("[MicStream] Paused for the assistant, %u listener(s) ended\n", ended);
+}
+
+void MicStream_Resume() {
+    if (!micMutex) return;
+    xSemaphoreTake(micMutex, portMAX_DELAY);
+    paused = false;
+    xSemaphoreGive(micMutex);
+    portENTER_CRITICAL(&statsMux);
+    stats.paused = false;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void MicStream_GetStats(MicStreamStats* out) {
+    if (!out) return;
+    portENTER_CRITICAL(&statsMux);
+    *out = stats;
+    portEXIT_CRITICAL(&statsMux);
+}
+
+void MicStream_PrintStats() {
+    MicStreamStats st;
+    MicStream_GetStats(&st);
+    Serial.printf("[MicStream] listeners %u (peak %u), sessions %u, rejected %u, kicked %u, preempted %u, dropped blocks %u, captured %llu KB, sent %llu KB, i2s errors %u\n",
+                  st.listeners, st.listeners_peak, st.sessions, st.rejected, st.kicked, st.preempted, st.dropped_blocks,
+                  (unsigned long long)(st.captured_bytes / 1024), (unsigned long long)(st.sent_bytes / 1024), st.i2s_errors);
+}
@@ -0,0 +1,76 @@
+#ifndef MIC_STREAM_H
+#define MIC_STREAM_H
+
+#include <Arduino.h>
+#include "HttpRequest.h"
+
+/*
+  Live microphone stream for several HTTP listeners (GET /stream)
+
+  One capture task reads the I2S microphone and applies the soft
+  compressor once, then copies every block into the ring buffer of each
+  listener. Each listener has its own sender task that drains its ring to
+  its socket as chunked HTTP, so a slow client only fills its own ring:
+  when that is full the newest block is dropped for that client only
+  (tail drop, latency stays bounded by MICSTREAM_RING_BYTES), and a client
+  that takes nothing for MICSTREAM_STALL_MS is disconnected. Capture never
+  waits for a socket.
+
+  The body is a WAV file (16 kHz, 16 bit, mono) whose header announces an
+  open-ended length, which players and ffmpeg accept for live input; with
+  "seconds=N" it is exactly N seconds long and the header sizes are exact.
+  No stream runs longer than MICSTREAM_MAX_SECONDS; an open-ended one is
+  ended there and the client reconnects. "format=pcm" sends the bare
+  samples as before, with the format in X-Audio-Format.
+
+  Listeners do not occupy HTTP workers: the request is detached from the
+  httpd task (async handler) and finished by the sender task. The
+  microphone runs only while someone listens.
+
+  The assistant (MIC_MSM) records from the same I2S pins. Its start calls
+  MicStream_Pause(), which ends every listener and releases the
+  microphone; until MicStream_Resume() new listeners get 503.
+*/
+
+#define MICSTREAM_SAMPLE_RATE     16000
+#define MICSTREAM_MAX_LISTENERS   4
+#define MICSTREAM_BLOCK_BYTES     1024      // One I2S read, 32 ms
+#define MICSTREAM_RING_BYTES      32768     // Per listener (PSRAM), ~1 s: the most a listener lags. Power of two.
+#define MICSTREAM_MAX_SECONDS     3600      // Longest stream, also the end of an open-ended one
+#define MICSTREAM_STALL_MS        5000      // Ring full this long: disconnect
+#define MICSTREAM_RELEASE_MS      1200      // MicStream_Pause() waits this long for the microphone (I2S read timeout)
+#define MICSTREAM_CAPTURE_STACK   4096
+#define MICSTREAM_SENDER_STACK    4096
+#define MICSTREAM_TASK_PRIORITY   2
+
+struct MicStreamStats {
+    uint32_t listeners;         // Connected now
+    uint32_t listeners_peak;
+    uint32_t sessions;          // Listeners served since boot
+    uint32_t rejected;          // No free listener slot
+    uint32_t kicked;            // Disconnected for not reading
+    uint32_t preempted;         // Ended because the assistant took the microphone
+    uint32_t dropped_blocks;    // Not queued for a listener whose ring was full
+    uint64_t captured_bytes;
+    uint64_t sent_bytes;
+    uint32_t i2s_errors;
+    bool     capturing;
+    bool     paused;            // Assistant recording, listeners refused
+};
+
+void MicStream_Init();
+
+// Takes over 'req' (GET /stream, run inline in the httpd task) and returns at once; a sender
+// task answers it. Failures (all slots taken, microphone error) are answered here.
+esp_err_t MicStream_Serve(HttpRequest& req);
+
+// Ends all listeners, refuses new ones and returns once the capture task has released the
+// microphone I2S, normally within one block (32 ms); it does not wait for the listeners' sends.
+// Called before the assistant starts recording.
+void MicStream_Pause();
+void MicStream_Resume();
+
+void MicStream_GetStats(MicStreamStats* out);
+void MicStream_PrintStats();
+
+#endif
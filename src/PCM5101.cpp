@@ -1,34 +1,36 @@
 #include "Audio.h"
 #include "PCM5101.h"
-#include <EEPROM.h>
+#include "AudioMixer.h"
+#include "StreamMonitor.h"
+#include "Settings.h"
+#include "EventStream.h"
 #include "config.h"
 
-#define DEFAULT_VOLUME     10      // fallback if uninitialized
-
-static uint8_t currentVolume = DEFAULT_VOLUME;
+static uint8_t currentVolume = SETTINGS_DEFAULT_VOLUME;
 
 Audio audio;
 
 void IRAM_ATTR increase_audio_tick(void *arg)
 {
   audio.loop();
-}
-
-uint8_t LoadVolumeFromEEPROM() {
-  uint8_t vol = EEPROM.read(EEPROM_VOLUME_ADDR);
-  Serial.printf("Load volume from EEPROM %d\n", vol);
-  if (vol > Volume_MAX) vol = DEFAULT_VOLUME;  // Sanity check
-  return vol;
+  AudioMixer_Loop();  // voice decoder + ducking state, same task as audio.loop()
+  StreamMonitor_Tick();  // radio buffer health, rate-limited internally
 }
 
 void Audio_Init() {
-  EEPROM.begin(EEPROM_SIZE);
-  currentVolume = LoadVolumeFromEEPROM();
+  currentVolume = Settings_GetVolume();
+  Serial.printf("Load volume from settings %d\n", currentVolume);
 
   // Audio
   audio.setPinout(I2S_BCLK, I2S_LRC, I2S_DOUT);
   audio.setVolume(currentVolume); // 0...21  
 
+  // Second decoder for voice/TTS mixed over music
+  AudioMixer_Init(audio);
+
+  // Rebuffering / fallback / health stats for radio streams
+  StreamMonitor_Init(audio);
+
   // Set up a hardware timer using ESP-IDF's esp_timer to periodically call the audio.loop() function,
   // which is critical for continuous audio playback using the ESP32-audioI2S library.
   // Using a timer for this is more efficient than doing it in loop() or polling with millis().
@@ -51,8 +53,10 @@ void SetVolume(uint8_t vol) {
 
   currentVolume = vol;
   audio.setVolume(currentVolume); // 0...21    
-  EEPROM.write(EEPROM_VOLUME_ADDR, currentVolume);
-  EEPROM.commit();
+
+  // RAM shadow only, flash commit is debounced (slider drags fire this many times)
+  Settings_SetVolume(currentVolume);
+  EventStream_Notify(EVENT_VOLUME);
 }
 
 uint8_t GetVolume() {
@@ -0,0 +1,318 @@
+// RequestSpool.cpp - SD spool for assistant requests made while the backend is unreachable
+#include "RequestSpool.h"
+#include <vector>
+#include <time.h>
+#include <SD_MMC.h>
+#include "FileUploader.h"
+#include "DirCache.h"
+
+#define SPOOL_MAX_ATTEMPTS   3            // Replay attempts before an entry is given up
+#define SPOOL_CLOCK_VALID    1600000000   // time() below this means the clock was never set
+
+struct SpoolEntry {
+    uint32_t seq;
+    uint8_t  kind;
+    uint8_t  attempts;      // Not persisted
+    time_t   created;
+    uint32_t size;
+};
+
+static std::vector<SpoolEntry> entries;
+static SemaphoreHandle_t spoolMutex = nullptr;
+static SemaphoreHandle_t uploadDone = nullptr;
+static TaskHandle_t spoolTaskHandle = nullptr;
+static uint32_t nextSeq = 1;
+static uint32_t inFlightSeq = 0;    // Entry the uploader holds, until its callback (guarded by spoolMutex)
+static uint32_t waitSeq = 0;        // Entry replayOne() is still waiting for (guarded by spoolMutex)
+static volatile bool uploadOk = false;
+
+static volatile bool backendReady = false;
+static char sessionId[UPLOADER_SESSION_MAX] = "";
+
+static RequestSpoolStats stats = {};
+
+static String entryPath(uint32_t seq) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), SPOOL_DIR "/%06lu.wav", (unsigned long)seq);
+    return String(buf);
+}
+
+static const char* kindName(uint8_t kind) {
+    return kind == SPOOL_KIND_STREAM ? "stream" : "upload";
+}
+
+// Index file: one "seq|kind|created|size" line per entry, oldest first (caller holds spoolMutex)
+static void saveIndex() {
+    File f = SD_MMC.open(SPOOL_INDEX, FILE_WRITE);
+    if (!f) {
+        Serial.println("[Spool] Failed to write index");
+        return;
+    }
+    for (const SpoolEntry& e : entries) {
+        f.printf("%lu|%u|%ld|%lu\n", (unsigned long)e.seq, e.kind, (long)e.created, (unsigned long)e.size);
+    }
+    f.close();
+    DirCache_Invalidate(SPOOL_INDEX);           // Every add and remove of an entry ends here
+}
+
+static void recount() {
+    uint64_t total = 0;
+    for (const SpoolEntry& e : entries) total += e.size;
+    stats.bytes = total;
+    stats.depth = entries.size();
+}
+
+// Caller holds spoolMutex
+static void removeAt(size_t i) {
+    SD_MMC.remove(entryPath(entries[i].seq).c_str());
+    entries.erase(entries.begin() + i);
+    recount();
+    saveIndex();
+}
+
+// Drop the oldest entries (except one being uploaded) until 'incoming' fits (caller holds spoolMutex)
+static void evictToFit(uint32_t incoming) {
+    while (!entries.empty() && (entries.size() >= SPOOL_MAX_ENTRIES || stats.bytes + incoming > SPOOL_MAX_BYTES)) {
+        size_t victim = (entries[0].seq == inFlightSeq && entries.size() > 1) ? 1 : 0;
+        if (entries[victim].seq == inFlightSeq) break;
+        Serial.printf("[Spool] Full, dropped %s request %lu\n", kindName(entries[victim].kind), (unsigned long)entries[victim].seq);
+        removeAt(victim);
+        stats.evicted++;
+    }
+}
+
+// Outcome of an upload of 'seq' (caller holds spoolMutex)
+static void settleReplay(uint32_t seq, bool ok) {
+    if (!entries.empty() && entries[0].seq == seq) {
+        if (ok) {
+            removeAt(0);
+            stats.replayed++;
+        } else if (++entries[0].attempts >= SPOOL_MAX_ATTEMPTS) {
+            Serial.printf("[Spool] Giving up on request %lu after %d attempts\n", (unsigned long)seq, SPOOL_MAX_ATTEMPTS);
+            removeAt(0);
+        }
+    }
+    if (!ok) stats.replay_failures++;
+}
+
+// Runs in the uploader task. Completions are matched by seq, so one that arrives after
+// replayOne() stopped waiting is settled here instead of releasing the next replay's wait.
+static void onReplayUploaded(const char* path, bool ok) {
+    unsigned long seq = 0;
+    if (!path || sscanf(path, SPOOL_DIR "/%lu.wav", &seq) != 1) return;
+
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    if (seq != inFlightSeq) {
+        xSemaphoreGive(spoolMutex);
+        return;
+    }
+    inFlightSeq = 0;
+    if (seq == waitSeq) {
+        waitSeq = 0;
+        uploadOk = ok;
+        xSemaphoreGive(spoolMutex);
+        xSemaphoreGive(uploadDone);
+        return;
+    }
+    Serial.printf("[Spool] Late upload result for request %lu: %s\n", seq, ok ? "ok" : "failed");
+    settleReplay(seq, ok);
+    xSemaphoreGive(spoolMutex);
+
+    // Replay paused while the uploader held this entry
+    if (backendReady && spoolTaskHandle) xTaskNotifyGive(spoolTaskHandle);
+}
+
+// Replays the oldest entry. Returns false when replay should pause (empty, failed, link lost).
+static bool replayOne() {
+    SpoolEntry e;
+    char session[UPLOADER_SESSION_MAX];
+
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    if (entries.empty() || inFlightSeq) {       // The uploader still holds a timed-out replay
+        xSemaphoreGive(spoolMutex);
+        return false;
+    }
+    e = entries[0];
+    const time_t now = time(nullptr);
+    if (now > SPOOL_CLOCK_VALID && e.created > SPOOL_CLOCK_VALID && now - e.created > SPOOL_MAX_AGE_S) {
+        Serial.printf("[Spool] Discarded %s request %lu, %ld s old\n", kindName(e.kind), (unsigned long)e.seq, (long)(now - e.created));
+        removeAt(0);
+        stats.expired++;
+        xSemaphoreGive(spoolMutex);
+        return true;
+    }
+    inFlightSeq = e.seq;
+    waitSeq = e.seq;
+    strlcpy(session, sessionId, sizeof(session));
+    xSemaphoreGive(spoolMutex);
+
+    const String path = entryPath(e.seq);
+    Serial.printf("[Spool] Replaying %s request %lu (%lu bytes)\n", kindName(e.kind), (unsigned long)e.seq, (unsigned long)e.size);
+
+    xSemaphoreTake(uploadDone, 0);
+    if (!FileUploader_Enqueue(path.c_str(), session, onReplayUploaded)) {
+        xSemaphoreTake(spoolMutex, portMAX_DELAY);
+        inFlightSeq = 0;
+        waitSeq = 0;
+        settleReplay(e.seq, false);
+        xSemaphoreGive(spoolMutex);
+        return false;
+    }
+    const bool done = xSemaphoreTake(uploadDone, pdMS_TO_TICKS(SPOOL_UPLOAD_TIMEOUT_MS)) == pdTRUE;
+
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    if (waitSeq == e.seq) {
+        // Timed out: the entry stays with the uploader, its callback settles it and resumes replay
+        waitSeq = 0;
+        xSemaphoreGive(spoolMutex);
+        Serial.printf("[Spool] Request %lu still uploading after %d ms\n", (unsigned long)e.seq, SPOOL_UPLOAD_TIMEOUT_MS);
+        return false;
+    }
+    if (!done) xSemaphoreTake(uploadDone, 0);  // Result landed between the timeout and the lock
+    const bool ok = uploadOk;
+    settleReplay(e.seq, ok);
+    xSemaphoreGive(spoolMutex);
+    return ok;
+}
+
+static void RequestSpoolTask(void*) {
+    while (true) {
+        // Woken by HELLO, or by a new entry while the backend is up
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(pdMS_TO_TICKS(SPOOL_REPLAY_DELAY_MS));
+
+        stats.replaying = true;
+        while (backendReady && replayOne()) {
+            vTaskDelay(pdMS_TO_TICKS(SPOOL_REPLAY_INTERVAL_MS));
+        }
+        stats.replaying = false;
+    }
+}
+
+void RequestSpool_Init() {
+    spoolMutex = xSemaphoreCreateMutex();
+    uploadDone = xSemaphoreCreateBinary();
+
+    if (!SD_MMC.exists(SPOOL_DIR)) {
+        SD_MMC.mkdir(SPOOL_DIR);
+        DirCache_Invalidate(SPOOL_DIR);
+    }
+
+    entries.clear();
+    File f = SD_MMC.open(SPOOL_INDEX, FILE_READ);
+    if (f) {
+        while (f.available()) {
+            String line = f.readStringUntil('\n');
+            line.trim();
+            int a = line.indexOf('|');
+            int b = line.indexOf('|', a + 1);
+            int c = line.indexOf('|', b + 1);
+            if (a < 0 || b < 0 || c < 0) continue;
+
+            SpoolEntry e = {};
+            e.seq = line.substring(0, a).toInt();
+            e.kind = line.substring(a + 1, b).toInt();
+            e.created = line.substring(b + 1, c).toInt();
+            e.size = line.substring(c + 1).toInt();
+
+            if (e.seq >= nextSeq) nextSeq = e.seq + 1;
+            // Skip entries whose file went missing
+            if (!SD_MMC.exists(entryPath(e.seq).c_str())) continue;
+            entries.push_back(e);
+        }
+        f.close();
+    }
+    recount();
+    saveIndex();
+
+    xTaskCreatePinnedToCore(RequestSpoolTask, "RequestSpool", 4096, NULL, 1, &spoolTaskHandle, 0);
+    Serial.printf("[Spool] %u requests waiting, %llu bytes\n", stats.depth, stats.bytes);
+}
+
+bool RequestSpool_ReservePath(char* out, size_t len) {
+    if (!spoolMutex) return false;
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    const uint32_t seq = nextSeq++;
+    xSemaphoreGive(spoolMutex);
+    strlcpy(out, entryPath(seq).c_str(), len);
+    return true;
+}
+
+bool RequestSpool_Commit(const char* path, SpoolKind kind) {
+    if (!spoolMutex || !path) return false;
+    unsigned long seq = 0;
+    if (sscanf(path, SPOOL_DIR "/%lu.wav", &seq) != 1) return false;
+
+    File f = SD_MMC.open(path, FILE_READ);
+    if (!f) return false;
+    SpoolEntry e = {};
+    e.seq = seq;
+    e.kind = kind;
+    e.created = time(nullptr);
+    e.size = f.size();
+    f.close();
+
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    evictToFit(e.size);
+    entries.push_back(e);
+    recount();
+    saveIndex();
+    stats.spooled++;
+    xSemaphoreGive(spoolMutex);
+
+    Serial.printf("[Spool] Stored %s request %lu (%lu bytes), %u waiting\n", kindName(kind), seq, (unsigned long)e.size, stats.depth);
+    if (backendReady && spoolTaskHandle) xTaskNotifyGive(spoolTaskHandle);
+    return true;
+}
+
+bool RequestSpool_AddFile(const char* srcPath, SpoolKind kind) {
+    char path[32];
+    if (!srcPath || !RequestSpool_ReservePath(path, sizeof(path))) return false;
+    if (!SD_MMC.rename(srcPath, path)) {
+        Serial.printf("[Spool] Could not move %s into the spool\n", srcPath);
+        return false;
+    }
+    DirCache_Invalidate(srcPath);
+    return RequestSpool_Commit(path, kind);
+}
+
+void RequestSpool_OnBackendReady(const char* id) {
+    if (!spoolMutex) return;
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    strlcpy(sessionId, id ? id : "", sizeof(sessionId));
+    const bool pending = !entries.empty();
+    xSemaphoreGive(spoolMutex);
+
+    backendReady = true;
+    if (pending && spoolTaskHandle) xTaskNotifyGive(spoolTaskHandle);
+}
+
+void RequestSpool_OnBackendLost() {
+    backendReady = false;
+}
+
+uint32_t RequestSpool_Depth() {
+    return stats.depth;
+}
+
+void RequestSpool_GetStats(RequestSpoolStats* out) {
+    if (!out) return;
+    if (!spoolMutex) {
+        *out = {};
+        return;
+    }
+    xSemaphoreTake(spoolMutex, portMAX_DELAY);
+    *out = stats;
+    const time_t now = time(nullptr);
+    out->oldest_age_s = (!entries.empty() && now > SPOOL_CLOCK_VALID && entries[0].created > SPOOL_CLOCK_VALID)
+        ? (uint32_t)(now - entries[0].created) : 0;
+    xSemaphoreGive(spoolMutex);
+}
+
+void RequestSpool_PrintStats() {
+    RequestSpoolStats s;
+    RequestSpool_GetStats(&s);
+    Serial.printf("[Spool] depth=%u bytes=%llu oldest=%us spooled=%u replayed=%u failures=%u expired=%u evicted=%u%s\n",
+                  s.depth, s.bytes, s.oldest_age_s, s.spooled, s.replayed, s.replay_failures,
+                  s.expired, s.evicted, s.replaying ? " (replaying)" : "");
+}
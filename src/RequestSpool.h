@@ -0,0 +1,64 @@
+#ifndef REQUEST_SPOOL_H
+#define REQUEST_SPOOL_H
+
+#include <Arduino.h>
+
+/*
+  Offline spool for assistant requests
+
+  Voice requests made while the backend is unreachable are kept on SD
+  instead of being dropped: a stream started while the WebSocket is down is
+  recorded into the spool as a WAV, and recordings whose upload could not be
+  made (or failed) are moved into it. /spool/index.txt keeps the entries in
+  order with their kind, creation time and size.
+
+  Once the backend acknowledges HELLO again, a worker replays the entries
+  oldest first as uploads under the new session id, one at a time and
+  SPOOL_REPLAY_INTERVAL_MS apart, so a backlog does not arrive as a burst of
+  overlapping answers. Entries older than SPOOL_MAX_AGE_S are discarded; when
+  the spool is full the oldest entry makes room.
+*/
+
+#define SPOOL_DIR                 "/spool"
+#define SPOOL_INDEX               "/spool/index.txt"
+#define SPOOL_MAX_ENTRIES         16
+#define SPOOL_MAX_BYTES           (8UL * 1024 * 1024)
+#define SPOOL_MAX_AGE_S           3600      // A request older than this is no longer meaningful
+#define SPOOL_REPLAY_DELAY_MS     2000      // After HELLO, before the first replay
+#define SPOOL_REPLAY_INTERVAL_MS  5000      // Between replayed requests
+#define SPOOL_UPLOAD_TIMEOUT_MS   60000
+
+enum SpoolKind : uint8_t {
+    SPOOL_KIND_STREAM = 0,      // Stream started while disconnected, recorded to SD
+    SPOOL_KIND_UPLOAD = 1,      // Recording that could not be uploaded
+};
+
+struct RequestSpoolStats {
+    uint32_t depth;             // Entries waiting
+    uint64_t bytes;
+    uint32_t oldest_age_s;      // 0 when empty or clock not set
+    uint32_t spooled;
+    uint32_t replayed;
+    uint32_t replay_failures;
+    uint32_t expired;           // Dropped for age
+    uint32_t evicted;           // Dropped to make room
+    bool     replaying;
+};
+
+void RequestSpool_Init();
+
+// Path for a new spooled recording ("/spool/<seq>.wav"); hand it to RequestSpool_Commit when written
+bool RequestSpool_ReservePath(char* out, size_t len);
+bool RequestSpool_Commit(const char* path, SpoolKind kind);
+// Moves an existing recording into the spool
+bool RequestSpool_AddFile(const char* srcPath, SpoolKind kind);
+
+// Backend link state, from the WebSocket client
+void RequestSpool_OnBackendReady(const char* sessionId);
+void RequestSpool_OnBackendLost();
+
+uint32_t RequestSpool_Depth();
+void RequestSpool_GetStats(RequestSpoolStats* out);
+void RequestSpool_PrintStats();
+
+#endif
@@ -1,4 +1,5 @@
 #include "SD_Card.h"
+#include "DirCache.h"
 
 // Define them only here
 uint16_t SDCard_Size = 0;
@@ -47,33 +48,38 @@ void SD_Init() {
 
 bool File_Search(const char* directory, const char* fileName)    
 {
-  File Path = SD_MMC.open(directory);
-  if (!Path) {
-    Serial.printf("Path: <%s> does not exist\r\n",directory);
-    return false;
-  }
-  File file = Path.openNextFile();
-  while (file) {
-    if (strcmp(file.name(), fileName) == 0) {                           
-      if (strcmp(directory, "/") == 0)
-        Serial.printf("File '%s%s' found in root directory.\r\n",directory,fileName);  
-      else
-        Serial.printf("File '%s/%s' found in root directory.\r\n",directory,fileName); 
-      Path.close();                                                     
-      return true;                                                     
-    }
-    file = Path.openNextFile();                                        
+  // Binary search in the cached directory listing
+  if (DirCache_Lookup(directory, fileName)) {
+    if (strcmp(directory, "/") == 0)
+      Serial.printf("File '%s%s' found in root directory.\r\n",directory,fileName);  
+    else
+      Serial.printf("File '%s/%s' found in root directory.\r\n",directory,fileName); 
+    return true;                                                     
   }
   if (strcmp(directory, "/") == 0)
     Serial.printf("File '%s%s' not found in root directory.\r\n",directory,fileName);           
   else
     Serial.printf("File '%s/%s' not found in root directory.\r\n",directory,fileName);          
-  Path.close();                                                         
   return false;                                                         
 }
 
 uint16_t Folder_retrieval(const char* directory, const char* fileExtension, char File_Name[][100], size_t File_Sizes[], uint16_t maxFiles)
 {
+  const DirSnapshot* snap = DirCache_Acquire(directory);
+  if (snap) {
+    uint16_t fileCount = 0;
+    for (size_t i = 0; i < DirCache_Count(snap) && fileCount < maxFiles; ++i) {
+      DirCacheEntry e = DirCache_At(snap, i);
+      if (e.isDir || (strlen(fileExtension) && !strstr(e.name, fileExtension))) continue;
+      strlcpy(File_Name[fileCount], e.name, sizeof(File_Name[fileCount]));
+      File_Sizes[fileCount] = e.size;
+      fileCount++;
+    }
+    DirCache_Release(snap);
+    return fileCount;
+  }
+
+  // Too big to cache: walk the card
   File Path = SD_MMC.open(directory);
   if (!Path || !Path.isDirectory()) {
     Serial.printf("Path: <%s> does not exist or is not a directory\r\n", directory);
@@ -116,6 +122,7 @@ bool Create_File_If_Not_Exists(const char* path) {
 
   file.println("123");
   file.close();
+  DirCache_Invalidate(path);
   Serial.printf("File created and written: %s\n", path);
   return true;
 }
@@ -126,6 +133,18 @@ void LoadSDCardMP3Files(std::vector<String>* fileList, const char* path) {
 
     fileList->clear();  // Clear previous entries
 
+    const DirSnapshot* snap = DirCache_Acquire(path);
+    if (snap) {
+        for (size_t i = 0; i < DirCache_Count(snap); ++i) {
+            DirCacheEntry e = DirCache_At(snap, i);
+            String name = e.name;
+            if (!e.isDir && (name.endsWith(".mp3") || name.endsWith(".wav"))) fileList->push_back(name);
+        }
+        DirCache_Release(snap);
+        return;
+    }
+
+    // Too big to cache: walk the card
     File dir = SD_MMC.open(path);
     if (!dir || !dir.isDirectory()) {
         Serial.printf("Failed to open directory: %s\n", path);
@@ -167,8 +186,10 @@ std::vector<std::pair<String, String>> ReadInternetStations(const char* path) {
         int sepIndex = line.indexOf('|');
         if (sepIndex <= 0 || sepIndex >= line.length() - 1) continue;
 
+        // Optional third field is a fallback URL, see StreamMonitor
+        int fallbackIndex = line.indexOf('|', sepIndex + 1);
         String name = line.substring(0, sepIndex);
-        String url = line.substring(sepIndex + 1);
+        String url = fallbackIndex > 0 ? line.substring(sepIndex + 1, fallbackIndex) : line.substring(sepIndex + 1);
 
         stations.emplace_back(name, url);
     }
@@ -0,0 +1,218 @@
+// SdWriter.cpp - Double-buffered SD writes for web uploads, on their own task
+#include "SdWriter.h"
+#include "Metrics.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+struct SdUpload {
+    int fd;
+    uint8_t* bufs[SDWRITER_BUFFERS];
+    QueueHandle_t freeBufs;     // Buffers back from the writer, ready to fill
+    uint8_t* cur;               // Being filled by the handler
+    size_t curLen;
+    uint64_t queued;            // Bytes handed to the writer
+    volatile bool error;
+    volatile int64_t sdUs;      // Time the writer spent in write()
+    int64_t startUs;
+};
+
+struct WriteJob {
+    SdUpload* up;
+    uint8_t* buf;
+    size_t len;
+};
+
+static QueueHandle_t jobQueue = nullptr;
+
+static Metric* mBytes = nullptr;
+static Metric* mWriteMs = nullptr;
+static Metric* mErrors = nullptr;
+
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static SdWriterStats stats = {};
+static uint64_t windowBytes[SDWRITER_RATE_WINDOW] = {};
+static int64_t windowUs[SDWRITER_RATE_WINDOW] = {};
+static int64_t windowSdUs[SDWRITER_RATE_WINDOW] = {};
+static uint32_t windowNext = 0;
+
+static void SdWriterTask(void*) {
+    WriteJob job;
+    for (;;) {
+        if (xQueueReceive(jobQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+        SdUpload* up = job.up;
+        if (!up->error) {
+            const int64_t t0 = esp_timer_get_time();
+            size_t done = 0;
+            while (done < job.len) {
+                const ssize_t n = write(up->fd, job.buf + done, job.len - done);
+                if (n <= 0) {
+                    up->error = true;
+                    Metrics_Add(mErrors);
+                    break;
+                }
+                done += n;
+            }
+            const int64_t us = esp_timer_get_time() - t0;
+            up->sdUs += us;
+            Metrics_Add(mBytes, done);
+            Metrics_Add(mWriteMs, (uint32_t)(us / 1000));
+        }
+        xQueueSend(up->freeBufs, &job.buf, portMAX_DELAY);
+    }
+}
+
+// Hands the filled buffer to the writer and takes the next free one
+static void submit(SdUpload* up) {
+    WriteJob job = { up, up->cur, up->curLen };
+    up->queued += up->curLen;
+    up->cur = nullptr;
+    up->curLen = 0;
+    xQueueSend(jobQueue, &job, portMAX_DELAY);
+
+    if (xQueueReceive(up->freeBufs, &up->cur, 0) != pdTRUE) {
+        portENTER_CRITICAL(&statsMux);
+        stats.stalls++;
+        portEXIT_CRITICAL(&statsMux);
+        xQueueReceive(up->freeBufs, &up->cur, portMAX_DELAY);
+    }
+}
+
+static void freeUpload(SdUpload* up) {
+    for (int i = 0; i < SDWRITER_BUFFERS; ++i) heap_caps_free(up->bufs[i]);
+    if (up->freeBufs) vQueueDelete(up->freeBufs);
+    if (up->fd >= 0) close(up->fd);
+    free(up);
+}
+
+void SdWriter_Init() {
+    if (jobQueue) return;
+    jobQueue = xQueueCreate(SDWRITER_QUEUE_LEN, sizeof(WriteJob));
+    mBytes = Metrics_Counter("sd_write_bytes_total", "Bytes written to the card by web uploads");
+    mWriteMs = Metrics_Counter("sd_write_ms_total", "Time spent in card writes for web uploads");
+    mErrors = Metrics_Counter("sd_write_errors_total", "Failed card writes for web uploads");
+    xTaskCreatePinnedToCore(SdWriterTask, "SdWriter", SDWRITER_TASK_STACK, nullptr, SDWRITER_TASK_PRIORITY, nullptr, 0);
+}
+
+SdUpload* SdWriter_Open(const char* path, uint64_t expectedBytes) {
+    if (!jobQueue) return nullptr;
+    SdUpload* up = (SdUpload*)calloc(1, sizeof(SdUpload));
+    if (!up) return nullptr;
+    up->fd = -1;
+
+    up->freeBufs = xQueueCreate(SDWRITER_BUFFERS, sizeof(uint8_t*));
+    for (int i = 0; i < SDWRITER_BUFFERS; ++i) {
+        up->bufs[i] = (uint8_t*)heap_caps_aligned_alloc(64, SDWRITER_BUFFER_BYTES, MALLOC_CAP_SPIRAM);
+        if (!up->bufs[i] || !up->freeBufs) {
+            freeUpload(up);
+            return nullptr;
+        }
+        xQueueSend(up->freeBufs, &up->bufs[i], 0);
+    }
+
+    const String full = String(SDWRITER_MOUNT) + path;
+    up->fd = open(full.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (up->fd < 0) {
+        freeUpload(up);
+        return nullptr;
+    }
+
+    // Seeking past the end in FATFS allocates the clusters; the size is trimmed on close
+    if (expectedBytes > 0 && lseek(up->fd, (off_t)expectedBytes, SEEK_SET) == (off_t)expectedBytes) {
+        portENTER_CRITICAL(&statsMux);
+        stats.preallocated++;
+        portEXIT_CRITICAL(&statsMux);
+    }
+    lseek(up->fd, 0, SEEK_SET);
+
+    xQueueReceive(up->freeBufs, &up->cur, 0);
+    up->startUs = esp_timer_get_time();
+    portENTER_CRITICAL(&statsMux);
+    stats.active++;
+    portEXIT_CRITICAL(&statsMux);
+    return up;
+}
+
+bool SdWriter_Write(SdUpload* up, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (len && !up->error) {
+        const size_t n = min(len, (size_t)SDWRITER_BUFFER_BYTES - up->curLen);
+        memcpy(up->cur + up->curLen, p, n);
+        up->curLen += n;
+        p += n;
+        len -= n;
+        if (up->curLen == SDWRITER_BUFFER_BYTES) submit(up);
+    }
+    return !up->error;
+}
+
+bool SdWriter_Close(SdUpload* up, SdWriterResult* out) {
+    if (up->curLen) {
+        WriteJob job = { up, up->cur, up->curLen };
+        up->queued += up->curLen;
+        xQueueSend(jobQueue, &job, portMAX_DELAY);
+    } else {
+        xQueueSend(up->freeBufs, &up->cur, 0);
+    }
+    up->cur = nullptr;
+
+    // All buffers back means the writer is done with this upload
+    uint8_t* buf;
+    for (int i = 0; i < SDWRITER_BUFFERS; ++i) xQueueReceive(up->freeBufs, &buf, portMAX_DELAY);
+
+    bool ok = !up->error;
+    if (ftruncate(up->fd, (off_t)up->queued) != 0) ok = false;      // Drop the preallocated tail
+    if (close(up->fd) != 0) ok = false;
+    up->fd = -1;
+
+    const int64_t us = esp_timer_get_time() - up->startUs;
+    SdWriterResult r;
+    r.bytes = up->queued;
+    r.ms = (uint32_t)(us / 1000);
+    r.mbps = us > 0 ? (float)up->queued / us : 0.0f;               // bytes/us == MB/s
+    r.sd_mbps = up->sdUs > 0 ? (float)up->queued / up->sdUs : 0.0f;
+    if (out) *out = r;
+
+    portENTER_CRITICAL(&statsMux);
+    stats.active--;
+    if (ok) {
+        stats.uploads++;
+        stats.bytes += up->queued;
+        stats.last_mbps = r.mbps;
+        windowBytes[windowNext] = up->queued;
+        windowUs[windowNext] = us;
+        windowSdUs[windowNext] = up->sdUs;
+        windowNext = (windowNext + 1) % SDWRITER_RATE_WINDOW;
+    } else {
+        stats.failures++;
+    }
+    portEXIT_CRITICAL(&statsMux);
+
+    freeUpload(up);
+    return ok;
+}
+
+void SdWriter_GetStats(SdWriterStats* out) {
+    if (!out) return;
+    portENTER_CRITICAL(&statsMux);
+    *out = stats;
+    uint64_t bytes = 0;
+    int64_t us = 0, sdUs = 0;
+    for (int i = 0; i < SDWRITER_RATE_WINDOW; ++i) {
+        bytes += windowBytes[i];
+        us += windowUs[i];
+        sdUs += windowSdUs[i];
+    }
+    portEXIT_CRITICAL(&statsMux);
+    out->avg_mbps = us > 0 ? (float)bytes / us : 0.0f;
+    out->sd_mbps = sdUs > 0 ? (float)bytes / sdUs : 0.0f;
+}
+
+void SdWriter_PrintStats() {
+    SdWriterStats st;
+    SdWriter_GetStats(&st);
+    Serial.printf("[SdWriter] %u uploads (%u failed, %u active), %llu KB, last %.2f MB/s, avg %.2f MB/s, SD %.2f MB/s, stalls %u\n",
+                  st.uploads, st.failures, st.active, (unsigned long long)(st.bytes / 1024),
+                  st.last_mbps, st.avg_mbps, st.sd_mbps, st.stalls);
+}
@@ -0,0 +1,68 @@
+#ifndef SD_WRITER_H
+#define SD_WRITER_H
+
+#include <Arduino.h>
+
+/*
+  Background SD writer for web uploads
+
+  The /upload handler used to write every received piece to the card
+  itself, so receiving and writing took turns and the card saw many small
+  writes. Now the handler copies file data into one of SDWRITER_BUFFERS
+  PSRAM buffers of SDWRITER_BUFFER_BYTES and hands each full buffer to the
+  writer task, then keeps receiving into the next one while the card is
+  busy. Each buffer is one large write() on the file (multi-sector
+  transfers in FATFS). When all buffers are in flight the handler waits for
+  one to come back, which throttles the socket to the card's speed.
+
+  The file is preallocated from the expected size (the request's
+  Content-Length) so FATFS allocates the cluster chain once instead of per
+  write, and trimmed to the bytes actually written on close.
+
+  Every upload reports MB/s end to end and for the card alone; the last
+  SDWRITER_RATE_WINDOW uploads give the rolling average shown in /status.
+*/
+
+#define SDWRITER_BUFFERS          3             // Per upload: one filling, two queued/writing
+#define SDWRITER_BUFFER_BYTES     (64 * 1024)   // One write() each (PSRAM, cache line aligned)
+#define SDWRITER_QUEUE_LEN        8             // Buffers waiting for the card, all uploads
+#define SDWRITER_TASK_STACK       4096
+#define SDWRITER_TASK_PRIORITY    2             // Above the HTTP workers, the card is the bottleneck
+#define SDWRITER_RATE_WINDOW      8             // Uploads in the rolling average
+#define SDWRITER_MOUNT            "/sdcard"     // SD_MMC mount point, for POSIX file access
+
+struct SdWriterResult {
+    uint64_t bytes;
+    uint32_t ms;                // Open to close
+    float    mbps;              // bytes / ms, end to end
+    float    sd_mbps;           // bytes / time spent in write()
+};
+
+struct SdWriterStats {
+    uint32_t uploads;
+    uint32_t failures;
+    uint32_t active;
+    uint64_t bytes;
+    uint32_t stalls;            // Receiver waited for a free buffer (card slower than network)
+    uint32_t preallocated;      // Files preallocated from the expected size
+    float    last_mbps;
+    float    avg_mbps;          // Over the last SDWRITER_RATE_WINDOW uploads
+    float    sd_mbps;           // Card write rate over the same uploads
+};
+
+struct SdUpload;
+
+void SdWriter_Init();
+
+// Creates or truncates 'path' (SD_MMC path). 'expectedBytes' > 0 preallocates that much.
+// nullptr if the file cannot be created or there is no memory for the buffers.
+SdUpload* SdWriter_Open(const char* path, uint64_t expectedBytes = 0);
+// Copies 'data'; blocks while all buffers are queued. False after any write error.
+bool SdWriter_Write(SdUpload* up, const void* data, size_t len);
+// Flushes, waits for the card, trims and closes; frees 'up'. True if every byte was written.
+bool SdWriter_Close(SdUpload* up, SdWriterResult* out = nullptr);
+
+void SdWriter_GetStats(SdWriterStats* out);
+void SdWriter_PrintStats();
+
+#endif
@@ -0,0 +1,191 @@
+// Settings.cpp - NVS backed settings with RAM shadow and debounced commits
+#include "Settings.h"
+#include <Preferences.h>
+#include <EEPROM.h>
+
+// Legacy EEPROM layout (schema 0), only read during migration.
+// The password area overlapped the end of the 128-byte region.
+#define LEGACY_EEPROM_SIZE       128
+#define LEGACY_VOLUME_ADDR       0
+#define LEGACY_WIFI_SSID_ADDR    4
+#define LEGACY_WIFI_PASS_ADDR    68
+
+enum {
+    DIRTY_VOLUME    = 1 << 0,
+    DIRTY_WIFI_SSID = 1 << 1,
+    DIRTY_WIFI_PASS = 1 << 2,
+};
+
+struct SettingsData {
+    uint8_t volume;
+    char wifi_ssid[SETTINGS_SSID_MAX + 1];
+    char wifi_pass[SETTINGS_PASS_MAX + 1];
+};
+
+static SettingsData shadow;
+static uint32_t dirtyMask = 0;
+static uint32_t firstDirtyMs = 0;
+static uint32_t flashWrites = 0;
+static uint32_t coalescedWrites = 0;
+
+static Preferences prefs;
+static SemaphoreHandle_t settingsMutex = nullptr;   // Shadow and dirty mask
+static SemaphoreHandle_t commitMutex = nullptr;     // One commit at a time: NVS handle, write order, counters
+static TimerHandle_t commitTimer = nullptr;
+
+static void readLegacyString(int addr, int maxLen, char* out, size_t outSize) {
+    size_t n = 0;
+    for (int i = 0; i < maxLen && addr + i < LEGACY_EEPROM_SIZE && n < outSize - 1; ++i) {
+        char c = EEPROM.read(addr + i);
+        if (c == '\0') break;
+        if (c < 0x20 || c > 0x7E) { n = 0; break; }   // Uninitialized flash, not a string
+        out[n++] = c;
+    }
+    out[n] = '\0';
+}
+
+// Bring the NVS content up to SETTINGS_SCHEMA_VERSION
+static void migrate(uint8_t from) {
+    Serial.printf("[Settings] Migrating schema %u -> %u\n", from, SETTINGS_SCHEMA_VERSION);
+
+    switch (from) {
+        case 0: {
+            // Legacy EEPROM emulation
+            EEPROM.begin(LEGACY_EEPROM_SIZE);
+            uint8_t vol = EEPROM.read(LEGACY_VOLUME_ADDR);
+            char ssid[SETTINGS_SSID_MAX + 1];
+            char pass[SETTINGS_PASS_MAX + 1];
+            readLegacyString(LEGACY_WIFI_SSID_ADDR, LEGACY_WIFI_PASS_ADDR - LEGACY_WIFI_SSID_ADDR, ssid, sizeof(ssid));
+            readLegacyString(LEGACY_WIFI_PASS_ADDR, LEGACY_EEPROM_SIZE - LEGACY_WIFI_PASS_ADDR, pass, sizeof(pass));
+            EEPROM.end();
+
+            if (vol <= 21) prefs.putUChar("volume", vol);
+            if (ssid[0]) prefs.putString("wifi_ssid", ssid);
+            if (pass[0]) prefs.putString("wifi_pass", pass);
+            Serial.printf("[Settings] Imported legacy EEPROM: volume=%u ssid=%s\n", vol, ssid);
+        }
+        // fall through for future versions
+        default:
+            break;
+    }
+
+    prefs.putUChar("schema", SETTINGS_SCHEMA_VERSION);
+}
+
+// Write dirty fields to NVS. Runs in the timer service task or the caller of Settings_Flush(),
+// possibly both at once; commitMutex keeps them apart and the newer snapshot written last.
+static void commitDirty() {
+    xSemaphoreTake(commitMutex, portMAX_DELAY);
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    uint32_t mask = dirtyMask;
+    SettingsData snapshot = shadow;
+    dirtyMask = 0;
+    firstDirtyMs = 0;
+    xSemaphoreGive(settingsMutex);
+
+    if (!mask) {
+        xSemaphoreGive(commitMutex);
+        return;
+    }
+
+    if (mask & DIRTY_VOLUME)    { prefs.putUChar("volume", snapshot.volume);       flashWrites++; }
+    if (mask & DIRTY_WIFI_SSID) { prefs.putString("wifi_ssid", snapshot.wifi_ssid); flashWrites++; }
+    if (mask & DIRTY_WIFI_PASS) { prefs.putString("wifi_pass", snapshot.wifi_pass); flashWrites++; }
+
+    Serial.printf("[Settings] Committed (mask 0x%02x), flash writes: %u, coalesced: %u\n",
+                  mask, flashWrites, coalescedWrites);
+    xSemaphoreGive(commitMutex);
+}
+
+static void commitTimerCallback(TimerHandle_t) {
+    commitDirty();
+}
+
+// Mark fields dirty and (re)arm the commit timer (caller holds settingsMutex)
+static void markDirty(uint32_t mask) {
+    if (dirtyMask & mask) coalescedWrites++;
+    dirtyMask |= mask;
+
+    uint32_t now = millis();
+    if (!firstDirtyMs) firstDirtyMs = now;
+
+    // Keep pushing the commit out while changes arrive, but not forever
+    if (now - firstDirtyMs < SETTINGS_COMMIT_MAX_MS || !xTimerIsTimerActive(commitTimer)) {
+        xTimerReset(commitTimer, 0);
+    }
+}
+
+void Settings_Init() {
+    settingsMutex = xSemaphoreCreateMutex();
+    commitMutex = xSemaphoreCreateMutex();
+    commitTimer = xTimerCreate("SettingsCommit", pdMS_TO_TICKS(SETTINGS_COMMIT_DELAY_MS), pdFALSE, nullptr, commitTimerCallback);
+
+    prefs.begin(SETTINGS_NAMESPACE, false);
+    uint8_t schema = prefs.getUChar("schema", 0);
+    if (schema < SETTINGS_SCHEMA_VERSION) migrate(schema);
+
+    shadow.volume = prefs.getUChar("volume", SETTINGS_DEFAULT_VOLUME);
+    if (shadow.volume > 21) shadow.volume = SETTINGS_DEFAULT_VOLUME;
+    strlcpy(shadow.wifi_ssid, prefs.getString("wifi_ssid", "").c_str(), sizeof(shadow.wifi_ssid));
+    strlcpy(shadow.wifi_pass, prefs.getString("wifi_pass", "").c_str(), sizeof(shadow.wifi_pass));
+
+    Serial.printf("[Settings] Loaded schema %u: volume=%u ssid=%s\n", SETTINGS_SCHEMA_VERSION, shadow.volume, shadow.wifi_ssid);
+}
+
+void Settings_Flush() {
+    if (commitTimer) xTimerStop(commitTimer, 0);
+    commitDirty();
+}
+
+uint8_t Settings_GetVolume() {
+    return shadow.volume;
+}
+
+void Settings_SetVolume(uint8_t vol) {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    if (shadow.volume != vol) {
+        shadow.volume = vol;
+        markDirty(DIRTY_VOLUME);
+    }
+    xSemaphoreGive(settingsMutex);
+}
+
+String Settings_GetWifiSSID() {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    String ssid(shadow.wifi_ssid);
+    xSemaphoreGive(settingsMutex);
+    return ssid;
+}
+
+void Settings_SetWifiSSID(const String& ssid) {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    if (strcmp(shadow.wifi_ssid, ssid.c_str()) != 0) {
+        strlcpy(shadow.wifi_ssid, ssid.c_str(), sizeof(shadow.wifi_ssid));
+        markDirty(DIRTY_WIFI_SSID);
+    }
+    xSemaphoreGive(settingsMutex);
+}
+
+String Settings_GetWifiPassword() {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    String pass(shadow.wifi_pass);
+    xSemaphoreGive(settingsMutex);
+    return pass;
+}
+
+void Settings_SetWifiPassword(const String& pass) {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    if (strcmp(shadow.wifi_pass, pass.c_str()) != 0) {
+        strlcpy(shadow.wifi_pass, pass.c_str(), sizeof(shadow.wifi_pass));
+        markDirty(DIRTY_WIFI_PASS);
+    }
+    xSemaphoreGive(settingsMutex);
+}
+
+uint32_t Settings_GetFlashWrites() {
+    return flashWrites;
+}
+
+uint32_t Settings_GetCoalescedWrites() {
+    return coalescedWrites;
+}
@@ -0,0 +1,42 @@
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include <Arduino.h>
+
+/*
+  Persistent settings on NVS (wear-leveled by the NVS layer)
+
+  All reads come from an in-RAM shadow. Setters only mark a field dirty and
+  (re)arm a deferred commit timer, so a burst of changes (e.g. dragging the
+  volume slider) ends up as a single flash write per changed field.
+  A commit is forced after SETTINGS_COMMIT_MAX_MS even if changes keep coming.
+
+  Schema version is stored in NVS; older layouts are migrated on boot
+  (version 0 = legacy 128-byte EEPROM emulation).
+*/
+
+#define SETTINGS_NAMESPACE        "settings"
+#define SETTINGS_SCHEMA_VERSION   1
+#define SETTINGS_COMMIT_DELAY_MS  2000     // Quiet time before committing
+#define SETTINGS_COMMIT_MAX_MS    10000    // Upper bound on commit delay
+
+#define SETTINGS_DEFAULT_VOLUME   10
+#define SETTINGS_SSID_MAX         32
+#define SETTINGS_PASS_MAX         64
+
+void Settings_Init();
+void Settings_Flush();              // Commit dirty fields now
+
+uint8_t Settings_GetVolume();
+void Settings_SetVolume(uint8_t vol);
+
+String Settings_GetWifiSSID();
+void Settings_SetWifiSSID(const String& ssid);
+
+String Settings_GetWifiPassword();
+void Settings_SetWifiPassword(const String& pass);
+
+uint32_t Settings_GetFlashWrites();    // NVS writes since boot
+uint32_t Settings_GetCoalescedWrites(); // Setter calls absorbed by the shadow
+
+#endif
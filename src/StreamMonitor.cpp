@@ -0,0 +1,344 @@
+// StreamMonitor.cpp - Adaptive rebuffering, fallback URLs and per-station health stats
+#include "StreamMonitor.h"
+#include "Metrics.h"
+#include "EventStream.h"
+#include <SD_MMC.h>
+#include <ArduinoJson.h>
+
+struct StationInfo {
+    String name;
+    String url;
+    String fallback;
+};
+
+typedef enum {
+    MON_IDLE = 0,       // Not a monitored stream
+    MON_STARTING,       // Connected, waiting for the decoder to start
+    MON_PLAYING,
+    MON_REBUFFERING     // Output muted by us until the target fill is reached
+} MonitorState;
+
+static Audio* audio_ptr = nullptr;
+static SemaphoreHandle_t monMutex = nullptr;
+static Metric* mUnderruns = nullptr;
+
+static std::vector<StationInfo> catalogue;
+static std::vector<StationStats> stations;
+static int current = -1;
+static volatile MonitorState state = MON_IDLE;
+static TaskHandle_t fallbackTask = nullptr;
+static String pendingFallback;      // Set by the tick, connected by fallbackTask (guarded by monMutex)
+
+// Tracking for the current stream
+static uint32_t lastTickMs = 0;
+static uint32_t lastFill = 0;
+static uint32_t playMsAcc = 0;
+static uint32_t starveSinceMs = 0;
+static uint32_t rebufferStartMs = 0;
+static float drainMs = 0.0f;
+static float jitterMs = 0.0f;
+static float throughputBps = 0.0f;
+
+static const char* stateName(MonitorState s) {
+    switch (s) {
+        case MON_STARTING:    return "starting";
+        case MON_PLAYING:     return "playing";
+        case MON_REBUFFERING: return "rebuffering";
+        default:              return "idle";
+    }
+}
+
+void StreamMonitor_LoadStations(const char* path) {
+    File file = SD_MMC.open(path, FILE_READ);
+    if (!file || file.isDirectory()) return;
+
+    std::vector<StationInfo> list;
+    while (file.available()) {
+        String line = file.readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty()) continue;
+
+        int sep = line.indexOf('|');
+        if (sep <= 0 || sep >= line.length() - 1) continue;
+        int sep2 = line.indexOf('|', sep + 1);
+
+        StationInfo s;
+        s.name = line.substring(0, sep);
+        s.url = sep2 > 0 ? line.substring(sep + 1, sep2) : line.substring(sep + 1);
+        s.fallback = sep2 > 0 ? line.substring(sep2 + 1) : "";
+        list.push_back(s);
+    }
+    file.close();
+
+    xSemaphoreTake(monMutex, portMAX_DELAY);
+    catalogue = list;
+    xSemaphoreGive(monMutex);
+}
+
+// Find or create the stats slot for a station (caller holds monMutex)
+static int stationIndex(const StationInfo& info) {
+    for (size_t i = 0; i < stations.size(); ++i) {
+        if (stations[i].url == info.url) return (int)i;
+    }
+    if (stations.size() >= STREAM_MON_MAX_STATIONS) {
+        // Reuse the slot with the least play time
+        size_t victim = 0;
+        for (size_t i = 1; i < stations.size(); ++i) {
+            if ((int)i != current && stations[i].play_seconds < stations[victim].play_seconds) victim = i;
+        }
+        stations.erase(stations.begin() + victim);
+        if (current > (int)victim) current--;
+    }
+    StationStats s = {};
+    s.name = info.name;
+    s.url = info.url;
+    s.fallback_url = info.fallback;
+    stations.push_back(s);
+    return (int)stations.size() - 1;
+}
+
+static void resetTracking() {
+    lastTickMs = millis();
+    lastFill = 0;
+    starveSinceMs = 0;
+    drainMs = 0.0f;
+    jitterMs = 0.0f;
+    throughputBps = 0.0f;
+}
+
+// The tick runs in the shared esp_timer task, which must not wait for DNS / TCP / TLS
+static void FallbackTask(void*) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        xSemaphoreTake(monMutex, portMAX_DELAY);
+        String url = pendingFallback;
+        pendingFallback = "";
+        xSemaphoreGive(monMutex);
+        if (url.isEmpty()) continue;       // Stopped or switched in the meantime
+
+        Serial.printf("[StreamMon] Throughput below bitrate, switching to fallback %s\n", url.c_str());
+        audio_ptr->connecttohost(url.c_str());
+    }
+}
+
+void StreamMonitor_Init(Audio& audio) {
+    audio_ptr = &audio;
+    mUnderruns = Metrics_Counter("audio_underruns_total", "Audio buffer underruns", "source=\"stream\"");
+    monMutex = xSemaphoreCreateMutex();
+    xTaskCreatePinnedToCore(FallbackTask, "StreamFallback", STREAM_MON_TASK_STACK, nullptr, 2, &fallbackTask, 0);
+    StreamMonitor_LoadStations();
+    Serial.printf("[StreamMon] %u stations loaded\n", catalogue.size());
+}
+
+bool StreamMonitor_Connect(const char* url) {
+    if (!audio_ptr || !url) return false;
+    StreamMonitor_LoadStations();
+
+    xSemaphoreTake(monMutex, portMAX_DELAY);
+    StationInfo info;
+    info.url = url;
+    info.name = url;
+    bool onFallback = false;
+    for (const StationInfo& s : catalogue) {
+        if (s.url == url || (!s.fallback.isEmpty() && s.fallback == url)) {
+            info = s;
+            onFallback = (s.url != url);
+            break;
+        }
+    }
+
+    int idx = stationIndex(info);
+    if (idx == current && state != MON_IDLE) stations[idx].reconnects++;
+    current = idx;
+    stations[idx].on_fallback = onFallback;
+    state = MON_STARTING;
+    resetTracking();
+    pendingFallback = "";
+    xSemaphoreGive(monMutex);
+
+    // The new station sends its own name and title
+    EventStream_SetStation(nullptr);
+    EventStream_SetTitle(nullptr);
+
+    return audio_ptr->connecttohost(url);
+}
+
+void StreamMonitor_Stop() {
+    if (!monMutex) return;
+    xSemaphoreTake(monMutex, portMAX_DELAY);
+    state = MON_IDLE;
+    current = -1;
+    pendingFallback = "";
+    xSemaphoreGive(monMutex);
+
+    // Stopped or switching to a file: the station's name and title no longer apply
+    EventStream_SetStation(nullptr);
+    EventStream_SetTitle(nullptr);
+}
+
+void StreamMonitor_OnAudioInfo(const char* msg) {
+    if (!msg || current < 0 || !strstr(msg, "reconnect")) return;
+    if (xSemaphoreTake(monMutex, 0) != pdTRUE) return;
+    if (current >= 0) stations[current].reconnects++;
+    xSemaphoreGive(monMutex);
+}
+
+void StreamMonitor_Tick() {
+    if (!audio_ptr || state == MON_IDLE) return;
+
+    const uint32_t now = millis();
+    const uint32_t dt = now - lastTickMs;
+    if (dt < STREAM_MON_PERIOD_MS) return;
+    if (xSemaphoreTake(monMutex, 0) != pdTRUE) return;  // never stall the audio tick
+    lastTickMs = now;
+
+    if (current < 0) {
+        xSemaphoreGive(monMutex);
+        return;
+    }
+    StationStats& st = stations[current];
+
+    const uint32_t size = audio_ptr->getInBufferSize();
+    const uint32_t fill = audio_ptr->inBufferFilled();
+    const uint32_t bitrate = audio_ptr->getBitRate();
+    st.bitrate_bps = bitrate;
+
+    if (state == MON_STARTING && audio_ptr->isRunning()) state = MON_PLAYING;
+    if (bitrate == 0 || size == 0) {
+        // Bitrate not known yet, nothing to measure against
+        lastFill = fill;
+        xSemaphoreGive(monMutex);
+        return;
+    }
+
+    const float bytesPerMs = bitrate / 8000.0f;
+    const bool playing = (state == MON_PLAYING);
+
+    // Arrival = fill delta + what the decoder consumed meanwhile (it keeps decoding while muted)
+    const float consumed = (playing || state == MON_REBUFFERING) ? bytesPerMs * dt : 0.0f;
+    float arrived = (float)fill - (float)lastFill + consumed;
+    if (arrived < 0.0f) arrived = 0.0f;
+    lastFill = fill;
+
+    const float bps = arrived * 8.0f * 1000.0f / dt;
+    throughputBps = (throughputBps == 0.0f) ? bps : 0.9f * throughputBps + 0.1f * bps;
+
+    // Jitter: depth of the buffer drain caused by arrival gaps.
+    // Follows new peaks quickly, decays slowly (half-life ~14 s).
+    drainMs += (consumed - arrived) / bytesPerMs;
+    if (drainMs < 0.0f) drainMs = 0.0f;
+    if (drainMs > jitterMs) jitterMs += 0.5f * (drainMs - jitterMs);
+    else jitterMs *= 0.995f;
+
+    const uint32_t fillMs = (uint32_t)(fill / bytesPerMs);
+    const uint32_t capacityMs = (uint32_t)(size / bytesPerMs);
+    uint32_t targetMs = STREAM_MON_MIN_TARGET_MS + (uint32_t)(2.0f * jitterMs);
+    if (targetMs > capacityMs * 9 / 10) targetMs = capacityMs * 9 / 10;
+
+    st.fill_ms = fillMs;
+    st.fill_percent = fill * 100 / size;
+    st.target_ms = targetMs;
+    st.jitter_ms = (uint32_t)jitterMs;
+    st.throughput_bps = (uint32_t)throughputBps;
+
+    if (playing) {
+        playMsAcc += dt;
+        st.play_seconds += playMsAcc / 1000;
+        playMsAcc %= 1000;
+    }
+    st.underruns_per_hour = st.play_seconds ? st.underruns * 3600.0f / st.play_seconds : 0.0f;
+
+    bool switchToFallback = false;
+    if (state == MON_PLAYING) {
+        if (fillMs < STREAM_MON_LOW_WATER_MS) {
+            st.underruns++;
+            Metrics_Add(mUnderruns);
+            state = MON_REBUFFERING;
+            rebufferStartMs = now;
+            Serial.printf("[StreamMon] Underrun on %s (fill %u ms), rebuffering to %u ms\n",
+                          st.name.c_str(), fillMs, targetMs);
+        } else if (throughputBps < bitrate * 0.9f && fillMs < targetMs) {
+            // Network slower than the stream and the buffer is draining
+            if (!starveSinceMs) starveSinceMs = now;
+            if (now - starveSinceMs > STREAM_MON_FALLBACK_MS && !st.on_fallback && !st.fallback_url.isEmpty()) {
+                switchToFallback = true;
+            }
+        } else {
+            starveSinceMs = 0;
+        }
+    } else if (state == MON_REBUFFERING) {
+        st.rebuffer_ms += dt;
+        if (fillMs >= targetMs || now - rebufferStartMs > STREAM_MON_REBUFFER_MAX_MS) {
+            state = MON_PLAYING;
+            starveSinceMs = 0;
+            Serial.printf("[StreamMon] Resumed %s after %lu ms (fill %u ms)\n",
+                          st.name.c_str(), now - rebufferStartMs, fillMs);
+        }
+    }
+
+    if (switchToFallback) {
+        st.fallbacks++;
+        st.on_fallback = true;
+        pendingFallback = st.fallback_url;
+        state = MON_STARTING;
+        resetTracking();
+    }
+    xSemaphoreGive(monMutex);
+
+    // The connect blocks, so it runs on FallbackTask
+    if (switchToFallback && fallbackTask) xTaskNotifyGive(fallbackTask);
+}
+
+bool StreamMonitor_IsHolding() {
+    return state == MON_REBUFFERING;
+}
+
+std::vector<StationStats> StreamMonitor_GetStats() {
+    std::vector<StationStats> copy;
+    if (!monMutex) return copy;
+    xSemaphoreTake(monMutex, portMAX_DELAY);
+    copy = stations;
+    xSemaphoreGive(monMutex);
+    return copy;
+}
+
+String StreamMonitor_ToJson() {
+    std::vector<StationStats> list = StreamMonitor_GetStats();
+
+    DynamicJsonDocument doc(1024 + list.size() * 512);
+    doc["state"] = stateName(state);
+    doc["current"] = current >= 0 && current < (int)list.size() ? list[current].url : "";
+    JsonArray arr = doc.createNestedArray("stations");
+    for (const StationStats& s : list) {
+        JsonObject o = arr.createNestedObject();
+        o["name"] = s.name;
+        o["url"] = s.url;
+        o["fallback"] = s.fallback_url;
+        o["on_fallback"] = s.on_fallback;
+        o["fill_ms"] = s.fill_ms;
+        o["fill_percent"] = s.fill_percent;
+        o["target_ms"] = s.target_ms;
+        o["jitter_ms"] = s.jitter_ms;
+        o["throughput_bps"] = s.throughput_bps;
+        o["bitrate_bps"] = s.bitrate_bps;
+        o["underruns"] = s.underruns;
+        o["underruns_per_hour"] = s.underruns_per_hour;
+        o["rebuffer_ms"] = s.rebuffer_ms;
+        o["reconnects"] = s.reconnects;
+        o["fallbacks"] = s.fallbacks;
+        o["play_seconds"] = s.play_seconds;
+    }
+    String out;
+    serializeJson(doc, out);
+    return out;
+}
+
+void StreamMonitor_PrintStats() {
+    std::vector<StationStats> list = StreamMonitor_GetStats();
+    for (const StationStats& s : list) {
+        Serial.printf("[StreamMon] %s: fill=%ums (%u%%) target=%ums jitter=%ums tput=%ukbps/%ukbps underruns=%u (%.2f/h) reconnects=%u fallbacks=%u\n",
+                      s.name.c_str(), s.fill_ms, s.fill_percent, s.target_ms, s.jitter_ms,
+                      s.throughput_bps / 1000, s.bitrate_bps / 1000, s.underruns, s.underruns_per_hour,
+                      s.reconnects, s.fallbacks);
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef STREAM_MONITOR_H
+#define STREAM_MONITOR_H
+
+#include <Arduino.h>
+#include <vector>
+#include "Audio.h"
+
+/*
+  Adaptive jitter buffer and health statistics for network radio streams
+
+  Every STREAM_MON_PERIOD_MS the decoder input buffer is sampled from the audio
+  tick. Arrival is estimated as (fill delta + bytes consumed at the stream
+  bitrate); the size of the drains caused by arrival gaps gives the jitter,
+  and the target fill adapts to it. Falling below the low watermark mutes
+  the output until the target fill is reached again (rebuffer). The decoder
+  is not paused, since a paused Audio::loop() stops reading the socket too:
+  it keeps reading and decoding while audio_process_i2s() writes silence,
+  so the buffer refills by whatever arrives above the bitrate and the
+  server never sees an idle connection.
+
+  If a station has an alternate URL ("name|url|fallback_url" in
+  /internet_stations.txt) and arrival stays below the bitrate while the
+  buffer drains, playback switches to the fallback before it underruns. The
+  switch is connected from a task of its own, never from the timer task.
+*/
+
+#define STREAM_MON_PERIOD_MS        100
+#define STREAM_MON_MIN_TARGET_MS    1000    // Target fill never below this
+#define STREAM_MON_LOW_WATER_MS     150     // Rebuffer below this
+#define STREAM_MON_REBUFFER_MAX_MS  10000   // Give up waiting and resume anyway
+#define STREAM_MON_FALLBACK_MS      5000    // Sustained starvation before switching to fallback
+#define STREAM_MON_MAX_STATIONS     16
+#define STREAM_MON_TASK_STACK       8192    // Fallback connect (DNS, TCP, TLS)
+
+struct StationStats {
+    String name;
+    String url;
+    String fallback_url;
+    bool     on_fallback;
+    uint32_t fill_ms;           // Current buffer fill (at stream bitrate)
+    uint32_t fill_percent;
+    uint32_t target_ms;         // Adaptive target fill
+    uint32_t jitter_ms;         // Smoothed arrival jitter
+    uint32_t throughput_bps;    // Measured network throughput (bits/s)
+    uint32_t bitrate_bps;       // Stream bitrate
+    uint32_t underruns;
+    uint32_t rebuffer_ms;       // Total time spent rebuffering
+    uint32_t reconnects;
+    uint32_t fallbacks;
+    uint32_t play_seconds;
+    float    underruns_per_hour;
+};
+
+void StreamMonitor_Init(Audio& audio);
+bool StreamMonitor_Connect(const char* url);    // Use instead of connecttohost() for radio streams
+void StreamMonitor_Stop();                      // Playback stopped by user or switched to a file; clears now-playing
+void StreamMonitor_Tick();                      // Called from the audio tick
+bool StreamMonitor_IsHolding();                 // Rebuffering: music output is muted
+void StreamMonitor_OnAudioInfo(const char* msg);
+void StreamMonitor_LoadStations(const char* path = "/internet_stations.txt");
+
+std::vector<StationStats> StreamMonitor_GetStats();
+String StreamMonitor_ToJson();
+void StreamMonitor_PrintStats();
+
+#endif
@@ -0,0 +1,295 @@
+// TTSCache.cpp - SD card cache for synthesized speech, keyed by hash(text, lang, voice)
+#include "TTSCache.h"
+#include <vector>
+#include <SD_MMC.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include "mbedtls/sha256.h"
+#include "AudioMixer.h"
+#include "DirCache.h"
+
+struct CacheEntry {
+    char key[17];       // 64-bit hash as hex
+    uint32_t size;
+    uint32_t lastUsed;  // LRU sequence number
+};
+
+struct FetchRequest {
+    char key[17];
+    char* text;
+    char lang[8];
+    uint32_t speakSeq;  // Played once fetched if no newer request came in
+};
+
+static std::vector<CacheEntry> entries;
+static SemaphoreHandle_t cacheMutex = nullptr;
+static QueueHandle_t fetchQueue = nullptr;
+static uint32_t useSeq = 0;
+static uint32_t speakSeq = 0;       // Bumped by every TTSCache_Speak() (guarded by cacheMutex)
+static bool indexDirty = false;     // Hit order changed since the index was written
+static char activeKey[17] = "";     // Last entry handed to the player, never evicted
+static TTSCacheStats stats = {};
+
+static void makeKey(const char* text, const char* lang, char out[17]) {
+    uint8_t digest[32];
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, (const uint8_t*)text, strlen(text) + 1);  // include '\0' as separator
+    mbedtls_sha256_update(&ctx, (const uint8_t*)lang, strlen(lang) + 1);
+    mbedtls_sha256_update(&ctx, (const uint8_t*)TTS_VOICE, strlen(TTS_VOICE));
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_free(&ctx);
+
+    for (int i = 0; i < 8; ++i) snprintf(out + 2 * i, 3, "%02x", digest[i]);
+}
+
+static String entryPath(const char* key) {
+    return String(TTS_CACHE_DIR) + "/" + key + ".mp3";
+}
+
+static String urlEncode(const char* s) {
+    static const char* hex = "0123456789ABCDEF";
+    String out;
+    out.reserve(strlen(s) * 3);
+    for (const uint8_t* p = (const uint8_t*)s; *p; ++p) {
+        if (isalnum(*p) || *p == '-' || *p == '_' || *p == '.' || *p == '~') {
+            out += (char)*p;
+        } else {
+            out += '%';
+            out += hex[*p >> 4];
+            out += hex[*p & 0x0F];
+        }
+    }
+    return out;
+}
+
+// Index file: one "key|size|lastUsed" line per entry
+static void saveIndex() {
+    File f = SD_MMC.open(TTS_CACHE_INDEX, FILE_WRITE);
+    if (!f) {
+        Serial.println("[TTSCache] Failed to write index");
+        return;
+    }
+    for (const CacheEntry& e : entries) {
+        f.printf("%s|%u|%u\n", e.key, e.size, e.lastUsed);
+    }
+    f.close();
+    DirCache_Invalidate(TTS_CACHE_INDEX);
+    indexDirty = false;
+}
+
+static int findEntry(const char* key) {
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (strcmp(entries[i].key, key) == 0) return (int)i;
+    }
+    return -1;
+}
+
+static void recountSize() {
+    uint64_t total = 0;
+    for (const CacheEntry& e : entries) total += e.size;
+    stats.bytes_cached = total;
+    stats.entries = entries.size();
+}
+
+// Drop least recently used entries until the cache fits (caller holds cacheMutex).
+// The entry that may be playing is skipped, so the cache can overshoot by that one file.
+static void evictToFit(uint64_t incoming) {
+    while (stats.bytes_cached + incoming > TTS_CACHE_MAX_BYTES) {
+        int lru = -1;
+        for (size_t i = 0; i < entries.size(); ++i) {
+            if (strcmp(entries[i].key, activeKey) == 0) continue;
+            if (lru < 0 || entries[i].lastUsed < entries[lru].lastUsed) lru = (int)i;
+        }
+        if (lru < 0) break;
+        SD_MMC.remove(entryPath(entries[lru].key).c_str());
+        Serial.printf("[TTSCache] Evicted %s (%u bytes)\n", entries[lru].key, entries[lru].size);
+        entries.erase(entries.begin() + lru);
+        stats.evictions++;
+        indexDirty = true;
+        recountSize();
+    }
+}
+
+static bool fetchToFile(const FetchRequest& req) {
+    String url = "https://translate.google.com/translate_tts?ie=UTF-8&client=tw-ob&tl=" +
+                 String(req.lang) + "&q=" + urlEncode(req.text);
+
+    WiFiClientSecure net;
+    net.setInsecure();
+    HTTPClient http;
+    if (!http.begin(net, url)) return false;
+    http.setUserAgent("Mozilla/5.0");
+
+    int code = http.GET();
+    if (code != HTTP_CODE_OK) {
+        Serial.printf("[TTSCache] Fetch failed, HTTP %d\n", code);
+        http.end();
+        return false;
+    }
+
+    String tmpPath = String(TTS_CACHE_DIR) + "/" + req.key + ".tmp";
+    File f = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!f) {
+        http.end();
+        return false;
+    }
+
+    int written = http.writeToStream(&f);
+    f.close();
+    http.end();
+
+    if (written <= 0) {
+        SD_MMC.remove(tmpPath.c_str());
+        DirCache_Invalidate(tmpPath.c_str());
+        return false;
+    }
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    evictToFit(written);
+    String finalPath = entryPath(req.key);
+    SD_MMC.remove(finalPath.c_str());
+    bool ok = SD_MMC.rename(tmpPath.c_str(), finalPath.c_str());
+    DirCache_Invalidate(finalPath.c_str());     // Also covers the .tmp and evicted entries, same directory
+    if (ok && findEntry(req.key) < 0) {
+        CacheEntry e;
+        strlcpy(e.key, req.key, sizeof(e.key));
+        e.size = written;
+        e.lastUsed = ++useSeq;
+        entries.push_back(e);
+        recountSize();
+        saveIndex();
+    }
+    xSemaphoreGive(cacheMutex);
+
+    Serial.printf("[TTSCache] Cached %s (%d bytes)\n", req.key, written);
+    return ok;
+}
+
+// Plays a fetched miss unless a newer request has taken over the voice
+static void playFetched(const FetchRequest& req, bool fetched) {
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    const bool current = (req.speakSeq == speakSeq);
+    if (current && fetched) strlcpy(activeKey, req.key, sizeof(activeKey));
+    xSemaphoreGive(cacheMutex);
+    if (!current) return;
+
+    if (fetched && AudioMixer_PlayVoiceFile(SD_MMC, entryPath(req.key).c_str())) return;
+    Serial.println("[TTSCache] Fetch failed, streaming from the network");
+    AudioMixer_Speak(req.text, req.lang);
+}
+
+static void TTSCacheFetchTask(void*) {
+    FetchRequest req;
+    while (true) {
+        // Hits only reorder entries in RAM; the index is written once things are quiet
+        if (xQueueReceive(fetchQueue, &req, pdMS_TO_TICKS(TTS_CACHE_FLUSH_MS)) != pdTRUE) {
+            xSemaphoreTake(cacheMutex, portMAX_DELAY);
+            if (indexDirty) saveIndex();
+            xSemaphoreGive(cacheMutex);
+            continue;
+        }
+        const bool fetched = fetchToFile(req);
+        if (!fetched) stats.fetch_failures++;
+        playFetched(req, fetched);
+        free(req.text);
+    }
+}
+
+void TTSCache_Init() {
+    cacheMutex = xSemaphoreCreateMutex();
+    fetchQueue = xQueueCreate(4, sizeof(FetchRequest));
+
+    if (!SD_MMC.exists(TTS_CACHE_DIR)) {
+        SD_MMC.mkdir(TTS_CACHE_DIR);
+        DirCache_Invalidate(TTS_CACHE_DIR);
+    }
+
+    entries.clear();
+    File f = SD_MMC.open(TTS_CACHE_INDEX, FILE_READ);
+    if (f) {
+        while (f.available()) {
+            String line = f.readStringUntil('\n');
+            line.trim();
+            int a = line.indexOf('|');
+            int b = line.indexOf('|', a + 1);
+            if (a != 16 || b < 0) continue;
+
+            CacheEntry e;
+            strlcpy(e.key, line.substring(0, a).c_str(), sizeof(e.key));
+            e.size = line.substring(a + 1, b).toInt();
+            e.lastUsed = line.substring(b + 1).toInt();
+
+            // Skip entries whose file went missing
+            if (!SD_MMC.exists(entryPath(e.key).c_str())) continue;
+            entries.push_back(e);
+            if (e.lastUsed > useSeq) useSeq = e.lastUsed;
+        }
+        f.close();
+    }
+    recountSize();
+
+    xTaskCreatePinnedToCore(TTSCacheFetchTask, "TTSCacheFetch", 8192, NULL, 1, NULL, 0);
+    Serial.printf("[TTSCache] %u entries, %llu bytes\n", stats.entries, stats.bytes_cached);
+}
+
+bool TTSCache_Speak(const char* text, const char* lang) {
+    if (!text || !*text) return false;
+    if (!lang || !*lang) lang = "en";
+
+    if (!cacheMutex || strlen(text) > TTS_CACHE_MAX_TEXT || strlen(lang) >= sizeof(FetchRequest::lang)) {
+        stats.bypassed++;
+        return AudioMixer_Speak(text, lang);
+    }
+
+    char key[17];
+    makeKey(text, lang, key);
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    const uint32_t seq = ++speakSeq;
+    int idx = findEntry(key);
+    if (idx >= 0) {
+        entries[idx].lastUsed = ++useSeq;
+        stats.hits++;
+        stats.bytes_saved += entries[idx].size;
+        indexDirty = true;
+        strlcpy(activeKey, key, sizeof(activeKey));
+    } else {
+        activeKey[0] = '\0';           // The fetched file replaces whatever played
+    }
+    xSemaphoreGive(cacheMutex);
+
+    if (idx >= 0) {
+        Serial.printf("[TTSCache] Hit %s\n", key);
+        if (AudioMixer_PlayVoiceFile(SD_MMC, entryPath(key).c_str())) return true;
+        Serial.println("[TTSCache] Cached file failed to play, falling back to network");
+    } else {
+        stats.misses++;
+        Serial.printf("[TTSCache] Miss %s\n", key);
+
+        // One download: the worker fetches into the cache and plays the file
+        FetchRequest req;
+        strlcpy(req.key, key, sizeof(req.key));
+        strlcpy(req.lang, lang, sizeof(req.lang));
+        req.speakSeq = seq;
+        req.text = strdup(text);
+        if (req.text && xQueueSend(fetchQueue, &req, 0) == pdTRUE) return true;
+        free(req.text);
+        Serial.println("[TTSCache] Fetch queue full, streaming uncached");
+    }
+
+    // Stream from the network as before
+    return AudioMixer_Speak(text, lang);
+}
+
+void TTSCache_GetStats(TTSCacheStats* out) {
+    if (out) *out = stats;
+}
+
+void TTSCache_PrintStats() {
+    uint32_t lookups = stats.hits + stats.misses;
+    Serial.printf("[TTSCache] hits=%u misses=%u (%.1f%% hit) bypassed=%u entries=%u size=%llu saved=%llu bytes evictions=%u fetch_failures=%u\n",
+                  stats.hits, stats.misses, lookups ? stats.hits * 100.0f / lookups : 0.0f, stats.bypassed,
+                  stats.entries, stats.bytes_cached, stats.bytes_saved, stats.evictions, stats.fetch_failures);
+}
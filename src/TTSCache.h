@@ -0,0 +1,42 @@
+#ifndef TTS_CACHE_H
+#define TTS_CACHE_H
+
+#include <Arduino.h>
+
+/*
+  Content-addressed TTS cache on SD card
+
+  Synthesized speech is stored as /tts_cache/<key>.mp3 where key is a hash of
+  (text, language, voice). An index file keeps size and LRU order; the cache is
+  trimmed to TTS_CACHE_MAX_BYTES. Hits reorder the LRU in RAM only, the index is
+  rewritten on insert or once the cache has been idle for a while. Hits play
+  straight from SD. A miss is fetched once, by a background worker into the
+  cache, and played from there when the fetch completes; only if the fetch
+  fails (or the worker queue is full) is the text streamed from the network.
+  A miss overtaken by a newer TTSCache_Speak() is cached but not played.
+*/
+
+#define TTS_CACHE_DIR        "/tts_cache"
+#define TTS_CACHE_INDEX      "/tts_cache/index.txt"
+#define TTS_CACHE_MAX_BYTES  (16UL * 1024 * 1024)
+#define TTS_CACHE_FLUSH_MS   30000     // Hit order reaches the index after this much quiet
+#define TTS_CACHE_MAX_TEXT   200       // Google TTS single-request limit, longer text bypasses the cache
+#define TTS_VOICE            "gtx-tw-ob"
+
+struct TTSCacheStats {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t bypassed;          // Too long / not cacheable
+    uint32_t fetch_failures;
+    uint32_t evictions;
+    uint32_t entries;
+    uint64_t bytes_cached;      // Current cache size on SD
+    uint64_t bytes_saved;       // Network bytes avoided by hits
+};
+
+void TTSCache_Init();
+bool TTSCache_Speak(const char* text, const char* lang);
+void TTSCache_GetStats(TTSCacheStats* out);
+void TTSCache_PrintStats();
+
+#endif
@@ -0,0 +1,301 @@
+// WebAssets.cpp - Static files from SD or flash with gzip variants, ETag/304 and a PSRAM LRU
+#include "WebAssets.h"
+#include <time.h>
+#include <SD_MMC.h>
+#include "DirCache.h"
+#include "WebBundle.h"
+#include "Metrics.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+
+struct Asset {
+    char     path[DIRCACHE_PATH_MAX];   // File on the card, ".gz" included
+    uint8_t* data;              // PSRAM, nullptr for files streamed from SD
+    uint32_t size;
+    time_t   mtime;
+    char     etag[32];
+    uint32_t generation;        // DirCache_Generation() when last checked
+    uint32_t lastUse;
+    uint32_t refs;              // Table slot + requests sending it
+};
+
+static Asset* table[WEBASSET_MAX_ENTRIES] = {};
+static SemaphoreHandle_t assetMutex = nullptr;
+static uint32_t useClock = 0;
+
+static WebAssetStats stats = {};
+static uint64_t serveUsTotal = 0;
+static Metric* mRead = nullptr;
+
+static void makeEtag(Asset* a, bool gz) {
+    snprintf(a->etag, sizeof(a->etag), "\"%lx-%lx%s\"", (unsigned long)a->size, (unsigned long)a->mtime, gz ? "-gz" : "");
+}
+
+// Caller holds assetMutex
+static void unref(Asset* a) {
+    if (--a->refs == 0) {
+        free(a->data);
+        free(a);
+    }
+}
+
+// Caller holds assetMutex
+static void dropSlot(int i) {
+    Asset* a = table[i];
+    table[i] = nullptr;
+    stats.entries--;
+    if (a->data) stats.cached_bytes -= a->size;
+    unref(a);
+}
+
+// Caller holds assetMutex
+static void makeRoom(uint32_t bytes) {
+    while (true) {
+        int lru = -1, used = 0;
+        for (int i = 0; i < WEBASSET_MAX_ENTRIES; ++i) {
+            if (!table[i]) continue;
+            used++;
+            if (lru < 0 || table[i]->lastUse < table[lru]->lastUse) lru = i;
+        }
+        if (lru < 0) return;
+        if (used < WEBASSET_MAX_ENTRIES && stats.cached_bytes + bytes <= WEBASSET_CACHE_BYTES) return;
+        dropSlot(lru);
+        stats.evictions++;
+    }
+}
+
+// Size and modification time; false if the file is gone
+static bool statFile(const char* path, uint32_t* size, time_t* mtime) {
+    File f = SD_MMC.open(path, FILE_READ);
+    if (!f || f.isDirectory()) return false;
+    *size = f.size();
+    *mtime = f.getLastWrite();
+    f.close();
+    return true;
+}
+
+// Current entry for 'path', loading or refreshing it from the card. The caller releases it.
+static Asset* acquire(const char* path, bool gz) {
+    const uint32_t gen = DirCache_Generation();
+
+    xSemaphoreTake(assetMutex, portMAX_DELAY);
+    Asset* a = nullptr;
+    int slot = -1;
+    for (int i = 0; i < WEBASSET_MAX_ENTRIES; ++i) {
+        if (table[i] && strcmp(table[i]->path, path) == 0) {
+            a = table[i];
+            slot = i;
+            break;
+        }
+    }
+    if (a && a->generation == gen) {
+        a->refs++;
+        a->lastUse = ++useClock;
+        if (a->data) stats.cache_hits++;
+        xSemaphoreGive(assetMutex);
+        return a;
+    }
+    xSemaphoreGive(assetMutex);
+
+    // Unknown, or the card was written since: stat it
+    uint32_t size;
+    time_t mtime;
+    const bool exists = statFile(path, &size, &mtime);
+
+    xSemaphoreTake(assetMutex, portMAX_DELAY);
+    stats.sd_reads++;
+    if (a) {
+        stats.revalidations++;
+        if (exists && a->size == size && a->mtime == mtime && table[slot] == a) {
+            a->generation = gen;
+            a->refs++;
+            a->lastUse = ++useClock;
+            if (a->data) stats.cache_hits++;
+            xSemaphoreGive(assetMutex);
+            return a;
+        }
+        if (table[slot] == a) dropSlot(slot);  // Changed or removed
+    }
+    xSemaphoreGive(assetMutex);
+    if (!exists) return nullptr;
+
+    // Load small files into PSRAM
+    Asset* fresh = (Asset*)calloc(1, sizeof(Asset));
+    if (!fresh) return nullptr;
+    strlcpy(fresh->path, path, sizeof(fresh->path));
+    fresh->size = size;
+    fresh->mtime = mtime;
+    fresh->generation = gen;
+    makeEtag(fresh, gz);
+
+    if (size <= WEBASSET_MAX_FILE_BYTES) {
+        fresh->data = (uint8_t*)heap_caps_malloc(size ? size : 1, MALLOC_CAP_SPIRAM);
+        File f = SD_MMC.open(path, FILE_READ);
+        if (fresh->data && f && f.read(fresh->data, size) == size) {
+            xSemaphoreTake(assetMutex, portMAX_DELAY);
+            stats.sd_reads++;
+            stats.sd_bytes += size;
+            xSemaphoreGive(assetMutex);
+            Metrics_Add(mRead, size);
+        } else {
+            free(fresh->data);
+            fresh->data = nullptr;
+        }
+        if (f) f.close();
+    }
+
+    xSemaphoreTake(assetMutex, portMAX_DELAY);
+    stats.cache_misses++;
+    fresh->refs = 1;                    // The caller
+    fresh->lastUse = ++useClock;
+    makeRoom(fresh->data ? size : 0);
+    for (int i = 0; i < WEBASSET_MAX_ENTRIES; ++i) {
+        if (!table[i]) {
+            table[i] = fresh;
+            fresh->refs++;              // The slot
+            stats.entries++;
+            if (fresh->data) stats.cached_bytes += size;
+            break;
+        }
+    }
+    xSemaphoreGive(assetMutex);
+    return fresh;
+}
+
+// "/html/css/style.css" -> dir "/html/css", name "style.css"
+static bool existsOnCard(const String& path) {
+    const int slash = path.lastIndexOf('/');
+    const String dir = slash > 0 ? path.substring(0, slash) : String("/");
+    return DirCache_Lookup(dir.c_str(), path.substring(slash + 1).c_str());
+}
+
+static bool etagMatches(const String& ifNoneMatch, const char* etag) {
+    if (ifNoneMatch.isEmpty()) return false;
+    if (ifNoneMatch == "*") return true;
+    return ifNoneMatch.indexOf(etag) >= 0;      // Also inside a list or with a W/ prefix
+}
+
+static const WebBundleAsset* findEmbedded(const String& uri) {
+    for (size_t i = 0; i < webBundleCount; ++i) {
+        if (uri == webBundle[i].path) return &webBundle[i];
+    }
+    return nullptr;
+}
+
+// Built-in copy from flash, used when the card has no file of that name
+static esp_err_t serveEmbedded(HttpRequest& req, const WebBundleAsset* e, bool acceptsGzip, int64_t startUs) {
+    const char* etag = acceptsGzip ? e->etagGzip : e->etag;
+    req.setHeader("ETag", etag);
+    req.setHeader("Cache-Control", "no-cache");
+    req.setHeader("Vary", "Accept-Encoding");
+    if (acceptsGzip) req.setHeader("Content-Encoding", "gzip");
+
+    esp_err_t err;
+    const bool notModified = etagMatches(req.header("If-None-Match"), etag);
+    if (notModified) {
+        err = req.send(304, e->contentType, "", 0);
+    } else if (acceptsGzip) {
+        err = req.send(200, e->contentType, (const char*)e->gz, e->gzLen);
+    } else {
+        err = req.send(200, e->contentType, (const char*)e->raw, e->rawLen);
+    }
+
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - startUs);
+    xSemaphoreTake(assetMutex, portMAX_DELAY);
+    stats.requests++;
+    stats.embedded++;
+    if (strstr(e->path, ".html")) stats.page_views++;
+    if (notModified) stats.not_modified++;
+    if (acceptsGzip && !notModified) stats.gzip++;
+    serveUsTotal += us;
+    if (us > stats.serve_us_max) stats.serve_us_max = us;
+    xSemaphoreGive(assetMutex);
+    return err;
+}
+
+void WebAssets_Init() {
+    if (!assetMutex) assetMutex = xSemaphoreCreateMutex();
+    mRead = Metrics_Counter("sd_read_bytes_total", "Bytes read from the card", "reader=\"web_assets\"");
+}
+
+esp_err_t WebAssets_Serve(HttpRequest& req, const String& uri) {
+    const int64_t startUs = esp_timer_get_time();
+    const String path = String(WEBASSET_ROOT) + (uri == "/" ? String("/index.html") : uri);
+    const String contentType = HttpRequest::contentTypeFor(path);
+    const bool page = path.endsWith(".html");
+
+    // Precompressed sibling when the client takes gzip
+    const bool acceptsGzip = req.header("Accept-Encoding").indexOf("gzip") >= 0;
+    bool gz = acceptsGzip && existsOnCard(path + ".gz");
+    Asset* a = nullptr;
+    if (gz) a = acquire((path + ".gz").c_str(), true);
+    if (!a) {
+        gz = false;
+        if (existsOnCard(path)) a = acquire(path.c_str(), false);
+    }
+    if (!a) {
+        const WebBundleAsset* e = findEmbedded(path.substring(strlen(WEBASSET_ROOT)));
+        if (e) return serveEmbedded(req, e, acceptsGzip, startUs);
+        return req.send(404, "text/plain", "File not found: " + path);
+    }
+
+    char lastModified[40];
+    struct tm tmv;
+    gmtime_r(&a->mtime, &tmv);
+    strftime(lastModified, sizeof(lastModified), "%a, %d %b %Y %H:%M:%S GMT", &tmv);
+
+    req.setHeader("ETag", a->etag);
+    req.setHeader("Cache-Control", "no-cache");     // Always revalidate, answered with 304
+    req.setHeader("Last-Modified", lastModified);
+    req.setHeader("Vary", "Accept-Encoding");
+    if (gz) req.setHeader("Content-Encoding", "gzip");
+
+    esp_err_t err = ESP_OK;
+    const bool notModified = etagMatches(req.header("If-None-Match"), a->etag);
+    if (notModified) {
+        err = req.send(304, contentType.c_str(), "", 0);
+    } else if (a->data) {
+        err = req.send(200, contentType.c_str(), (const char*)a->data, a->size);
+    } else {
+        File f = SD_MMC.open(a->path, FILE_READ);
+        if (!f) {
+            err = req.send(404, "text/plain", "File not found: " + path);
+        } else {
+            if (!req.sendFile(f, contentType.c_str())) err = ESP_FAIL;
+            f.close();
+        }
+    }
+
+    const uint32_t us = (uint32_t)(esp_timer_get_time() - startUs);
+    xSemaphoreTake(assetMutex, portMAX_DELAY);
+    stats.requests++;
+    if (page) stats.page_views++;
+    if (notModified) stats.not_modified++;
+    if (gz && !notModified) stats.gzip++;
+    if (!notModified && !a->data) {
+        stats.sd_reads++;
+        stats.sd_bytes += a->size;
+    }
+    serveUsTotal += us;
+    if (us > stats.serve_us_max) stats.serve_us_max = us;
+    unref(a);
+    xSemaphoreGive(assetMutex);
+    return err;
+}
+
+void WebAssets_GetStats(WebAssetStats* out) {
+    if (!out) return;
+    if (assetMutex) xSemaphoreTake(assetMutex, portMAX_DELAY);
+    *out = stats;
+    out->serve_us_avg = stats.requests ? (uint32_t)(serveUsTotal / stats.requests) : 0;
+    out->sd_reads_per_view = stats.page_views ? (float)stats.sd_reads / stats.page_views : 0.0f;
+    if (assetMutex) xSemaphoreGive(assetMutex);
+}
+
+void WebAssets_PrintStats() {
+    WebAssetStats st;
+    WebAssets_GetStats(&st);
+    Serial.printf("[WebAssets] %u requests (%u pages, %u built-in), 304: %u, gzip: %u, PSRAM hits/misses: %u/%u, SD reads: %u (%.1f per page view), cached %u files/%u KB, serve avg %u us, max %u us\n",
+                  st.requests, st.page_views, st.embedded, st.not_modified, st.gzip, st.cache_hits, st.cache_misses,
+                  st.sd_reads, st.sd_reads_per_view, st.entries, st.cached_bytes / 1024, st.serve_us_avg, st.serve_us_max);
+}
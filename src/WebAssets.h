@@ -0,0 +1,65 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+#include "HttpRequest.h"
+
+/*
+  Static web UI files
+
+  The UI is built into the firmware (WebBundle.h, from sdcard/ at build
+  time). A file under /html on the SD card with the same name overrides the
+  built-in copy, so pages can still be changed without reflashing.
+
+  For files on the card the handler picks a variant and answers it as cheaply as
+  possible:
+    - "name.gz" next to "name" is sent with Content-Encoding: gzip when the
+      client accepts gzip (precompress with `gzip -k -9 style.css`)
+    - every response carries an ETag (size and modification time of the file
+      sent) and Cache-Control: no-cache, so a browser revalidates and gets a
+      304 without a body when nothing changed
+    - files up to WEBASSET_MAX_FILE_BYTES are kept in a PSRAM LRU of
+      WEBASSET_CACHE_BYTES and served without touching the card
+
+  Existence checks go through the directory cache, so a hit needs no SD
+  access at all. Cached files are checked again (one stat) only after
+  something wrote to the card (DirCache_Generation() changed).
+
+  SD reads per page view (an .html request) and serve times are counted
+  under [Web Assets] in /status; tools/http_bench.py --page measures page
+  load time from the client side.
+*/
+
+#define WEBASSET_ROOT             "/html"
+#define WEBASSET_CACHE_BYTES      (256 * 1024)   // PSRAM for cached files
+#define WEBASSET_MAX_FILE_BYTES   (64 * 1024)    // Larger files are streamed from SD
+#define WEBASSET_MAX_ENTRIES      32
+
+struct WebAssetStats {
+    uint32_t requests;
+    uint32_t page_views;        // .html requests
+    uint32_t embedded;          // Sent from the built-in copy in flash
+    uint32_t not_modified;      // 304
+    uint32_t gzip;              // .gz variant sent
+    uint32_t cache_hits;        // Sent from PSRAM
+    uint32_t cache_misses;
+    uint32_t revalidations;     // Stat after a card write
+    uint32_t sd_reads;          // Files opened on the card
+    uint64_t sd_bytes;          // Bytes read from the card
+    uint32_t entries;           // In the PSRAM cache
+    uint32_t cached_bytes;
+    uint32_t evictions;
+    uint32_t serve_us_avg;
+    uint32_t serve_us_max;
+    float    sd_reads_per_view;
+};
+
+void WebAssets_Init();
+
+// Answers a GET for 'uri' (URL path, "/" = "/index.html"), 404 if there is no such file
+esp_err_t WebAssets_Serve(HttpRequest& req, const String& uri);
+
+void WebAssets_GetStats(WebAssetStats* out);
+void WebAssets_PrintStats();
+
+#endif
@@ -0,0 +1,2359 @@
+// WebBundle.cpp - Generated by tools/embed_web.py from sdcard/, do not edit
+#include "WebBundle.h"
+
+constexpr uint8_t alarms_html_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x59,0xcd,0x6e,0xe3,0xc8,0x11,0xbe,0xeb,0x29,
+    0xca,0x7d,0xd8,0xa5,0x30,0x16,0xe9,0xc9,0x1c,0x26,0xb0,0x7e,0x06,0x8e,0x7f,0x76,0x26,0xb0,0xc7,0x86,
+    0x65,0x67,0xb0,0x18,0x18,0x8b,0x36,0xd9,0x92,0xb8,0xa6,0xd8,0x44,0xb3,0x69,0x59,0xf0,0x1a,0x98,0x53,
+    0x2e,0x39,0x04,0x39,0xe5,0x92,0x20,0xb7,0x9c,0x73,0x4f,0x9e,0xc6,0x2f,0x90,0x3c,0x42,0xaa,0xba,0x9b,
+    0x14,0x29,0xc9,0x3f,0x33,0x46,0x10,0x18,0x12,0xc5,0xea,0xea,0xea,0xaa,0xaf,0xaa,0xab,0xaa,0xdb,0xbd,
+    0x8d,0xbd,0xe3,0xdd,0xb3,0x1f,0x4f,0xf6,0x61,0xa2,0xa7,0xc9,0xa0,0xd5,0xa3,0x07,0x24,0x3c,0x1d,0xf7,
+    0x99,0x48,0x19,0x11,0x04,0x8f,0xf0,0x31,0x15,0x9a,0x43,0x38,0xe1,0x2a,0x17,0xba,0xcf,0xce,0xcf,0x0e,
+    0x3a,0xbf,0x66,0x10,0xe0,0x80,0x8e,0x75,0x22,0x06,0xfb,0xc3,0x93,0x37,0xbf,0xea,0x0c,0xdf,0xc0,0x4e,
+    0xc2,0xd5,0x34,0xef,0x05,0x96,0xdc,0xea,0x25,0x71,0x7a,0x05,0x4a,0x24,0x7d,0x96,0xeb,0x79,0x22,0xf2,
+    0x89,0x10,0x9a,0xc1,0x44,0x89,0x91,0xa3,0xf8,0x61,0x9e,0x5b,0x49,0x81,0x5b,0xea,0x52,0x46,0x73,0x7c,
+    0xa4,0xfc,0x1a,0xbf,0xb9,0xe3,0x0d,0xd8,0xe0,0xbd,0x9c,0x8a,0x5e,0xc0,0xeb,0xc4,0x38,0xd5,0x42,0xa5,
+    0x42,0xff,0xa4,0x78,0x14,0x4b,0x9f,0x94,0x67,0x83,0x0f,0x8e,0x08,0xa7,0x44,0x5c,0x9a,0x31,0x8a,0x13,
+    0xf1,0x93,0xb8,0xc9,0x12,0xa9,0x84,0x72,0x13,0x0e,0x90,0x06,0xfb,0x8e,0x56,0xf2,0x87,0x09,0xcf,0xf3,
+    0x3e,0xe3,0xa1,0x8e,0xaf,0x45,0xa9,0x71,0xc0,0x8d,0x79,0x6e,0x5e,0x69,0x2b,0x4d,0x08,0xac,0xba,0x93,
+    0xd7,0x83,0xfb,0x3f,0xfe,0xa3,0x42,0x01,0x5f,0x5b,0xbd,0x28,0xbe,0xae,0xa4,0x19,0x7a,0x27,0x94,0xa9,
+    0xe6,0x71,0x2a,0x14,0x6b,0x0e,0x13,0x5d,0xc9,0x24,0x27,0xf2,0x65,0xa1,0xb5,0x4c,0x41,0xa6,0x61,0x12,
+    0x87,0x57,0x7d,0x86,0x18,0x4a,0x1e,0x1d,0x28,0x39,0xdd,0x8b,0xf3,0x2b,0xaf,0xcd,0x06,0xf7,0xbf,0xff,
+    0x27,0x9c,0x1a,0x2a,0x8c,0x90,0x0c,0x11,0xd2,0x7b,0x81,0x9d,0xb7,0x46,0x00,0x8f,0xa2,0x8f,0x62,0x66,
+    0x34,0xa3,0xd9,0xff,0xfe,0xd7,0x1f,0x60,0x27,0x8a,0xc0,0xa8,0x54,0x9b,0x16,0xa0,0x3e,0x4d,0xad,0xc6,
+    0x2a,0x8e,0x80,0x7c,0x53,0xe9,0x3b,0xd8,0x4f,0xf9,0x65,0x22,0xa2,0x1a,0xf3,0xe0,0x2c,0x26,0xef,0xd4,
+    0xde,0xe7,0x59,0xe3,0xfd,0x84,0xeb,0x09,0x04,0x70,0x7e,0x7a,0x58,0xa7,0x7e,0x12,0xe2,0x2a,0xe2,0xf3,
+    0x7c,0xcd,0xb2,0x2a,0x1e,0x4f,0x34,0x82,0x8c,0x0e,0x90,0x69,0xc5,0x50,0xe3,0x8b,0x23,0x07,0xe8,0xee,
+    0x02,0xce,0x25,0xb6,0x3c,0x54,0x71,0xa6,0x07,0xad,0x20,0x80,0x4e,0xa7,0x03,0xef,0x45,0x92,0x09,0x95,
+    0xd3,0xef,0x16,0x62,0x9d,0x6b,0xd8,0xdb,0xf9,0x71,0x08,0x7d,0xf8,0xcc,0x86,0x6c,0x93,0x1d,0xe1,0xe7,
+    0x0c,0x3f,0x9f,0xdc,0xf3,0x00,0x3f,0x43,0x76,0xd1,0x05,0x9c,0x3e,0x2c,0x52,0xdf,0x1f,0x72,0xdd,0x1a,
+    0x15,0xa9,0xd1,0x08,0xd5,0x94,0xa9,0xb0,0x70,0xf2,0xf6,0x6d,0x4b,0x09,0x5d,0xa8,0x14,0x6e,0x5b,0x1a,
+    0x81,0xd8,0x06,0xee,0xd3,0x13,0x7e,0xf9,0x05,0xd8,0xd6,0xdb,0xed,0xad,0x2d,0xb6,0xd9,0x9a,0x39,0x5b,
+    0xb7,0x61,0x47,0x29,0x3e,0xf7,0xe3,0xdc,0x3c,0x3d,0xee,0x97,0x23,0x6d,0xf8,0xee,0x3b,0x58,0xbc,0xfa,
+    0x89,0x48,0xc7,0x88,0x5a,0xbf,0xdf,0x87,0xb7,0xf0,0xae,0x3e,0x92,0xa3,0x4f,0x85,0xb7,0xb5,0xf9,0xb6,
+    0x0d,0xdb,0xf0,0x79,0x6b,0xf3,0x75,0xf5,0xb7,0x75,0xb1,0xd9,0xe2,0x46,0xc3,0x6d,0x52,0x06,0xbd,0xb0,
+    0x0d,0xb8,0x84,0x25,0x59,0xf9,0xf6,0xb7,0x4f,0x63,0x6d,0x23,0xb6,0x46,0x40,0x71,0x6c,0x9a,0xbd,0x41,
+    0x75,0x33,0x74,0xd8,0x43,0x53,0x69,0xac,0x31,0x95,0x08,0x34,0x95,0xb5,0xee,0x36,0x5b,0xc2,0x46,0xc7,
+    0x36,0x90,0x40,0x39,0x42,0x2e,0x47,0x31,0x96,0xb0,0x4b,0x29,0x13,0xc1,0x53,0x66,0xe6,0x97,0x23,0xc8,
+    0xac,0x0a,0xd1,0xba,0xeb,0xb6,0xee,0x16,0x10,0x47,0x62,0xc4,0x8b,0x44,0xbb,0x98,0xad,0x30,0xae,0x21,
+    0x5f,0xc2,0xbd,0x06,0xe4,0x87,0x51,0x01,0x8b,0x8a,0xb5,0x13,0xac,0x9d,0x2c,0x98,0x16,0x79,0x1c,0x06,
+    0x07,0x82,0x2b,0x40,0x9d,0xf5,0x44,0x40,0xc4,0xd5,0x95,0x4f,0x4c,0xd0,0x30,0xca,0xe8,0xd9,0x26,0x45,
+    0x5d,0x58,0xed,0x9c,0x7c,0x30,0x21,0xc5,0xf3,0x79,0x1a,0x42,0xa5,0x3d,0xcf,0xe2,0x1f,0x84,0x55,0x3e,
+    0x27,0xed,0x6d,0xc4,0x29,0x91,0x63,0xc0,0xf1,0x19,0x8f,0x35,0x8c,0x84,0x0e,0x27,0x5e,0x99,0x55,0x18,
+    0xca,0x8c,0x47,0xe0,0x6d,0x20,0x8b,0x2f,0xaf,0xda,0xa8,0x83,0x92,0x33,0x48,0xc5,0x0c,0xf6,0x95,0x92,
+    0xca,0x63,0x3f,0xec,0x9f,0x81,0x63,0x86,0x11,0xc7,0xac,0x15,0xd1,0x1c,0x87,0x8a,0x15,0x49,0x73,0x7f,
+    0xce,0x65,0xea,0x19,0x05,0x57,0x35,0xc2,0x2d,0xbf,0x88,0xd9,0xa7,0x34,0x0a,0x30,0x67,0x20,0x42,0xb7,
+    0x2d,0xcc,0xfe,0x13,0x89,0xb6,0xb3,0x93,0xe3,0x21,0xee,0x8c,0x96,0xcd,0x06,0x39,0x61,0xc9,0x68,0xf7,
+    0x89,0x54,0x77,0x68,0xc3,0x33,0x64,0xe1,0x59,0x86,0xc1,0xc9,0x69,0xc1,0x80,0x34,0x31,0xe8,0x51,0x4e,
+    0xdf,0x86,0xdf,0x0e,0x8f,0x3f,0xfa,0xb9,0x56,0x71,0x3a,0x8e,0x47,0x18,0xf8,0x6d,0x83,0xe3,0xe3,0x36,
+    0xd3,0x8a,0x50,0xd3,0xe7,0x5b,0x0d,0x3f,0xcf,0x22,0xae,0x5d,0xd4,0xc4,0x69,0x24,0x6e,0x8c,0xe7,0xc3,
+    0xc9,0x73,0x60,0x28,0xcc,0xdc,0xff,0x21,0x12,0xc7,0x97,0x3f,0x8b,0x50,0xfb,0x98,0xf7,0xe2,0x71,0xea,
+    0xdd,0x82,0x51,0x10,0xb9,0x9d,0x8a,0x5f,0x8d,0x93,0x55,0xf8,0x5b,0xa1,0xda,0x13,0x89,0x68,0x40,0xf5,
+    0x1c,0x8c,0x22,0x33,0xe9,0x45,0x18,0xdd,0x74,0x66,0xb3,0x59,0x67,0x24,0xd5,0xb4,0x53,0x28,0xcc,0x7d,
+    0xa1,0x8c,0x50,0xfb,0x05,0x68,0xcc,0x28,0xd3,0x67,0xf0,0x0a,0xec,0xe0,0xf9,0xe9,0x87,0x5d,0x39,0xcd,
+    0x30,0x1b,0xa4,0xda,0x69,0xfa,0xb5,0x48,0x59,0xb5,0xbf,0x15,0x29,0x5b,0x7e,0x9f,0xb3,0xb9,0x03,0x5b,
+    0xbf,0x09,0x1f,0x68,0xe2,0x03,0x5f,0xa9,0xb1,0x72,0x25,0xff,0x39,0x1a,0xbb,0x04,0x75,0x6e,0xf3,0x13,
+    0x5a,0x0a,0x3b,0x87,0x3b,0xa7,0x47,0xa6,0xe4,0x5d,0x74,0x17,0x89,0xd6,0x65,0xcd,0x93,0x38,0x49,0x72,
+    0x8f,0x6f,0x62,0x69,0x5d,0xf8,0x7c,0xa6,0x78,0x86,0xfc,0x91,0x0c,0x8b,0x29,0xe2,0xec,0x87,0x4a,0x60,
+    0x6c,0xed,0x27,0x82,0xde,0x3c,0x86,0x85,0x96,0x94,0x40,0xaf,0x81,0x47,0x0b,0xc4,0xc8,0xbb,0xd5,0xc5,
+    0x47,0x0f,0xde,0xe2,0xe3,0xd5,0xab,0x4a,0x50,0x86,0xd2,0x1f,0x11,0x94,0x67,0x58,0x13,0x50,0x12,0xb1,
+    0xf9,0xa6,0x07,0xf8,0xc8,0xb1,0x82,0x62,0xc1,0x20,0x0a,0x39,0xbd,0x56,0x29,0x3f,0xc7,0x17,0x58,0x3e,
+    0x18,0xd0,0xa6,0xa2,0xb2,0x53,0xce,0xd3,0xe2,0x46,0xbb,0x10,0xc3,0x99,0x54,0xdd,0x91,0xb3,0x1c,0xa3,
+    0x96,0xd4,0x16,0xfb,0x22,0xa5,0x72,0x2f,0xe9,0xfb,0xac,0x10,0x54,0xf2,0x11,0x4a,0xfc,0x3d,0x29,0xa8,
+    0xec,0xab,0x98,0x0a,0x3f,0xd7,0xec,0x62,0x31,0xd9,0xb5,0x51,0xe4,0x5d,0x13,0x05,0x5e,0x1b,0xfa,0x03,
+    0x28,0x4d,0x43,0x5f,0xfd,0x8e,0x93,0x71,0x2b,0x25,0x1a,0x15,0xb3,0x83,0xa4,0x71,0x7d,0xdc,0x5a,0xb0,
+    0x85,0xda,0xbf,0xee,0xb6,0xb4,0x9a,0xa3,0x2c,0xeb,0xc1,0xe5,0x5c,0x15,0xdd,0x50,0xcc,0x2c,0xea,0x9a,
+    0x5b,0x8b,0xa2,0x66,0x21,0x0d,0x45,0x5b,0x7a,0x1d,0xbf,0xc3,0x38,0xd7,0xbe,0x96,0xe3,0x71,0x22,0x3c,
+    0x26,0x0d,0xb8,0x77,0x10,0x52,0x46,0x01,0x0f,0x2b,0xff,0x2d,0xf6,0x7e,0x42,0x69,0x4f,0xf8,0x53,0x91,
+    0xe7,0x7c,0x2c,0xda,0x5d,0xb8,0xa3,0x0a,0x4c,0x1e,0xf7,0x71,0x63,0x8a,0x34,0xda,0x9d,0xc4,0x49,0xe4,
+    0x91,0x48,0x13,0x4f,0x2e,0xd4,0x88,0xa1,0x51,0xa8,0xad,0x2b,0x4f,0xe5,0x6c,0x39,0x78,0x28,0x90,0x9f,
+    0x8c,0x1d,0x64,0x6a,0x3a,0xdc,0x74,0x9c,0x48,0x65,0x5d,0x8a,0x60,0xd7,0x6c,0x3a,0x89,0x55,0x2b,0xf1,
+    0xa0,0xd4,0x38,0xcd,0x0a,0x4d,0x72,0x1d,0xab,0xed,0x6b,0x50,0x6c,0x38,0x11,0xe1,0xd5,0xa5,0xbc,0x61,
+    0x8b,0xa1,0xc6,0xb2,0x96,0x78,0x66,0x00,0xab,0xf3,0xd0,0x34,0xb3,0xe2,0xc6,0x46,0xd5,0xb0,0x2c,0x86,
+    0x31,0x32,0x26,0x78,0x5e,0x12,0x2b,0xa1,0xf1,0xb4,0x53,0xab,0x9e,0x62,0x79,0x29,0xeb,0xdc,0x85,0xa9,
+    0x4b,0xe3,0x4b,0x7e,0x5c,0xa7,0xe9,0xca,0x8c,0x15,0x5f,0xb7,0x8c,0xaf,0x09,0xfb,0xba,0xab,0xdd,0xbc,
+    0xb6,0x41,0x9e,0x7a,0x7a,0x07,0xbb,0xe9,0x66,0x9f,0x81,0x39,0xf1,0x55,0x80,0xd3,0x0b,0x73,0xb4,0x6b,
+    0x9e,0x14,0x06,0xa3,0xe5,0xc6,0xd8,0x8d,0xbf,0x00,0x46,0xdb,0x02,0xd6,0x56,0xb1,0xf0,0x39,0x95,0x17,
+    0xf4,0xa7,0xc3,0x7f,0x8d,0xa6,0x6e,0x4f,0x2c,0xe3,0x44,0x43,0x0e,0x24,0x34,0xb6,0x04,0xc9,0xda,0xfd,
+    0x60,0x86,0xc3,0x5a,0x13,0x1a,0x94,0x3e,0xdb,0xde,0x93,0xe5,0xb2,0x48,0x29,0xf1,0x98,0xe3,0x2b,0xbb,
+    0xf0,0x31,0x8b,0xee,0x73,0xac,0x1a,0x32,0xd3,0xf5,0xf4,0x22,0x1f,0x11,0x8a,0xac,0xb1,0xdd,0xdb,0xb2,
+    0xd2,0x1c,0x69,0x5d,0x90,0x4b,0xc9,0x90,0x88,0xa6,0xce,0x3c,0x78,0x18,0x30,0xed,0x39,0xb2,0xb5,0x71,
+    0xae,0xd5,0xd5,0xc4,0x12,0x35,0xbc,0x5d,0x73,0x92,0x68,0x20,0x20,0x29,0x84,0xda,0x6e,0xe0,0x05,0xde,
+    0x5b,0x6e,0xcb,0x8d,0x3c,0x63,0x49,0xd9,0x9b,0xd3,0x77,0xe9,0x59,0xe7,0xdb,0x86,0xd6,0xb5,0x29,0xcf,
+    0xcc,0x70,0x0b,0x77,0x7d,0x7a,0x56,0x75,0x2b,0x39,0x9b,0xf9,0xc2,0x2a,0xd1,0xa1,0x6c,0xc8,0x6a,0x3c,
+    0x8d,0x30,0xa1,0x33,0xd6,0x9a,0xe8,0x71,0xbc,0x36,0x82,0xe8,0x68,0x5c,0xd6,0x48,0x3a,0x47,0x3d,0x63,
+    0x9b,0x19,0x48,0xaa,0x6d,0x86,0x7e,0x66,0x8e,0x96,0x25,0x3c,0x14,0x13,0x99,0x60,0xc3,0x65,0x42,0xf8,
+    0x31,0x57,0xbb,0xb0,0xa3,0x42,0x3a,0xd1,0x3a,0xdb,0x0e,0x02,0xdf,0xf7,0x4d,0x3d,0x75,0x87,0x21,0xba,
+    0x2c,0x31,0x07,0x20,0x27,0xbc,0x8c,0xaf,0xc7,0x0e,0x85,0xb4,0xb1,0x4b,0xfe,0xff,0x53,0x54,0x38,0x10,
+    0x17,0x0c,0x4f,0x47,0x45,0xc3,0xbc,0xa6,0x20,0x6b,0xd0,0xfa,0x2c,0x60,0x4c,0x36,0x3e,0x2c,0x2f,0x32,
+    0x56,0x58,0xd6,0xb5,0x56,0x76,0x8a,0xbb,0xd9,0x70,0x9e,0xb7,0x4b,0xe6,0x4f,0xc7,0xa2,0x63,0x6c,0x86,
+    0xa2,0xbd,0x2c,0x29,0x03,0x1b,0x9b,0xda,0x47,0xe4,0xd8,0xab,0x1e,0x12,0x85,0x7c,0x4b,0x49,0x82,0xfd,
+    0xe7,0x6f,0x7f,0xfe,0x13,0xd8,0x03,0x00,0xb3,0x0c,0x0f,0x75,0x3e,0xa6,0x65,0xc5,0xf5,0x46,0x31,0x7a,
+    0x8d,0xd9,0x29,0xd8,0xba,0xc6,0xb9,0xbd,0x52,0x7a,0xc7,0xda,0x6d,0xb0,0xfd,0xc2,0x4a,0x7f,0xd3,0x38,
+    0x60,0x20,0x1e,0x5d,0x37,0x44,0x8d,0xed,0x4e,0x1a,0x9d,0x22,0x78,0x42,0x79,0xcd,0x76,0xe5,0xc1,0xbd,
+    0x5c,0xe2,0x51,0x07,0x1d,0xf5,0x5e,0xb3,0xeb,0x1c,0xe7,0xa2,0x65,0x46,0x86,0x35,0x7d,0xfd,0x92,0x16,
+    0x65,0x12,0xae,0x2e,0xed,0xea,0xd0,0x8e,0x85,0x76,0xb8,0xfe,0x66,0xfe,0x21,0xf2,0x96,0xef,0xa3,0xda,
+    0xc6,0x23,0xf6,0xc5,0x8f,0x53,0xfc,0x7e,0x7f,0x76,0x74,0x88,0x02,0xbe,0xaf,0xdf,0x74,0x4d,0x0b,0x4c,
+    0xb4,0x6c,0x70,0x88,0xeb,0xe2,0x79,0xf0,0xfe,0xcb,0xdf,0xed,0xf5,0xd5,0xf7,0x25,0x6e,0x55,0xcf,0xee,
+    0x55,0x08,0xd6,0x2e,0x16,0xcc,0x96,0xa3,0x6e,0x7e,0xfd,0x4a,0xb4,0x19,0x8d,0xab,0xac,0x14,0x77,0xa7,
+    0x54,0x59,0x25,0xa6,0x99,0x9e,0x3f,0x1d,0x74,0x86,0xad,0x19,0x72,0x56,0xeb,0x72,0x68,0x29,0x8c,0x3e,
+    0x4a,0x70,0xf7,0x14,0x73,0xa1,0x7d,0xd8,0x35,0x11,0x74,0xff,0xe5,0x2f,0x8d,0x5b,0xc7,0xfb,0x2f,0x7f,
+    0xf5,0x59,0x5d,0xef,0x46,0x23,0x42,0x62,0x2b,0x57,0x91,0x9b,0x9c,0x01,0x65,0x8d,0x2c,0x37,0x13,0x45,
+    0xe3,0x7a,0x11,0x2b,0x5d,0x69,0x7b,0xb9,0x03,0xfe,0x0a,0xef,0x1c,0x98,0xf3,0x16,0x68,0x69,0xe2,0xc3,
+    0x59,0xe7,0x57,0x9e,0x22,0x34,0x25,0x66,0xcb,0x19,0x57,0xa9,0xe7,0xba,0xab,0x95,0x03,0x63,0xfd,0x06,
+    0xb6,0x74,0x00,0x27,0xf0,0x1b,0xf7,0x5c,0x2b,0xdb,0xa5,0x76,0x67,0xf3,0x82,0x9d,0xb2,0xac,0xcd,0xf2,
+    0x85,0xf2,0xf2,0x8e,0xae,0x5f,0x2d,0x97,0xf7,0xde,0x74,0xb2,0xc4,0x33,0x17,0x0c,0xf7,0xde,0xc1,0x79,
+    0x9a,0xf3,0x6b,0x44,0xc4,0xa6,0xf8,0x1c,0xe2,0x14,0x4e,0x77,0x8e,0x60,0x46,0xa7,0xbc,0x4b,0x81,0x1a,
+    0xe2,0xe1,0xe3,0x91,0x1c,0x50,0x1e,0x9d,0x5f,0x62,0x11,0x26,0x51,0xa7,0xe5,0x6c,0x22,0x52,0x73,0x67,
+    0x97,0xc4,0xb4,0x55,0x9d,0x4a,0x22,0xc9,0x05,0x8e,0x28,0x01,0x9e,0x96,0x05,0xca,0xca,0x31,0x24,0x44,
+    0xba,0x09,0x3c,0x95,0xc8,0xac,0xe0,0x12,0x33,0x40,0x2e,0x54,0xdb,0x1c,0x8d,0x8d,0x8d,0xa7,0xe2,0x9a,
+    0xce,0x52,0x45,0x92,0xd4,0x8f,0xc7,0xa4,0xc8,0xe2,0x22,0xcf,0xe0,0x34,0x8b,0xd3,0x08,0xf3,0xcb,0xfe,
+    0x35,0x46,0xfc,0x50,0x16,0x2a,0x14,0x0b,0x53,0xdd,0xd6,0xa2,0x21,0x77,0x32,0x83,0x1a,0x9f,0xc7,0x02,
+    0x3b,0x64,0x36,0x96,0xf9,0xe5,0x63,0x68,0x18,0x0e,0x3a,0xb2,0x09,0x0c,0x44,0x97,0x49,0xd8,0x26,0x88,
+    0x7a,0x23,0x48,0xed,0x98,0xb9,0x3a,0xca,0xe8,0x1f,0x31,0x88,0x07,0xd6,0x4d,0xee,0xae,0x0f,0x2a,0xf5,
+    0x37,0xfa,0xd6,0x00,0x2a,0xce,0x91,0xaf,0x1c,0xa5,0x1c,0x6e,0xaf,0x22,0x5d,0x33,0xdc,0xf0,0x77,0xdd,
+    0xf5,0xa6,0x33,0x71,0x55,0xb7,0xbd,0xe3,0x23,0xb7,0xd7,0x29,0x67,0xd1,0xd1,0xb9,0xaa,0x0a,0x2b,0xc2,
+    0x1b,0xd8,0x59,0xc9,0xbd,0xa0,0xbc,0x97,0xef,0x05,0xee,0x9f,0x3d,0x81,0xf9,0xf7,0xd3,0x7f,0x01,0x00,
+    0x71,0xb9,0x7a,0x8e,0x1a,0x00,0x00,
+};
+
+constexpr uint8_t alarms_html_raw[] = {
+    0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x3c,0x68,0x74,0x6d,
+    0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,
+    0x22,0x20,0x2f,0x3e,0x0a,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,
+    0x20,0x41,0x6c,0x61,0x72,0x6d,0x73,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,
+    0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,
+    0x72,0x65,0x66,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x22,0x20,0x2f,0x3e,0x0a,0x3c,
+    0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x6e,0x61,0x76,0x3e,0x0a,
+    0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,
+    0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x69,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x5f,
+    0x72,0x61,0x64,0x69,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x49,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,
+    0x20,0x52,0x61,0x64,0x69,0x6f,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,
+    0x2f,0x66,0x69,0x6c,0x65,0x5f,0x65,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x2e,0x68,0x74,0x6d,0x6c,0x22,
+    0x3e,0x46,0x69,0x6c,0x65,0x20,0x45,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,
+    0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x20,0x68,0x72,0x65,
+    0x66,0x3d,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x41,0x6c,0x61,
+    0x72,0x6d,0x73,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x2f,0x6e,0x61,0x76,0x3e,0x0a,0x3c,0x68,0x31,0x3e,0xe2,
+    0x8f,0xb0,0x20,0x41,0x6c,0x61,0x72,0x6d,0x73,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2d,0x63,0x6f,0x6e,0x74,0x61,0x69,
+    0x6e,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
+    0x6e,0x74,0x72,0x6f,0x6c,0x73,0x22,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,
+    0x6c,0x69,0x63,0x6b,0x3d,0x22,0x72,0x65,0x6c,0x6f,0x61,0x64,0x46,0x72,0x6f,0x6d,0x44,0x69,0x73,0x6b,
+    0x28,0x29,0x22,0x3e,0xe2,0x86,0xbb,0x20,0x52,0x65,0x6c,0x6f,0x61,0x64,0x20,0x66,0x72,0x6f,0x6d,0x20,
+    0x64,0x69,0x73,0x6b,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,
+    0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x61,0x64,0x64,0x4e,0x65,0x77,0x41,0x6c,0x61,
+    0x72,0x6d,0x28,0x29,0x22,0x3e,0xef,0xbc,0x8b,0x20,0x41,0x64,0x64,0x20,0x61,0x6c,0x61,0x72,0x6d,0x3c,
+    0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,
+    0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x67,0x72,0x69,0x64,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x22,
+    0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,0x45,0x6e,0x61,0x62,0x6c,0x65,0x64,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+    0x0a,0x3c,0x64,0x69,0x76,0x3e,0x54,0x69,0x6d,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,
+    0x76,0x3e,0x54,0x79,0x70,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,0x50,0x61,
+    0x74,0x68,0x20,0x2f,0x20,0x55,0x52,0x4c,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,
+    0x57,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x69,0x67,0x68,0x74,0x22,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,
+    0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,
+    0x69,0x64,0x3d,0x22,0x61,0x6c,0x61,0x72,0x6d,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,
+    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x73,0x63,0x72,0x69,0x70,
+    0x74,0x3e,0x0a,0x2f,0x2f,0x20,0x2d,0x2d,0x2d,0x20,0x48,0x65,0x6c,0x70,0x65,0x72,0x73,0x20,0x2d,0x2d,
+    0x2d,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x44,0x41,0x59,0x53,0x20,0x3d,0x20,0x5b,0x22,0x53,0x22,0x2c,
+    0x22,0x4d,0x22,0x2c,0x22,0x54,0x22,0x2c,0x22,0x57,0x22,0x2c,0x22,0x54,0x22,0x2c,0x22,0x46,0x22,0x2c,
+    0x22,0x53,0x22,0x5d,0x3b,0x20,0x2f,0x2f,0x20,0x53,0x75,0x6e,0x2e,0x2e,0x53,0x61,0x74,0x0a,0x66,0x75,
+    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x6c,0x6f,0x6e,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x61,0x29,
+    0x7b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x7b,0x0a,0x74,0x69,0x6d,0x65,0x3a,0x20,0x61,0x2e,0x74,
+    0x69,0x6d,0x65,0x20,0x7c,0x7c,0x20,0x22,0x30,0x37,0x3a,0x30,0x30,0x22,0x2c,0x0a,0x77,0x65,0x65,0x6b,
+    0x64,0x61,0x79,0x73,0x3a,0x20,0x41,0x72,0x72,0x61,0x79,0x2e,0x69,0x73,0x41,0x72,0x72,0x61,0x79,0x28,
+    0x61,0x2e,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x29,0x20,0x26,0x26,0x20,0x61,0x2e,0x77,0x65,0x65,
+    0x6b,0x64,0x61,0x79,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x3d,0x3d,0x3d,0x20,0x37,0x20,0x3f,
+    0x20,0x61,0x2e,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x2e,0x73,0x6c,0x69,0x63,0x65,0x28,0x30,0x2c,
+    0x37,0x29,0x20,0x3a,0x20,0x5b,0x30,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x30,0x5d,
+    0x2c,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x7b,0x0a,0x74,0x79,0x70,0x65,0x3a,0x20,0x28,0x61,
+    0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x26,0x26,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,
+    0x74,0x79,0x70,0x65,0x29,0x20,0x3f,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x74,0x79,0x70,
+    0x65,0x20,0x3a,0x20,0x22,0x6d,0x70,0x33,0x22,0x2c,0x0a,0x70,0x61,0x74,0x68,0x3a,0x20,0x28,0x61,0x2e,
+    0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x26,0x26,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x70,
+    0x61,0x74,0x68,0x29,0x20,0x3f,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x70,0x61,0x74,0x68,
+    0x20,0x3a,0x20,0x22,0x22,0x0a,0x7d,0x2c,0x0a,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x3a,0x20,0x74,0x79,
+    0x70,0x65,0x6f,0x66,0x20,0x61,0x2e,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x3d,0x3d,0x20,0x22,
+    0x62,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x22,0x20,0x3f,0x20,0x61,0x2e,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,
+    0x20,0x3a,0x20,0x74,0x72,0x75,0x65,0x0a,0x7d,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+    0x6e,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x41,0x6c,0x61,0x72,0x6d,0x28,0x29,0x7b,0x0a,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x20,0x63,0x6c,0x6f,0x6e,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x7b,0x0a,0x74,0x69,
+    0x6d,0x65,0x3a,0x20,0x22,0x30,0x37,0x3a,0x30,0x30,0x22,0x2c,0x0a,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,
+    0x73,0x3a,0x20,0x5b,0x30,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x31,0x2c,0x30,0x5d,0x2c,0x0a,
+    0x61,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x7b,0x20,0x74,0x79,0x70,0x65,0x3a,0x20,0x22,0x6d,0x70,0x33,
+    0x22,0x2c,0x20,0x70,0x61,0x74,0x68,0x3a,0x20,0x22,0x2f,0x6d,0x75,0x73,0x69,0x63,0x2f,0x46,0x65,0x61,
+    0x72,0x20,0x6f,0x66,0x20,0x74,0x68,0x65,0x20,0x64,0x61,0x72,0x6b,0x2e,0x6d,0x70,0x33,0x22,0x20,0x7d,
+    0x2c,0x0a,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x3a,0x20,0x74,0x72,0x75,0x65,0x0a,0x7d,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x2f,0x2f,0x20,0x2d,0x2d,0x2d,0x20,0x41,0x50,0x49,0x20,0x2d,0x2d,0x2d,0x0a,0x61,0x73,0x79,
+    0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x70,0x69,0x47,0x65,0x74,0x41,0x6c,
+    0x61,0x72,0x6d,0x73,0x28,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x20,0x3d,0x20,
+    0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,
+    0x22,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,
+    0x6f,0x77,0x20,0x6e,0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x47,0x45,0x54,0x20,0x2f,0x61,
+    0x6c,0x61,0x72,0x6d,0x73,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x3b,
+    0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x70,
+    0x69,0x41,0x64,0x64,0x41,0x6c,0x61,0x72,0x6d,0x28,0x61,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x72,0x65,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,
+    0x61,0x6c,0x61,0x72,0x6d,0x73,0x2f,0x61,0x64,0x64,0x22,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,
+    0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,
+    0x7b,0x20,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x3a,0x20,0x22,0x61,
+    0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x6a,0x73,0x6f,0x6e,0x22,0x20,0x7d,0x2c,0x0a,
+    0x62,0x6f,0x64,0x79,0x3a,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,
+    0x28,0x61,0x29,0x0a,0x7d,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x2e,0x6f,0x6b,0x29,
+    0x20,0x74,0x68,0x72,0x6f,0x77,0x20,0x6e,0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x50,0x4f,
+    0x53,0x54,0x20,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2f,0x61,0x64,0x64,0x20,0x66,0x61,0x69,0x6c,0x65,
+    0x64,0x22,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,
+    0x73,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,
+    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x70,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x41,0x6c,0x61,0x72,
+    0x6d,0x28,0x69,0x6e,0x64,0x65,0x78,0x2c,0x20,0x70,0x61,0x74,0x63,0x68,0x29,0x7b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x72,0x65,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x28,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2f,0x75,0x70,0x64,0x61,0x74,0x65,0x22,0x2c,0x20,0x7b,
+    0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,
+    0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,
+    0x65,0x22,0x3a,0x20,0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x6a,0x73,0x6f,
+    0x6e,0x22,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,
+    0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x4f,0x62,0x6a,0x65,0x63,0x74,0x2e,0x61,0x73,0x73,0x69,0x67,0x6e,
+    0x28,0x7b,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x7d,0x2c,0x20,0x70,0x61,0x74,0x63,0x68,0x29,0x29,0x0a,
+    0x7d,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,
+    0x6f,0x77,0x20,0x6e,0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x50,0x4f,0x53,0x54,0x20,0x2f,
+    0x61,0x6c,0x61,0x72,0x6d,0x73,0x2f,0x75,0x70,0x64,0x61,0x74,0x65,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+    0x22,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,
+    0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,
+    0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x70,0x69,0x44,0x65,0x6c,0x65,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,
+    0x28,0x69,0x6e,0x64,0x65,0x78,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x20,0x3d,
+    0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,
+    0x73,0x2f,0x64,0x65,0x6c,0x65,0x74,0x65,0x22,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,
+    0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,
+    0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x3a,0x20,0x22,0x61,0x70,0x70,
+    0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,
+    0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x22,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,
+    0x20,0x22,0x69,0x6e,0x64,0x65,0x78,0x3d,0x22,0x20,0x2b,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,
+    0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x69,0x6e,0x64,0x65,0x78,0x29,0x0a,0x7d,0x29,
+    0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,0x6f,0x77,
+    0x20,0x6e,0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x50,0x4f,0x53,0x54,0x20,0x2f,0x61,0x6c,
+    0x61,0x72,0x6d,0x73,0x2f,0x64,0x65,0x6c,0x65,0x74,0x65,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,
+    0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x2e,0x6a,
+    0x73,0x6f,0x6e,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x20,0x61,0x70,0x69,0x52,0x65,0x6c,0x6f,0x61,0x64,0x28,0x29,0x7b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x72,0x65,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,
+    0x28,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2f,0x72,0x65,0x6c,0x6f,0x61,0x64,0x22,0x2c,0x20,0x7b,
+    0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x20,0x7d,0x29,0x3b,0x0a,
+    0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,0x6f,0x77,0x20,0x6e,
+    0x65,0x77,0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x22,0x50,0x4f,0x53,0x54,0x20,0x2f,0x61,0x6c,0x61,0x72,
+    0x6d,0x73,0x2f,0x72,0x65,0x6c,0x6f,0x61,0x64,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,0x22,0x29,0x3b,0x0a,
+    0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x2e,0x6a,0x73,0x6f,
+    0x6e,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x2d,0x2d,0x2d,0x20,0x55,0x49,0x20,0x2d,0x2d,0x2d,
+    0x0a,0x6c,0x65,0x74,0x20,0x41,0x4c,0x41,0x52,0x4d,0x53,0x20,0x3d,0x20,0x5b,0x5d,0x3b,0x0a,0x66,0x75,
+    0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x50,0x69,0x6c,0x6c,0x73,0x28,
+    0x61,0x2c,0x20,0x69,0x64,0x78,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x77,0x72,0x61,0x70,0x20,
+    0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,0x29,0x3b,0x0a,0x66,0x6f,0x72,0x20,0x28,0x6c,0x65,
+    0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x37,0x3b,0x20,0x69,0x2b,0x2b,0x29,
+    0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x69,0x6c,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,
+    0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x73,
+    0x70,0x61,0x6e,0x22,0x29,0x3b,0x0a,0x70,0x69,0x6c,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,
+    0x65,0x20,0x3d,0x20,0x22,0x70,0x69,0x6c,0x6c,0x22,0x20,0x2b,0x20,0x28,0x61,0x2e,0x77,0x65,0x65,0x6b,
+    0x64,0x61,0x79,0x73,0x5b,0x69,0x5d,0x20,0x3f,0x20,0x22,0x20,0x6f,0x6e,0x22,0x20,0x3a,0x20,0x22,0x22,
+    0x29,0x3b,0x0a,0x70,0x69,0x6c,0x6c,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x44,0x41,0x59,0x53,0x5b,0x69,0x5d,0x3b,0x0a,0x70,0x69,0x6c,0x6c,0x2e,0x74,0x69,0x74,0x6c,
+    0x65,0x20,0x3d,0x20,0x5b,0x22,0x53,0x75,0x6e,0x22,0x2c,0x22,0x4d,0x6f,0x6e,0x22,0x2c,0x22,0x54,0x75,
+    0x65,0x22,0x2c,0x22,0x57,0x65,0x64,0x22,0x2c,0x22,0x54,0x68,0x75,0x22,0x2c,0x22,0x46,0x72,0x69,0x22,
+    0x2c,0x22,0x53,0x61,0x74,0x22,0x5d,0x5b,0x69,0x5d,0x3b,0x0a,0x70,0x69,0x6c,0x6c,0x2e,0x6f,0x6e,0x63,
+    0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,0x63,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x65,0x77,0x56,0x61,0x6c,0x20,0x3d,0x20,0x61,0x2e,0x77,0x65,
+    0x65,0x6b,0x64,0x61,0x79,0x73,0x2e,0x73,0x6c,0x69,0x63,0x65,0x28,0x29,0x3b,0x0a,0x6e,0x65,0x77,0x56,
+    0x61,0x6c,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x61,0x2e,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x5b,0x69,
+    0x5d,0x20,0x3f,0x20,0x30,0x20,0x3a,0x20,0x31,0x3b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x61,0x70,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x69,0x64,
+    0x78,0x2c,0x20,0x7b,0x20,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x3a,0x20,0x6e,0x65,0x77,0x56,0x61,
+    0x6c,0x20,0x7d,0x29,0x3b,0x0a,0x61,0x2e,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x73,0x20,0x3d,0x20,0x6e,
+    0x65,0x77,0x56,0x61,0x6c,0x3b,0x0a,0x70,0x69,0x6c,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4c,0x69,0x73,
+    0x74,0x2e,0x74,0x6f,0x67,0x67,0x6c,0x65,0x28,0x22,0x6f,0x6e,0x22,0x29,0x3b,0x0a,0x7d,0x20,0x63,0x61,
+    0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,0x6d,0x65,
+    0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x7d,0x0a,0x7d,0x3b,0x0a,0x77,0x72,0x61,0x70,0x2e,0x61,0x70,
+    0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x70,0x69,0x6c,0x6c,0x29,0x3b,0x0a,0x7d,0x0a,0x72,
+    0x65,0x74,0x75,0x72,0x6e,0x20,0x77,0x72,0x61,0x70,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x20,0x63,0x72,0x65,0x61,0x74,0x65,0x52,0x6f,0x77,0x28,0x61,0x2c,0x20,0x69,0x64,0x78,0x29,
+    0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+    0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x64,0x69,
+    0x76,0x22,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,
+    0x20,0x22,0x67,0x72,0x69,0x64,0x20,0x72,0x6f,0x77,0x22,0x3b,0x0a,0x2f,0x2f,0x20,0x45,0x6e,0x61,0x62,
+    0x6c,0x65,0x64,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x3b,0x0a,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,
+    0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x22,0x63,0x68,0x65,0x63,0x6b,0x62,0x6f,0x78,0x22,0x3b,0x0a,
+    0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,
+    0x22,0x65,0x6e,0x61,0x62,0x6c,0x65,0x54,0x6f,0x67,0x67,0x6c,0x65,0x22,0x3b,0x0a,0x65,0x6e,0x61,0x62,
+    0x6c,0x65,0x64,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x21,0x21,0x61,0x2e,0x65,0x6e,
+    0x61,0x62,0x6c,0x65,0x64,0x3b,0x0a,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x2e,0x6f,0x6e,0x63,0x68,0x61,
+    0x6e,0x67,0x65,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,0x63,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,
+    0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x61,0x70,0x69,0x55,0x70,0x64,0x61,0x74,
+    0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x69,0x64,0x78,0x2c,0x20,0x7b,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,
+    0x64,0x3a,0x20,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x7d,
+    0x29,0x3b,0x0a,0x61,0x2e,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x65,0x6e,0x61,0x62,0x6c,
+    0x65,0x64,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,
+    0x28,0x65,0x29,0x20,0x7b,0x0a,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,
+    0x64,0x20,0x3d,0x20,0x21,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,
+    0x3b,0x0a,0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x7d,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,
+    0x28,0x65,0x6e,0x61,0x62,0x6c,0x65,0x64,0x29,0x3b,0x0a,0x2f,0x2f,0x20,0x54,0x69,0x6d,0x65,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x74,0x69,0x6d,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+    0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x69,0x6e,0x70,0x75,
+    0x74,0x22,0x29,0x3b,0x0a,0x74,0x69,0x6d,0x65,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x22,0x74,0x69,
+    0x6d,0x65,0x22,0x3b,0x0a,0x74,0x69,0x6d,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,
+    0x74,0x69,0x6d,0x65,0x20,0x7c,0x7c,0x20,0x22,0x30,0x37,0x3a,0x30,0x30,0x22,0x3b,0x0a,0x74,0x69,0x6d,
+    0x65,0x2e,0x6f,0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,0x63,0x20,0x28,
+    0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x61,
+    0x70,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x69,0x64,0x78,0x2c,0x20,0x7b,
+    0x20,0x74,0x69,0x6d,0x65,0x3a,0x20,0x74,0x69,0x6d,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x7d,0x29,
+    0x3b,0x0a,0x61,0x2e,0x74,0x69,0x6d,0x65,0x20,0x3d,0x20,0x74,0x69,0x6d,0x65,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x20,0x61,0x6c,0x65,
+    0x72,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x74,0x69,0x6d,0x65,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x74,0x69,0x6d,0x65,0x3b,0x20,0x7d,0x0a,0x7d,0x3b,
+    0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x74,0x69,0x6d,
+    0x65,0x29,0x3b,0x0a,0x2f,0x2f,0x20,0x54,0x79,0x70,0x65,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x79,
+    0x70,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x73,0x65,0x6c,0x65,0x63,0x74,0x22,0x29,0x3b,0x0a,0x5b,
+    0x22,0x6d,0x70,0x33,0x22,0x2c,0x22,0x73,0x6f,0x75,0x6e,0x64,0x22,0x2c,0x22,0x72,0x61,0x64,0x69,0x6f,
+    0x22,0x5d,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x6f,0x70,0x74,0x20,0x3d,0x3e,0x20,0x7b,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,
+    0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x6f,0x70,0x74,0x69,0x6f,0x6e,
+    0x22,0x29,0x3b,0x0a,0x6f,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x70,0x74,0x3b,0x20,0x6f,
+    0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6f,0x70,0x74,0x3b,0x0a,
+    0x69,0x66,0x20,0x28,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x26,0x26,0x20,0x61,0x2e,0x61,0x63,
+    0x74,0x69,0x6f,0x6e,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x6f,0x70,0x74,0x29,0x20,0x6f,
+    0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x74,0x79,
+    0x70,0x65,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6f,0x29,0x3b,0x0a,0x7d,
+    0x29,0x3b,0x0a,0x74,0x79,0x70,0x65,0x2e,0x6f,0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x61,
+    0x73,0x79,0x6e,0x63,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,
+    0x77,0x61,0x69,0x74,0x20,0x61,0x70,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,
+    0x69,0x64,0x78,0x2c,0x20,0x7b,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x7b,0x20,0x74,0x79,0x70,
+    0x65,0x3a,0x20,0x74,0x79,0x70,0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x70,0x61,0x74,0x68,0x3a,
+    0x20,0x70,0x61,0x74,0x68,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x7d,0x20,0x7d,0x29,0x3b,0x0a,0x61,0x2e,
+    0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x74,0x79,0x70,0x65,0x2e,0x76,
+    0x61,0x6c,0x75,0x65,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x20,
+    0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x7d,0x0a,
+    0x7d,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x79,0x70,0x65,0x57,0x72,0x61,0x70,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,0x29,0x3b,0x0a,0x74,0x79,0x70,0x65,0x57,0x72,0x61,0x70,0x2e,
+    0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x22,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2d,
+    0x77,0x72,0x61,0x70,0x22,0x3b,0x0a,0x74,0x79,0x70,0x65,0x57,0x72,0x61,0x70,0x2e,0x61,0x70,0x70,0x65,
+    0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x74,0x79,0x70,0x65,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,
+    0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x74,0x79,0x70,0x65,0x57,0x72,0x61,0x70,0x29,
+    0x3b,0x0a,0x2f,0x2f,0x20,0x50,0x61,0x74,0x68,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x61,0x74,0x68,
+    0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,
+    0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x69,0x6e,0x70,0x75,0x74,0x22,0x29,0x3b,0x0a,0x70,0x61,0x74,0x68,
+    0x2e,0x74,0x79,0x70,0x65,0x20,0x3d,0x20,0x22,0x74,0x65,0x78,0x74,0x22,0x3b,0x0a,0x70,0x61,0x74,0x68,
+    0x2e,0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x20,0x3d,0x20,0x61,0x2e,0x61,0x63,0x74,
+    0x69,0x6f,0x6e,0x20,0x26,0x26,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x74,0x79,0x70,0x65,
+    0x20,0x3d,0x3d,0x3d,0x20,0x22,0x72,0x61,0x64,0x69,0x6f,0x22,0x20,0x3f,0x20,0x22,0x68,0x74,0x74,0x70,
+    0x3a,0x2f,0x2f,0x2e,0x2e,0x2e,0x22,0x20,0x3a,0x20,0x22,0x2f,0x6d,0x75,0x73,0x69,0x63,0x2f,0x66,0x69,
+    0x6c,0x65,0x2e,0x6d,0x70,0x33,0x22,0x3b,0x0a,0x70,0x61,0x74,0x68,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
+    0x3d,0x20,0x28,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x20,0x26,0x26,0x20,0x61,0x2e,0x61,0x63,0x74,
+    0x69,0x6f,0x6e,0x2e,0x70,0x61,0x74,0x68,0x29,0x20,0x7c,0x7c,0x20,0x22,0x22,0x3b,0x0a,0x70,0x61,0x74,
+    0x68,0x2e,0x6f,0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,0x63,0x20,0x28,
+    0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x61,
+    0x70,0x69,0x55,0x70,0x64,0x61,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x69,0x64,0x78,0x2c,0x20,0x7b,
+    0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x7b,0x20,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x79,0x70,
+    0x65,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x70,0x61,0x74,0x68,0x3a,0x20,0x70,0x61,0x74,0x68,0x2e,
+    0x76,0x61,0x6c,0x75,0x65,0x20,0x7d,0x20,0x7d,0x29,0x3b,0x0a,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,
+    0x2e,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x70,0x61,0x74,0x68,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,
+    0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x70,0x61,0x74,0x68,0x2e,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x2e,0x70,0x61,0x74,0x68,0x20,0x7c,
+    0x7c,0x20,0x22,0x22,0x3b,0x20,0x7d,0x0a,0x7d,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,
+    0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x70,0x61,0x74,0x68,0x29,0x3b,0x0a,0x2f,0x2f,0x20,0x57,0x65,0x65,
+    0x6b,0x64,0x61,0x79,0x73,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,
+    0x64,0x28,0x77,0x65,0x65,0x6b,0x64,0x61,0x79,0x50,0x69,0x6c,0x6c,0x73,0x28,0x61,0x2c,0x20,0x69,0x64,
+    0x78,0x29,0x29,0x3b,0x0a,0x2f,0x2f,0x20,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+    0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,
+    0x29,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,
+    0x20,0x3d,0x20,0x22,0x72,0x69,0x67,0x68,0x74,0x22,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,
+    0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x29,0x3b,0x0a,0x64,0x65,
+    0x6c,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x22,0xf0,0x9f,0x97,
+    0x91,0x20,0x44,0x65,0x6c,0x65,0x74,0x65,0x22,0x3b,0x0a,0x64,0x65,0x6c,0x2e,0x6f,0x6e,0x63,0x6c,0x69,
+    0x63,0x6b,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,0x63,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x69,
+    0x66,0x20,0x28,0x21,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x28,0x22,0x44,0x65,0x6c,0x65,0x74,0x65,0x20,
+    0x74,0x68,0x69,0x73,0x20,0x61,0x6c,0x61,0x72,0x6d,0x3f,0x22,0x29,0x29,0x20,0x72,0x65,0x74,0x75,0x72,
+    0x6e,0x3b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x61,0x70,0x69,0x44,0x65,
+    0x6c,0x65,0x74,0x65,0x41,0x6c,0x61,0x72,0x6d,0x28,0x69,0x64,0x78,0x29,0x3b,0x0a,0x61,0x77,0x61,0x69,
+    0x74,0x20,0x6c,0x6f,0x61,0x64,0x41,0x6e,0x64,0x52,0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x3b,0x0a,0x7d,
+    0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x7b,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,
+    0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x7d,0x0a,0x7d,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,
+    0x6e,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x64,0x65,0x6c,0x29,0x3b,
+    0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x61,0x63,0x74,
+    0x69,0x6f,0x6e,0x73,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x72,0x6f,0x77,0x3b,0x0a,0x7d,
+    0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,
+    0x41,0x6e,0x64,0x52,0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,
+    0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+    0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x61,0x6c,0x61,0x72,
+    0x6d,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,
+    0x6e,0x65,0x72,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x27,0x3c,0x64,0x69,
+    0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x75,0x74,0x65,0x64,0x22,0x3e,0x4c,0x6f,0x61,0x64,
+    0x69,0x6e,0x67,0xe2,0x80,0xa6,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x27,0x3b,0x0a,0x74,0x72,0x79,0x20,0x7b,
+    0x0a,0x41,0x4c,0x41,0x52,0x4d,0x53,0x20,0x3d,0x20,0x28,0x61,0x77,0x61,0x69,0x74,0x20,0x61,0x70,0x69,
+    0x47,0x65,0x74,0x41,0x6c,0x61,0x72,0x6d,0x73,0x28,0x29,0x29,0x20,0x7c,0x7c,0x20,0x5b,0x5d,0x3b,0x0a,
+    0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,
+    0x3d,0x20,0x22,0x22,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x41,0x4c,0x41,0x52,0x4d,0x53,0x2e,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,0x6d,0x70,0x74,0x79,0x20,0x3d,
+    0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,
+    0x65,0x6e,0x74,0x28,0x22,0x64,0x69,0x76,0x22,0x29,0x3b,0x0a,0x65,0x6d,0x70,0x74,0x79,0x2e,0x63,0x6c,
+    0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x22,0x6d,0x75,0x74,0x65,0x64,0x22,0x3b,0x0a,0x65,
+    0x6d,0x70,0x74,0x79,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x22,
+    0x4e,0x6f,0x20,0x61,0x6c,0x61,0x72,0x6d,0x73,0x20,0x79,0x65,0x74,0x2e,0x20,0x43,0x6c,0x69,0x63,0x6b,
+    0x20,0xe2,0x80,0x9c,0xef,0xbc,0x8b,0x20,0x41,0x64,0x64,0x20,0x61,0x6c,0x61,0x72,0x6d,0xe2,0x80,0x9d,
+    0x2e,0x22,0x3b,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+    0x43,0x68,0x69,0x6c,0x64,0x28,0x65,0x6d,0x70,0x74,0x79,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,
+    0x3b,0x0a,0x7d,0x0a,0x41,0x4c,0x41,0x52,0x4d,0x53,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x28,
+    0x61,0x2c,0x20,0x69,0x64,0x78,0x29,0x20,0x3d,0x3e,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
+    0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x63,0x72,0x65,0x61,0x74,0x65,0x52,
+    0x6f,0x77,0x28,0x61,0x2c,0x20,0x69,0x64,0x78,0x29,0x29,0x29,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,
+    0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x69,0x6e,
+    0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x27,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x6d,0x75,0x74,0x65,0x64,0x22,0x3e,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,
+    0x6c,0x6f,0x61,0x64,0x20,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x27,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x77,0x61,0x72,0x6e,0x28,0x65,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x64,0x64,
+    0x4e,0x65,0x77,0x41,0x6c,0x61,0x72,0x6d,0x28,0x29,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x61,0x20,
+    0x3d,0x20,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x41,0x6c,0x61,0x72,0x6d,0x28,0x29,0x3b,0x0a,0x74,0x72,
+    0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x61,0x70,0x69,0x41,0x64,0x64,0x41,0x6c,0x61,0x72,
+    0x6d,0x28,0x61,0x29,0x3b,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,0x41,0x6e,0x64,0x52,
+    0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,
+    0x7b,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,
+    0x7d,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,
+    0x65,0x6c,0x6f,0x61,0x64,0x46,0x72,0x6f,0x6d,0x44,0x69,0x73,0x6b,0x28,0x29,0x7b,0x0a,0x69,0x66,0x20,
+    0x28,0x21,0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x28,0x22,0x52,0x65,0x6c,0x6f,0x61,0x64,0x20,0x66,0x72,
+    0x6f,0x6d,0x20,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,0x6a,0x73,0x6f,0x6e,0x20,0x6f,0x6e,0x20,0x53,
+    0x44,0x3f,0x20,0x55,0x6e,0x73,0x61,0x76,0x65,0x64,0x20,0x63,0x68,0x61,0x6e,0x67,0x65,0x73,0x20,0x69,
+    0x6e,0x20,0x52,0x41,0x4d,0x20,0x77,0x69,0x6c,0x6c,0x20,0x62,0x65,0x20,0x6c,0x6f,0x73,0x74,0x2e,0x22,
+    0x29,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x61,0x70,0x69,0x52,0x65,0x6c,0x6f,0x61,0x64,0x28,0x29,0x3b,0x0a,0x61,0x77,0x61,0x69,
+    0x74,0x20,0x6c,0x6f,0x61,0x64,0x41,0x6e,0x64,0x52,0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x3b,0x0a,0x7d,
+    0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x7b,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x65,0x2e,
+    0x6d,0x65,0x73,0x73,0x61,0x67,0x65,0x29,0x3b,0x20,0x7d,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x52,0x65,0x6c,
+    0x6f,0x61,0x64,0x20,0x77,0x68,0x65,0x6e,0x20,0x74,0x68,0x65,0x20,0x6c,0x69,0x73,0x74,0x20,0x63,0x68,
+    0x61,0x6e,0x67,0x65,0x73,0x20,0x65,0x6c,0x73,0x65,0x77,0x68,0x65,0x72,0x65,0x20,0x28,0x74,0x6f,0x75,
+    0x63,0x68,0x20,0x73,0x63,0x72,0x65,0x65,0x6e,0x2c,0x20,0x61,0x6e,0x6f,0x74,0x68,0x65,0x72,0x20,0x62,
+    0x72,0x6f,0x77,0x73,0x65,0x72,0x29,0x0a,0x6c,0x65,0x74,0x20,0x61,0x6c,0x61,0x72,0x6d,0x52,0x65,0x76,
+    0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x77,0x61,
+    0x74,0x63,0x68,0x41,0x6c,0x61,0x72,0x6d,0x73,0x28,0x29,0x7b,0x0a,0x69,0x66,0x20,0x28,0x21,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x2e,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x29,0x20,0x72,0x65,
+    0x74,0x75,0x72,0x6e,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,0x76,0x65,0x6e,0x74,0x73,0x20,0x3d,
+    0x20,0x6e,0x65,0x77,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x28,0x22,0x2f,0x65,
+    0x76,0x65,0x6e,0x74,0x73,0x22,0x29,0x3b,0x0a,0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x61,0x64,0x64,0x45,
+    0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x61,0x6c,0x61,0x72,0x6d,0x22,
+    0x2c,0x20,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x20,0x3d,0x20,0x4a,
+    0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x69,
+    0x66,0x20,0x28,0x61,0x6c,0x61,0x72,0x6d,0x52,0x65,0x76,0x20,0x21,0x3d,0x3d,0x20,0x6e,0x75,0x6c,0x6c,
+    0x20,0x26,0x26,0x20,0x64,0x2e,0x72,0x65,0x76,0x20,0x21,0x3d,0x3d,0x20,0x61,0x6c,0x61,0x72,0x6d,0x52,
+    0x65,0x76,0x29,0x20,0x6c,0x6f,0x61,0x64,0x41,0x6e,0x64,0x52,0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x3b,
+    0x0a,0x61,0x6c,0x61,0x72,0x6d,0x52,0x65,0x76,0x20,0x3d,0x20,0x64,0x2e,0x72,0x65,0x76,0x3b,0x0a,0x7d,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,
+    0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x22,0x44,0x4f,0x4d,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,
+    0x4c,0x6f,0x61,0x64,0x65,0x64,0x22,0x2c,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x6c,0x6f,0x61,
+    0x64,0x41,0x6e,0x64,0x52,0x65,0x6e,0x64,0x65,0x72,0x28,0x29,0x3b,0x0a,0x77,0x61,0x74,0x63,0x68,0x41,
+    0x6c,0x61,0x72,0x6d,0x73,0x28,0x29,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,
+    0x74,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+constexpr uint8_t file_explorer_html_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x58,0x5b,0x6f,0xdc,0x44,0x14,0x7e,0xdf,0x5f,
+    0x31,0xb5,0xaa,0xda,0x16,0xbb,0x76,0xc3,0x45,0x42,0xe9,0xee,0x56,0xcd,0x8d,0x46,0x24,0x6d,0xd4,0x24,
+    0x42,0xa8,0x54,0xcd,0xac,0x3d,0x9b,0x1d,0xe2,0xf5,0x58,0xe3,0xd9,0x6c,0x97,0x90,0x07,0x5e,0xca,0x13,
+    0x42,0x08,0x24,0x5e,0x90,0x78,0xe1,0x09,0xf1,0xc8,0x2f,0xe2,0x17,0xf0,0x13,0x38,0x67,0x2e,0xbe,0x24,
+    0x9b,0x74,0x29,0x42,0xa0,0xaa,0x1b,0x7b,0xe6,0x9b,0x39,0xb7,0xef,0x9c,0x39,0xe3,0xfe,0x9d,0xad,0xa7,
+    0x9b,0x47,0x9f,0x1e,0x6c,0x93,0x89,0x9a,0x66,0xc3,0x4e,0x1f,0xff,0x90,0x8c,0xe6,0xa7,0x03,0x8f,0xe5,
+    0x1e,0x0e,0x30,0x9a,0xc2,0x9f,0x29,0x53,0x94,0x24,0x13,0x2a,0x4b,0xa6,0x06,0xde,0xf1,0xd1,0x4e,0xef,
+    0x43,0x9c,0x55,0x5c,0x65,0x6c,0xb8,0x7d,0x78,0xf0,0xde,0xbb,0xbd,0xc3,0xf7,0xc8,0x0e,0xcf,0x18,0xd9,
+    0x7e,0x55,0x64,0x42,0x32,0xd9,0x8f,0xcd,0x6c,0xa7,0x9f,0xf1,0xfc,0x8c,0x48,0x96,0x0d,0xbc,0x52,0x2d,
+    0x32,0x56,0x4e,0x18,0x53,0x1e,0x99,0x48,0x36,0xb6,0x23,0x51,0x52,0x96,0xb8,0x5d,0x6c,0xa5,0x8d,0x44,
+    0xba,0x80,0x3f,0x39,0x3d,0x87,0x5f,0x6a,0x91,0xb1,0x37,0x7c,0x2c,0xa6,0xac,0x1f,0xd3,0xe6,0x20,0xcf,
+    0x15,0x93,0x39,0x53,0x2f,0x25,0x4d,0xb9,0x88,0x50,0x7f,0x6f,0xb8,0x6b,0x07,0xc9,0x33,0x1c,0x74,0x2b,
+    0x92,0x8c,0x96,0xe5,0xc0,0xa3,0x89,0xe2,0xe7,0xcc,0xc9,0x8f,0xc7,0xa0,0xf3,0x4b,0x66,0x75,0xb6,0xeb,
+    0xaf,0xd8,0xd1,0x12,0x48,0x33,0x2a,0xa7,0xa5,0x05,0x3e,0xd2,0x2f,0x06,0x11,0x1b,0x75,0x27,0x6b,0xc3,
+    0x3f,0x7f,0xfe,0xfe,0x2b,0xe2,0x9c,0xd2,0x3b,0x12,0xb3,0x64,0xd2,0xdb,0xdb,0xdc,0xea,0xad,0x45,0x1f,
+    0x7e,0xb0,0x79,0xd5,0x49,0x80,0xef,0xf4,0x53,0x7e,0xee,0xd4,0x53,0x42,0x64,0x23,0x2a,0xd1,0x1d,0xa3,
+    0x99,0x52,0x22,0x27,0x22,0x4f,0x32,0x9e,0x9c,0x0d,0xbc,0x53,0x71,0x5c,0x04,0xa1,0x37,0xfc,0xe3,0xb7,
+    0xd7,0xe4,0x23,0x41,0x8e,0x8b,0x7e,0x6c,0x20,0x4b,0xb0,0x89,0x64,0x54,0xb1,0x1d,0x91,0xa5,0x4c,0xe2,
+    0x1a,0xad,0xd3,0x13,0x36,0x27,0x66,0xa8,0xb1,0x92,0xe7,0xc5,0x4c,0x11,0xb5,0x28,0xd8,0xc0,0x43,0x67,
+    0x78,0x84,0xa7,0xe6,0x69,0x17,0x67,0x96,0x29,0x32,0x03,0xe5,0x69,0x8a,0x86,0x68,0x75,0x7e,0xf9,0x1d,
+    0x74,0xc1,0x91,0xc6,0xae,0x31,0x98,0xd4,0x36,0xac,0xa0,0x6a,0xd2,0x4b,0x79,0x59,0x64,0x74,0x61,0x64,
+    0x24,0x33,0x29,0x59,0xae,0x0e,0x60,0x62,0xcb,0x8e,0x0f,0xe3,0x25,0x2b,0x01,0x23,0x17,0x04,0xb9,0xc1,
+    0xb4,0x5f,0x10,0xf0,0x84,0x22,0x15,0xf0,0x49,0xbf,0x1e,0xf2,0x2f,0x9a,0xaf,0x8f,0x20,0xc6,0x22,0x2f,
+    0x1b,0x23,0x5b,0x2c,0x63,0x8a,0xb9,0xcd,0x1b,0x32,0x9c,0xb1,0x7b,0xbc,0x04,0x5b,0xdd,0x4c,0x99,0x48,
+    0x5e,0xa8,0x61,0x07,0x16,0x91,0x86,0x9a,0x64,0x40,0x52,0x96,0x88,0x94,0x1d,0x3f,0xdb,0xdd,0x14,0xd3,
+    0x42,0xe4,0x30,0x11,0xe4,0xe0,0xd6,0xe3,0x67,0x7b,0x87,0x8c,0xca,0x64,0x72,0x40,0x25,0x9d,0x96,0xc1,
+    0x9c,0xe7,0xa9,0x98,0x47,0x99,0x48,0x28,0xaa,0x12,0x95,0x7a,0x32,0x8c,0x4e,0x99,0x0a,0x7c,0x74,0x85,
+    0x1f,0x92,0x2f,0xbf,0x24,0x7e,0xec,0x87,0x0f,0x3a,0xe3,0x59,0xae,0x15,0x26,0xb3,0x22,0x85,0xa8,0xa1,
+    0xa4,0xdd,0x1c,0x76,0x0c,0x42,0x72,0xd1,0x49,0xc0,0x10,0x45,0x66,0x32,0x03,0xe1,0x56,0xd2,0xb5,0xdd,
+    0x91,0x9b,0xb0,0x0f,0x80,0xac,0x20,0xa3,0x05,0xbc,0x38,0x69,0xdd,0xa6,0x19,0x00,0xb5,0x3b,0x4c,0xc0,
+    0x6a,0x21,0x17,0x91,0x64,0xe0,0xfe,0x84,0x1d,0x2a,0x10,0x1f,0x5c,0x5c,0x76,0x89,0x0f,0x2b,0x60,0x3b,
+    0x40,0x5e,0xd6,0xea,0x8d,0x85,0x9c,0x52,0xb5,0xb1,0x50,0xac,0x0c,0x46,0xf8,0x8b,0xfa,0xf1,0x31,0x31,
+    0x2f,0x64,0x30,0x18,0x90,0xfb,0x21,0x64,0xba,0x9a,0xc9,0x9c,0xf8,0xf7,0xc9,0x86,0xff,0xc0,0xaa,0x7f,
+    0x06,0xca,0xaf,0xdd,0x7f,0xf7,0x7d,0xf7,0x3e,0xcb,0xb9,0x82,0x05,0xe4,0xb9,0xbf,0x01,0x82,0xfc,0x8f,
+    0xf5,0xef,0xbe,0xfe,0xfd,0x68,0xc3,0x7f,0xe1,0x60,0x1c,0x20,0xfb,0xa0,0x70,0x34,0xce,0x84,0x90,0x81,
+    0x7e,0xcc,0xc4,0xa9,0x13,0x1e,0x93,0x6a,0xe4,0x2c,0x04,0x55,0xad,0xe4,0x02,0xcb,0xd4,0x0e,0x10,0x52,
+    0x05,0x56,0x33,0x0b,0x2c,0xc4,0x3c,0x38,0xeb,0x12,0x1e,0x86,0x91,0x12,0x3b,0xfc,0x15,0x4b,0x83,0xb5,
+    0x30,0x24,0xef,0x10,0x1f,0xfe,0xbd,0x63,0x94,0x7a,0xce,0x5f,0xb4,0x6c,0x36,0x49,0x57,0xc5,0x01,0xf6,
+    0xd6,0x8a,0x37,0xbc,0x19,0x01,0x75,0x39,0xf8,0x19,0x42,0x19,0x01,0x93,0xa0,0xf4,0x04,0x1b,0x90,0xc4,
+    0x8c,0xe6,0xa0,0x92,0xc6,0x83,0x60,0xd8,0x03,0x8c,0x6a,0x31,0x09,0x16,0x80,0x50,0x03,0xf8,0x5c,0xf0,
+    0x3c,0x30,0x64,0xb8,0xc6,0x81,0x07,0x1d,0x97,0x6d,0x65,0xa0,0xe3,0x41,0xcb,0x45,0x9e,0x90,0x4a,0xc3,
+    0xc6,0x2c,0xa8,0xb9,0x64,0x79,0x2a,0x92,0xd9,0x14,0xe4,0x22,0xf9,0xb6,0x33,0x86,0x8f,0x1b,0x8b,0xdd,
+    0x34,0xf0,0xaf,0x27,0x20,0x98,0xc0,0xf3,0x9c,0xc9,0x23,0xf6,0x4a,0xb5,0xad,0x74,0x21,0x91,0x18,0x68,
+    0x42,0xe7,0x94,0x2b,0x32,0x66,0x2a,0x99,0x04,0x27,0x71,0x06,0x2c,0xc2,0x1c,0x2a,0x1f,0xea,0x32,0xf2,
+    0x79,0x29,0xf2,0x7b,0xc8,0xba,0xc1,0xdd,0x0b,0x96,0x5f,0x4b,0x97,0x26,0x11,0x2f,0x4f,0xc2,0x2a,0xd6,
+    0x8a,0x4d,0xeb,0xad,0x41,0x4c,0x84,0xfb,0x04,0xd5,0x3c,0xfc,0x2a,0xca,0x41,0x37,0x4c,0xc2,0x9b,0x2c,
+    0x72,0x99,0xec,0x9b,0x65,0x66,0x81,0x31,0xe9,0xf1,0xd1,0xfe,0x1e,0x7a,0x1d,0x38,0x19,0xc7,0xe4,0x50,
+    0x48,0x2b,0x72,0x9d,0xa4,0x5c,0xb2,0x04,0xd2,0x80,0x83,0x69,0x63,0x2e,0x4b,0xd5,0x25,0x6a,0xc2,0x80,
+    0xee,0x68,0x52,0x97,0x8c,0x04,0x84,0x8b,0x66,0xc5,0x84,0x8e,0x98,0xe2,0x09,0xcd,0xb2,0x45,0x47,0xaf,
+    0x8c,0x4a,0xd8,0x24,0x08,0x28,0x40,0x42,0x32,0x18,0xda,0x5c,0xa0,0x11,0x2f,0xb7,0xb8,0x24,0xf7,0xee,
+    0x91,0x3b,0x23,0xf3,0x5c,0xe5,0x44,0x6f,0xed,0x81,0xc6,0xdc,0x69,0x80,0xae,0x62,0xd6,0x2a,0x1e,0xd3,
+    0x28,0x87,0x2a,0xa7,0xb3,0x3c,0x63,0xe8,0x3f,0x2a,0x59,0x30,0xd2,0x83,0xc8,0x03,0xf8,0x6f,0xd4,0x80,
+    0xb4,0xdc,0xa6,0x10,0x08,0x7c,0x33,0x7a,0xd8,0x50,0x89,0x79,0xd3,0x57,0xe6,0x48,0xb0,0xee,0x0a,0x7c,
+    0x28,0x74,0xe8,0x25,0x00,0x45,0xba,0xce,0x62,0x45,0x45,0xff,0xe8,0x6a,0x6b,0x9c,0xb4,0xa9,0x57,0x10,
+    0x14,0x68,0xb7,0xc4,0xc7,0x4d,0x96,0x65,0x6f,0xde,0xd7,0x21,0xdb,0x9b,0xe3,0xa8,0xdf,0x98,0x6c,0x92,
+    0x0d,0xd5,0xd7,0xc6,0x19,0x1f,0xe9,0x57,0xeb,0x9a,0x8b,0x7a,0x85,0x69,0x18,0xc6,0x10,0xdb,0x4f,0x18,
+    0x3f,0x9d,0xe0,0x42,0x7f,0x04,0x67,0x5a,0x73,0x57,0xdb,0x54,0xcc,0x24,0x04,0x08,0xe7,0x0b,0xa1,0xdb,
+    0x84,0x26,0xc4,0x9e,0x65,0x30,0x1b,0xd8,0xd8,0xb5,0x93,0xb3,0x99,0xdf,0xb6,0x38,0x06,0xf1,0x67,0xf1,
+    0xdd,0x18,0x4b,0xa3,0x2e,0x19,0x3a,0x7b,0x1b,0x3a,0xb7,0x93,0x14,0xf3,0xb4,0xf6,0x60,0x09,0xc7,0x93,
+    0xf5,0x20,0x3e,0xae,0xe6,0x41,0x87,0x6c,0x7b,0x10,0x47,0xfd,0xc6,0xe4,0x35,0x0f,0x1a,0x62,0x3d,0x24,
+    0x7e,0xcf,0x27,0xeb,0xad,0x92,0xad,0xa7,0x71,0x61,0x95,0x53,0x54,0x57,0x90,0xd5,0xd4,0xa9,0xb1,0x6d,
+    0x85,0x14,0x1d,0x65,0xac,0x67,0x66,0xcb,0x16,0x6f,0xc0,0x81,0x88,0x31,0x3d,0x41,0x55,0x3e,0x70,0x6c,
+    0x43,0xe5,0xb7,0x08,0x34,0x0b,0x34,0x39,0x1d,0xba,0x65,0xa6,0xff,0xc7,0x4f,0xdf,0x92,0x67,0xcc,0x72,
+    0xa9,0xc6,0x2c,0x89,0xa9,0x96,0x09,0xec,0x78,0xeb,0xa8,0x5a,0xda,0xb3,0xb9,0x35,0xb7,0x90,0x90,0x87,
+    0x2a,0xf0,0xb0,0x95,0x42,0xc4,0xba,0xd7,0xad,0xe1,0xa1,0xcd,0x6e,0x07,0x87,0x03,0xbe,0x5a,0x39,0x68,
+    0x10,0xdc,0xe5,0x7a,0x63,0xfb,0xbf,0xa7,0xa0,0xdd,0x15,0x3a,0x07,0x5d,0x81,0xbd,0x78,0x2a,0xa0,0xa5,
+    0xed,0x82,0xc5,0xd0,0xa8,0x4f,0x44,0xba,0x4e,0xbc,0x83,0xa7,0x87,0x47,0x5e,0xb7,0x63,0xba,0x26,0x28,
+    0x72,0x17,0xc4,0xdb,0x84,0xa4,0x81,0xcd,0x7b,0x47,0x50,0xa4,0x3d,0x80,0xd0,0x02,0x0e,0x2e,0xd3,0x41,
+    0xc4,0xaf,0x7a,0xf3,0xf9,0xbc,0x87,0x6c,0xe9,0xc1,0xb1,0x6f,0xaa,0x76,0xea,0x91,0xcb,0x6e,0x07,0x9b,
+    0xf1,0x75,0x72,0x32,0x06,0xc3,0x97,0xd7,0x73,0xeb,0xde,0xf0,0xf2,0x9e,0x12,0xcb,0x11,0xd6,0x3e,0xa8,
+    0xf6,0x50,0xb5,0x22,0xac,0xad,0x81,0x89,0x50,0x23,0x67,0x4c,0xd2,0x34,0x48,0x06,0xda,0xb1,0x3c,0xdd,
+    0x9c,0xf0,0x2c,0x0d,0xaa,0x18,0x3b,0x0f,0xb7,0x8b,0x43,0x4d,0x39,0xe8,0x69,0x72,0xdc,0xb4,0x4d,0x3a,
+    0x37,0xba,0x2a,0xed,0x1a,0xf8,0x2b,0xc4,0xfb,0xed,0x6b,0xb2,0x65,0x27,0xfd,0x36,0xee,0x26,0xf2,0x8d,
+    0x67,0x59,0xf6,0x0f,0xd9,0x47,0x6f,0x51,0x9a,0xea,0xd4,0xd4,0x0d,0x20,0xa0,0x4e,0x62,0xa7,0xd2,0xc3,
+    0x9b,0xcf,0x5f,0xa7,0x11,0x84,0x03,0x97,0x56,0x2e,0x6b,0x55,0xe0,0x4a,0x1e,0x86,0xbf,0x15,0x0b,0xaa,
+    0x05,0x6a,0x63,0x5b,0xcd,0x85,0x06,0x4a,0x86,0x4c,0xac,0x81,0x37,0x87,0xb4,0xe1,0xbb,0xb0,0x59,0x34,
+    0x0a,0xc9,0xce,0x39,0x24,0x57,0x2b,0x80,0x76,0x70,0xd5,0xf8,0xd5,0xf0,0x76,0xf8,0xfe,0xfc,0xf9,0x87,
+    0x6f,0xc8,0x81,0x99,0xf4,0x5b,0xb0,0x7f,0x25,0x7a,0xb6,0xc7,0x16,0x60,0x34,0x34,0x49,0x56,0xda,0x6a,
+    0x81,0x81,0x3d,0x5f,0x8e,0xe0,0x1e,0x7e,0xe6,0xdf,0xea,0xc4,0xda,0x02,0x84,0x11,0x96,0x95,0xac,0x52,
+    0x1d,0x03,0xb1,0xaa,0xc3,0x2c,0xf6,0x0a,0xd9,0x5f,0xff,0x4a,0xf6,0x61,0x82,0x3c,0x66,0x12,0x0b,0xad,
+    0x03,0xdd,0xe4,0x2b,0x45,0x25,0xb4,0x63,0x78,0xf8,0xbc,0x3d,0xd5,0x4b,0x99,0x34,0x8a,0xac,0xbe,0x2a,
+    0x2b,0xa1,0x4d,0x59,0xf7,0x6c,0xee,0x03,0xa4,0x6e,0xc7,0xb1,0x2a,0xad,0x2e,0x0e,0x96,0x3a,0x41,0xb0,
+    0xeb,0xa0,0xa1,0x71,0x0b,0xf1,0x7f,0x28,0xaa,0x38,0x73,0x4b,0x45,0x55,0xe2,0x8d,0xc5,0xf4,0x16,0xda,
+    0xd8,0x48,0x86,0xed,0x26,0x25,0xd5,0x57,0xe4,0x2b,0x95,0x53,0x8f,0xad,0xd6,0x20,0x54,0x2b,0x56,0x2e,
+    0xb3,0x1a,0x7a,0x35,0x45,0x7f,0xfc,0x8e,0x98,0xcb,0xba,0x5f,0x21,0x6e,0x62,0x5c,0xf1,0xb6,0x99,0x89,
+    0x3c,0x82,0x2d,0xa0,0xd9,0x9f,0x06,0x27,0x8f,0x24,0x23,0x0b,0x31,0x23,0xe5,0xcc,0x3e,0xcc,0x69,0xae,
+    0x09,0x62,0x1d,0xe2,0xdd,0xbd,0xa8,0x96,0x5e,0x7a,0x0f,0x4f,0x42,0xa4,0x9f,0xe3,0x88,0xc1,0xfc,0xbb,
+    0x2c,0xb9,0xb9,0x62,0x14,0xab,0x9c,0xaa,0x48,0x84,0x3a,0x8e,0xed,0x22,0xac,0xfd,0x6b,0x6f,0x01,0xcd,
+    0x09,0xd7,0x27,0x2f,0x99,0x72,0x9d,0xe7,0x92,0xa9,0x9a,0x6e,0x4b,0x26,0x6b,0x15,0x5a,0x77,0xb3,0xd6,
+    0x31,0x2f,0xe6,0xf6,0x62,0x73,0xd9,0xfc,0x26,0x52,0x7f,0x6c,0xaa,0xf3,0xde,0x7d,0x9e,0x7a,0xd3,0x65,
+    0x50,0x83,0x7c,0xd7,0x36,0x54,0x23,0x91,0xbe,0xdb,0x45,0xe0,0xed,0x53,0xf0,0xa0,0xbb,0x7a,0xc1,0x35,
+    0x0b,0x2e,0x74,0xde,0x21,0x68,0x9a,0xe0,0xb1,0x8b,0x20,0x73,0x23,0x8c,0xbc,0x8a,0xe0,0x18,0xa8,0x2d,
+    0xaa,0xa8,0xfd,0x1c,0xb3,0x63,0x5f,0xf1,0x2c,0x74,0x53,0xd6,0x28,0xa3,0x81,0xdf,0x25,0x57,0xc4,0x3e,
+    0xbf,0xff,0x62,0x19,0x78,0xe9,0x77,0x1a,0xc3,0x33,0x3f,0x36,0x5e,0x80,0xe9,0x0b,0xe2,0x78,0xe6,0x23,
+    0xcf,0x7c,0xbc,0x9f,0x22,0x4b,0x2a,0xb5,0x2e,0xc3,0x8e,0x21,0x03,0x5c,0xa1,0x0b,0xa4,0x03,0xfe,0x8d,
+    0x14,0xe4,0x17,0xd0,0xc1,0x4e,0x69,0x43,0xdd,0x4b,0x45,0x97,0xb6,0xdf,0xdb,0x5f,0x10,0x2b,0xcf,0xe7,
+    0xd7,0xfb,0xe0,0xb1,0xc6,0xd8,0x76,0xb8,0xea,0x81,0x97,0xf4,0xb9,0x7f,0xff,0x34,0xcd,0xdb,0x5d,0xee,
+    0x19,0x5c,0xd5,0xff,0xab,0x5c,0x6b,0x9c,0xce,0x9d,0x7f,0xe8,0x63,0xdb,0x18,0xd0,0x34,0xdd,0x3e,0x87,
+    0xad,0xf1,0x83,0x05,0x83,0x5c,0x08,0xfc,0xad,0xa7,0xfb,0x56,0xfb,0x3d,0x58,0xc0,0x30,0xde,0xcd,0x95,
+    0xfd,0xd8,0x7d,0x97,0xec,0xc7,0xf6,0x1b,0x79,0xac,0x3f,0xdc,0xff,0x05,0x4b,0x7e,0x87,0xda,0xc8,0x17,
+    0x00,0x00,
+};
+
+constexpr uint8_t file_explorer_html_raw[] = {
+    0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x3c,0x68,0x74,0x6d,
+    0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,
+    0x22,0x3e,0x0a,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,0x20,0x46,
+    0x69,0x6c,0x65,0x20,0x45,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,
+    0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,
+    0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x22,
+    0x3e,0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x6e,0x61,
+    0x76,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,0x6f,0x6d,0x65,0x3c,
+    0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x69,0x6e,0x74,0x65,0x72,0x6e,
+    0x65,0x74,0x5f,0x72,0x61,0x64,0x69,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x49,0x6e,0x74,0x65,0x72,
+    0x6e,0x65,0x74,0x20,0x52,0x61,0x64,0x69,0x6f,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x63,0x6c,0x61,
+    0x73,0x73,0x3d,0x22,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x66,
+    0x69,0x6c,0x65,0x5f,0x65,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x46,
+    0x69,0x6c,0x65,0x20,0x45,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,
+    0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,
+    0x41,0x6c,0x61,0x72,0x6d,0x73,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x2f,0x6e,0x61,0x76,0x3e,0x0a,0x3c,0x68,
+    0x31,0x3e,0xf0,0x9f,0x93,0x81,0x20,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,0x2d,0x54,0x6f,0x75,0x63,
+    0x68,0x2d,0x4c,0x43,0x44,0x2d,0x31,0x2e,0x38,0x35,0x43,0x20,0x46,0x69,0x6c,0x65,0x20,0x45,0x78,0x70,
+    0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x22,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,
+    0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x67,0x6f,0x55,0x70,0x28,0x29,0x22,0x3e,0xe2,0xac,
+    0x86,0x20,0x47,0x6f,0x20,0x55,0x70,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x63,0x72,0x65,0x61,0x74,0x65,
+    0x46,0x6f,0x6c,0x64,0x65,0x72,0x28,0x29,0x22,0x3e,0xf0,0x9f,0x93,0x81,0x20,0x4e,0x65,0x77,0x20,0x46,
+    0x6f,0x6c,0x64,0x65,0x72,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,
+    0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,0x22,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,
+    0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x22,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,
+    0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x28,0x29,0x22,
+    0x3e,0xe2,0xa4,0xb4,0x20,0x55,0x70,0x6c,0x6f,0x61,0x64,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,
+    0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+    0x70,0x61,0x74,0x68,0x2d,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x22,0x20,0x69,0x64,0x3d,0x22,0x63,0x75,
+    0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x22,0x3e,0x2f,0x3c,
+    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x65,0x6e,
+    0x74,0x72,0x79,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,0x4e,0x61,
+    0x6d,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x3e,0x53,0x69,0x7a,0x65,0x3c,0x2f,0x64,
+    0x69,0x76,0x3e,0x3c,0x64,0x69,0x76,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x64,0x69,0x76,
+    0x3e,0x3c,0x64,0x69,0x76,0x3e,0x44,0x65,0x6c,0x65,0x74,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,
+    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,0x6c,0x65,0x4c,
+    0x69,0x73,0x74,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,
+    0x0a,0x6c,0x65,0x74,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x20,0x3d,0x20,0x64,
+    0x65,0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x6e,0x65,
+    0x77,0x20,0x55,0x52,0x4c,0x53,0x65,0x61,0x72,0x63,0x68,0x50,0x61,0x72,0x61,0x6d,0x73,0x28,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x2e,0x6c,0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x73,0x65,0x61,0x72,0x63,0x68,
+    0x29,0x2e,0x67,0x65,0x74,0x28,0x27,0x70,0x61,0x74,0x68,0x27,0x29,0x20,0x7c,0x7c,0x20,0x27,0x2f,0x27,
+    0x29,0x3b,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x61,
+    0x74,0x68,0x49,0x6e,0x55,0x52,0x4c,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x72,
+    0x6c,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x55,0x52,0x4c,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x6c,
+    0x6f,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x68,0x72,0x65,0x66,0x29,0x3b,0x0a,0x75,0x72,0x6c,0x2e,0x73,
+    0x65,0x61,0x72,0x63,0x68,0x50,0x61,0x72,0x61,0x6d,0x73,0x2e,0x73,0x65,0x74,0x28,0x27,0x70,0x61,0x74,
+    0x68,0x27,0x2c,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x29,0x3b,0x0a,0x77,0x69,
+    0x6e,0x64,0x6f,0x77,0x2e,0x68,0x69,0x73,0x74,0x6f,0x72,0x79,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,
+    0x53,0x74,0x61,0x74,0x65,0x28,0x7b,0x7d,0x2c,0x20,0x27,0x27,0x2c,0x20,0x75,0x72,0x6c,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x42,0x79,0x74,
+    0x65,0x73,0x28,0x62,0x79,0x74,0x65,0x73,0x29,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x62,0x79,0x74,0x65,
+    0x73,0x20,0x3d,0x3d,0x3d,0x20,0x30,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x27,0x30,0x20,0x42,
+    0x27,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6b,0x20,0x3d,0x20,0x31,0x30,0x32,0x34,0x3b,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x75,0x6e,0x69,0x74,0x73,0x20,0x3d,0x20,0x5b,0x27,0x42,0x27,0x2c,0x20,0x27,
+    0x4b,0x42,0x27,0x2c,0x20,0x27,0x4d,0x42,0x27,0x2c,0x20,0x27,0x47,0x42,0x27,0x5d,0x3b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x69,0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x4d,
+    0x61,0x74,0x68,0x2e,0x6c,0x6f,0x67,0x28,0x62,0x79,0x74,0x65,0x73,0x29,0x20,0x2f,0x20,0x4d,0x61,0x74,
+    0x68,0x2e,0x6c,0x6f,0x67,0x28,0x6b,0x29,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x70,0x61,
+    0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x28,0x62,0x79,0x74,0x65,0x73,0x20,0x2f,0x20,0x4d,0x61,
+    0x74,0x68,0x2e,0x70,0x6f,0x77,0x28,0x6b,0x2c,0x20,0x69,0x29,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,
+    0x64,0x28,0x31,0x29,0x29,0x20,0x2b,0x20,0x27,0x20,0x27,0x20,0x2b,0x20,0x75,0x6e,0x69,0x74,0x73,0x5b,
+    0x69,0x5d,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x67,0x6f,0x55,0x70,0x28,
+    0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x61,0x72,0x74,0x73,0x20,0x3d,0x20,0x63,0x75,
+    0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x73,0x70,0x6c,0x69,0x74,0x28,0x27,0x2f,0x27,0x29,
+    0x2e,0x66,0x69,0x6c,0x74,0x65,0x72,0x28,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,0x29,0x3b,0x0a,0x70,0x61,
+    0x72,0x74,0x73,0x2e,0x70,0x6f,0x70,0x28,0x29,0x3b,0x0a,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,
+    0x74,0x68,0x20,0x3d,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x70,0x61,0x72,0x74,0x73,0x2e,0x6a,0x6f,0x69,
+    0x6e,0x28,0x27,0x2f,0x27,0x29,0x3b,0x0a,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x61,0x74,0x68,0x49,0x6e,
+    0x55,0x52,0x4c,0x28,0x29,0x3b,0x0a,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,
+    0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x20,0x7b,0x0a,0x75,0x70,0x64,0x61,0x74,0x65,0x50,0x61,0x74,
+    0x68,0x49,0x6e,0x55,0x52,0x4c,0x28,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
+    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x75,0x72,0x72,0x65,
+    0x6e,0x74,0x50,0x61,0x74,0x68,0x44,0x69,0x73,0x70,0x6c,0x61,0x79,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
+    0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,
+    0x65,0x74,0x63,0x68,0x28,0x60,0x2f,0x6c,0x69,0x73,0x74,0x66,0x69,0x6c,0x65,0x73,0x3f,0x74,0x79,0x70,
+    0x65,0x3d,0x6a,0x73,0x6f,0x6e,0x26,0x70,0x61,0x74,0x68,0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,
+    0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,
+    0x50,0x61,0x74,0x68,0x29,0x7d,0x60,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x69,0x74,0x65,0x6d,
+    0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,
+    0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
+    0x79,0x49,0x64,0x28,0x27,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x27,0x29,0x3b,0x0a,0x63,0x6f,0x6e,
+    0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x27,
+    0x27,0x3b,0x0a,0x2f,0x2f,0x20,0x53,0x6f,0x72,0x74,0x20,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x64,0x69,
+    0x72,0x65,0x63,0x74,0x6f,0x72,0x69,0x65,0x73,0x20,0x66,0x69,0x72,0x73,0x74,0x2c,0x20,0x74,0x68,0x65,
+    0x6e,0x20,0x66,0x69,0x6c,0x65,0x73,0x2c,0x20,0x62,0x6f,0x74,0x68,0x20,0x61,0x6c,0x70,0x68,0x61,0x62,
+    0x65,0x74,0x69,0x63,0x61,0x6c,0x6c,0x79,0x0a,0x69,0x74,0x65,0x6d,0x73,0x2e,0x73,0x6f,0x72,0x74,0x28,
+    0x28,0x61,0x2c,0x20,0x62,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x61,0x2e,0x69,0x73,
+    0x44,0x69,0x72,0x20,0x26,0x26,0x20,0x21,0x62,0x2e,0x69,0x73,0x44,0x69,0x72,0x29,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x20,0x2d,0x31,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x61,0x2e,0x69,0x73,0x44,0x69,0x72,
+    0x20,0x26,0x26,0x20,0x62,0x2e,0x69,0x73,0x44,0x69,0x72,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
+    0x31,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x2e,0x6e,0x61,0x6d,0x65,0x2e,0x6c,0x6f,0x63,
+    0x61,0x6c,0x65,0x43,0x6f,0x6d,0x70,0x61,0x72,0x65,0x28,0x62,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,
+    0x7d,0x29,0x3b,0x0a,0x69,0x74,0x65,0x6d,0x73,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x69,0x74,
+    0x65,0x6d,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x6f,0x77,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x63,0x6c,0x61,0x73,0x73,
+    0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x65,0x6e,0x74,0x72,0x79,0x27,0x3b,0x0a,0x2f,0x2f,0x20,0x43,
+    0x72,0x65,0x61,0x74,0x65,0x20,0x6e,0x61,0x6d,0x65,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x61,0x6d,
+    0x65,0x43,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,
+    0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x6e,
+    0x61,0x6d,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,
+    0x27,0x6e,0x61,0x6d,0x65,0x27,0x3b,0x0a,0x6e,0x61,0x6d,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x69,0x6e,0x6e,
+    0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,
+    0x69,0x66,0x20,0x28,0x69,0x74,0x65,0x6d,0x2e,0x69,0x73,0x44,0x69,0x72,0x29,0x20,0x7b,0x0a,0x6e,0x61,
+    0x6d,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x66,0x6f,0x6e,0x74,0x57,0x65,0x69,
+    0x67,0x68,0x74,0x20,0x3d,0x20,0x27,0x62,0x6f,0x6c,0x64,0x27,0x3b,0x0a,0x6e,0x61,0x6d,0x65,0x43,0x65,
+    0x6c,0x6c,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x75,0x72,0x73,0x6f,0x72,0x20,0x3d,0x20,0x27,0x70,
+    0x6f,0x69,0x6e,0x74,0x65,0x72,0x27,0x3b,0x0a,0x6e,0x61,0x6d,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x6f,0x6e,
+    0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x75,0x72,0x72,
+    0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,
+    0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,
+    0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,
+    0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x7d,0x0a,0x2f,0x2f,
+    0x20,0x43,0x72,0x65,0x61,0x74,0x65,0x20,0x73,0x69,0x7a,0x65,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,
+    0x69,0x7a,0x65,0x43,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,
+    0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,
+    0x0a,0x73,0x69,0x7a,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,
+    0x3d,0x20,0x27,0x73,0x69,0x7a,0x65,0x27,0x3b,0x0a,0x73,0x69,0x7a,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x69,
+    0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x69,0x74,0x65,0x6d,0x2e,0x69,0x73,0x44,0x69,
+    0x72,0x20,0x3f,0x20,0x27,0x2d,0x27,0x20,0x3a,0x20,0x66,0x6f,0x72,0x6d,0x61,0x74,0x42,0x79,0x74,0x65,
+    0x73,0x28,0x69,0x74,0x65,0x6d,0x2e,0x73,0x69,0x7a,0x65,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x61,0x63,0x74,0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+    0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,
+    0x27,0x29,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,
+    0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x74,0x61,0x62,0x6c,0x65,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,
+    0x73,0x27,0x3b,0x0a,0x2f,0x2f,0x20,0x43,0x72,0x65,0x61,0x74,0x65,0x20,0x72,0x65,0x6e,0x61,0x6d,0x65,
+    0x20,0x62,0x75,0x74,0x74,0x6f,0x6e,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x6e,0x61,0x6d,0x65,
+    0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,
+    0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,
+    0x72,0x65,0x6e,0x61,0x6d,0x65,0x42,0x74,0x6e,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
+    0x3d,0x20,0x27,0xe2,0x9c,0x8f,0x20,0x52,0x65,0x6e,0x61,0x6d,0x65,0x27,0x3b,0x0a,0x72,0x65,0x6e,0x61,
+    0x6d,0x65,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,
+    0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x6c,0x64,0x50,0x61,0x74,0x68,0x20,0x3d,0x20,
+    0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,
+    0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x69,
+    0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x65,0x77,0x4e,
+    0x61,0x6d,0x65,0x20,0x3d,0x20,0x70,0x72,0x6f,0x6d,0x70,0x74,0x28,0x22,0x4e,0x65,0x77,0x20,0x6e,0x61,
+    0x6d,0x65,0x3a,0x22,0x2c,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x69,0x66,
+    0x20,0x28,0x21,0x6e,0x65,0x77,0x4e,0x61,0x6d,0x65,0x20,0x7c,0x7c,0x20,0x6e,0x65,0x77,0x4e,0x61,0x6d,
+    0x65,0x20,0x3d,0x3d,0x3d,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x29,0x20,0x72,0x65,0x74,
+    0x75,0x72,0x6e,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x65,0x77,0x50,0x61,0x74,0x68,0x20,0x3d,
+    0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,
+    0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,
+    0x6e,0x65,0x77,0x4e,0x61,0x6d,0x65,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x6d,0x6f,0x76,
+    0x65,0x22,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,
+    0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,
+    0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x3a,0x20,0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,
+    0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,
+    0x64,0x65,0x64,0x22,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x60,0x66,0x72,0x6f,0x6d,0x3d,
+    0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,
+    0x28,0x6f,0x6c,0x64,0x50,0x61,0x74,0x68,0x29,0x7d,0x26,0x74,0x6f,0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,
+    0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x6e,0x65,0x77,0x50,0x61,
+    0x74,0x68,0x29,0x7d,0x60,0x0a,0x7d,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x29,0x20,0x3d,0x3e,0x20,
+    0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x61,0x63,0x74,
+    0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,
+    0x72,0x65,0x6e,0x61,0x6d,0x65,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x69,0x74,0x65,
+    0x6d,0x2e,0x69,0x73,0x44,0x69,0x72,0x29,0x20,0x7b,0x0a,0x2f,0x2f,0x20,0x43,0x72,0x65,0x61,0x74,0x65,
+    0x20,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x20,0x62,0x75,0x74,0x74,0x6f,0x6e,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,
+    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,
+    0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x42,
+    0x74,0x6e,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0xe2,0xac,0x87,0x20,
+    0x44,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x27,0x3b,0x0a,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x42,
+    0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,0x68,0x20,0x3d,0x20,0x63,0x75,
+    0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,
+    0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x69,0x74,0x65,
+    0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x61,0x20,0x3d,0x20,0x64,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+    0x28,0x27,0x61,0x27,0x29,0x3b,0x0a,0x61,0x2e,0x68,0x72,0x65,0x66,0x20,0x3d,0x20,0x60,0x2f,0x64,0x6f,
+    0x77,0x6e,0x6c,0x6f,0x61,0x64,0x3f,0x70,0x61,0x74,0x68,0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,
+    0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,
+    0x68,0x29,0x7d,0x60,0x3b,0x0a,0x61,0x2e,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x20,0x3d,0x20,0x69,
+    0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x62,
+    0x6f,0x64,0x79,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x61,0x29,0x3b,0x0a,
+    0x61,0x2e,0x63,0x6c,0x69,0x63,0x6b,0x28,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+    0x62,0x6f,0x64,0x79,0x2e,0x72,0x65,0x6d,0x6f,0x76,0x65,0x43,0x68,0x69,0x6c,0x64,0x28,0x61,0x29,0x3b,
+    0x0a,0x7d,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x2e,0x61,0x70,0x70,0x65,0x6e,
+    0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x64,0x6f,0x77,0x6e,0x6c,0x6f,0x61,0x64,0x42,0x74,0x6e,0x29,0x3b,
+    0x0a,0x2f,0x2f,0x20,0x43,0x72,0x65,0x61,0x74,0x65,0x20,0x70,0x72,0x65,0x76,0x69,0x65,0x77,0x20,0x62,
+    0x75,0x74,0x74,0x6f,0x6e,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x72,0x65,0x76,0x69,0x65,0x77,0x42,
+    0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x70,
+    0x72,0x65,0x76,0x69,0x65,0x77,0x42,0x74,0x6e,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
+    0x3d,0x20,0x27,0xf0,0x9f,0x94,0x8d,0x20,0x50,0x72,0x65,0x76,0x69,0x65,0x77,0x27,0x3b,0x0a,0x70,0x72,
+    0x65,0x76,0x69,0x65,0x77,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,
+    0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,
+    0x68,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,
+    0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,
+    0x20,0x2b,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x77,0x69,0x6e,0x64,0x6f,0x77,
+    0x2e,0x6f,0x70,0x65,0x6e,0x28,0x60,0x2f,0x70,0x72,0x65,0x76,0x69,0x65,0x77,0x3f,0x70,0x61,0x74,0x68,
+    0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,
+    0x74,0x28,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,0x68,0x29,0x7d,0x60,0x2c,0x20,0x27,0x5f,0x62,0x6c,0x61,
+    0x6e,0x6b,0x27,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x2e,
+    0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x70,0x72,0x65,0x76,0x69,0x65,0x77,0x42,
+    0x74,0x6e,0x29,0x3b,0x0a,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,
+    0x6d,0x6f,0x76,0x65,0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,
+    0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,
+    0x27,0x29,0x3b,0x0a,0x6d,0x6f,0x76,0x65,0x42,0x74,0x6e,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,
+    0x74,0x20,0x3d,0x20,0x27,0xe2,0x86,0xaa,0x20,0x4d,0x6f,0x76,0x65,0x20,0x48,0x65,0x72,0x65,0x27,0x3b,
+    0x0a,0x6d,0x6f,0x76,0x65,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,
+    0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x44,
+    0x69,0x72,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,
+    0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,
+    0x27,0x20,0x2b,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x73,0x72,0x63,0x20,0x3d,0x20,0x70,0x72,0x6f,0x6d,0x70,0x74,0x28,0x22,0x46,0x69,0x6c,0x65,0x20,
+    0x74,0x6f,0x20,0x6d,0x6f,0x76,0x65,0x3a,0x22,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x73,0x72,0x63,0x29,
+    0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x72,0x6f,0x6d,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,
+    0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,
+    0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x73,0x72,0x63,0x3b,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x6f,0x20,0x3d,0x20,0x74,0x61,0x72,0x67,0x65,0x74,0x44,0x69,0x72,
+    0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x73,0x72,0x63,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,
+    0x22,0x2f,0x6d,0x6f,0x76,0x65,0x22,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x22,
+    0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x22,0x43,
+    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x3a,0x20,0x22,0x61,0x70,0x70,0x6c,0x69,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,
+    0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x22,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x60,
+    0x66,0x72,0x6f,0x6d,0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,
+    0x6f,0x6e,0x65,0x6e,0x74,0x28,0x66,0x72,0x6f,0x6d,0x29,0x7d,0x26,0x74,0x6f,0x3d,0x24,0x7b,0x65,0x6e,
+    0x63,0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x74,0x6f,0x29,
+    0x7d,0x60,0x0a,0x7d,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x29,0x20,0x3d,0x3e,0x20,0x6c,0x6f,0x61,
+    0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x3b,0x0a,0x61,0x63,0x74,0x69,
+    0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6d,
+    0x6f,0x76,0x65,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x43,0x72,0x65,0x61,0x74,0x65,
+    0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x20,0x62,0x75,0x74,0x74,0x6f,0x6e,0x0a,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x43,0x65,0x6c,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+    0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,
+    0x76,0x27,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x6c,0x42,0x74,0x6e,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x64,0x65,0x6c,0x42,0x74,0x6e,
+    0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0xf0,0x9f,0x97,0x91,0x20,0x44,
+    0x65,0x6c,0x65,0x74,0x65,0x27,0x3b,0x0a,0x64,0x65,0x6c,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,
+    0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,
+    0x61,0x74,0x68,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,
+    0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,
+    0x2f,0x27,0x20,0x2b,0x20,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x69,0x66,0x20,0x28,
+    0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x28,0x60,0x41,0x72,0x65,0x20,0x79,0x6f,0x75,0x20,0x73,0x75,0x72,
+    0x65,0x20,0x79,0x6f,0x75,0x20,0x77,0x61,0x6e,0x74,0x20,0x74,0x6f,0x20,0x64,0x65,0x6c,0x65,0x74,0x65,
+    0x20,0x22,0x24,0x7b,0x69,0x74,0x65,0x6d,0x2e,0x6e,0x61,0x6d,0x65,0x7d,0x22,0x3f,0x60,0x29,0x29,0x20,
+    0x7b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x64,0x65,0x6c,0x65,0x74,0x65,0x22,0x2c,0x20,0x7b,
+    0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,
+    0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,
+    0x65,0x22,0x3a,0x20,0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,
+    0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x22,0x20,
+    0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x60,0x70,0x61,0x74,0x68,0x3d,0x24,0x7b,0x65,0x6e,0x63,
+    0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x70,0x61,0x74,0x68,
+    0x29,0x7d,0x60,0x0a,0x7d,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x28,0x29,0x20,0x3d,0x3e,0x20,0x6c,0x6f,
+    0x61,0x64,0x46,0x69,0x6c,0x65,0x73,0x28,0x29,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x3b,0x0a,0x64,0x65,0x6c,
+    0x65,0x74,0x65,0x43,0x65,0x6c,0x6c,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,
+    0x64,0x65,0x6c,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,
+    0x68,0x69,0x6c,0x64,0x28,0x6e,0x61,0x6d,0x65,0x43,0x65,0x6c,0x6c,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,
+    0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x73,0x69,0x7a,0x65,0x43,0x65,0x6c,0x6c,
+    0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x61,
+    0x63,0x74,0x69,0x6f,0x6e,0x43,0x65,0x6c,0x6c,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,
+    0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x64,0x65,0x6c,0x65,0x74,0x65,0x43,0x65,0x6c,0x6c,0x29,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,
+    0x6c,0x64,0x28,0x72,0x6f,0x77,0x29,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x20,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x28,0x29,0x20,0x7b,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x66,0x69,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x20,0x3d,0x20,0x64,0x6f,0x63,
+    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
+    0x28,0x27,0x66,0x69,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x27,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,
+    0x66,0x69,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x2e,0x66,0x69,0x6c,0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,
+    0x74,0x68,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x61,0x6c,0x65,0x72,0x74,0x28,0x22,0x53,0x65,
+    0x6c,0x65,0x63,0x74,0x20,0x61,0x20,0x66,0x69,0x6c,0x65,0x20,0x66,0x69,0x72,0x73,0x74,0x2e,0x22,0x29,
+    0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x20,0x3d,0x20,0x6e,
+    0x65,0x77,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x28,0x29,0x3b,0x0a,0x66,0x6f,0x72,0x6d,0x44,
+    0x61,0x74,0x61,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x27,0x66,0x69,0x6c,0x65,0x27,0x2c,0x20,0x66,
+    0x69,0x6c,0x65,0x49,0x6e,0x70,0x75,0x74,0x2e,0x66,0x69,0x6c,0x65,0x73,0x5b,0x30,0x5d,0x29,0x3b,0x0a,
+    0x66,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x27,0x70,0x61,0x74,
+    0x68,0x27,0x2c,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x50,0x61,0x74,0x68,0x29,0x3b,0x0a,0x66,0x65,
+    0x74,0x63,0x68,0x28,0x27,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x27,0x2c,0x20,0x7b,0x20,0x6d,0x65,0x74,
+    0x68,0x6f,0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x20,0x62,0x6f,0x64,0x79,0x3a,0x20,0x66,
+    0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x20,0x7d,0x29,0x0a,0x2e,0x74,0x68,0x65,0x6e,0x28,0x72,0x65,0x73,
+    0x70,0x20,0x3d,0x3e,0x20,0x72,0x65,0x73,0x70,0x2e,0x74,0x65,0x78,0x74,0x28,0x29,0x29,0x0a,0x2e,0x74,
+    0x68,0x65,0x6e,0x28,0x61,0x6c,0x65,0x72,0x74,0x29,0x0a,0x2e,0x74,0x68,0x65,0x6e,0x28,0x6c,0x6f,0x61,
+    0x64,0x46,0x69,0x6c,0x65,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,
+    0x63,0x72,0x65,0x61,0x74,0x65,0x46,0x6f,0x6c,0x64,0x65,0x72,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x70,0x72,0x6f,0x6d,0x70,0x74,0x28,0x22,0x4e,0x65,
+    0x77,0x20,0x66,0x6f,0x6c,0x64,0x65,0x72,0x20,0x6e,0x61,0x6d,0x65,0x3a,0x22,0x29,0x3b,0x0a,0x69,0x66,
+    0x20,0x28,0x21,0x6e,0x61,0x6d,0x65,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,0x68,0x20,0x3d,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,
+    0x74,0x50,0x61,0x74,0x68,0x2e,0x72,0x65,0x70,0x6c,0x61,0x63,0x65,0x28,0x2f,0x5c,0x2f,0x24,0x2f,0x2c,
+    0x20,0x27,0x27,0x29,0x20,0x2b,0x20,0x27,0x2f,0x27,0x20,0x2b,0x20,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x66,
+    0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x6d,0x6b,0x64,0x69,0x72,0x22,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,
+    0x68,0x6f,0x64,0x3a,0x20,0x22,0x50,0x4f,0x53,0x54,0x22,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,
+    0x3a,0x20,0x7b,0x20,0x22,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x22,0x3a,0x20,
+    0x22,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,
+    0x6f,0x72,0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x22,0x20,0x7d,0x2c,0x0a,0x62,
+    0x6f,0x64,0x79,0x3a,0x20,0x60,0x70,0x61,0x74,0x68,0x3d,0x24,0x7b,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,
+    0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x66,0x75,0x6c,0x6c,0x50,0x61,0x74,0x68,
+    0x29,0x7d,0x60,0x0a,0x7d,0x29,0x0a,0x2e,0x74,0x68,0x65,0x6e,0x28,0x72,0x65,0x73,0x70,0x20,0x3d,0x3e,
+    0x20,0x72,0x65,0x73,0x70,0x2e,0x74,0x65,0x78,0x74,0x28,0x29,0x29,0x0a,0x2e,0x74,0x68,0x65,0x6e,0x28,
+    0x61,0x6c,0x65,0x72,0x74,0x29,0x0a,0x2e,0x74,0x68,0x65,0x6e,0x28,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,
+    0x65,0x73,0x29,0x3b,0x0a,0x7d,0x0a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,
+    0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x44,0x4f,0x4d,0x43,0x6f,0x6e,0x74,0x65,
+    0x6e,0x74,0x4c,0x6f,0x61,0x64,0x65,0x64,0x27,0x2c,0x20,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x73,
+    0x29,0x3b,0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,
+    0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+constexpr uint8_t index_html_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x5a,0x6b,0x8e,0x1b,0xc7,0x11,0xfe,0xcf,0x53,
+    0xb4,0xc6,0x89,0x38,0x94,0x96,0x43,0xee,0x0a,0x52,0x84,0xe5,0xc3,0xd0,0x3e,0x04,0x2b,0x58,0x49,0x0b,
+    0x71,0xe5,0x20,0x30,0x0c,0xab,0x77,0xa6,0x49,0x8e,0x77,0x38,0x3d,0xee,0xe9,0x21,0x97,0x91,0xf7,0x0a,
+    0xf1,0xbf,0x00,0xf9,0x95,0x5b,0x04,0xc9,0x75,0x7c,0x81,0xe4,0x08,0xa9,0xaa,0xee,0x79,0xf2,0xa1,0x75,
+    0x12,0x21,0xb1,0xe0,0xe5,0xb0,0xbb,0xba,0xba,0xaa,0xba,0xea,0xab,0xea,0xe2,0x0c,0x1f,0x9c,0xbd,0x3d,
+    0xbd,0xfa,0xfd,0xe5,0x39,0x9b,0xeb,0x45,0x34,0x6e,0x0d,0xf1,0x83,0x45,0x3c,0x9e,0x8d,0x1c,0x11,0x3b,
+    0x38,0x20,0x78,0x00,0x1f,0x0b,0xa1,0x39,0xf3,0xe7,0x5c,0xa5,0x42,0x8f,0x9c,0xf7,0x57,0x2f,0xbb,0xcf,
+    0x71,0x56,0x87,0x3a,0x12,0xe3,0xf3,0xc9,0xe5,0x93,0xa3,0xee,0xe4,0x09,0x7b,0x91,0x05,0xa1,0x64,0xa7,
+    0x32,0xd6,0x4a,0x46,0xec,0x92,0xc7,0x22,0x1a,0xf6,0x0c,0x4d,0x6b,0x18,0x85,0xf1,0x0d,0x53,0x22,0x1a,
+    0x39,0xa9,0x5e,0x47,0x22,0x9d,0x0b,0xa1,0x1d,0x36,0x57,0x62,0x6a,0x47,0x3c,0x3f,0x4d,0x91,0x69,0xcf,
+    0xee,0x79,0x2d,0x83,0x35,0x7c,0xc4,0x7c,0x09,0x7f,0x61,0xf7,0x88,0xa7,0xe9,0xc8,0xe1,0xbe,0x0e,0x97,
+    0x22,0x5f,0xd8,0x73,0xc6,0x5f,0xc9,0x85,0x18,0xf6,0x38,0xd1,0xd8,0xc1,0x30,0xd6,0x42,0xc5,0x42,0x7f,
+    0xa7,0x38,0x08,0xe4,0xa1,0x52,0xce,0xf8,0x95,0x1d,0x64,0xef,0x70,0xb0,0xb1,0x62,0x1a,0x46,0xe2,0x3b,
+    0x71,0x9b,0x44,0x52,0x09,0x65,0x17,0xbc,0x84,0x31,0x76,0x6e,0xc7,0x1a,0xf4,0x3c,0xe2,0x6a,0x91,0x5a,
+    0xc2,0x17,0xf4,0xc5,0x50,0xf4,0x8c,0xb8,0xf3,0xc3,0xc2,0x2a,0xdd,0x2b,0x99,0xf9,0xf3,0xee,0xc5,0xe9,
+    0x59,0xf7,0xd0,0x7b,0xfe,0xf4,0xb4,0x69,0x1f,0x20,0x6d,0x0d,0x53,0x01,0x6a,0xc9,0x18,0x57,0x1e,0xe1,
+    0x4a,0x36,0xd1,0x5c,0x67,0xc0,0x13,0xbe,0xb6,0x86,0x41,0xb8,0x64,0x61,0x30,0x72,0x02,0xb1,0x0c,0x7d,
+    0x81,0x53,0xc2,0x19,0xbf,0x91,0x2b,0x96,0x44,0x7c,0x1d,0xc6,0xb3,0x63,0x36,0x4c,0x13,0x1e,0x13,0x4d,
+    0x2c,0x57,0x97,0x66,0xd4,0x19,0x77,0x87,0x3d,0x1c,0x1f,0xb3,0x1f,0xd9,0x09,0xf7,0x6f,0x44,0x1c,0x54,
+    0x29,0xaf,0xcd,0x90,0x65,0x57,0xa1,0x9d,0xf8,0x4a,0x88,0xb8,0x49,0x1a,0x85,0xb3,0xb9,0xde,0x24,0x26,
+    0xe5,0xab,0xb4,0x64,0x9a,0x06,0xdd,0xb0,0x07,0x2a,0x80,0x22,0x89,0x12,0x44,0x93,0x92,0x76,0x6f,0x33,
+    0x9d,0x64,0xda,0x19,0x5f,0x48,0x38,0x91,0x78,0xc6,0xcc,0xa8,0xe7,0x79,0xc3,0x1e,0x10,0xa2,0x31,0x4b,
+    0xb3,0xd4,0x0c,0x64,0xfc,0xec,0x6b,0x19,0x65,0x78,0xf4,0x64,0xa2,0x30,0x06,0x56,0x4c,0xaf,0x13,0x31,
+    0x72,0x14,0xf8,0x2f,0x78,0x08,0x6e,0xb4,0x24,0x9a,0x49,0x14,0x06,0x42,0x39,0x6c,0x11,0xc6,0x23,0xa7,
+    0x0f,0x9f,0xfc,0x76,0xe4,0x1c,0x1d,0x3a,0x6c,0xc9,0xa3,0x0c,0x16,0x1c,0xc2,0x98,0x8c,0xc1,0xbd,0x61,
+    0x1d,0x08,0x27,0xb4,0x61,0xed,0x76,0xd0,0x1d,0xaf,0x33,0xad,0x65,0x8c,0xf3,0x51,0xe8,0xdf,0x34,0xa6,
+    0x27,0xe0,0x4f,0xb9,0x1c,0x86,0x70,0x8f,0xd8,0x13,0xad,0x04,0x5f,0xd8,0x28,0x99,0x2a,0xb9,0x60,0xef,
+    0xdf,0x5d,0x58,0xf9,0x23,0x7e,0x2d,0x22,0x36,0x95,0xca,0x18,0x07,0xd6,0x4c,0x44,0x04,0x8b,0x9d,0xf1,
+    0xe9,0x5c,0xca,0x54,0x30,0xce,0xec,0xf8,0xf1,0xb0,0x47,0xc4,0xc4,0x1d,0x49,0x0a,0x8b,0x96,0x8b,0x6a,
+    0xda,0xe0,0xc8,0xc4,0x4c,0x1b,0x8d,0x64,0x82,0xcf,0xb9,0xf2,0x70,0x4a,0x5d,0x76,0x9a,0xa5,0xda,0xc8,
+    0xc3,0xa4,0x62,0x86,0x0b,0xb3,0x8b,0x58,0x17,0x8e,0xd1,0xac,0x31,0xca,0xe1,0x64,0xc3,0xe4,0x5a,0xdc,
+    0x6a,0x63,0xf1,0x4c,0x45,0xaf,0x70,0xc2,0x41,0xe7,0xf4,0xc5,0x5c,0x46,0x60,0xfa,0x91,0x33,0xd7,0x3a,
+    0x39,0xee,0xf5,0xc4,0x2d,0x5f,0x24,0x18,0xea,0x72,0xd1,0x4b,0xc9,0x1c,0xde,0x22,0x79,0xb2,0xcd,0xcc,
+    0xe8,0xda,0xef,0x55,0x04,0x12,0xe7,0x91,0x8f,0x23,0xce,0x18,0x9d,0xbb,0x62,0xeb,0x8d,0xd3,0xd1,0x32,
+    0x41,0x12,0xf4,0xd8,0xca,0x5a,0x1c,0x86,0xd3,0x82,0xbf,0xf7,0x38,0xa7,0x2b,0x50,0x86,0x69,0xc9,0x26,
+    0x89,0x10,0xfe,0x7c,0x8b,0x83,0x95,0xda,0x6a,0x9d,0x5e,0xd1,0x97,0x9a,0xb2,0xe7,0x08,0x35,0x8c,0xa8,
+    0xea,0xa7,0x04,0xe4,0x17,0x1c,0x23,0xb3,0x79,0x08,0x08,0xb6,0xe7,0xf1,0x2c,0x0a,0xd3,0x79,0xc5,0xd6,
+    0x75,0x9a,0x04,0xa0,0xe6,0x52,0x36,0x48,0xca,0xe3,0xd8,0xb0,0x44,0x22,0xf8,0x0d,0xf9,0x28,0x3e,0xdc,
+    0x43,0xed,0xf7,0x80,0x74,0x3c,0x60,0x04,0x7b,0xa8,0xfd,0x19,0x3b,0xe5,0x2a,0xb0,0xea,0x83,0x67,0x2e,
+    0xcc,0xf9,0x12,0xd5,0x4b,0xf8,0x0a,0x71,0x24,0xf4,0x5c,0xc2,0xd8,0xe5,0xdb,0xc9,0x95,0xc3,0x44,0xec,
+    0x1b,0xf3,0x2c,0xb2,0x48,0x87,0x09,0x57,0xba,0x87,0xab,0xba,0x01,0xd7,0xdc,0x69,0x58,0x10,0xf1,0xd6,
+    0x61,0x31,0x5f,0x14,0xcf,0x4a,0xfc,0x90,0x85,0x4a,0x04,0xa5,0x26,0x86,0x32,0xcd,0xae,0x17,0x21,0xd8,
+    0xd1,0x48,0x57,0x55,0x03,0x99,0x57,0xc0,0xd1,0x08,0x66,0x70,0xd3,0x29,0x10,0x67,0x97,0xb2,0xe8,0x23,
+    0x46,0x55,0x0a,0xc4,0xba,0xb2,0x4d,0x53,0x92,0xc6,0x40,0x7b,0x11,0xa6,0xba,0xe2,0x54,0x90,0x0a,0x14,
+    0xe4,0x31,0x67,0xfc,0xce,0x3c,0x18,0x7e,0x48,0x54,0x11,0x13,0xc5,0xb3,0xf4,0xa8,0x68,0x17,0xce,0xcf,
+    0xfa,0xce,0xd4,0x72,0x74,0xb6,0x50,0x29,0x00,0x77,0x4c,0x83,0x80,0x5a,0x28,0x39,0x62,0xab,0x9d,0x46,
+    0x9b,0xd9,0xdc,0xf4,0x86,0x23,0xec,0x10,0xc0,0xd6,0x69,0xd2,0xf0,0x0f,0x40,0x33,0x81,0xbf,0x5b,0xa7,
+    0x39,0xd9,0x01,0xf2,0x16,0x7d,0x16,0x24,0xb9,0xc5,0xf6,0x1b,0xee,0x9f,0x7f,0xf9,0xe3,0x9f,0xff,0xf1,
+    0xb7,0x9f,0x40,0xcd,0xa5,0x60,0xaf,0x43,0x5f,0xc9,0x64,0x2e,0x63,0xc1,0x0c,0xb8,0xed,0x30,0x20,0xa0,
+    0x93,0xd2,0x40,0x6c,0x88,0x36,0x62,0xfa,0xe7,0x3f,0xfd,0x15,0xc1,0x46,0x69,0x64,0x58,0x70,0xda,0x1b,
+    0xe3,0xdb,0x98,0x99,0x20,0xff,0xf9,0xa7,0xbf,0xb3,0x46,0xa0,0xa3,0x75,0xa9,0xc4,0x00,0xdf,0xe4,0x6a,
+    0x16,0xc6,0x5d,0x98,0x3f,0x66,0x87,0x62,0x31,0x70,0x72,0xec,0x1d,0x1b,0x18,0x67,0x17,0x62,0x29,0xa2,
+    0x0a,0xc6,0xe6,0xee,0xb5,0xcc,0x30,0x6f,0xf3,0x30,0xc6,0x44,0x62,0x99,0xad,0xc2,0x40,0xcf,0x8f,0xd9,
+    0xd1,0xd3,0x7e,0x72,0x3b,0x80,0xf3,0xc2,0x0c,0x09,0x6c,0x9f,0xe1,0x37,0x04,0xa0,0x99,0x92,0x19,0xe6,
+    0xdc,0x2f,0x84,0x10,0x30,0x22,0x15,0x9c,0x27,0xcc,0x27,0xb7,0x2c,0x85,0x38,0x0e,0xd8,0x17,0xbe,0xef,
+    0x0f,0x9c,0xda,0x26,0xb4,0x7d,0xb1,0x41,0xc1,0xb2,0xdf,0xff,0xf5,0x80,0xd9,0xed,0xf0,0xb1,0xca,0x1d,
+    0x0a,0x2b,0xc1,0x55,0x77,0x86,0xc5,0x8e,0x88,0xb5,0x0b,0xb1,0xab,0x70,0xd9,0x01,0xfb,0xa2,0x3f,0xed,
+    0xc3,0xdf,0xa9,0xf9,0xdb,0xef,0x77,0x06,0x4c,0x43,0x72,0x4c,0x43,0xca,0x23,0x86,0x1f,0xeb,0x7b,0x87,
+    0xe9,0xa0,0x12,0x30,0x3b,0xbd,0xc0,0x57,0x61,0x02,0x40,0xd3,0xeb,0x31,0x8b,0x14,0xe8,0xa9,0xad,0x40,
+    0xfa,0x60,0xb6,0x58,0x7b,0x33,0xa1,0xcf,0x23,0x81,0x8f,0x27,0xeb,0x57,0x81,0xdb,0x2e,0x81,0xa2,0xdd,
+    0xf1,0x64,0x6c,0xe2,0x98,0x8d,0x18,0x4f,0xd7,0xb1,0xcf,0xa6,0x59,0x4c,0x8c,0x5d,0xd1,0x61,0x1f,0x5b,
+    0xc2,0x83,0x84,0xbf,0x84,0xa5,0x67,0x62,0xca,0x01,0x3d,0xdc,0xce,0xa0,0xe5,0xc3,0x1a,0x8d,0x19,0x71,
+    0x71,0x06,0x00,0x02,0x0b,0x63,0xb1,0x62,0x2f,0xed,0x57,0x57,0xcf,0xc3,0xb4,0x20,0x82,0xe0,0x4b,0xe0,
+    0x41,0x20,0xf7,0x15,0x87,0x5d,0xa6,0x42,0xfb,0x73,0xb7,0xdd,0x33,0x32,0xb4,0x0f,0xd8,0x47,0x8b,0x55,
+    0xc7,0xac,0x8d,0x60,0x05,0x23,0x58,0x5d,0x1e,0x97,0xec,0xef,0x80,0xd9,0x27,0x54,0x31,0xd0,0x02,0xca,
+    0x84,0x31,0x38,0x01,0x25,0x89,0x7c,0xbf,0x5c,0x00,0x0f,0x31,0x1f,0x85,0xbf,0x1b,0xb4,0x72,0x0d,0x59,
+    0xa5,0x60,0x00,0x55,0x8d,0xc4,0x04,0xe9,0xb0,0x7c,0xe7,0x96,0xd5,0xc2,0x05,0xb6,0x24,0x7a,0xe0,0x69,
+    0xf5,0x32,0xb3,0xa8,0x57,0xab,0xa1,0x57,0xcb,0xa0,0x46,0x7a,0x0c,0x2a,0xb7,0xd1,0x63,0x81,0x63,0xf7,
+    0x0a,0x90,0xb4,0x0d,0x24,0x3c,0x49,0x20,0x82,0x28,0xa9,0xf7,0x6e,0xbb,0xab,0xd5,0xaa,0x4b,0x00,0x0d,
+    0x29,0x1b,0xb0,0x5b,0x06,0x22,0x68,0xb3,0xbb,0x83,0x96,0xb1,0x4c,0xdb,0x64,0x9d,0x36,0x7b,0x6c,0x84,
+    0x6d,0xa1,0x85,0xee,0x4a,0xad,0x8a,0xfc,0x5c,0xe8,0x04,0x6c,0xf6,0x69,0x94,0x17,0x06,0x9b,0xda,0x20,
+    0xab,0xcf,0xab,0x0b,0x8c,0x92,0x26,0x66,0xea,0xfd,0xbb,0x57,0xa7,0x72,0x01,0x07,0x86,0xd1,0x02,0x53,
+    0x9d,0xa6,0x6e,0xf5,0x22,0x02,0x04,0xcb,0x25,0xc5,0x89,0x2d,0xde,0xc4,0x9a,0xeb,0x4d,0xea,0x2d,0x2c,
+    0xa3,0x8d,0xaf,0xec,0x34,0x8d,0xad,0x22,0x4a,0xcb,0x98,0x65,0x78,0x0f,0xfb,0xc4,0x32,0xac,0x26,0x36,
+    0x0d,0x9a,0x52,0xe1,0xf2,0x79,0x4d,0x8a,0x3a,0xed,0xb2,0x29,0xce,0x75,0x60,0xaa,0xfd,0x90,0xae,0x92,
+    0x48,0x85,0x0f,0xd6,0xcc,0x91,0x40,0xd5,0x52,0x1b,0x14,0x18,0xd8,0x59,0x14,0x7d,0x9e,0x78,0x09,0xa7,
+    0xcc,0x35,0x4b,0x1f,0x8c,0x46,0x95,0x4d,0xab,0x67,0xfa,0xbf,0x8a,0xa5,0x9a,0x09,0xac,0xbc,0x77,0xf0,
+    0xaf,0x8e,0x8f,0x0c,0x91,0xa7,0x62,0x0e,0xad,0xd6,0x85,0x51,0x10,0x75,0x36,0x20,0xcf,0xaa,0x53,0x60,
+    0xa3,0x6e,0xe2,0x54,0x81,0x51,0xd6,0xb2,0x12,0xa3,0x36,0xc1,0x9b,0xfd,0x2b,0x7b,0x74,0x9e,0x56,0x21,
+    0xe4,0xd5,0x8e,0xb1,0xdf,0x83,0x30,0x7d,0xc3,0xdf,0xb8,0x40,0xd7,0x41,0x01,0x7e,0xd1,0x09,0xa0,0x66,
+    0x32,0x22,0xbd,0x18,0xd8,0xca,0x9f,0x33,0x83,0xf7,0xb8,0xb5,0x84,0x6b,0xc0,0x8a,0xab,0xd8,0x75,0x5e,
+    0x72,0x48,0x24,0x01,0xd6,0x9c,0xa4,0x04,0xf3,0x33,0xa5,0x80,0x2d,0x33,0x1c,0x9d,0xce,0x4e,0xbb,0x18,
+    0x44,0xbe,0x9f,0x5d,0x52,0x8b,0xde,0x9f,0xb6,0xcb,0x4e,0x0d,0xab,0xb7,0xd6,0x46,0x1a,0xc0,0xb5,0x83,
+    0x8a,0x92,0x4a,0xed,0xb5,0xd5,0x1e,0x4e,0xed,0xd2,0x1a,0x94,0x64,0xed,0xa5,0xb8,0xbd,0xd3,0x08,0x65,
+    0x61,0xba,0xdf,0x00,0x58,0x78,0x62,0xc6,0x4e,0xbf,0xc4,0xc8,0xc5,0x6b,0xd7,0xc3,0x84,0xeb,0xf9,0xa8,
+    0xb7,0xc8,0xd2,0xd0,0x7f,0x48,0xd5,0xf6,0xf7,0xa9,0x8c,0x4b,0x13,0x11,0x75,0xdd,0x46,0x48,0xe0,0xd6,
+    0x08,0x70,0xeb,0x7d,0x81,0x99,0xd3,0x20,0x5b,0x28,0x1d,0x4e,0x23,0xa8,0x55,0x18,0x8f,0x03,0xe4,0xa7,
+    0xa5,0x12,0xb6,0xcc,0x6d,0xe5,0x74,0xc6,0x18,0x5f,0x5d,0xbd,0xbe,0x00,0xae,0x1f,0xfe,0x9f,0x2a,0xe3,
+    0x0f,0x36,0x1e,0xc8,0x2c,0x1e,0x84,0xf9,0x4c,0xcf,0x2b,0x36,0x07,0xb9,0x2a,0x66,0xf0,0xa1,0x36,0xd5,
+    0xc2,0x5a,0xc2,0x6d,0x03,0x03,0x34,0x00,0x10,0x79,0xb4,0x15,0x0a,0x88,0x87,0x9d,0xab,0xd4,0x36,0x73,
+    0x55,0xdd,0xdb,0x24,0xd9,0xf8,0x8d,0x64,0x78,0x56,0xf6,0x30,0xa6,0x58,0xf2,0x79,0x56,0x30,0x58,0x54,
+    0x58,0x0d,0xe0,0x48,0xc4,0xc1,0xe9,0x3c,0x8c,0x02,0x17,0x38,0xe1,0x5e,0x42,0x67,0x2a,0xa6,0xbc,0x44,
+    0x02,0x03,0x3c,0x9d,0x73,0xf0,0x04,0xfc,0xc6,0x46,0xe3,0xff,0x9e,0xe0,0x86,0x4d,0x6c,0x26,0x76,0xf1,
+    0x41,0x81,0x91,0x11,0x92,0xd5,0x39,0xe1,0x48,0xdb,0x4e,0x54,0x03,0x01,0x77,0xf0,0x70,0x34,0xdf,0x01,
+    0xcf,0xee,0x1e,0x3b,0x20,0x59,0x7d,0x07,0x1c,0x69,0xdb,0x89,0xea,0x0e,0x1f,0x7e,0xf5,0x91,0x36,0xc1,
+    0x89,0x3b,0x76,0xf2,0x81,0x1c,0x94,0x2e,0x86,0xe6,0xe6,0x60,0xf7,0xc5,0xf2,0xe4,0x44,0xc7,0x7b,0xb6,
+    0x36,0xe4,0xb8,0xb9,0xa5,0xad,0xef,0x4f,0xf5,0x4d,0x39,0x57,0x8b,0x76,0xbc,0xfa,0x5c,0xd6,0xe7,0xed,
+    0x3d,0x07,0x66,0x21,0xa4,0xe9,0xa0,0x30,0x63,0x62,0xac,0xd6,0xad,0x42,0xce,0x88,0xc3,0x1e,0x5d,0xaf,
+    0xd2,0xdf,0x85,0x7a,0xee,0x3a,0x3d,0x07,0x60,0xda,0x12,0xc3,0x17,0x48,0x39,0xf8,0xa5,0x5e,0x6c,0x21,
+    0x93,0xcf,0x9b,0xf0,0x2a,0xc8,0xd2,0xdb,0x51,0x24,0x20,0x89,0xad,0xbc,0x06,0x15,0x4b,0x17,0xb7,0xac,
+    0x7b,0x1c,0x75,0x8d,0xbe,0x6e,0x73,0x13,0xc9,0xed,0x26,0x4d,0x35,0x4c,0xac,0xbd,0xad,0x77,0x57,0x67,
+    0xd0,0xbe,0x5b,0x86,0xd1,0x4f,0xb6,0x0c,0xd7,0x76,0xe8,0xec,0x8d,0x49,0x53,0x00,0xed,0xc8,0x64,0xf0,
+    0xfc,0x0b,0x72,0x19,0x52,0x97,0x50,0x9d,0x8f,0xec,0x43,0x6b,0xdb,0x87,0xda,0x83,0xd5,0xb5,0x26,0x22,
+    0xc5,0x92,0x65,0x5b,0x80,0x87,0x1d,0xa8,0xe2,0x87,0x4c,0xf4,0x9e,0xa3,0x32,0x8d,0x2a,0xe4,0x05,0x4f,
+    0x45,0x51,0x60,0xd9,0x78,0xe0,0x3c,0x66,0x02,0xf3,0xa7,0x75,0xb8,0xca,0xb4,0xf1,0x73,0x23,0x77,0xcd,
+    0x9a,0xb0,0x24,0xb7,0xe6,0xee,0xba,0x62,0x5b,0x26,0x25,0x7b,0xdb,0x6c,0x74,0x57,0x2b,0xd9,0xeb,0x6d,
+    0xd2,0x42,0xbb,0x40,0xc9,0x24,0x90,0xab,0xf8,0x17,0x99,0xad,0x76,0x1f,0xb2,0x0c,0xaa,0x25,0x29,0xde,
+    0x39,0xf6,0x95,0x07,0xcd,0xab,0x12,0xb0,0x21,0x4b,0xa1,0xc4,0x00,0x51,0xdd,0xcd,0xff,0x08,0x22,0x38,
+    0x36,0x96,0x4f,0xf5,0xed,0x01,0xe4,0x57,0x1e,0xad,0x53,0xa1,0x0e,0xd8,0x32,0x7b,0x2d,0x34,0x3e,0xdc,
+    0x08,0x91,0xbc,0x13,0xa6,0xd1,0x0e,0x30,0xc2,0xa3,0x54,0x1c,0xb0,0x45,0xe8,0xbf,0xb8,0x96,0x4a,0xdb,
+    0x9f,0x24,0x22,0xa1,0x06,0xa6,0x3c,0x17,0x53,0x2d,0x97,0x14,0x83,0x78,0xeb,0x7e,0x1f,0xc6,0xfa,0xf9,
+    0x0b,0xa5,0xf8,0xda,0xc5,0x1e,0x02,0x88,0x00,0xfe,0xc0,0xe6,0x90,0xc5,0x23,0xea,0xdb,0x03,0x30,0x80,
+    0x7b,0x51,0x67,0x37,0xad,0xde,0xa2,0xea,0x4d,0x1f,0xd0,0x98,0x20,0x2b,0x17,0x93,0xfd,0xf8,0x63,0x21,
+    0x32,0x42,0x98,0x06,0x3d,0xa1,0x4a,0x77,0xfc,0x48,0xa6,0x22,0x70,0x90,0xbe,0x20,0x35,0x72,0xb8,0xab,
+    0x30,0x06,0x5b,0x7a,0xd4,0x41,0x27,0x77,0x01,0x10,0x05,0x2e,0x76,0x78,0x25,0xae,0x6f,0x42,0x5d,0x9d,
+    0xec,0xd0,0x5d,0x9c,0x09,0x50,0x96,0xe1,0xde,0xdb,0xb6,0x4b,0xb3,0x14,0x1d,0xab,0xb1,0xa3,0x07,0x01,
+    0x44,0x35,0x37,0x05,0xac,0x35,0x27,0x46,0x57,0x3e,0x6f,0xfc,0xfc,0x85,0x9d,0x41,0xba,0x9c,0xca,0x9b,
+    0x4e,0xf5,0xc4,0xe4,0xaa,0xa3,0xa7,0xcf,0x06,0x2d,0x7b,0x04,0x7b,0x3c,0xa8,0xe8,0xfb,0x00,0x97,0xcd,
+    0x23,0xb1,0xca,0x37,0x46,0x2b,0x71,0x1d,0xce,0x60,0x67,0xa0,0xda,0x5c,0xea,0x99,0xb9,0x1c,0xfd,0x1d,
+    0xdb,0x73,0xff,0x12,0x91,0x9b,0xeb,0x51,0xe2,0x2f,0x1c,0xbc,0xcd,0x5a,0x0e,0x77,0x1d,0x4f,0xcf,0x45,
+    0xec,0x1a,0x7c,0x2a,0x9b,0x2a,0xe3,0xfc,0xe4,0x8a,0x36,0x87,0xbc,0xe9,0x30,0x3d,0xc7,0xca,0x01,0x25,
+    0x3b,0x57,0x4a,0xaa,0x6a,0x19,0x0f,0x72,0xc5,0x08,0x35,0xf0,0x68,0x36,0x74,0x2a,0xad,0x1a,0xcc,0x30,
+    0x20,0x6c,0xc1,0x0b,0x33,0x06,0x1a,0xe4,0x1d,0xcd,0x54,0xd4,0x22,0x7f,0x7a,0x47,0xe7,0xc4,0x0e,0x9f,
+    0xf5,0xfb,0xfd,0x41,0xab,0xee,0xc4,0x5a,0x61,0x40,0xad,0xe6,0x58,0xd0,0xb8,0x95,0xa9,0x32,0x7a,0x3f,
+    0x9a,0x8b,0xd5,0x01,0x58,0x3e,0x16,0xec,0xae,0x82,0x8e,0xb8,0x97,0x87,0x1f,0xae,0xbd,0xe6,0x10,0x05,
+    0xf8,0xd2,0x03,0x13,0x71,0xf0,0x44,0x0f,0xb6,0xce,0x23,0x57,0xe9,0x77,0xd8,0x35,0x2c,0xb9,0x31,0x31,
+    0xe2,0xcb,0xc5,0x35,0x20,0x7e,0xb0,0x19,0x23,0x79,0xf4,0xe4,0x6b,0x1f,0xd7,0x58,0x91,0x82,0x66,0xa9,
+    0x07,0x57,0xdd,0x82,0xfa,0x00,0xf8,0x37,0xa6,0xac,0xf0,0x0d,0x7e,0x1d,0xb3,0xbf,0xb1,0xcf,0x29,0x14,
+    0x84,0x08,0x99,0xaf,0xb1,0x0e,0x98,0x46,0x12,0x0e,0xa2,0x60,0x61,0xb7,0xef,0xb1,0x23,0xbb,0x24,0x4b,
+    0xf9,0x75,0x24,0x4e,0xd6,0x9a,0xca,0xfa,0x2a,0x83,0x47,0xec,0xc8,0x90,0x80,0x4b,0x7c,0x1d,0x8a,0x95,
+    0x55,0x0a,0x5b,0x63,0xf8,0xb5,0xe4,0x79,0x9d,0x4d,0xa7,0x24,0xeb,0x41,0x95,0x9b,0xe5,0x0f,0xfb,0x73,
+    0x4d,0x36,0xc8,0xdb,0x75,0x38,0xf0,0xe4,0xc8,0x98,0xa5,0xb2,0x1f,0x66,0x49,0x40,0x10,0x17,0x17,0x85,
+    0x40,0xdb,0x1f,0xc0,0xc7,0xb0,0x2a,0x11,0x0c,0x3c,0x7e,0x4c,0xd7,0xf4,0x82,0xe7,0x37,0xe1,0xb7,0x78,
+    0x53,0x35,0x02,0xa2,0xc7,0xc0,0x7d,0xf5,0xf0,0x99,0x1b,0xa2,0xf0,0x07,0xe4,0x0c,0x1d,0xd0,0xf5,0xc9,
+    0xd1,0x6f,0x9e,0x3d,0xcf,0xdb,0x0c,0x14,0xad,0x27,0x24,0xf2,0x66,0xec,0x9a,0x71,0xf7,0xf0,0xa0,0x22,
+    0xb7,0xb5,0xd9,0x41,0xc5,0xfb,0x30,0xb2,0x4b,0x36,0x9e,0x2f,0x93,0xf5,0x95,0x3c,0x05,0xf0,0x8b,0x45,
+    0xe4,0x96,0x2b,0xcd,0xf1,0xd1,0xc1,0xc8,0x4c,0xf9,0x62,0xd7,0x7e,0x13,0x9a,0x45,0xaf,0x33,0x74,0xd6,
+    0xa2,0x39,0xb9,0x21,0x2a,0x26,0x6d,0x24,0xb9,0x39,0xb6,0x54,0x61,0xa6,0x98,0xcb,0xb7,0x09,0xe0,0x46,
+    0x15,0xc6,0x94,0x8b,0x4a,0xf6,0x84,0xc2,0x2e,0x89,0x56,0x60,0x7a,0xe9,0x64,0x50,0xd1,0x09,0xb7,0x76,
+    0x90,0x88,0xee,0x13,0xbe,0x14,0x65,0x0e,0xc0,0x93,0x8a,0x11,0x69,0xa7,0x0a,0xf2,0x71,0x2b,0x50,0x7c,
+    0x95,0x37,0x24,0x28,0x25,0x75,0x3c,0x4a,0xc1,0x78,0xe9,0x2d,0xb1,0x02,0xbe,0x78,0xe6,0x4a,0x80,0x18,
+    0x4b,0xb0,0x44,0x30,0xe1,0x54,0xd3,0x74,0x24,0x67,0xae,0x83,0x2d,0x7f,0x83,0x12,0x8c,0x23,0x19,0x88,
+    0xe5,0x94,0xa8,0x5d,0x12,0x0b,0x83,0x32,0xf6,0x47,0x54,0xfa,0x76,0x0c,0xe8,0x85,0x57,0x6d,0x23,0xc6,
+    0x46,0x0b,0xaf,0x9e,0x7b,0xb6,0x24,0x40,0x13,0xf9,0x9b,0xb0,0xd9,0xd9,0x06,0xa5,0x24,0x5c,0x8e,0x16,
+    0x16,0xd3,0x3b,0x79,0x7e,0xf5,0xcc,0x1b,0x0c,0xa6,0xa3,0x0e,0x0a,0xf7,0x7f,0xed,0x18,0xc2,0x22,0x83,
+    0x3d,0x7c,0xb8,0x35,0xd9,0xa9,0x2c,0x8e,0xf1,0xb7,0xfa,0x5a,0xee,0xb1,0x29,0xc9,0x6d,0x16,0x29,0x55,
+    0xd3,0x97,0x15,0x0a,0xc4,0x68,0x35,0xe6,0x2a,0x40,0x54,0x66,0x24,0xfc,0x75,0x0d,0x6a,0xf0,0xf5,0x49,
+    0x18,0xe7,0x01,0x58,0x4c,0x42,0x24,0xe1,0xd9,0x5f,0x85,0x0b,0x71,0x26,0x17,0x50,0xc5,0x52,0x83,0xbd,
+    0x60,0x9b,0x7b,0x75,0xb6,0xa0,0x40,0xdd,0x1a,0xb8,0x05,0xb1,0x8d,0x9f,0x22,0x7a,0x91,0x6e,0x89,0x37,
+    0x99,0x82,0x02,0xa3,0xb8,0xcb,0x0e,0x8f,0x9e,0x63,0xb0,0xc2,0x07,0x38,0x2a,0x70,0x7e,0x3c,0x02,0xb2,
+    0x47,0x6c,0x99,0x07,0xae,0x5a,0xa4,0x39,0xa8,0xa5,0x3f,0x80,0xd9,0x91,0xa6,0xb7,0xb1,0x8d,0x15,0x6d,
+    0x99,0x77,0xd1,0x88,0x7e,0x11,0xc6,0x18,0xd3,0xc8,0xe1,0x11,0x21,0xdf,0xf6,0x23,0x22,0x5a,0xfa,0x05,
+    0xc5,0xb5,0xeb,0x1f,0xe1,0xcf,0x2c,0xd8,0xb6,0x74,0xf2,0xc3,0xab,0xe5,0x14,0x32,0x61,0xaa,0x5f,0xc4,
+    0xe1,0x82,0x42,0xec,0x25,0x46,0x83,0x5b,0x1e,0x09,0x1d,0xd6,0x8e,0xea,0x0c,0x86,0xe9,0xf7,0x32,0x73,
+    0xf0,0x49,0x96,0xce,0x21,0x6f,0x5c,0xaf,0x21,0x87,0x0a,0x66,0x5e,0xea,0x60,0x6e,0x8f,0x7e,0x00,0xc1,
+    0x08,0xc4,0xd1,0x69,0x16,0x45,0xb6,0xf7,0x03,0x17,0xb8,0x19,0x94,0x2f,0x29,0xb3,0xbf,0x37,0xc2,0x52,
+    0xc5,0x95,0x88,0xd6,0x15,0xe5,0x2f,0xc1,0x47,0xf1,0x00,0xd5,0x96,0x76,0x2a,0x02,0xc0,0x39,0xf1,0x2e,
+    0x6b,0x30,0x5b,0x31,0xd1,0xb0,0x41,0x24,0x9c,0xda,0xe4,0x95,0x12,0xca,0x0a,0x05,0x99,0xc8,0x2d,0x3b,
+    0x91,0x07,0x68,0x29,0xfc,0x39,0xa9,0xd2,0x64,0x30,0xce,0x68,0x74,0xb0,0x9e,0x58,0xe1,0x0e,0x97,0x16,
+    0x33,0x85,0xe5,0xb1,0x79,0xf2,0x78,0x10,0x10,0x05,0xde,0x95,0x04,0x5c,0x9d,0xf2,0x16,0x22,0xdc,0x4c,
+    0x6b,0x0d,0x0a,0xcc,0xb0,0xbf,0x9d,0xbc,0x7d,0xe3,0x51,0x93,0xd2,0x15,0x1e,0xba,0x41,0x59,0x26,0x50,
+    0xc3,0xf1,0xfe,0xad,0xe1,0x3c,0xdb,0x5b,0x62,0xf3,0x3a,0x91,0xa5,0xa7,0x2e,0xb1,0x61,0xd8,0xb1,0x9f,
+    0x45,0x01,0x1e,0x78,0x86,0x4f,0xa3,0x71,0x0b,0x00,0x03,0xde,0xe1,0xe6,0xb3,0xf6,0x56,0xb2,0x53,0xc3,
+    0x58,0xae,0xec,0x3b,0x3b,0xf7,0xd5,0x72,0xa7,0x5a,0xe5,0x8b,0x3e,0x8d,0x0e,0xe2,0x37,0x81,0x67,0x6f,
+    0x24,0x50,0xf7,0x78,0xf4,0xfa,0xd5,0xb7,0x1e,0x5c,0x4a,0xe1,0x18,0xdd,0x13,0x09,0x50,0xca,0xe3,0x8e,
+    0xf7,0xbd,0x84,0x30,0x69,0x43,0x24,0xb6,0x3b,0x58,0xeb,0xb4,0xbb,0xed,0x4f,0x48,0x6e,0xdf,0x16,0x2a,
+    0xc5,0xde,0x29,0x58,0xf5,0xbd,0xa2,0x86,0x68,0x9b,0x0a,0xe6,0x59,0x0c,0x9c,0xfa,0x4b,0xd6,0x96,0x31,
+    0xfe,0x98,0xd9,0x66,0xc7,0xf0,0x38,0x9d,0xd2,0xf3,0x3d,0xc4,0xa2,0x37,0x93,0xee,0x29,0x58,0xf9,0x16,
+    0xd3,0xa7,0x45,0x83,0xe0,0x21,0x99,0x72,0x79,0x3e,0x25,0x0b,0xbd,0xf9,0xf4,0x1f,0x9f,0x6b,0xf9,0xfe,
+    0x54,0x43,0xc2,0xc0,0x43,0x57,0xc3,0xf4,0x05,0x52,0xd9,0xc7,0x76,0xeb,0x18,0xc6,0x29,0x3b,0xc3,0x20,
+    0x7d,0x62,0xbb,0xc5,0xd6,0x6e,0x00,0x4f,0x66,0x8e,0xa0,0xad,0x0f,0xe5,0xbd,0xbc,0x90,0x3e,0x8f,0x84,
+    0xf5,0xda,0x0e,0x2a,0x16,0xcb,0xa6,0x95,0x65,0x2c,0x21,0xfd,0x54,0xfa,0x4f,0x94,0xf1,0xea,0xd8,0xd0,
+    0x61,0x3e,0x76,0x72,0x0b,0x70,0x68,0x4e,0x0f,0x5a,0xbb,0x80,0xe9,0xae,0xb2,0x0f,0x65,0xf1,0xca,0x46,
+    0xd4,0x20,0xc6,0xdb,0x1f,0x15,0x1d,0x33,0x29,0x03,0xa8,0x24,0xbc,0x99,0xc7,0x9e,0xf6,0x9f,0xb0,0x15,
+    0xdc,0x4d,0x18,0x47,0x58,0xcc,0xae,0xf1,0xc7,0xe8,0x6b,0x60,0x9a,0x46,0x12,0xe0,0x06,0xd0,0x90,0x69,
+    0x0e,0x4e,0xd7,0x39,0x66,0x09,0x6c,0xc8,0x42,0xb0,0x3c,0xe0,0xb6,0xa9,0x44,0xcc,0x66,0x58,0xeb,0xaf,
+    0x27,0x45,0xe2,0xad,0x60,0x93,0x77,0x7a,0xf1,0x76,0x72,0x7e,0x86,0x19,0xfa,0xc1,0x86,0x96,0xff,0x0e,
+    0x28,0xde,0xa1,0x8e,0x77,0x2d,0x8b,0xb1,0x9b,0x7e,0x72,0xf6,0xf6,0xb5,0xed,0x75,0xe0,0x9b,0x6f,0x02,
+    0x63,0xaa,0xe8,0xf4,0xd5,0x1a,0xfa,0x83,0x56,0xf5,0x57,0x0e,0xf3,0xad,0x2c,0xbd,0xea,0x7d,0x23,0x6a,
+    0xd6,0x94,0x40,0x8f,0x6d,0x93,0xba,0x94,0x86,0xcd,0x01,0x7b,0x96,0x4b,0x09,0xff,0x0f,0x7b,0xf9,0xaf,
+    0xfa,0xc3,0x9e,0x7d,0xdd,0xb2,0x47,0x6f,0x82,0xfe,0x0b,0xcd,0x47,0xd7,0xc1,0x19,0x2a,0x00,0x00,
+};
+
+constexpr uint8_t index_html_raw[] = {
+    0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x3c,0x68,0x74,0x6d,
+    0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,
+    0x22,0x3e,0x0a,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,0x20,0x41,
+    0x75,0x64,0x69,0x6f,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x20,0x50,0x61,0x6e,0x65,0x6c,0x3c,0x2f,
+    0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,
+    0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x73,0x74,0x79,0x6c,
+    0x65,0x2e,0x63,0x73,0x73,0x22,0x3e,0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,
+    0x79,0x3e,0x0a,0x3c,0x6e,0x61,0x76,0x3e,0x0a,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,0x48,0x6f,0x6d,0x65,
+    0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x69,0x6e,0x74,0x65,0x72,
+    0x6e,0x65,0x74,0x5f,0x72,0x61,0x64,0x69,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x49,0x6e,0x74,0x65,
+    0x72,0x6e,0x65,0x74,0x20,0x52,0x61,0x64,0x69,0x6f,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x66,0x69,0x6c,0x65,0x5f,0x65,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x2e,0x68,
+    0x74,0x6d,0x6c,0x22,0x3e,0x46,0x69,0x6c,0x65,0x20,0x45,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,
+    0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,
+    0x68,0x74,0x6d,0x6c,0x22,0x3e,0x41,0x6c,0x61,0x72,0x6d,0x73,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x2f,0x6e,
+    0x61,0x76,0x3e,0x0a,0x3c,0x68,0x31,0x3e,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,0x2d,0x54,0x6f,0x75,
+    0x63,0x68,0x2d,0x4c,0x43,0x44,0x2d,0x31,0x2e,0x38,0x35,0x43,0x20,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,
+    0x20,0x50,0x61,0x6e,0x65,0x6c,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,
+    0x3e,0x0a,0x3c,0x68,0x32,0x3e,0x45,0x53,0x50,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x3c,0x2f,0x68,0x32,
+    0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x64,0x65,0x76,0x69,0x63,0x65,0x53,0x74,0x61,
+    0x74,0x65,0x22,0x3e,0x4e,0x6f,0x77,0x20,0x70,0x6c,0x61,0x79,0x69,0x6e,0x67,0x3a,0x20,0x3c,0x73,0x70,
+    0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x6e,0x6f,0x77,0x50,0x6c,0x61,0x79,0x69,0x6e,0x67,0x22,0x3e,0x2d,
+    0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x20,0x7c,0x20,0x42,0x61,0x63,0x6b,0x65,0x6e,0x64,0x3a,0x20,0x3c,
+    0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x53,0x74,0x61,0x74,
+    0x65,0x22,0x3e,0x2d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x20,0x7c,0x20,0x53,0x63,0x72,0x65,0x65,0x6e,
+    0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x62,0x61,0x63,0x6b,0x6c,0x69,0x67,0x68,
+    0x74,0x53,0x74,0x61,0x74,0x65,0x22,0x3e,0x2d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x20,0x7c,0x20,0x41,
+    0x6c,0x61,0x72,0x6d,0x3a,0x20,0x3c,0x73,0x70,0x61,0x6e,0x20,0x69,0x64,0x3d,0x22,0x61,0x6c,0x61,0x72,
+    0x6d,0x53,0x74,0x61,0x74,0x65,0x22,0x3e,0x2d,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x64,0x69,
+    0x76,0x3e,0x0a,0x3c,0x70,0x72,0x65,0x20,0x69,0x64,0x3d,0x22,0x73,0x74,0x61,0x74,0x75,0x73,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x22,0x3e,0x4c,0x6f,0x61,0x64,0x69,0x6e,0x67,0x20,0x73,0x74,0x61,0x74,0x75,0x73,
+    0x2e,0x2e,0x2e,0x3c,0x2f,0x70,0x72,0x65,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,
+    0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x68,0x32,0x3e,0x41,0x75,0x64,0x69,0x6f,
+    0x20,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x3c,0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
+    0x74,0x79,0x70,0x65,0x3d,0x22,0x72,0x61,0x6e,0x67,0x65,0x22,0x20,0x69,0x64,0x3d,0x22,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x53,0x6c,0x69,0x64,0x65,0x72,0x22,0x20,0x6d,0x69,0x6e,0x3d,0x22,0x30,0x22,0x20,0x6d,
+    0x61,0x78,0x3d,0x22,0x32,0x31,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x31,0x30,0x22,0x20,0x6f,
+    0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x22,0x73,0x65,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,
+    0x22,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,
+    0x73,0x65,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,0x22,0x3e,0x53,0x65,0x74,0x20,0x56,0x6f,0x6c,
+    0x75,0x6d,0x65,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,
+    0x6f,0x6e,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x68,0x32,0x3e,0x53,0x74,
+    0x72,0x65,0x61,0x6d,0x20,0x41,0x75,0x64,0x69,0x6f,0x20,0x66,0x72,0x6f,0x6d,0x20,0x55,0x52,0x4c,0x3c,
+    0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x66,0x6f,0x72,0x3d,0x22,0x73,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x53,0x65,0x6c,0x65,0x63,0x74,0x22,0x3e,0x43,0x68,0x6f,0x6f,0x73,0x65,0x20,0x61,
+    0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0a,0x3c,0x73,
+    0x65,0x6c,0x65,0x63,0x74,0x20,0x69,0x64,0x3d,0x22,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x53,0x65,0x6c,
+    0x65,0x63,0x74,0x22,0x20,0x6f,0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,0x22,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x28,0x29,0x22,0x3e,0x0a,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,
+    0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x22,0x3e,0x2d,0x2d,0x20,0x43,0x75,0x73,0x74,0x6f,0x6d,0x20,
+    0x55,0x52,0x4c,0x20,0x6f,0x72,0x20,0x53,0x65,0x6c,0x65,0x63,0x74,0x20,0x53,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x20,0x2d,0x2d,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x6c,0x65,
+    0x63,0x74,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,
+    0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x75,0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,0x22,0x20,0x70,0x6c,0x61,
+    0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x65,0x78,0x61,
+    0x6d,0x70,0x6c,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x73,0x74,0x72,0x65,0x61,0x6d,0x2e,0x6d,0x70,0x33,0x22,
+    0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x70,
+    0x6c,0x61,0x79,0x55,0x72,0x6c,0x28,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x70,0x6c,0x61,
+    0x79,0x22,0x3e,0x50,0x6c,0x61,0x79,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x74,0x6f,0x70,0x50,0x6c,
+    0x61,0x79,0x62,0x61,0x63,0x6b,0x28,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x74,0x6f,
+    0x70,0x22,0x3e,0x53,0x74,0x6f,0x70,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x73,
+    0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x68,
+    0x32,0x3e,0x54,0x65,0x78,0x74,0x20,0x74,0x6f,0x20,0x53,0x70,0x65,0x65,0x63,0x68,0x3c,0x2f,0x68,0x32,
+    0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,
+    0x20,0x69,0x64,0x3d,0x22,0x74,0x74,0x73,0x54,0x65,0x78,0x74,0x22,0x20,0x70,0x6c,0x61,0x63,0x65,0x68,
+    0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x45,0x6e,0x74,0x65,0x72,0x20,0x74,0x65,0x78,0x74,0x22,0x3e,0x0a,
+    0x3c,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,0x69,0x64,0x3d,0x22,0x74,0x74,0x73,0x4c,0x61,0x6e,0x67,0x22,
+    0x3e,0x0a,0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x65,0x6e,0x22,
+    0x3e,0x45,0x6e,0x67,0x6c,0x69,0x73,0x68,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x6f,
+    0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x70,0x6c,0x22,0x3e,0x50,0x6f,0x6c,
+    0x69,0x73,0x68,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x6c,0x65,0x63,
+    0x74,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,
+    0x73,0x70,0x65,0x61,0x6b,0x28,0x29,0x22,0x3e,0x53,0x70,0x65,0x61,0x6b,0x3c,0x2f,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,
+    0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x68,0x32,0x3e,0x55,0x70,0x6c,0x6f,0x61,0x64,0x20,0x46,0x69,0x6c,0x65,
+    0x20,0x74,0x6f,0x20,0x53,0x44,0x20,0x43,0x61,0x72,0x64,0x3c,0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x66,0x6f,
+    0x72,0x6d,0x20,0x69,0x64,0x3d,0x22,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x6f,0x72,0x6d,0x22,0x20,0x6d,
+    0x65,0x74,0x68,0x6f,0x64,0x3d,0x22,0x50,0x4f,0x53,0x54,0x22,0x20,0x65,0x6e,0x63,0x74,0x79,0x70,0x65,
+    0x3d,0x22,0x6d,0x75,0x6c,0x74,0x69,0x70,0x61,0x72,0x74,0x2f,0x66,0x6f,0x72,0x6d,0x2d,0x64,0x61,0x74,
+    0x61,0x22,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x66,0x69,0x6c,
+    0x65,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x66,0x69,0x6c,0x65,0x22,0x20,0x72,0x65,0x71,0x75,0x69,
+    0x72,0x65,0x64,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x73,
+    0x75,0x62,0x6d,0x69,0x74,0x22,0x3e,0x55,0x70,0x6c,0x6f,0x61,0x64,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,
+    0x6e,0x3e,0x0a,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,
+    0x75,0x70,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+    0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,
+    0x3e,0x0a,0x3c,0x68,0x32,0x3e,0x50,0x6c,0x61,0x79,0x20,0x46,0x69,0x6c,0x65,0x20,0x66,0x72,0x6f,0x6d,
+    0x20,0x53,0x44,0x20,0x43,0x61,0x72,0x64,0x3c,0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,
+    0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x4c,
+    0x69,0x73,0x74,0x28,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x65,0x66,0x72,0x65,0x73,
+    0x68,0x22,0x3e,0x52,0x65,0x66,0x72,0x65,0x73,0x68,0x20,0x46,0x69,0x6c,0x65,0x20,0x4c,0x69,0x73,0x74,
+    0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+    0x3d,0x22,0x66,0x69,0x6c,0x65,0x2d,0x6c,0x69,0x73,0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x66,0x69,0x6c,
+    0x65,0x4c,0x69,0x73,0x74,0x22,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+    0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,0x3c,0x73,
+    0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x46,0x69,0x6c,
+    0x65,0x20,0x4e,0x61,0x6d,0x65,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x3c,0x73,0x70,0x61,0x6e,0x20,
+    0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x69,0x7a,0x65,0x22,0x3e,0x53,0x69,0x7a,0x65,0x3c,0x2f,0x73,
+    0x70,0x61,0x6e,0x3e,0x0a,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x61,0x63,
+    0x74,0x69,0x6f,0x6e,0x22,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,
+    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,
+    0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x3e,0x0a,0x3c,0x68,0x32,0x3e,0xf0,
+    0x9f,0x8e,0x99,0xef,0xb8,0x8f,0x20,0x4c,0x69,0x76,0x65,0x20,0x4d,0x69,0x63,0x72,0x6f,0x70,0x68,0x6f,
+    0x6e,0x65,0x20,0x53,0x74,0x72,0x65,0x61,0x6d,0x3c,0x2f,0x68,0x32,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x74,0x61,0x72,0x74,0x4d,0x69,0x63,
+    0x53,0x74,0x72,0x65,0x61,0x6d,0x28,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x70,0x6c,0x61,
+    0x79,0x22,0x3e,0xe2,0x96,0xb6,0x20,0x53,0x74,0x61,0x72,0x74,0x20,0x4d,0x69,0x63,0x20,0x53,0x74,0x72,
+    0x65,0x61,0x6d,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,
+    0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,0x74,0x6f,0x70,0x4d,0x69,0x63,0x53,0x74,0x72,
+    0x65,0x61,0x6d,0x28,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x74,0x6f,0x70,0x22,0x3e,
+    0xe2,0x8f,0xb9,0x20,0x53,0x74,0x6f,0x70,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x64,
+    0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,
+    0x3a,0x20,0x31,0x65,0x6d,0x3b,0x22,0x3e,0x0a,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x56,0x6f,0x6c,0x75,
+    0x6d,0x65,0x20,0x4c,0x65,0x76,0x65,0x6c,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0a,0x3c,0x64,
+    0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x76,0x75,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x20,
+    0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x32,0x35,0x30,0x70,0x78,0x3b,
+    0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,
+    0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x65,0x65,0x65,0x3b,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
+    0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x63,0x63,0x63,0x3b,0x22,0x3e,0x0a,0x3c,
+    0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x76,0x75,0x4c,0x65,0x76,0x65,0x6c,0x22,0x20,0x73,0x74,0x79,
+    0x6c,0x65,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x20,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x20,0x30,0x25,0x3b,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
+    0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x74,0x6f,0x20,
+    0x72,0x69,0x67,0x68,0x74,0x2c,0x20,0x23,0x30,0x66,0x30,0x2c,0x20,0x23,0x66,0x66,0x30,0x2c,0x20,0x23,
+    0x66,0x30,0x30,0x29,0x3b,0x20,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x77,0x69,
+    0x64,0x74,0x68,0x20,0x30,0x2e,0x31,0x73,0x3b,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,
+    0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,0x73,0x65,0x63,0x74,0x69,0x6f,
+    0x6e,0x3e,0x0a,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x2f,0x2f,0x20,0x55,0x70,0x6c,0x6f,0x61,
+    0x64,0x20,0x66,0x69,0x6c,0x65,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x70,0x6c,0x6f,0x61,0x64,0x46,0x6f,
+    0x72,0x6d,0x27,0x29,0x2e,0x6f,0x6e,0x73,0x75,0x62,0x6d,0x69,0x74,0x20,0x3d,0x20,0x61,0x73,0x79,0x6e,
+    0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x65,0x29,0x20,0x7b,0x0a,0x65,0x2e,0x70,0x72,
+    0x65,0x76,0x65,0x6e,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x28,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6f,0x72,0x6d,0x44,0x61,0x74,0x61,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x46,0x6f,0x72,
+    0x6d,0x44,0x61,0x74,0x61,0x28,0x74,0x68,0x69,0x73,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,
+    0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,
+    0x68,0x28,0x27,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x27,0x2c,0x20,0x7b,0x20,0x6d,0x65,0x74,0x68,0x6f,
+    0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x20,0x62,0x6f,0x64,0x79,0x3a,0x20,0x66,0x6f,0x72,
+    0x6d,0x44,0x61,0x74,0x61,0x20,0x7d,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
+    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x70,0x6c,0x6f,0x61,
+    0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
+    0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,0x74,0x65,0x78,
+    0x74,0x28,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,
+    0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x53,0x6c,0x69,0x64,
+    0x65,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,
+    0x76,0x6f,0x6c,0x75,0x6d,0x65,0x27,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x27,
+    0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x27,0x43,
+    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x27,0x3a,0x20,0x27,0x61,0x70,0x70,0x6c,0x69,
+    0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,
+    0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x27,
+    0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x20,0x2b,0x20,0x76,0x61,0x6c,0x75,0x65,0x0a,0x7d,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x70,0x6c,0x61,0x79,0x55,0x72,0x6c,0x28,0x29,
+    0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x72,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,
+    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
+    0x75,0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x66,0x65,
+    0x74,0x63,0x68,0x28,0x27,0x2f,0x70,0x6c,0x61,0x79,0x27,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,
+    0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,
+    0x7b,0x20,0x27,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x27,0x3a,0x20,0x27,0x61,
+    0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,
+    0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,
+    0x79,0x3a,0x20,0x27,0x75,0x72,0x6c,0x3d,0x27,0x20,0x2b,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,
+    0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x72,0x6c,0x29,0x0a,0x7d,0x29,0x3b,0x0a,
+    0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x6f,0x70,0x50,0x6c,0x61,0x79,0x62,
+    0x61,0x63,0x6b,0x28,0x29,0x20,0x7b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x73,0x74,0x6f,0x70,
+    0x27,0x2c,0x20,0x7b,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,
+    0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x70,0x65,0x61,0x6b,
+    0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x64,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
+    0x64,0x28,0x27,0x74,0x74,0x73,0x54,0x65,0x78,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x6c,0x61,0x6e,0x67,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+    0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x74,0x74,
+    0x73,0x4c,0x61,0x6e,0x67,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,
+    0x28,0x27,0x2f,0x73,0x70,0x65,0x65,0x63,0x68,0x27,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,
+    0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,
+    0x20,0x27,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x27,0x3a,0x20,0x27,0x61,0x70,
+    0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,
+    0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,
+    0x3a,0x20,0x27,0x74,0x65,0x78,0x74,0x3d,0x27,0x20,0x2b,0x20,0x65,0x6e,0x63,0x6f,0x64,0x65,0x55,0x52,
+    0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x74,0x65,0x78,0x74,0x29,0x20,0x2b,0x20,0x27,
+    0x26,0x6c,0x61,0x6e,0x67,0x3d,0x27,0x20,0x2b,0x20,0x6c,0x61,0x6e,0x67,0x0a,0x7d,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x6c,0x65,0x74,0x20,0x6c,0x61,0x73,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3d,0x20,0x6e,0x75,
+    0x6c,0x6c,0x3b,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x74,0x56,0x6f,0x6c,0x75,
+    0x6d,0x65,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
+    0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+    0x42,0x79,0x49,0x64,0x28,0x27,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x53,0x6c,0x69,0x64,0x65,0x72,0x27,0x29,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x69,0x66,0x20,0x28,0x76,0x61,0x6c,0x75,0x65,0x20,0x21,0x3d,
+    0x3d,0x20,0x6c,0x61,0x73,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x29,0x20,0x7b,0x0a,0x66,0x65,0x74,0x63,
+    0x68,0x28,0x27,0x2f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x27,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,
+    0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,
+    0x7b,0x20,0x27,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x27,0x3a,0x20,0x27,0x61,
+    0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,
+    0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,
+    0x79,0x3a,0x20,0x27,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x20,0x2b,0x20,0x76,0x61,0x6c,0x75,0x65,0x0a,
+    0x7d,0x29,0x3b,0x0a,0x6c,0x61,0x73,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3d,0x20,0x76,0x61,0x6c,
+    0x75,0x65,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,0x20,0x7b,0x0a,0x74,0x72,
+    0x79,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,0x20,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x27,0x29,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,
+    0x72,0x65,0x73,0x70,0x2e,0x74,0x65,0x78,0x74,0x28,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x76,
+    0x6f,0x6c,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x49,0x6e,0x74,0x28,0x74,0x65,0x78,0x74,0x2e,0x74,
+    0x72,0x69,0x6d,0x28,0x29,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x69,0x73,0x4e,0x61,0x4e,0x28,0x76,
+    0x6f,0x6c,0x29,0x29,0x20,0x7b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x53,0x6c,
+    0x69,0x64,0x65,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x76,0x6f,0x6c,0x3b,0x0a,
+    0x7d,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x6f,0x6c,0x65,0x2e,0x77,0x61,0x72,0x6e,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,
+    0x66,0x65,0x74,0x63,0x68,0x20,0x63,0x75,0x72,0x72,0x65,0x6e,0x74,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x22,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x20,0x7b,0x0a,0x74,0x72,
+    0x79,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,0x20,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x73,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x74,0x65,0x78,0x74,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,
+    0x72,0x65,0x73,0x70,0x2e,0x74,0x65,0x78,0x74,0x28,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+    0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x74,
+    0x61,0x74,0x75,0x73,0x4f,0x75,0x74,0x70,0x75,0x74,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
+    0x78,0x74,0x20,0x3d,0x20,0x74,0x65,0x78,0x74,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,
+    0x65,0x72,0x72,0x29,0x20,0x7b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x74,0x61,0x74,0x75,0x73,0x4f,0x75,
+    0x74,0x70,0x75,0x74,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,
+    0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x73,0x74,0x61,0x74,0x75,
+    0x73,0x2e,0x27,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x28,0x29,0x20,0x7b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,
+    0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x6c,0x69,0x73,0x74,0x66,0x69,0x6c,0x65,0x73,0x3f,0x65,0x78,
+    0x74,0x3d,0x2e,0x6d,0x70,0x33,0x26,0x70,0x61,0x74,0x68,0x3d,0x2f,0x6d,0x75,0x73,0x69,0x63,0x26,0x74,
+    0x79,0x70,0x65,0x3d,0x6a,0x73,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x69,
+    0x6c,0x65,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x70,0x2e,0x6a,0x73,0x6f,
+    0x6e,0x28,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x20,
+    0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
+    0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x27,0x29,0x3b,0x0a,0x2f,
+    0x2f,0x20,0x43,0x6c,0x65,0x61,0x72,0x20,0x61,0x6e,0x64,0x20,0x72,0x65,0x73,0x74,0x6f,0x72,0x65,0x20,
+    0x68,0x65,0x61,0x64,0x65,0x72,0x0a,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x2e,0x69,0x6e,0x6e,0x65,
+    0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x60,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
+    0x3d,0x22,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,
+    0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6e,0x61,0x6d,0x65,0x22,0x3e,0x46,
+    0x69,0x6c,0x65,0x20,0x4e,0x61,0x6d,0x65,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x3c,0x73,0x70,0x61,
+    0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x69,0x7a,0x65,0x22,0x3e,0x53,0x69,0x7a,0x65,0x3c,
+    0x2f,0x73,0x70,0x61,0x6e,0x3e,0x0a,0x3c,0x73,0x70,0x61,0x6e,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+    0x61,0x63,0x74,0x69,0x6f,0x6e,0x22,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x73,0x70,0x61,0x6e,
+    0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x60,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x66,0x69,0x6c,
+    0x65,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,
+    0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,
+    0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,
+    0x77,0x27,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,
+    0x27,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x4e,0x6f,0x20,0x2e,0x6d,0x70,0x33,0x20,0x66,0x69,0x6c,0x65,0x73,
+    0x20,0x66,0x6f,0x75,0x6e,0x64,0x2e,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x27,0x3b,0x0a,0x66,0x69,0x6c,
+    0x65,0x4c,0x69,0x73,0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x72,0x6f,
+    0x77,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x66,0x69,0x6c,0x65,0x73,0x2e,
+    0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x66,0x69,0x6c,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x72,0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,
+    0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,
+    0x0a,0x72,0x6f,0x77,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x66,0x69,
+    0x6c,0x65,0x2d,0x72,0x6f,0x77,0x27,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x61,0x6d,0x65,0x20,
+    0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x28,0x27,0x73,0x70,0x61,0x6e,0x27,0x29,0x3b,0x0a,0x6e,0x61,0x6d,0x65,0x2e,0x63,
+    0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x6e,0x61,0x6d,0x65,0x27,0x3b,0x0a,0x6e,
+    0x61,0x6d,0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x66,0x69,0x6c,0x65,
+    0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x69,0x7a,0x65,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x28,0x27,0x73,0x70,0x61,0x6e,0x27,0x29,0x3b,0x0a,0x73,0x69,0x7a,0x65,0x2e,0x63,0x6c,0x61,
+    0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x73,0x69,0x7a,0x65,0x27,0x3b,0x0a,0x73,0x69,0x7a,
+    0x65,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x60,0x24,0x7b,0x66,0x69,0x6c,
+    0x65,0x2e,0x73,0x69,0x7a,0x65,0x7d,0x20,0x42,0x60,0x3b,0x0a,0x2f,0x2f,0x20,0x50,0x6c,0x61,0x79,0x20,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,
+    0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,
+    0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x70,0x6c,0x61,
+    0x79,0x42,0x74,0x6e,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x70,0x6c,
+    0x61,0x79,0x27,0x3b,0x0a,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
+    0x78,0x74,0x20,0x3d,0x20,0x27,0xe2,0x96,0xb6,0x20,0x50,0x6c,0x61,0x79,0x27,0x3b,0x0a,0x70,0x6c,0x61,
+    0x79,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,
+    0x20,0x7b,0x0a,0x6c,0x65,0x74,0x20,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x66,0x69,0x6c,0x65,0x2e,0x6e,
+    0x61,0x6d,0x65,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x70,0x61,0x74,0x68,0x2e,0x73,0x74,0x61,0x72,0x74,
+    0x73,0x57,0x69,0x74,0x68,0x28,0x22,0x2f,0x22,0x29,0x29,0x20,0x70,0x61,0x74,0x68,0x20,0x3d,0x20,0x22,
+    0x2f,0x22,0x20,0x2b,0x20,0x70,0x61,0x74,0x68,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x70,
+    0x6c,0x61,0x79,0x66,0x69,0x6c,0x65,0x27,0x2c,0x20,0x7b,0x0a,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,
+    0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x27,
+    0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,0x27,0x3a,0x20,0x27,0x61,0x70,0x70,0x6c,
+    0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,
+    0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,
+    0x27,0x70,0x61,0x74,0x68,0x3d,0x2f,0x6d,0x75,0x73,0x69,0x63,0x2f,0x27,0x20,0x2b,0x20,0x65,0x6e,0x63,
+    0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x70,0x61,0x74,0x68,
+    0x29,0x0a,0x7d,0x29,0x3b,0x0a,0x7d,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x70,0x6c,0x61,0x79,0x43,
+    0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
+    0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x73,0x70,0x61,0x6e,0x27,
+    0x29,0x3b,0x0a,0x70,0x6c,0x61,0x79,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x63,0x6c,0x61,
+    0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x61,0x63,0x74,0x69,0x6f,0x6e,0x27,0x3b,0x0a,0x70,
+    0x6c,0x61,0x79,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,
+    0x68,0x69,0x6c,0x64,0x28,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,
+    0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x72,0x6f,
+    0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x73,0x69,0x7a,0x65,0x29,0x3b,
+    0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x70,0x6c,0x61,
+    0x79,0x43,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x29,0x3b,0x0a,0x66,0x69,0x6c,0x65,0x4c,0x69,0x73,
+    0x74,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x72,0x6f,0x77,0x29,0x3b,0x0a,
+    0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
+    0x20,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x20,0x7b,0x0a,0x74,0x72,
+    0x79,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,0x20,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x27,
+    0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,
+    0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x70,0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x3b,0x0a,0x63,
+    0x6f,0x6e,0x73,0x74,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+    0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x53,0x65,0x6c,0x65,0x63,0x74,0x27,0x29,0x3b,0x0a,0x73,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x73,0x2e,0x66,0x6f,0x72,0x45,0x61,0x63,0x68,0x28,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x70,0x74,0x20,0x3d,0x20,0x64,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+    0x28,0x27,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x6f,0x70,0x74,0x2e,0x76,0x61,0x6c,0x75,
+    0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x2e,0x75,0x72,0x6c,0x3b,0x0a,0x6f,0x70,0x74,
+    0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x69,
+    0x6f,0x6e,0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x73,0x65,0x6c,0x65,0x63,0x74,0x2e,0x61,0x70,0x70,0x65,
+    0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6f,0x70,0x74,0x29,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x7d,0x20,
+    0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,
+    0x77,0x61,0x72,0x6e,0x28,0x27,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,
+    0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x69,0x73,0x74,0x27,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,
+    0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,0x6c,0x65,0x63,0x74,0x53,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x72,0x6f,0x70,0x64,0x6f,
+    0x77,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x53,0x65,0x6c,
+    0x65,0x63,0x74,0x27,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x72,0x6c,0x20,0x3d,0x20,0x64,
+    0x72,0x6f,0x70,0x64,0x6f,0x77,0x6e,0x2e,0x76,0x61,0x6c,0x75,0x65,0x3b,0x0a,0x69,0x66,0x20,0x28,0x75,
+    0x72,0x6c,0x29,0x20,0x7b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
+    0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,0x27,
+    0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x75,0x72,0x6c,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x2f,
+    0x2f,0x20,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+    0x2d,0x0a,0x6c,0x65,0x74,0x20,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2c,0x20,0x61,0x6e,0x61,0x6c,
+    0x79,0x73,0x65,0x72,0x2c,0x20,0x76,0x75,0x4d,0x65,0x74,0x65,0x72,0x2c,0x20,0x6b,0x65,0x65,0x70,0x52,
+    0x65,0x61,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x2c,0x20,0x6d,0x69,0x63,0x41,
+    0x62,0x6f,0x72,0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x3b,0x0a,0x6c,0x65,0x74,0x20,
+    0x6c,0x65,0x66,0x74,0x6f,0x76,0x65,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x55,0x69,0x6e,0x74,0x38,
+    0x41,0x72,0x72,0x61,0x79,0x28,0x30,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x66,0x6f,0x72,0x20,0x68,0x61,0x6e,
+    0x64,0x6c,0x69,0x6e,0x67,0x20,0x73,0x70,0x6c,0x69,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x73,0x0a,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x4d,0x69,0x63,0x53,0x74,0x72,
+    0x65,0x61,0x6d,0x28,0x29,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x21,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,
+    0x78,0x20,0x7c,0x7c,0x20,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x73,0x74,0x61,0x74,0x65,0x20,
+    0x3d,0x3d,0x3d,0x20,0x22,0x63,0x6c,0x6f,0x73,0x65,0x64,0x22,0x29,0x20,0x7b,0x0a,0x61,0x75,0x64,0x69,
+    0x6f,0x43,0x74,0x78,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x41,
+    0x75,0x64,0x69,0x6f,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,0x20,0x7c,0x7c,0x20,0x77,0x69,0x6e,0x64,0x6f,
+    0x77,0x2e,0x77,0x65,0x62,0x6b,0x69,0x74,0x41,0x75,0x64,0x69,0x6f,0x43,0x6f,0x6e,0x74,0x65,0x78,0x74,
+    0x29,0x28,0x29,0x3b,0x0a,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x61,0x75,0x64,0x69,
+    0x6f,0x43,0x74,0x78,0x2e,0x73,0x74,0x61,0x74,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x22,0x73,0x75,0x73,0x70,
+    0x65,0x6e,0x64,0x65,0x64,0x22,0x29,0x20,0x7b,0x0a,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x72,
+    0x65,0x73,0x75,0x6d,0x65,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x61,0x6e,0x61,0x6c,0x79,0x73,0x65,0x72,0x20,
+    0x3d,0x20,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x41,0x6e,0x61,
+    0x6c,0x79,0x73,0x65,0x72,0x28,0x29,0x3b,0x0a,0x61,0x6e,0x61,0x6c,0x79,0x73,0x65,0x72,0x2e,0x66,0x66,
+    0x74,0x53,0x69,0x7a,0x65,0x20,0x3d,0x20,0x32,0x35,0x36,0x3b,0x0a,0x76,0x75,0x4d,0x65,0x74,0x65,0x72,
+    0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x76,0x75,0x4c,0x65,0x76,0x65,0x6c,0x22,0x29,0x3b,0x0a,0x6d,
+    0x69,0x63,0x41,0x62,0x6f,0x72,0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x20,0x3d,0x20,
+    0x6e,0x65,0x77,0x20,0x41,0x62,0x6f,0x72,0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x28,
+    0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x69,0x67,0x6e,0x61,0x6c,0x20,0x3d,0x20,0x6d,0x69,
+    0x63,0x41,0x62,0x6f,0x72,0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x2e,0x73,0x69,0x67,
+    0x6e,0x61,0x6c,0x3b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x22,0x2f,0x73,0x74,0x72,0x65,0x61,0x6d,0x3f,
+    0x66,0x6f,0x72,0x6d,0x61,0x74,0x3d,0x70,0x63,0x6d,0x22,0x2c,0x20,0x7b,0x20,0x73,0x69,0x67,0x6e,0x61,
+    0x6c,0x20,0x7d,0x29,0x2e,0x74,0x68,0x65,0x6e,0x28,0x61,0x73,0x79,0x6e,0x63,0x20,0x72,0x65,0x73,0x70,
+    0x6f,0x6e,0x73,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x21,0x72,0x65,0x73,0x70,0x6f,
+    0x6e,0x73,0x65,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,0x6f,0x77,0x20,0x6e,0x65,0x77,0x20,0x45,0x72,
+    0x72,0x6f,0x72,0x28,0x22,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,0x74,0x6f,0x20,0x63,0x6f,0x6e,0x6e,0x65,
+    0x63,0x74,0x20,0x74,0x6f,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x22,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x72,0x65,0x61,0x64,0x65,0x72,0x20,0x3d,0x20,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x2e,
+    0x62,0x6f,0x64,0x79,0x2e,0x67,0x65,0x74,0x52,0x65,0x61,0x64,0x65,0x72,0x28,0x29,0x3b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x52,0x61,0x74,0x65,0x20,0x3d,0x20,0x31,0x36,0x30,
+    0x30,0x30,0x3b,0x0a,0x6b,0x65,0x65,0x70,0x52,0x65,0x61,0x64,0x69,0x6e,0x67,0x20,0x3d,0x20,0x74,0x72,
+    0x75,0x65,0x3b,0x0a,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6b,0x65,0x65,0x70,0x52,0x65,0x61,0x64,0x69,
+    0x6e,0x67,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x7b,0x20,0x76,0x61,0x6c,0x75,0x65,0x2c,
+    0x20,0x64,0x6f,0x6e,0x65,0x20,0x7d,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x61,0x64,
+    0x65,0x72,0x2e,0x72,0x65,0x61,0x64,0x28,0x29,0x3b,0x0a,0x69,0x66,0x20,0x28,0x64,0x6f,0x6e,0x65,0x20,
+    0x7c,0x7c,0x20,0x21,0x76,0x61,0x6c,0x75,0x65,0x20,0x7c,0x7c,0x20,0x76,0x61,0x6c,0x75,0x65,0x2e,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x20,0x3d,0x3d,0x3d,0x20,0x30,0x29,0x20,0x62,0x72,0x65,0x61,0x6b,0x3b,0x0a,
+    0x6c,0x65,0x74,0x20,0x63,0x6f,0x6d,0x62,0x69,0x6e,0x65,0x64,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x55,
+    0x69,0x6e,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x6c,0x65,0x66,0x74,0x6f,0x76,0x65,0x72,0x2e,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x20,0x2b,0x20,0x76,0x61,0x6c,0x75,0x65,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,
+    0x29,0x3b,0x0a,0x63,0x6f,0x6d,0x62,0x69,0x6e,0x65,0x64,0x2e,0x73,0x65,0x74,0x28,0x6c,0x65,0x66,0x74,
+    0x6f,0x76,0x65,0x72,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x63,0x6f,0x6d,0x62,0x69,0x6e,0x65,0x64,0x2e,0x73,
+    0x65,0x74,0x28,0x76,0x61,0x6c,0x75,0x65,0x2c,0x20,0x6c,0x65,0x66,0x74,0x6f,0x76,0x65,0x72,0x2e,0x6c,
+    0x65,0x6e,0x67,0x74,0x68,0x29,0x3b,0x0a,0x6c,0x65,0x74,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,
+    0x75,0x6e,0x74,0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,0x66,0x6c,0x6f,0x6f,0x72,0x28,0x63,0x6f,0x6d,
+    0x62,0x69,0x6e,0x65,0x64,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x2f,0x20,0x32,0x29,0x3b,0x0a,0x6c,
+    0x65,0x74,0x20,0x75,0x73,0x61,0x62,0x6c,0x65,0x42,0x79,0x74,0x65,0x73,0x20,0x3d,0x20,0x73,0x61,0x6d,
+    0x70,0x6c,0x65,0x43,0x6f,0x75,0x6e,0x74,0x20,0x2a,0x20,0x32,0x3b,0x0a,0x6c,0x65,0x74,0x20,0x70,0x63,
+    0x6d,0x56,0x69,0x65,0x77,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x61,0x56,0x69,0x65,0x77,
+    0x28,0x63,0x6f,0x6d,0x62,0x69,0x6e,0x65,0x64,0x2e,0x62,0x75,0x66,0x66,0x65,0x72,0x2c,0x20,0x30,0x2c,
+    0x20,0x75,0x73,0x61,0x62,0x6c,0x65,0x42,0x79,0x74,0x65,0x73,0x29,0x3b,0x0a,0x6c,0x65,0x74,0x20,0x66,
+    0x6c,0x6f,0x61,0x74,0x41,0x72,0x72,0x61,0x79,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x46,0x6c,0x6f,0x61,
+    0x74,0x33,0x32,0x41,0x72,0x72,0x61,0x79,0x28,0x73,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x75,0x6e,0x74,
+    0x29,0x3b,0x0a,0x66,0x6f,0x72,0x20,0x28,0x6c,0x65,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,
+    0x20,0x3c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x43,0x6f,0x75,0x6e,0x74,0x3b,0x20,0x69,0x2b,0x2b,0x29,
+    0x20,0x7b,0x0a,0x66,0x6c,0x6f,0x61,0x74,0x41,0x72,0x72,0x61,0x79,0x5b,0x69,0x5d,0x20,0x3d,0x20,0x70,
+    0x63,0x6d,0x56,0x69,0x65,0x77,0x2e,0x67,0x65,0x74,0x49,0x6e,0x74,0x31,0x36,0x28,0x69,0x20,0x2a,0x20,
+    0x32,0x2c,0x20,0x74,0x72,0x75,0x65,0x29,0x20,0x2f,0x20,0x33,0x32,0x37,0x36,0x38,0x3b,0x0a,0x7d,0x0a,
+    0x6c,0x65,0x74,0x20,0x61,0x75,0x64,0x69,0x6f,0x42,0x75,0x66,0x66,0x65,0x72,0x20,0x3d,0x20,0x61,0x75,
+    0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x42,0x75,0x66,0x66,0x65,0x72,0x28,
+    0x31,0x2c,0x20,0x66,0x6c,0x6f,0x61,0x74,0x41,0x72,0x72,0x61,0x79,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,
+    0x2c,0x20,0x73,0x61,0x6d,0x70,0x6c,0x65,0x52,0x61,0x74,0x65,0x29,0x3b,0x0a,0x61,0x75,0x64,0x69,0x6f,
+    0x42,0x75,0x66,0x66,0x65,0x72,0x2e,0x63,0x6f,0x70,0x79,0x54,0x6f,0x43,0x68,0x61,0x6e,0x6e,0x65,0x6c,
+    0x28,0x66,0x6c,0x6f,0x61,0x74,0x41,0x72,0x72,0x61,0x79,0x2c,0x20,0x30,0x29,0x3b,0x0a,0x6c,0x65,0x74,
+    0x20,0x73,0x6f,0x75,0x72,0x63,0x65,0x20,0x3d,0x20,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x63,
+    0x72,0x65,0x61,0x74,0x65,0x42,0x75,0x66,0x66,0x65,0x72,0x53,0x6f,0x75,0x72,0x63,0x65,0x28,0x29,0x3b,
+    0x0a,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x62,0x75,0x66,0x66,0x65,0x72,0x20,0x3d,0x20,0x61,0x75,0x64,
+    0x69,0x6f,0x42,0x75,0x66,0x66,0x65,0x72,0x3b,0x0a,0x73,0x6f,0x75,0x72,0x63,0x65,0x2e,0x63,0x6f,0x6e,
+    0x6e,0x65,0x63,0x74,0x28,0x61,0x6e,0x61,0x6c,0x79,0x73,0x65,0x72,0x29,0x3b,0x0a,0x61,0x6e,0x61,0x6c,
+    0x79,0x73,0x65,0x72,0x2e,0x63,0x6f,0x6e,0x6e,0x65,0x63,0x74,0x28,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,
+    0x78,0x2e,0x64,0x65,0x73,0x74,0x69,0x6e,0x61,0x74,0x69,0x6f,0x6e,0x29,0x3b,0x0a,0x73,0x6f,0x75,0x72,
+    0x63,0x65,0x2e,0x73,0x74,0x61,0x72,0x74,0x28,0x29,0x3b,0x0a,0x6c,0x65,0x66,0x74,0x6f,0x76,0x65,0x72,
+    0x20,0x3d,0x20,0x63,0x6f,0x6d,0x62,0x69,0x6e,0x65,0x64,0x2e,0x73,0x6c,0x69,0x63,0x65,0x28,0x75,0x73,
+    0x61,0x62,0x6c,0x65,0x42,0x79,0x74,0x65,0x73,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x53,0x61,0x76,0x65,0x20,
+    0x6c,0x65,0x66,0x74,0x6f,0x76,0x65,0x72,0x20,0x66,0x6f,0x72,0x20,0x6e,0x65,0x78,0x74,0x20,0x66,0x72,
+    0x61,0x6d,0x65,0x0a,0x64,0x72,0x61,0x77,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,0x3b,0x0a,0x7d,0x0a,
+    0x7d,0x29,0x2e,0x63,0x61,0x74,0x63,0x68,0x28,0x65,0x72,0x72,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x69,0x66,
+    0x20,0x28,0x65,0x72,0x72,0x2e,0x6e,0x61,0x6d,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x22,0x41,0x62,0x6f,0x72,
+    0x74,0x45,0x72,0x72,0x6f,0x72,0x22,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x6c,
+    0x6f,0x67,0x28,0x22,0x4d,0x69,0x63,0x20,0x73,0x74,0x72,0x65,0x61,0x6d,0x20,0x61,0x62,0x6f,0x72,0x74,
+    0x65,0x64,0x2e,0x22,0x29,0x3b,0x0a,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x6f,0x6c,0x65,0x2e,0x65,0x72,0x72,0x6f,0x72,0x28,0x22,0x53,0x74,0x72,0x65,0x61,0x6d,0x20,0x65,0x72,
+    0x72,0x6f,0x72,0x3a,0x22,0x2c,0x20,0x65,0x72,0x72,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x6f,0x70,0x4d,0x69,0x63,0x53,0x74,0x72,
+    0x65,0x61,0x6d,0x28,0x29,0x20,0x7b,0x0a,0x6b,0x65,0x65,0x70,0x52,0x65,0x61,0x64,0x69,0x6e,0x67,0x20,
+    0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x69,0x66,0x20,0x28,0x6d,0x69,0x63,0x41,0x62,0x6f,0x72,
+    0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x29,0x20,0x6d,0x69,0x63,0x41,0x62,0x6f,0x72,
+    0x74,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x6c,0x65,0x72,0x2e,0x61,0x62,0x6f,0x72,0x74,0x28,0x29,0x3b,
+    0x0a,0x69,0x66,0x20,0x28,0x76,0x75,0x4d,0x65,0x74,0x65,0x72,0x29,0x20,0x76,0x75,0x4d,0x65,0x74,0x65,
+    0x72,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x77,0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x22,0x30,0x25,0x22,
+    0x3b,0x0a,0x69,0x66,0x20,0x28,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x20,0x26,0x26,0x20,0x61,0x75,
+    0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x73,0x74,0x61,0x74,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x22,0x72,0x75,
+    0x6e,0x6e,0x69,0x6e,0x67,0x22,0x29,0x20,0x7b,0x0a,0x61,0x75,0x64,0x69,0x6f,0x43,0x74,0x78,0x2e,0x73,
+    0x75,0x73,0x70,0x65,0x6e,0x64,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,
+    0x6f,0x6e,0x20,0x64,0x72,0x61,0x77,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x64,0x61,0x74,0x61,0x41,0x72,0x72,0x61,0x79,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,
+    0x55,0x69,0x6e,0x74,0x38,0x41,0x72,0x72,0x61,0x79,0x28,0x61,0x6e,0x61,0x6c,0x79,0x73,0x65,0x72,0x2e,
+    0x66,0x72,0x65,0x71,0x75,0x65,0x6e,0x63,0x79,0x42,0x69,0x6e,0x43,0x6f,0x75,0x6e,0x74,0x29,0x3b,0x0a,
+    0x61,0x6e,0x61,0x6c,0x79,0x73,0x65,0x72,0x2e,0x67,0x65,0x74,0x42,0x79,0x74,0x65,0x54,0x69,0x6d,0x65,
+    0x44,0x6f,0x6d,0x61,0x69,0x6e,0x44,0x61,0x74,0x61,0x28,0x64,0x61,0x74,0x61,0x41,0x72,0x72,0x61,0x79,
+    0x29,0x3b,0x0a,0x6c,0x65,0x74,0x20,0x73,0x75,0x6d,0x20,0x3d,0x20,0x30,0x3b,0x0a,0x66,0x6f,0x72,0x20,
+    0x28,0x6c,0x65,0x74,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,0x64,0x61,0x74,0x61,
+    0x41,0x72,0x72,0x61,0x79,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,
+    0x0a,0x6c,0x65,0x74,0x20,0x76,0x20,0x3d,0x20,0x28,0x64,0x61,0x74,0x61,0x41,0x72,0x72,0x61,0x79,0x5b,
+    0x69,0x5d,0x20,0x2d,0x20,0x31,0x32,0x38,0x29,0x20,0x2f,0x20,0x31,0x32,0x38,0x3b,0x0a,0x73,0x75,0x6d,
+    0x20,0x2b,0x3d,0x20,0x76,0x20,0x2a,0x20,0x76,0x3b,0x0a,0x7d,0x0a,0x6c,0x65,0x74,0x20,0x72,0x6d,0x73,
+    0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,0x73,0x71,0x72,0x74,0x28,0x73,0x75,0x6d,0x20,0x2f,0x20,0x64,
+    0x61,0x74,0x61,0x41,0x72,0x72,0x61,0x79,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x3b,0x0a,0x6c,0x65,
+    0x74,0x20,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,0x6d,0x69,0x6e,0x28,
+    0x31,0x2c,0x20,0x72,0x6d,0x73,0x20,0x2a,0x20,0x32,0x29,0x3b,0x0a,0x76,0x75,0x4d,0x65,0x74,0x65,0x72,
+    0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,0x77,0x69,0x64,0x74,0x68,0x20,0x3d,0x20,0x4d,0x61,0x74,0x68,0x2e,
+    0x72,0x6f,0x75,0x6e,0x64,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x2a,0x20,0x31,0x30,0x30,0x29,0x20,
+    0x2b,0x20,0x22,0x25,0x22,0x3b,0x0a,0x69,0x66,0x20,0x28,0x6b,0x65,0x65,0x70,0x52,0x65,0x61,0x64,0x69,
+    0x6e,0x67,0x29,0x20,0x72,0x65,0x71,0x75,0x65,0x73,0x74,0x41,0x6e,0x69,0x6d,0x61,0x74,0x69,0x6f,0x6e,
+    0x46,0x72,0x61,0x6d,0x65,0x28,0x64,0x72,0x61,0x77,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x2f,0x2f,0x20,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,0x2d,
+    0x2d,0x2d,0x2d,0x0a,0x2f,0x2f,0x20,0x4c,0x69,0x76,0x65,0x20,0x73,0x74,0x61,0x74,0x65,0x20,0x70,0x75,
+    0x73,0x68,0x65,0x64,0x20,0x62,0x79,0x20,0x74,0x68,0x65,0x20,0x64,0x65,0x76,0x69,0x63,0x65,0x20,0x28,
+    0x2f,0x65,0x76,0x65,0x6e,0x74,0x73,0x29,0x3b,0x20,0x74,0x68,0x65,0x20,0x66,0x75,0x6c,0x6c,0x20,0x73,
+    0x74,0x61,0x74,0x75,0x73,0x20,0x70,0x61,0x67,0x65,0x20,0x69,0x73,0x20,0x72,0x65,0x66,0x72,0x65,0x73,
+    0x68,0x65,0x64,0x20,0x72,0x61,0x72,0x65,0x6c,0x79,0x0a,0x6c,0x65,0x74,0x20,0x76,0x6f,0x6c,0x75,0x6d,
+    0x65,0x50,0x6f,0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0x0a,0x66,
+    0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,
+    0x29,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x21,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x45,0x76,0x65,0x6e,
+    0x74,0x53,0x6f,0x75,0x72,0x63,0x65,0x29,0x20,0x7b,0x0a,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x50,0x6f,0x6c,
+    0x6c,0x54,0x69,0x6d,0x65,0x72,0x20,0x3d,0x20,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,
+    0x28,0x6c,0x6f,0x61,0x64,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,0x31,0x30,0x30,0x30,0x30,0x29,0x3b,
+    0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,0x76,0x65,
+    0x6e,0x74,0x73,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,
+    0x65,0x28,0x27,0x2f,0x65,0x76,0x65,0x6e,0x74,0x73,0x27,0x29,0x3b,0x0a,0x65,0x76,0x65,0x6e,0x74,0x73,
+    0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x76,
+    0x6f,0x6c,0x75,0x6d,0x65,0x27,0x2c,0x20,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x64,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,
+    0x74,0x61,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x73,0x6c,0x69,0x64,0x65,0x72,0x20,0x3d,0x20,
+    0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
+    0x79,0x49,0x64,0x28,0x27,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x53,0x6c,0x69,0x64,0x65,0x72,0x27,0x29,0x3b,
+    0x0a,0x69,0x66,0x20,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x61,0x63,0x74,0x69,0x76,0x65,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x20,0x21,0x3d,0x3d,0x20,0x73,0x6c,0x69,0x64,0x65,0x72,0x29,0x20,
+    0x73,0x6c,0x69,0x64,0x65,0x72,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x64,0x2e,0x76,0x6f,0x6c,
+    0x75,0x6d,0x65,0x3b,0x0a,0x6c,0x61,0x73,0x74,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x20,0x3d,0x20,0x53,0x74,
+    0x72,0x69,0x6e,0x67,0x28,0x64,0x2e,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x29,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,
+    0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,
+    0x6e,0x65,0x72,0x28,0x27,0x6e,0x6f,0x77,0x70,0x6c,0x61,0x79,0x69,0x6e,0x67,0x27,0x2c,0x20,0x65,0x20,
+    0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,
+    0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,
+    0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,
+    0x6e,0x6f,0x77,0x50,0x6c,0x61,0x79,0x69,0x6e,0x67,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
+    0x78,0x74,0x20,0x3d,0x20,0x5b,0x64,0x2e,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x2c,0x20,0x64,0x2e,0x74,
+    0x69,0x74,0x6c,0x65,0x5d,0x2e,0x66,0x69,0x6c,0x74,0x65,0x72,0x28,0x42,0x6f,0x6f,0x6c,0x65,0x61,0x6e,
+    0x29,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x27,0x20,0x2d,0x20,0x27,0x29,0x20,0x7c,0x7c,0x20,0x27,0x2d,0x27,
+    0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,
+    0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,0x27,0x2c,
+    0x20,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x62,0x61,0x63,0x6b,0x65,0x6e,0x64,
+    0x53,0x74,0x61,0x74,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
+    0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x2e,0x63,
+    0x6f,0x6e,0x6e,0x65,0x63,0x74,0x65,0x64,0x20,0x3f,0x20,0x27,0x6f,0x6e,0x6c,0x69,0x6e,0x65,0x27,0x20,
+    0x3a,0x20,0x27,0x6f,0x66,0x66,0x6c,0x69,0x6e,0x65,0x27,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x65,0x76,0x65,
+    0x6e,0x74,0x73,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,
+    0x28,0x27,0x62,0x61,0x63,0x6b,0x6c,0x69,0x67,0x68,0x74,0x27,0x2c,0x20,0x65,0x20,0x3d,0x3e,0x20,0x7b,
+    0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
+    0x42,0x79,0x49,0x64,0x28,0x27,0x62,0x61,0x63,0x6b,0x6c,0x69,0x67,0x68,0x74,0x53,0x74,0x61,0x74,0x65,
+    0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,
+    0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,0x64,0x61,0x74,0x61,0x29,0x2e,0x6f,0x6e,0x20,0x3f,0x20,0x27,
+    0x6f,0x6e,0x27,0x20,0x3a,0x20,0x27,0x6f,0x66,0x66,0x27,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x65,0x76,0x65,
+    0x6e,0x74,0x73,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,
+    0x28,0x27,0x61,0x6c,0x61,0x72,0x6d,0x27,0x2c,0x20,0x65,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x64,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x70,0x61,0x72,0x73,0x65,0x28,0x65,0x2e,
+    0x64,0x61,0x74,0x61,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x61,0x6c,0x61,0x72,0x6d,0x53,0x74,0x61,
+    0x74,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x64,0x2e,0x72,
+    0x69,0x6e,0x67,0x69,0x6e,0x67,0x20,0x3f,0x20,0x27,0x72,0x69,0x6e,0x67,0x69,0x6e,0x67,0x27,0x0a,0x3a,
+    0x20,0x64,0x2e,0x6e,0x65,0x78,0x74,0x20,0x3f,0x20,0x27,0x6e,0x65,0x78,0x74,0x20,0x27,0x20,0x2b,0x20,
+    0x6e,0x65,0x77,0x20,0x44,0x61,0x74,0x65,0x28,0x64,0x2e,0x6e,0x65,0x78,0x74,0x20,0x2a,0x20,0x31,0x30,
+    0x30,0x30,0x29,0x2e,0x74,0x6f,0x4c,0x6f,0x63,0x61,0x6c,0x65,0x53,0x74,0x72,0x69,0x6e,0x67,0x28,0x29,
+    0x20,0x3a,0x20,0x27,0x6e,0x6f,0x6e,0x65,0x27,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x65,0x76,0x65,0x6e,0x74,
+    0x73,0x2e,0x6f,0x6e,0x6f,0x70,0x65,0x6e,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x69,
+    0x66,0x20,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x50,0x6f,0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x29,0x20,
+    0x63,0x6c,0x65,0x61,0x72,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x76,0x6f,0x6c,0x75,0x6d,0x65,
+    0x50,0x6f,0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x29,0x3b,0x0a,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x50,0x6f,
+    0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x20,0x3d,0x20,0x6e,0x75,0x6c,0x6c,0x3b,0x0a,0x7d,0x3b,0x0a,0x65,
+    0x76,0x65,0x6e,0x74,0x73,0x2e,0x6f,0x6e,0x65,0x72,0x72,0x6f,0x72,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,
+    0x3e,0x20,0x7b,0x0a,0x2f,0x2f,0x20,0x43,0x6c,0x6f,0x73,0x65,0x64,0x20,0x66,0x6f,0x72,0x20,0x67,0x6f,
+    0x6f,0x64,0x20,0x28,0x65,0x2e,0x67,0x2e,0x20,0x35,0x30,0x33,0x20,0x77,0x68,0x65,0x6e,0x20,0x61,0x6c,
+    0x6c,0x20,0x73,0x75,0x62,0x73,0x63,0x72,0x69,0x62,0x65,0x72,0x20,0x73,0x6c,0x6f,0x74,0x73,0x20,0x61,
+    0x72,0x65,0x20,0x74,0x61,0x6b,0x65,0x6e,0x29,0x3a,0x20,0x70,0x6f,0x6c,0x6c,0x20,0x69,0x6e,0x73,0x74,
+    0x65,0x61,0x64,0x0a,0x69,0x66,0x20,0x28,0x65,0x76,0x65,0x6e,0x74,0x73,0x2e,0x72,0x65,0x61,0x64,0x79,
+    0x53,0x74,0x61,0x74,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x45,0x76,0x65,0x6e,0x74,0x53,0x6f,0x75,0x72,0x63,
+    0x65,0x2e,0x43,0x4c,0x4f,0x53,0x45,0x44,0x20,0x26,0x26,0x20,0x21,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x50,
+    0x6f,0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x29,0x20,0x7b,0x0a,0x76,0x6f,0x6c,0x75,0x6d,0x65,0x50,0x6f,
+    0x6c,0x6c,0x54,0x69,0x6d,0x65,0x72,0x20,0x3d,0x20,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,
+    0x6c,0x28,0x6c,0x6f,0x61,0x64,0x56,0x6f,0x6c,0x75,0x6d,0x65,0x2c,0x20,0x31,0x30,0x30,0x30,0x30,0x29,
+    0x3b,0x0a,0x7d,0x0a,0x7d,0x3b,0x0a,0x7d,0x0a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,
+    0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x44,0x4f,0x4d,0x43,0x6f,0x6e,
+    0x74,0x65,0x6e,0x74,0x4c,0x6f,0x61,0x64,0x65,0x64,0x27,0x2c,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,
+    0x0a,0x6c,0x6f,0x61,0x64,0x46,0x69,0x6c,0x65,0x4c,0x69,0x73,0x74,0x28,0x29,0x3b,0x0a,0x6c,0x6f,0x61,
+    0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x28,0x29,0x3b,0x0a,0x6c,0x6f,0x61,0x64,0x56,0x6f,0x6c,0x75,0x6d,
+    0x65,0x28,0x29,0x3b,0x0a,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x3b,
+    0x0a,0x73,0x74,0x61,0x72,0x74,0x45,0x76,0x65,0x6e,0x74,0x73,0x28,0x29,0x3b,0x0a,0x73,0x65,0x74,0x49,
+    0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x75,0x73,0x2c,0x20,
+    0x36,0x30,0x30,0x30,0x30,0x29,0x3b,0x0a,0x7d,0x29,0x3b,0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,
+    0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+constexpr uint8_t internet_radio_html_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x58,0xef,0x6e,0xdb,0x36,0x10,0xff,0xee,0xa7,
+    0x60,0x85,0x01,0x92,0xb0,0xd8,0x42,0xd7,0x2f,0x43,0xfd,0xa7,0x68,0x9b,0x14,0x0d,0x90,0xb6,0x41,0x93,
+    0xa0,0x18,0xb2,0xa0,0xa5,0xa5,0x73,0xcc,0x86,0x16,0x05,0x92,0x8e,0x63,0x24,0x79,0x86,0x61,0x18,0xb0,
+    0x7d,0x19,0xd0,0xb7,0xd8,0x97,0xbd,0xcd,0x9e,0xa0,0x8f,0xb0,0x3b,0x8a,0x92,0x65,0xc5,0x4e,0x5a,0x04,
+    0xb1,0x2c,0xf2,0xee,0x77,0x7f,0x79,0x77,0xf4,0xe0,0xd1,0xee,0xbb,0x97,0xc7,0xbf,0x1c,0xee,0xb1,0xa9,
+    0x9d,0xc9,0x51,0x67,0x40,0x0f,0x26,0x79,0x7e,0x3e,0x0c,0x20,0x0f,0x68,0x01,0x78,0x86,0x8f,0x19,0x58,
+    0xce,0xd2,0x29,0xd7,0x06,0xec,0x30,0x38,0x39,0x7e,0xd5,0xfd,0x39,0x60,0x09,0x6e,0x58,0x61,0x25,0x8c,
+    0xf6,0x8e,0x0e,0x9f,0xfc,0xd4,0x3d,0x7a,0xc2,0xf6,0x73,0x0b,0x3a,0x07,0xcb,0xde,0xf3,0x4c,0xa8,0x41,
+    0x52,0x6e,0x77,0x06,0x52,0xe4,0x17,0x4c,0x83,0x1c,0x06,0xc6,0x2e,0x25,0x98,0x29,0x80,0x0d,0xd8,0x54,
+    0xc3,0xc4,0xaf,0xf4,0x52,0x63,0x4a,0xc4,0xc4,0x8b,0x1c,0xab,0x6c,0x89,0x8f,0x9c,0x5f,0xe2,0x27,0xf7,
+    0xb4,0x49,0x30,0x7a,0xad,0x66,0x30,0x48,0xb8,0x5b,0x4c,0x25,0x37,0x66,0x18,0xf0,0xd4,0x8a,0x4b,0x08,
+    0x58,0x45,0x24,0xbc,0x16,0x1f,0x35,0x69,0xd1,0x23,0xa3,0x82,0x51,0x5b,0x35,0xde,0x84,0x9d,0x08,0x09,
+    0x1f,0xe1,0xaa,0x90,0x4a,0x83,0xf6,0x0c,0xaf,0x70,0x8d,0xed,0xf9,0xb5,0x16,0x3d,0x97,0x5c,0xcf,0x8c,
+    0x27,0x7c,0xee,0x5e,0x4a,0x8a,0xa4,0xd4,0x77,0xfa,0x78,0xf4,0xf5,0xcb,0x1f,0xff,0xb6,0xfc,0xc1,0x8e,
+    0x2c,0xb7,0x42,0xe5,0x48,0x8b,0x04,0x9d,0x41,0x26,0x2e,0x2b,0x13,0xac,0x52,0x72,0xcc,0x35,0xb9,0x5c,
+    0xe4,0xc5,0xdc,0x32,0x91,0x0d,0x83,0x9c,0xcf,0x60,0x9f,0xde,0x02,0x66,0x97,0x05,0x20,0x15,0x5c,0xe1,
+    0xf7,0x42,0xf2,0x14,0xa6,0x4a,0x66,0xa0,0x87,0x81,0x87,0x64,0x44,0x5b,0x3a,0x70,0xc5,0x3f,0xd7,0x72,
+    0x8d,0x1d,0xdf,0x5b,0xdc,0x53,0x6b,0x8b,0xa7,0x49,0x02,0x57,0x7c,0x56,0x50,0x10,0xd4,0x2c,0x31,0x56,
+    0x03,0x9f,0xf5,0x66,0xc5,0x93,0x12,0x6e,0x3c,0xb7,0x16,0xf1,0x09,0xcf,0xf0,0x4b,0x78,0x61,0xf3,0xa0,
+    0x52,0x7a,0x6c,0x73,0x86,0xff,0xdd,0x42,0x8b,0x19,0xd7,0xcb,0x60,0x74,0x84,0x04,0x95,0x91,0x83,0xa4,
+    0xe4,0x5c,0x87,0xd0,0x80,0x19,0xb4,0x09,0x43,0xcd,0x2d,0x26,0x09,0x04,0xa3,0xf7,0x44,0xb1,0x8d,0x59,
+    0x2a,0x9e,0xb5,0xb8,0x89,0x83,0x96,0x1b,0x2c,0x09,0x3a,0x76,0xdd,0xbd,0x90,0x5b,0xbd,0x64,0x94,0x59,
+    0xa0,0xd9,0xb9,0x16,0x99,0xfb,0xe8,0xba,0xfc,0x08,0x4a,0xd2,0xd1,0x5b,0x4e,0x89,0x55,0xb3,0x8e,0x4e,
+    0xde,0x1f,0x34,0x5f,0x9f,0xa7,0x3e,0x74,0x77,0xc0,0xb5,0x38,0x9f,0xda,0x60,0xb4,0x0b,0x12,0x6c,0x8d,
+    0xd0,0x20,0x73,0xae,0x2b,0x9d,0x72,0x20,0x0c,0x52,0x56,0x9b,0x26,0xd5,0xa2,0xb0,0xa3,0x0e,0xf2,0x31,
+    0x4f,0x60,0xd8,0x90,0x9d,0x9e,0xf5,0xdd,0x12,0x64,0xc2,0xee,0xe7,0x19,0x5c,0xe1,0x5a,0xf7,0x71,0xbf,
+    0xc3,0xcd,0x32,0x4f,0xd9,0x64,0x9e,0x3b,0x4d,0x18,0x19,0x5d,0x25,0x54,0x14,0xb3,0xeb,0x0e,0x99,0x78,
+    0xdd,0x49,0xf1,0xd5,0xe2,0x59,0x33,0x05,0xb2,0xf1,0x05,0x17,0x96,0x4d,0xc0,0xa6,0xd3,0x28,0x4c,0x2a,
+    0x19,0x61,0xdc,0xef,0x34,0xe4,0x95,0x44,0xc4,0xd1,0xfb,0x6c,0x54,0x1e,0xc5,0x7d,0x96,0x24,0xec,0xf4,
+    0x9a,0x52,0x6a,0x87,0x61,0xd2,0xdc,0xee,0xb0,0x5e,0xaf,0x77,0xd6,0xd1,0x80,0xda,0x68,0xb2,0x01,0x69,
+    0x3a,0xb7,0x2c,0xe5,0x88,0xcb,0x22,0x88,0xbd,0x58,0x85,0x29,0xb4,0xe0,0x3a,0x8f,0xc2,0x57,0x1c,0x0f,
+    0x4f,0xc6,0xac,0x72,0x5a,0xd6,0xc6,0x85,0x3b,0x0c,0xd6,0x65,0x93,0xad,0x2d,0x58,0xfc,0xab,0x6d,0x6c,
+    0x6e,0xd5,0xb6,0xe1,0xa7,0xe5,0x98,0x2b,0x1a,0xf9,0x33,0x95,0xce,0x67,0x18,0xdd,0xde,0x39,0xd8,0x3d,
+    0x09,0xf4,0xf5,0xc5,0x72,0x3f,0x8b,0xc2,0x86,0xc3,0xc9,0xdc,0x9a,0xa7,0x27,0x72,0xfc,0x7c,0x7d,0xfc,
+    0xe6,0x00,0xb9,0xc3,0xb0,0xdf,0x11,0x13,0x16,0x3d,0xaa,0x34,0xea,0x49,0xc8,0xcf,0xed,0x74,0x25,0x0b,
+    0x66,0x85,0x5d,0x36,0xe5,0xa4,0x78,0x3a,0x2c,0x78,0x51,0x51,0x88,0x81,0x24,0x78,0x47,0xd6,0x73,0xf9,
+    0x40,0x69,0x44,0xd0,0x65,0xca,0x69,0xb5,0x08,0xab,0x6d,0x3a,0xbd,0x2f,0x51,0x0f,0xdc,0x21,0x82,0xb7,
+    0x6a,0x15,0xf4,0x89,0x9a,0xe7,0x59,0x2f,0x6c,0xea,0xc9,0x8b,0x02,0x8d,0x7f,0x39,0x15,0x32,0x8b,0x1c,
+    0x7f,0x4c,0x9e,0xb2,0x73,0x9d,0x93,0x8f,0x6a,0x85,0x27,0x4a,0xef,0x71,0x8c,0x6e,0x64,0x76,0x98,0x88,
+    0xd9,0x70,0xb4,0x4a,0x01,0xb5,0x78,0x58,0x71,0x24,0xda,0xa2,0x76,0xfb,0x98,0xa0,0x72,0x98,0x15,0x44,
+    0xe6,0xf1,0xf3,0x92,0xe3,0x01,0x01,0x44,0xd5,0xb2,0xdc,0xf4,0x68,0xd1,0xc1,0xe1,0x19,0xc3,0xfc,0x91,
+    0x52,0x14,0x46,0x98,0xd8,0x03,0x63,0xc6,0x3d,0x8c,0x8b,0x44,0x2d,0xc5,0x3d,0x4a,0x58,0xee,0xb5,0x45,
+    0xe2,0x9a,0x93,0xe8,0x8f,0x31,0x8b,0x0e,0x25,0x5f,0xb2,0x84,0xed,0xe1,0x21,0xab,0x04,0xf3,0xb4,0x4a,
+    0xcb,0x07,0x84,0x7b,0xc2,0x75,0x05,0xca,0xc5,0x32,0x86,0x08,0x86,0x75,0x76,0x89,0xa5,0xea,0x1e,0xb0,
+    0xb2,0x5e,0x11,0x9e,0xa7,0x5d,0xc7,0xc3,0xda,0x16,0xae,0xb6,0x5a,0xc9,0xf3,0xdf,0x9f,0xff,0x30,0xb2,
+    0xa0,0x41,0xa1,0xf2,0x54,0x8a,0xf4,0x02,0x77,0x23,0x97,0x07,0xb4,0xee,0xeb,0x43,0xe4,0xec,0x8f,0x2b,
+    0xd5,0xa8,0xb0,0x7c,0xab,0x6a,0x9e,0xf6,0x8e,0x6a,0xae,0x68,0x1b,0x40,0xc0,0x0c,0x4b,0x7f,0xb8,0x22,
+    0x6c,0x2b,0xfa,0xf7,0x6f,0xce,0xc7,0x0d,0x8a,0xb6,0xa2,0x98,0xcb,0xda,0x12,0x4d,0x24,0x1a,0xbe,0x6d,
+    0xe6,0xbf,0x37,0x71,0xcb,0xae,0xc7,0x8d,0x5d,0x7c,0xcb,0x2a,0xec,0x0d,0xcd,0x40,0x7e,0xd0,0xbc,0x78,
+    0x38,0xa0,0x9e,0x70,0xdd,0x4a,0x57,0xd7,0xeb,0x78,0x22,0xc9,0xb7,0xfa,0xac,0x24,0xdd,0xec,0xb2,0x0c,
+    0x87,0x2b,0xd0,0x61,0x4d,0xd4,0x72,0xd7,0xd7,0x2f,0x7f,0xfd,0xee,0x6d,0x58,0xd1,0xb4,0x1d,0x96,0xb9,
+    0xfd,0x2a,0xb6,0xa2,0xa1,0x7f,0xd3,0x2d,0x25,0xb3,0x3f,0xe3,0xcd,0x0d,0x3a,0x7d,0x1b,0x96,0xcb,0x0c,
+    0x69,0xaf,0x7a,0x87,0x6f,0xd8,0xf1,0x32,0xe3,0x6d,0x45,0x0b,0xe9,0xa9,0x9c,0xbb,0x92,0x5e,0x17,0xf4,
+    0x66,0xac,0xb1,0x52,0x35,0x5b,0x9c,0x40,0x33,0xb6,0x55,0xf3,0x7a,0x12,0x0a,0xe3,0xde,0x25,0x97,0x73,
+    0x72,0x69,0x55,0x02,0x4f,0xc5,0x99,0x2f,0x28,0x5b,0xd9,0xab,0x41,0x68,0x0b,0xb7,0xab,0x0d,0xdb,0x3b,
+    0x49,0x39,0xf5,0x20,0x6f,0x2b,0x56,0x27,0x45,0x86,0xf1,0xaf,0xe6,0x9d,0xb0,0xbf,0xde,0xb8,0x70,0x8a,
+    0x79,0xa5,0xf4,0x2c,0x6a,0x9b,0x49,0x9d,0xfc,0xbb,0xec,0xa4,0x26,0xf5,0x3d,0x96,0xdd,0x4b,0xbf,0xd5,
+    0x98,0xe6,0xe8,0xb6,0x6e,0x0a,0xe2,0x0a,0x32,0xd4,0xc9,0x31,0x51,0x3d,0x15,0x90,0x61,0xae,0x79,0x96,
+    0x25,0x1e,0x67,0xc0,0x28,0xa6,0x35,0x2e,0x41,0xe3,0x71,0x38,0x94,0xc0,0x0d,0x30,0xa0,0x09,0x98,0xf1,
+    0xca,0xdf,0xae,0x6b,0xf4,0xc2,0xba,0x97,0xb1,0x09,0x97,0x06,0x48,0x9e,0x83,0x72,0x95,0xfb,0x1b,0x91,
+    0xb0,0x77,0x6c,0x05,0x72,0x52,0x04,0x1e,0x9b,0x79,0x06,0x26,0x0a,0x6f,0xc2,0x98,0xdd,0xdc,0x90,0xd2,
+    0xeb,0x8b,0x0d,0x21,0xc7,0x53,0x60,0xc1,0x4d,0xe0,0x2e,0x39,0x98,0xf3,0x28,0x49,0x18,0x96,0x2b,0x6c,
+    0x0a,0x52,0xaa,0x05,0x64,0x1b,0x45,0xf9,0x77,0xab,0xe7,0xee,0xb5,0x35,0xa0,0xa9,0x9c,0x9c,0xda,0x18,
+    0x5c,0xda,0x1d,0xf3,0xc1,0xe8,0x7b,0x5f,0xf4,0x1b,0x8d,0xf1,0x3e,0xfe,0x76,0x32,0xd4,0xec,0xce,0xb7,
+    0x5b,0xe3,0x18,0xb3,0x6a,0xae,0x20,0xba,0x46,0xae,0x0e,0x29,0x5b,0x49,0xfd,0x7a,0xda,0x28,0xe6,0x66,
+    0x1a,0x5d,0xb3,0x9a,0x97,0xb9,0xe3,0xcd,0x00,0xfd,0xd1,0x20,0x3b,0xad,0x31,0xce,0x50,0xdd,0x6b,0x1a,
+    0x1e,0x37,0x6c,0xed,0x34,0x61,0xfa,0x8c,0x66,0xce,0x0b,0x80,0x82,0xbc,0x8b,0x57,0xa1,0xf4,0x82,0x1c,
+    0xea,0x26,0x53,0xca,0xd9,0x63,0xb5,0x2b,0xcc,0x45,0xe4,0x62,0x50,0x9f,0xac,0xbe,0x27,0x58,0x9f,0x84,
+    0x37,0x44,0xa2,0x5d,0x30,0xab,0xcc,0x45,0xb7,0x4e,0x04,0x22,0x7d,0x2a,0x2b,0x6e,0x9d,0x5a,0xc1,0x0f,
+    0xd7,0xed,0xea,0x72,0x1b,0x3c,0xfb,0xd4,0xf0,0x54,0xed,0x11,0x53,0x60,0x69,0x86,0x48,0xec,0xb0,0xc7,
+    0xb5,0x3e,0xeb,0x0a,0x6f,0xd3,0x11,0xed,0x75,0x87,0xce,0x62,0xe6,0x2d,0xf0,0x42,0x06,0x4c,0xe2,0xb0,
+    0xca,0xc8,0x74,0x1a,0x9c,0x57,0xb7,0xd8,0x5a,0x96,0xbd,0xb2,0xec,0x52,0x70,0x96,0xcc,0x0b,0x82,0x6b,
+    0x5b,0xd9,0x14,0xbb,0x36,0x2c,0xfb,0x19,0xa8,0x82,0x99,0xf1,0x22,0x32,0xd4,0x47,0x3e,0xa1,0x99,0xa5,
+    0x71,0x37,0xf4,0x8d,0x26,0x7d,0x7a,0x56,0x01,0x60,0xcf,0x18,0x1e,0x12,0xf6,0x23,0x6b,0x2c,0x3d,0xc5,
+    0xf2,0x72,0xfb,0x29,0xee,0x7d,0x56,0x02,0xc7,0xfc,0x5f,0xb1,0x90,0xe0,0x3e,0x3d,0xab,0x1c,0xa5,0x9b,
+    0x34,0x0a,0xcb,0x61,0xc1,0xe8,0x02,0x1d,0x9d,0x7a,0x05,0x30,0xdc,0xe1,0x46,0x8b,0xf0,0x4e,0x70,0xed,
+    0xee,0xa7,0x08,0x4d,0x35,0x29,0xc1,0x66,0x2f,0xf2,0xd0,0x65,0x96,0x87,0xc4,0x60,0x57,0x90,0xf8,0x75,
+    0x97,0x5b,0x4e,0x1e,0xa4,0x65,0xdf,0x70,0xa2,0x90,0xc4,0x22,0x12,0x3d,0xda,0x5b,0x05,0xb7,0x53,0xdc,
+    0x0a,0x93,0xb0,0xbc,0xd8,0x68,0xa5,0xec,0x0e,0x1b,0x43,0xca,0xe7,0x98,0xb5,0x06,0xf4,0x25,0x1e,0x76,
+    0x6c,0xe5,0x99,0x61,0xc1,0x66,0xa7,0x07,0x5e,0x91,0xf1,0x7a,0xff,0xdf,0x5a,0x5b,0x2b,0xc5,0xf1,0x92,
+    0x8d,0xf4,0xe3,0xf5,0x2e,0xdf,0xef,0xd0,0x42,0x26,0x0c,0x1f,0xd3,0x15,0x69,0xe8,0xab,0xc7,0xf8,0xee,
+    0x2c,0x80,0xd9,0x21,0xf2,0x73,0x3c,0x3c,0xe8,0xdc,0x07,0xef,0x76,0x65,0x4a,0x38,0x67,0xce,0xc0,0x4e,
+    0x55,0x86,0xee,0x3c,0x7c,0x77,0x74,0x8c,0x2b,0xf4,0x4b,0xca,0xd3,0xd2,0x8b,0xb7,0x55,0x31,0x70,0xb7,
+    0x3d,0x75,0x11,0x63,0xf6,0xd1,0xac,0x4f,0xbe,0xdd,0xd3,0x5a,0xe9,0x08,0xbb,0x9a,0xbb,0xb2,0x4d,0xdc,
+    0x0d,0x2e,0x74,0xc7,0x7b,0x22,0x72,0x8c,0x3f,0x29,0xd0,0x52,0xdd,0x17,0xc2,0xbb,0xba,0xa3,0xe5,0xe5,
+    0x4d,0x0e,0xfd,0xed,0x06,0xed,0x29,0xc8,0x02,0xdd,0x1c,0x19,0x2a,0x81,0x05,0x5f,0x3a,0x19,0xdc,0xb0,
+    0xa5,0x9a,0x63,0xa5,0x75,0xe5,0xa6,0xe0,0xe7,0x10,0xaf,0xda,0x4e,0x73,0x7c,0xf5,0xdd,0xa6,0xb2,0x95,
+    0xb6,0xc8,0xd2,0x4e,0xcb,0xd2,0x4e,0x79,0xc1,0x37,0x4f,0xd1,0x09,0xa1,0x57,0xa6,0x7b,0x8c,0xa9,0x15,
+    0x22,0x09,0xa6,0x03,0x9e,0x54,0x87,0x97,0x5c,0x75,0x17,0x8b,0x45,0x97,0x3c,0xd2,0x45,0x68,0xc8,0x53,
+    0x95,0xa1,0xad,0xec,0x76,0xa7,0x53,0xfa,0x8a,0x2a,0xe9,0x90,0x32,0xbf,0xdc,0x3a,0x79,0xbf,0xff,0x52,
+    0xcd,0x0a,0x95,0xd3,0x9c,0x47,0xba,0xf8,0xa9,0x06,0x8d,0xfb,0x20,0x34,0xb0,0x79,0xe1,0x8e,0x99,0x56,
+    0xd2,0x74,0x16,0x68,0x0c,0x0d,0x4a,0x59,0xb6,0x77,0x89,0xe4,0x74,0xff,0x04,0x9c,0x8c,0xa2,0x70,0xf7,
+    0xdd,0x1b,0xaf,0xd2,0x01,0xda,0x0e,0x14,0xaa,0xc8,0xdf,0xd7,0xbe,0xa1,0x5b,0xdf,0xc5,0x73,0x23,0x21,
+    0x82,0x94,0x5d,0x26,0xbe,0xa7,0xe7,0x57,0xbf,0xb9,0xdc,0x0b,0x53,0x97,0xd5,0xfb,0x91,0xfc,0x0f,0x30,
+    0xf7,0x42,0x35,0x4b,0x1d,0xa2,0xdd,0xa9,0x7c,0xf8,0x3f,0x48,0xaa,0xdf,0x3e,0x06,0x89,0xff,0xa1,0x2f,
+    0x71,0x3f,0x41,0xfe,0x0f,0xb6,0xc2,0x99,0x14,0x92,0x14,0x00,0x00,
+};
+
+constexpr uint8_t internet_radio_html_raw[] = {
+    0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x3c,0x68,0x74,0x6d,
+    0x6c,0x20,0x6c,0x61,0x6e,0x67,0x3d,0x22,0x65,0x6e,0x22,0x3e,0x0a,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,
+    0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,
+    0x22,0x20,0x2f,0x3e,0x0a,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x45,0x53,0x50,0x33,0x32,0x2d,0x53,0x33,
+    0x20,0x49,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x20,0x52,0x61,0x64,0x69,0x6f,0x3c,0x2f,0x74,0x69,0x74,
+    0x6c,0x65,0x3e,0x0a,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,
+    0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,
+    0x73,0x73,0x22,0x20,0x2f,0x3e,0x0a,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x3c,0x62,0x6f,0x64,0x79,
+    0x3e,0x0a,0x3c,0x6e,0x61,0x76,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x22,0x3e,
+    0x48,0x6f,0x6d,0x65,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x61,
+    0x63,0x74,0x69,0x76,0x65,0x22,0x20,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x69,0x6e,0x74,0x65,0x72,
+    0x6e,0x65,0x74,0x5f,0x72,0x61,0x64,0x69,0x6f,0x2e,0x68,0x74,0x6d,0x6c,0x22,0x3e,0x49,0x6e,0x74,0x65,
+    0x72,0x6e,0x65,0x74,0x20,0x52,0x61,0x64,0x69,0x6f,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,
+    0x65,0x66,0x3d,0x22,0x2f,0x66,0x69,0x6c,0x65,0x5f,0x65,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x2e,0x68,
+    0x74,0x6d,0x6c,0x22,0x3e,0x46,0x69,0x6c,0x65,0x20,0x45,0x78,0x70,0x6c,0x6f,0x72,0x65,0x72,0x3c,0x2f,
+    0x61,0x3e,0x0a,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x2f,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2e,
+    0x68,0x74,0x6d,0x6c,0x22,0x3e,0x41,0x6c,0x61,0x72,0x6d,0x73,0x3c,0x2f,0x61,0x3e,0x0a,0x3c,0x2f,0x6e,
+    0x61,0x76,0x3e,0x0a,0x3c,0x68,0x31,0x3e,0xf0,0x9f,0x93,0xbb,0x20,0x49,0x6e,0x74,0x65,0x72,0x6e,0x65,
+    0x74,0x20,0x52,0x61,0x64,0x69,0x6f,0x20,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x3c,0x2f,0x68,0x31,
+    0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x74,0x6f,0x6f,0x6c,0x62,0x61,
+    0x72,0x22,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x6e,0x61,0x6d,0x65,0x49,
+    0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x70,0x6c,
+    0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x6e,
+    0x61,0x6d,0x65,0x22,0x20,0x2f,0x3e,0x0a,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x69,0x64,0x3d,0x22,0x75,
+    0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x75,0x72,0x6c,0x22,0x20,
+    0x70,0x6c,0x61,0x63,0x65,0x68,0x6f,0x6c,0x64,0x65,0x72,0x3d,0x22,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,
+    0x65,0x78,0x61,0x6d,0x70,0x6c,0x65,0x2e,0x63,0x6f,0x6d,0x2f,0x73,0x74,0x72,0x65,0x61,0x6d,0x2e,0x6d,
+    0x70,0x33,0x22,0x20,0x2f,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x73,
+    0x61,0x76,0x65,0x42,0x74,0x6e,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,
+    0x74,0x6e,0x2d,0x70,0x72,0x69,0x6d,0x61,0x72,0x79,0x22,0x3e,0x53,0x61,0x76,0x65,0x20,0x53,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,0x6f,
+    0x6e,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x73,0x65,0x74,0x42,0x74,0x6e,0x22,0x20,0x63,0x6c,0x61,0x73,
+    0x73,0x3d,0x22,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x22,0x3e,
+    0x52,0x65,0x73,0x65,0x74,0x3c,0x2f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x20,0x69,0x64,0x3d,0x22,0x72,0x65,0x6c,0x6f,0x61,0x64,0x42,0x74,0x6e,0x22,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x62,0x74,0x6e,0x22,0x3e,0x52,0x65,0x6c,0x6f,0x61,0x64,0x3c,0x2f,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x3e,0x0a,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+    0x61,0x73,0x73,0x3d,0x22,0x65,0x6e,0x74,0x72,0x79,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x67,0x72,
+    0x69,0x64,0x20,0x67,0x72,0x69,0x64,0x2d,0x72,0x61,0x64,0x69,0x6f,0x22,0x3e,0x0a,0x3c,0x64,0x69,0x76,
+    0x3e,0x4e,0x61,0x6d,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,0x55,0x52,0x4c,
+    0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x3e,0x41,0x63,0x74,0x69,0x6f,0x6e,0x73,0x3c,
+    0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x72,0x69,
+    0x67,0x68,0x74,0x22,0x3e,0x44,0x65,0x6c,0x65,0x74,0x65,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x2f,
+    0x64,0x69,0x76,0x3e,0x0a,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x74,0x61,0x74,0x69,0x6f,
+    0x6e,0x4c,0x69,0x73,0x74,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x3c,0x73,0x63,0x72,0x69,0x70,
+    0x74,0x3e,0x0a,0x6c,0x65,0x74,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x5b,0x5d,
+    0x3b,0x0a,0x6c,0x65,0x74,0x20,0x65,0x64,0x69,0x74,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x2d,0x31,
+    0x3b,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6c,0x6f,0x61,
+    0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x20,0x7b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,
+    0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x27,0x29,0x3b,0x0a,0x73,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x72,0x65,0x73,0x70,
+    0x2e,0x6a,0x73,0x6f,0x6e,0x28,0x29,0x3b,0x20,0x2f,0x2f,0x20,0x5b,0x7b,0x6e,0x61,0x6d,0x65,0x2c,0x20,
+    0x75,0x72,0x6c,0x7d,0x2c,0x20,0x2e,0x2e,0x2e,0x5d,0x0a,0x72,0x65,0x6e,0x64,0x65,0x72,0x4c,0x69,0x73,
+    0x74,0x28,0x29,0x3b,0x0a,0x7d,0x20,0x63,0x61,0x74,0x63,0x68,0x20,0x28,0x65,0x29,0x20,0x7b,0x0a,0x63,
+    0x6f,0x6e,0x73,0x6f,0x6c,0x65,0x2e,0x77,0x61,0x72,0x6e,0x28,0x27,0x46,0x61,0x69,0x6c,0x65,0x64,0x20,
+    0x74,0x6f,0x20,0x6c,0x6f,0x61,0x64,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x27,0x2c,0x20,0x65,
+    0x29,0x3b,0x0a,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x5b,0x5d,0x3b,0x0a,0x72,0x65,
+    0x6e,0x64,0x65,0x72,0x4c,0x69,0x73,0x74,0x28,0x29,0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,
+    0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x6e,0x64,0x65,0x72,0x4c,0x69,0x73,0x74,0x28,0x29,0x20,0x7b,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3d,0x20,0x64,0x6f,
+    0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,
+    0x64,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x4c,0x69,0x73,0x74,0x27,0x29,0x3b,0x0a,0x63,0x6f,
+    0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,
+    0x27,0x27,0x3b,0x0a,0x69,0x66,0x20,0x28,0x21,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x6c,0x65,
+    0x6e,0x67,0x74,0x68,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,0x6d,0x70,0x74,0x79,0x20,
+    0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x65,0x6d,0x70,0x74,0x79,0x2e,0x63,
+    0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x65,0x6e,0x74,0x72,0x79,0x20,0x72,0x6f,
+    0x77,0x27,0x3b,0x0a,0x65,0x6d,0x70,0x74,0x79,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,
+    0x74,0x20,0x3d,0x20,0x27,0x4e,0x6f,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x20,0x66,0x6f,0x75,
+    0x6e,0x64,0x2e,0x27,0x3b,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x2e,0x61,0x70,0x70,0x65,
+    0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x65,0x6d,0x70,0x74,0x79,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x3b,0x0a,0x7d,0x0a,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x66,0x6f,0x72,0x45,0x61,
+    0x63,0x68,0x28,0x28,0x73,0x2c,0x20,0x69,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,
+    0x20,0x72,0x6f,0x77,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,
+    0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x72,0x6f,
+    0x77,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x65,0x6e,0x74,0x72,0x79,
+    0x20,0x72,0x6f,0x77,0x20,0x67,0x72,0x69,0x64,0x20,0x67,0x72,0x69,0x64,0x2d,0x72,0x61,0x64,0x69,0x6f,
+    0x27,0x3b,0x0a,0x2f,0x2f,0x20,0x4e,0x61,0x6d,0x65,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,0x61,0x6d,
+    0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x6e,0x61,0x6d,0x65,0x2e,
+    0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x2e,0x6e,0x61,0x6d,0x65,
+    0x3b,0x0a,0x2f,0x2f,0x20,0x55,0x52,0x4c,0x20,0x28,0x65,0x6c,0x6c,0x69,0x70,0x73,0x69,0x73,0x29,0x0a,
+    0x63,0x6f,0x6e,0x73,0x74,0x20,0x75,0x72,0x6c,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
+    0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,
+    0x29,0x3b,0x0a,0x75,0x72,0x6c,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,
+    0x65,0x6c,0x6c,0x69,0x70,0x73,0x69,0x73,0x27,0x3b,0x0a,0x75,0x72,0x6c,0x2e,0x74,0x65,0x78,0x74,0x43,
+    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x2e,0x75,0x72,0x6c,0x3b,0x0a,0x2f,0x2f,0x20,0x41,
+    0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x28,0x50,0x6c,0x61,0x79,0x20,0x2f,0x20,0x45,0x64,0x69,0x74,0x29,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x20,0x3d,0x20,0x64,0x6f,0x63,
+    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,
+    0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x63,0x6c,0x61,0x73,
+    0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x61,0x63,0x74,0x69,0x6f,0x6e,0x27,0x3b,0x0a,0x63,0x6f,
+    0x6e,0x73,0x74,0x20,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,
+    0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,0x2e,0x63,0x6c,0x61,0x73,
+    0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x62,0x74,0x6e,0x27,0x3b,0x0a,0x70,0x6c,0x61,0x79,0x42,
+    0x74,0x6e,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x27,0xe2,0x96,
+    0xb6,0x20,0x50,0x6c,0x61,0x79,0x27,0x3b,0x0a,0x70,0x6c,0x61,0x79,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,
+    0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x70,0x6c,0x61,0x79,0x53,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x28,0x73,0x2e,0x75,0x72,0x6c,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x65,
+    0x64,0x69,0x74,0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,
+    0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,
+    0x29,0x3b,0x0a,0x65,0x64,0x69,0x74,0x42,0x74,0x6e,0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,
+    0x20,0x3d,0x20,0x27,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x73,0x65,0x63,0x6f,0x6e,0x64,0x61,0x72,
+    0x79,0x27,0x3b,0x0a,0x65,0x64,0x69,0x74,0x42,0x74,0x6e,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,
+    0x65,0x6e,0x74,0x20,0x3d,0x20,0x27,0xe2,0x9c,0x8f,0x20,0x45,0x64,0x69,0x74,0x27,0x3b,0x0a,0x65,0x64,
+    0x69,0x74,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x28,0x29,0x20,0x3d,
+    0x3e,0x20,0x73,0x74,0x61,0x72,0x74,0x45,0x64,0x69,0x74,0x28,0x69,0x29,0x3b,0x0a,0x61,0x63,0x74,0x69,
+    0x6f,0x6e,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x70,0x6c,0x61,0x79,
+    0x42,0x74,0x6e,0x29,0x3b,0x0a,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,
+    0x43,0x68,0x69,0x6c,0x64,0x28,0x65,0x64,0x69,0x74,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x2f,0x2f,0x20,0x44,
+    0x65,0x6c,0x65,0x74,0x65,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x6c,0x57,0x72,0x61,0x70,0x20,
+    0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x28,0x27,0x64,0x69,0x76,0x27,0x29,0x3b,0x0a,0x64,0x65,0x6c,0x57,0x72,0x61,0x70,
+    0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x72,0x69,0x67,0x68,0x74,0x27,
+    0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x64,0x65,0x6c,0x42,0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,
+    0x75,0x6d,0x65,0x6e,0x74,0x2e,0x63,0x72,0x65,0x61,0x74,0x65,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x28,
+    0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x29,0x3b,0x0a,0x64,0x65,0x6c,0x42,0x74,0x6e,0x2e,0x63,0x6c,
+    0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x20,0x3d,0x20,0x27,0x62,0x74,0x6e,0x20,0x62,0x74,0x6e,0x2d,0x64,
+    0x61,0x6e,0x67,0x65,0x72,0x27,0x3b,0x0a,0x64,0x65,0x6c,0x42,0x74,0x6e,0x2e,0x74,0x65,0x78,0x74,0x43,
+    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x27,0xf0,0x9f,0x97,0x91,0x20,0x44,0x65,0x6c,0x65,0x74,
+    0x65,0x27,0x3b,0x0a,0x64,0x65,0x6c,0x42,0x74,0x6e,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,
+    0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x28,0x69,0x29,0x3b,0x0a,0x64,0x65,0x6c,0x57,0x72,0x61,0x70,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,
+    0x68,0x69,0x6c,0x64,0x28,0x64,0x65,0x6c,0x42,0x74,0x6e,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,
+    0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x6e,0x61,0x6d,0x65,0x29,0x3b,0x0a,0x72,0x6f,0x77,
+    0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x75,0x72,0x6c,0x29,0x3b,0x0a,0x72,
+    0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x61,0x63,0x74,0x69,0x6f,
+    0x6e,0x73,0x29,0x3b,0x0a,0x72,0x6f,0x77,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,
+    0x28,0x64,0x65,0x6c,0x57,0x72,0x61,0x70,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
+    0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x43,0x68,0x69,0x6c,0x64,0x28,0x72,0x6f,0x77,0x29,0x3b,0x0a,0x7d,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x74,0x61,0x72,0x74,0x45,
+    0x64,0x69,0x74,0x28,0x69,0x29,0x20,0x7b,0x0a,0x65,0x64,0x69,0x74,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,
+    0x20,0x69,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
+    0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x6e,0x61,0x6d,0x65,0x49,0x6e,0x70,0x75,0x74,0x27,0x29,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5b,0x69,0x5d,
+    0x2e,0x6e,0x61,0x6d,0x65,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
+    0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,
+    0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5b,
+    0x69,0x5d,0x2e,0x75,0x72,0x6c,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
+    0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x61,0x76,0x65,0x42,0x74,0x6e,
+    0x27,0x29,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x27,0x55,0x70,
+    0x64,0x61,0x74,0x65,0x20,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x27,0x3b,0x0a,0x7d,0x0a,0x66,0x75,0x6e,
+    0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x73,0x65,0x74,0x46,0x6f,0x72,0x6d,0x28,0x29,0x20,0x7b,0x0a,
+    0x65,0x64,0x69,0x74,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x20,0x2d,0x31,0x3b,0x0a,0x64,0x6f,0x63,0x75,
+    0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
+    0x27,0x6e,0x61,0x6d,0x65,0x49,0x6e,0x70,0x75,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
+    0x20,0x27,0x27,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x72,0x6c,0x49,0x6e,0x70,0x75,0x74,0x27,0x29,
+    0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x27,0x27,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+    0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x61,
+    0x76,0x65,0x42,0x74,0x6e,0x27,0x29,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,
+    0x3d,0x20,0x27,0x53,0x61,0x76,0x65,0x20,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x27,0x3b,0x0a,0x7d,0x0a,
+    0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,0x49,0x6e,0x70,
+    0x75,0x74,0x73,0x28,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x75,0x72,0x6c,0x29,0x20,0x7b,0x0a,0x69,0x66,0x20,
+    0x28,0x21,0x6e,0x61,0x6d,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x29,0x20,0x7b,0x0a,0x61,0x6c,0x65,
+    0x72,0x74,0x28,0x27,0x50,0x6c,0x65,0x61,0x73,0x65,0x20,0x65,0x6e,0x74,0x65,0x72,0x20,0x61,0x20,0x73,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x6e,0x61,0x6d,0x65,0x2e,0x27,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x7d,0x0a,0x69,0x66,0x20,0x28,0x21,0x75,0x72,0x6c,
+    0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x29,0x20,0x7b,0x0a,0x61,0x6c,0x65,0x72,0x74,0x28,0x27,0x50,0x6c,
+    0x65,0x61,0x73,0x65,0x20,0x65,0x6e,0x74,0x65,0x72,0x20,0x61,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x20,0x55,0x52,0x4c,0x2e,0x27,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,
+    0x65,0x3b,0x0a,0x7d,0x0a,0x69,0x66,0x20,0x28,0x6e,0x61,0x6d,0x65,0x2e,0x69,0x6e,0x63,0x6c,0x75,0x64,
+    0x65,0x73,0x28,0x27,0x7c,0x27,0x29,0x20,0x7c,0x7c,0x20,0x75,0x72,0x6c,0x2e,0x69,0x6e,0x63,0x6c,0x75,
+    0x64,0x65,0x73,0x28,0x27,0x7c,0x27,0x29,0x29,0x20,0x7b,0x0a,0x61,0x6c,0x65,0x72,0x74,0x28,0x27,0x54,
+    0x68,0x65,0x20,0x22,0x7c,0x22,0x20,0x63,0x68,0x61,0x72,0x61,0x63,0x74,0x65,0x72,0x20,0x69,0x73,0x20,
+    0x6e,0x6f,0x74,0x20,0x61,0x6c,0x6c,0x6f,0x77,0x65,0x64,0x2e,0x27,0x29,0x3b,0x0a,0x72,0x65,0x74,0x75,
+    0x72,0x6e,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x7d,0x0a,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x74,
+    0x72,0x75,0x65,0x3b,0x0a,0x7d,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
+    0x6e,0x20,0x6f,0x6e,0x53,0x61,0x76,0x65,0x28,0x29,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6e,
+    0x61,0x6d,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,
+    0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x6e,0x61,0x6d,0x65,0x49,0x6e,0x70,0x75,0x74,
+    0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x3b,0x0a,0x63,0x6f,0x6e,
+    0x73,0x74,0x20,0x75,0x72,0x6c,0x20,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
+    0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x75,0x72,0x6c,0x49,0x6e,
+    0x70,0x75,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x2e,0x74,0x72,0x69,0x6d,0x28,0x29,0x3b,0x0a,
+    0x69,0x66,0x20,0x28,0x21,0x76,0x61,0x6c,0x69,0x64,0x61,0x74,0x65,0x49,0x6e,0x70,0x75,0x74,0x73,0x28,
+    0x6e,0x61,0x6d,0x65,0x2c,0x20,0x75,0x72,0x6c,0x29,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,
+    0x69,0x66,0x20,0x28,0x65,0x64,0x69,0x74,0x49,0x6e,0x64,0x65,0x78,0x20,0x3d,0x3d,0x3d,0x20,0x2d,0x31,
+    0x29,0x20,0x7b,0x0a,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x70,0x75,0x73,0x68,0x28,0x7b,0x20,
+    0x6e,0x61,0x6d,0x65,0x2c,0x20,0x75,0x72,0x6c,0x20,0x7d,0x29,0x3b,0x0a,0x7d,0x20,0x65,0x6c,0x73,0x65,
+    0x20,0x7b,0x0a,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5b,0x65,0x64,0x69,0x74,0x49,0x6e,0x64,0x65,
+    0x78,0x5d,0x20,0x3d,0x20,0x7b,0x20,0x2e,0x2e,0x2e,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5b,0x65,
+    0x64,0x69,0x74,0x49,0x6e,0x64,0x65,0x78,0x5d,0x2c,0x20,0x6e,0x61,0x6d,0x65,0x2c,0x20,0x75,0x72,0x6c,
+    0x20,0x7d,0x3b,0x20,0x20,0x2f,0x2f,0x20,0x6b,0x65,0x65,0x70,0x20,0x66,0x61,0x6c,0x6c,0x62,0x61,0x63,
+    0x6b,0x0a,0x7d,0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x73,0x61,0x76,0x65,0x54,0x6f,0x44,0x69,0x73,0x6b,
+    0x28,0x29,0x3b,0x0a,0x72,0x65,0x73,0x65,0x74,0x46,0x6f,0x72,0x6d,0x28,0x29,0x3b,0x0a,0x61,0x77,0x61,
+    0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x3b,0x0a,0x7d,
+    0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x64,0x65,0x6c,0x65,
+    0x74,0x65,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x28,0x69,0x29,0x20,0x7b,0x0a,0x69,0x66,0x20,0x28,0x21,
+    0x63,0x6f,0x6e,0x66,0x69,0x72,0x6d,0x28,0x60,0x44,0x65,0x6c,0x65,0x74,0x65,0x20,0x73,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x20,0x22,0x24,0x7b,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x5b,0x69,0x5d,0x2e,0x6e,
+    0x61,0x6d,0x65,0x7d,0x22,0x3f,0x60,0x29,0x29,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x3b,0x0a,0x73,0x74,
+    0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x73,0x70,0x6c,0x69,0x63,0x65,0x28,0x69,0x2c,0x20,0x31,0x29,0x3b,
+    0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x73,0x61,0x76,0x65,0x54,0x6f,0x44,0x69,0x73,0x6b,0x28,0x29,0x3b,
+    0x0a,0x61,0x77,0x61,0x69,0x74,0x20,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,
+    0x29,0x3b,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x53,0x61,0x76,0x65,0x20,0x74,0x68,0x65,0x20,0x77,0x68,0x6f,
+    0x6c,0x65,0x20,0x6c,0x69,0x73,0x74,0x20,0x62,0x61,0x63,0x6b,0x20,0x74,0x6f,0x20,0x2f,0x69,0x6e,0x74,
+    0x65,0x72,0x6e,0x65,0x74,0x5f,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x74,0x78,0x74,0x20,0x76,
+    0x69,0x61,0x20,0x2f,0x75,0x70,0x6c,0x6f,0x61,0x64,0x0a,0x61,0x73,0x79,0x6e,0x63,0x20,0x66,0x75,0x6e,
+    0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x61,0x76,0x65,0x54,0x6f,0x44,0x69,0x73,0x6b,0x28,0x29,0x20,0x7b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x73,0x74,0x61,
+    0x74,0x69,0x6f,0x6e,0x73,0x2e,0x6d,0x61,0x70,0x28,0x73,0x20,0x3d,0x3e,0x20,0x60,0x24,0x7b,0x73,0x2e,
+    0x6e,0x61,0x6d,0x65,0x7d,0x7c,0x24,0x7b,0x73,0x2e,0x75,0x72,0x6c,0x7d,0x24,0x7b,0x73,0x2e,0x66,0x61,
+    0x6c,0x6c,0x62,0x61,0x63,0x6b,0x20,0x3f,0x20,0x27,0x7c,0x27,0x20,0x2b,0x20,0x73,0x2e,0x66,0x61,0x6c,
+    0x6c,0x62,0x61,0x63,0x6b,0x20,0x3a,0x20,0x27,0x27,0x7d,0x60,0x29,0x2e,0x6a,0x6f,0x69,0x6e,0x28,0x27,
+    0x5c,0x6e,0x27,0x29,0x20,0x2b,0x20,0x27,0x5c,0x6e,0x27,0x3b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x66,
+    0x69,0x6c,0x65,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x46,0x69,0x6c,0x65,0x28,0x5b,0x63,0x6f,0x6e,0x74,
+    0x65,0x6e,0x74,0x5d,0x2c,0x20,0x27,0x69,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x5f,0x73,0x74,0x61,0x74,
+    0x69,0x6f,0x6e,0x73,0x2e,0x74,0x78,0x74,0x27,0x2c,0x20,0x7b,0x20,0x74,0x79,0x70,0x65,0x3a,0x20,0x27,
+    0x74,0x65,0x78,0x74,0x2f,0x70,0x6c,0x61,0x69,0x6e,0x27,0x20,0x7d,0x29,0x3b,0x0a,0x63,0x6f,0x6e,0x73,
+    0x74,0x20,0x66,0x6f,0x72,0x6d,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x46,0x6f,0x72,0x6d,0x44,0x61,0x74,
+    0x61,0x28,0x29,0x3b,0x0a,0x66,0x6f,0x72,0x6d,0x2e,0x61,0x70,0x70,0x65,0x6e,0x64,0x28,0x27,0x66,0x69,
+    0x6c,0x65,0x27,0x2c,0x20,0x66,0x69,0x6c,0x65,0x29,0x3b,0x0a,0x66,0x6f,0x72,0x6d,0x2e,0x61,0x70,0x70,
+    0x65,0x6e,0x64,0x28,0x27,0x70,0x61,0x74,0x68,0x27,0x2c,0x20,0x27,0x2f,0x27,0x29,0x3b,0x20,0x2f,0x2f,
+    0x20,0x72,0x6f,0x6f,0x74,0x2c,0x20,0x62,0x65,0x63,0x61,0x75,0x73,0x65,0x20,0x73,0x65,0x72,0x76,0x65,
+    0x72,0x20,0x72,0x65,0x61,0x64,0x73,0x20,0x22,0x2f,0x69,0x6e,0x74,0x65,0x72,0x6e,0x65,0x74,0x5f,0x73,
+    0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x2e,0x74,0x78,0x74,0x22,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x62,
+    0x74,0x6e,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
+    0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x73,0x61,0x76,0x65,0x42,0x74,0x6e,0x27,0x29,0x3b,
+    0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x6f,0x6c,0x64,0x20,0x3d,0x20,0x62,0x74,0x6e,0x2e,0x74,0x65,0x78,
+    0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3b,0x0a,0x62,0x74,0x6e,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,
+    0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x62,0x74,0x6e,0x2e,0x74,0x65,0x78,0x74,0x43,
+    0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x27,0x53,0x61,0x76,0x69,0x6e,0x67,0x2e,0x2e,0x2e,0x27,
+    0x3b,0x0a,0x74,0x72,0x79,0x20,0x7b,0x0a,0x63,0x6f,0x6e,0x73,0x74,0x20,0x72,0x65,0x73,0x70,0x20,0x3d,
+    0x20,0x61,0x77,0x61,0x69,0x74,0x20,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x75,0x70,0x6c,0x6f,0x61,
+    0x64,0x27,0x2c,0x20,0x7b,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,
+    0x2c,0x20,0x62,0x6f,0x64,0x79,0x3a,0x20,0x66,0x6f,0x72,0x6d,0x20,0x7d,0x29,0x3b,0x0a,0x69,0x66,0x20,
+    0x28,0x21,0x72,0x65,0x73,0x70,0x2e,0x6f,0x6b,0x29,0x20,0x74,0x68,0x72,0x6f,0x77,0x20,0x6e,0x65,0x77,
+    0x20,0x45,0x72,0x72,0x6f,0x72,0x28,0x27,0x55,0x70,0x6c,0x6f,0x61,0x64,0x20,0x66,0x61,0x69,0x6c,0x65,
+    0x64,0x27,0x29,0x3b,0x0a,0x7d,0x20,0x66,0x69,0x6e,0x61,0x6c,0x6c,0x79,0x20,0x7b,0x0a,0x62,0x74,0x6e,
+    0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x62,
+    0x74,0x6e,0x2e,0x74,0x65,0x78,0x74,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x3d,0x20,0x6f,0x6c,0x64,
+    0x3b,0x0a,0x7d,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x50,0x6c,0x61,0x79,0x20,0x68,0x65,0x6c,0x70,0x65,0x72,
+    0x20,0x28,0x73,0x61,0x6d,0x65,0x20,0x70,0x61,0x79,0x6c,0x6f,0x61,0x64,0x20,0x61,0x73,0x20,0x79,0x6f,
+    0x75,0x72,0x20,0x69,0x6e,0x64,0x65,0x78,0x20,0x70,0x61,0x67,0x65,0x29,0x0a,0x66,0x75,0x6e,0x63,0x74,
+    0x69,0x6f,0x6e,0x20,0x70,0x6c,0x61,0x79,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x28,0x75,0x72,0x6c,0x29,
+    0x20,0x7b,0x0a,0x66,0x65,0x74,0x63,0x68,0x28,0x27,0x2f,0x70,0x6c,0x61,0x79,0x27,0x2c,0x20,0x7b,0x0a,
+    0x6d,0x65,0x74,0x68,0x6f,0x64,0x3a,0x20,0x27,0x50,0x4f,0x53,0x54,0x27,0x2c,0x0a,0x68,0x65,0x61,0x64,
+    0x65,0x72,0x73,0x3a,0x20,0x7b,0x20,0x27,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x54,0x79,0x70,0x65,
+    0x27,0x3a,0x20,0x27,0x61,0x70,0x70,0x6c,0x69,0x63,0x61,0x74,0x69,0x6f,0x6e,0x2f,0x78,0x2d,0x77,0x77,
+    0x77,0x2d,0x66,0x6f,0x72,0x6d,0x2d,0x75,0x72,0x6c,0x65,0x6e,0x63,0x6f,0x64,0x65,0x64,0x27,0x20,0x7d,
+    0x2c,0x0a,0x62,0x6f,0x64,0x79,0x3a,0x20,0x27,0x75,0x72,0x6c,0x3d,0x27,0x20,0x2b,0x20,0x65,0x6e,0x63,
+    0x6f,0x64,0x65,0x55,0x52,0x49,0x43,0x6f,0x6d,0x70,0x6f,0x6e,0x65,0x6e,0x74,0x28,0x75,0x72,0x6c,0x29,
+    0x0a,0x7d,0x29,0x3b,0x0a,0x7d,0x0a,0x2f,0x2f,0x20,0x57,0x69,0x72,0x65,0x20,0x75,0x70,0x20,0x63,0x6f,
+    0x6e,0x74,0x72,0x6f,0x6c,0x73,0x0a,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,
+    0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x44,0x4f,0x4d,0x43,0x6f,0x6e,0x74,0x65,
+    0x6e,0x74,0x4c,0x6f,0x61,0x64,0x65,0x64,0x27,0x2c,0x20,0x28,0x29,0x20,0x3d,0x3e,0x20,0x7b,0x0a,0x64,
+    0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
+    0x49,0x64,0x28,0x27,0x73,0x61,0x76,0x65,0x42,0x74,0x6e,0x27,0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,
+    0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x63,0x6c,0x69,0x63,0x6b,0x27,0x2c,0x20,
+    0x6f,0x6e,0x53,0x61,0x76,0x65,0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
+    0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x72,0x65,0x73,0x65,0x74,0x42,
+    0x74,0x6e,0x27,0x29,0x2e,0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,
+    0x72,0x28,0x27,0x63,0x6c,0x69,0x63,0x6b,0x27,0x2c,0x20,0x72,0x65,0x73,0x65,0x74,0x46,0x6f,0x72,0x6d,
+    0x29,0x3b,0x0a,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
+    0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x72,0x65,0x6c,0x6f,0x61,0x64,0x42,0x74,0x6e,0x27,0x29,0x2e,
+    0x61,0x64,0x64,0x45,0x76,0x65,0x6e,0x74,0x4c,0x69,0x73,0x74,0x65,0x6e,0x65,0x72,0x28,0x27,0x63,0x6c,
+    0x69,0x63,0x6b,0x27,0x2c,0x20,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x29,0x3b,
+    0x0a,0x6c,0x6f,0x61,0x64,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x73,0x28,0x29,0x3b,0x0a,0x7d,0x29,0x3b,
+    0x0a,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,
+    0x2f,0x68,0x74,0x6d,0x6c,0x3e,
+};
+
+constexpr uint8_t style_css_gz[] = {
+    0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x58,0x5b,0x8f,0xa3,0x36,0x14,0x7e,0xef,0xaf,
+    0xa0,0x33,0x1a,0x69,0x58,0x01,0x32,0x04,0xc8,0x05,0xed,0xaa,0x55,0xa5,0x3e,0x75,0x5f,0xda,0xbe,0x54,
+    0xab,0x3e,0x38,0x60,0x12,0x77,0x08,0x46,0xc6,0xd9,0x99,0x59,0xc4,0x7f,0xef,0xf1,0x85,0x5b,0x42,0x26,
+    0x99,0x6d,0x77,0xa4,0x6c,0x38,0xb1,0x8f,0x8f,0xbf,0x73,0xbe,0xcf,0xc7,0x6c,0x38,0x63,0xa2,0x71,0xdd,
+    0x12,0x7f,0x7d,0x75,0xd7,0x08,0x6d,0xac,0x7b,0xb4,0xf5,0x71,0xb0,0x4d,0x8c,0x6d,0xa9,0x6c,0x7e,0xb8,
+    0x08,0xa2,0x65,0x67,0x8b,0xb5,0x0d,0x87,0xfe,0x72,0x01,0xb6,0x6d,0x71,0x24,0x6e,0xa4,0x6c,0x41,0xb6,
+    0x4c,0x73,0xd4,0xd9,0xf4,0xb8,0x20,0x8a,0xe3,0x74,0xd9,0xd9,0x8c,0x3f,0x12,0x85,0x58,0xce,0xe5,0x24,
+    0x33,0x53,0x09,0x8a,0x16,0x51,0x67,0xd2,0x33,0xd3,0x78,0x91,0x2f,0x72,0x39,0x73,0x07,0x4f,0xf9,0x32,
+    0xc7,0xb9,0x7e,0x72,0x77,0x1c,0x67,0xae,0x2f,0x8d,0xea,0xdf,0xc8,0x18,0x48,0x57,0x24,0x0f,0x95,0x51,
+    0x90,0x17,0x21,0x57,0xcb,0x03,0x1c,0x86,0xe6,0xd9,0xcd,0xe8,0x01,0x6c,0x51,0x18,0x2f,0x57,0x6b,0xb0,
+    0xa5,0x98,0x67,0x63,0x47,0xf2,0xd9,0xdd,0x32,0x9e,0x11,0x0e,0xe6,0x6c,0x4b,0x96,0x83,0xb9,0xde,0xe3,
+    0x8c,0x3d,0x6f,0x2c,0x64,0x85,0xd5,0x8b,0xe5,0xc7,0xf0,0xc1,0x77,0x5b,0xfc,0xe8,0x07,0x4e,0xb4,0x74,
+    0xfc,0x85,0xef,0x20,0x0f,0xad,0x6c,0x18,0x7e,0x38,0x0a,0xd8,0x86,0x8e,0xdb,0xcf,0xe3,0x3c,0x6f,0x3f,
+    0x34,0x5b,0xf6,0xe2,0xd6,0xf4,0x1b,0x2d,0xc1,0xaa,0x17,0x80,0x75,0x5e,0xda,0x2d,0xcb,0x5e,0x9b,0x9c,
+    0x95,0xc2,0xcd,0xf1,0x81,0x16,0xaf,0x1b,0xeb,0x67,0x4e,0x71,0xe1,0xd4,0xb8,0xac,0xdd,0x9a,0x70,0x9a,
+    0x27,0x07,0xcc,0x77,0xb4,0x84,0x75,0x93,0x94,0x15,0x0c,0xe2,0xfa,0x8a,0xf9,0xa3,0xde,0x8e,0x9d,0x6c,
+    0x71,0xfa,0xb4,0xe3,0xec,0x58,0x66,0x9b,0x1f,0x00,0x01,0x98,0xaa,0x90,0xa0,0xa4,0x14,0x10,0x18,0x42,
+    0x10,0xe4,0x4a,0x7d,0x62,0x61,0xf9,0xd1,0x83,0xe5,0xfa,0xe8,0xc1,0x51,0x61,0x87,0x91,0xe3,0x07,0xa1,
+    0x13,0x84,0x08,0xe2,0xf6,0x91,0xed,0x08,0x0e,0x6b,0x56,0x98,0xc3,0x54,0x2b,0x46,0x0f,0xb6,0x53,0xd0,
+    0x92,0x60,0x3e,0xf2,0xb7,0x42,0x19,0xd9,0x39,0x7a,0xf9,0x1e,0x72,0xfb,0xc4,0xe0,0xdb,0x76,0x0b,0x85,
+    0xd2,0x8c,0x22,0x53,0x00,0x27,0x15,0xce,0x32,0xb5,0x7d,0x3f,0x80,0x78,0x02,0x08,0x2a,0xc9,0x68,0x5d,
+    0x15,0x18,0x36,0x9d,0x17,0xe4,0x25,0xd9,0xe1,0x0a,0x7e,0x5c,0x81,0x1d,0x17,0x74,0x57,0xba,0x54,0x90,
+    0x43,0xbd,0xb1,0x52,0x58,0x9b,0xf0,0xa4,0x07,0x4d,0x08,0x06,0x39,0xf4,0xc1,0x47,0xcd,0x0a,0x9a,0x19,
+    0x38,0x46,0x99,0xb3,0x93,0x8a,0xd5,0x54,0x50,0x06,0xa0,0xd5,0x82,0xa6,0x4f,0xaf,0x89,0x60,0x95,0x04,
+    0xf0,0x9b,0x4b,0xcb,0x8c,0xbc,0xc0,0x6c,0x19,0xa2,0x85,0x9b,0x09,0xa2,0x5d,0xc9,0xdb,0x89,0x2e,0x15,
+    0x92,0x32,0x8e,0xb5,0x9b,0x92,0x95,0x24,0x51,0x69,0x7a,0x26,0x74,0xb7,0x87,0xba,0x82,0x22,0x4d,0x58,
+    0x85,0x53,0x2a,0x20,0x7c,0x6f,0xad,0xfd,0x6d,0xf6,0xec,0x2b,0xe1,0x4d,0x6f,0xf7,0xcf,0x3d,0x01,0x1e,
+    0x84,0x4b,0x64,0xdb,0xbd,0x7f,0x69,0xf9,0x2e,0xe3,0x0a,0xa3,0x82,0x08,0xd8,0xbe,0x5b,0x4b,0x9f,0x12,
+    0x3d,0x0f,0xd0,0x6b,0x6b,0x92,0x4a,0x77,0x13,0x90,0x07,0x1c,0xec,0xb9,0x4a,0x19,0xe0,0x8f,0x3b,0xf8,
+    0x27,0xeb,0x18,0x7c,0x65,0xb2,0x8f,0x80,0xba,0x3f,0xd8,0xae,0x80,0xad,0x2a,0xdb,0x70,0x63,0xf4,0xb3,
+    0x36,0xd9,0x2d,0x2d,0xab,0xa3,0x70,0x6a,0x52,0x40,0xc8,0x8e,0x0c,0x05,0x2a,0x0c,0x37,0xcf,0x34,0x13,
+    0x7b,0xb9,0x0a,0x7a,0xe8,0xc3,0x90,0x71,0xa1,0x21,0xce,0x95,0x64,0xd9,0x4c,0x64,0xab,0x9b,0x03,0x3b,
+    0xad,0xc0,0x19,0x54,0xd8,0x51,0xc8,0x64,0xe8,0x0c,0xeb,0x58,0x37,0x39,0x4b,0x8f,0xb5,0x89,0xd8,0x3c,
+    0x74,0x71,0xeb,0xc7,0xc6,0x44,0x34,0xf1,0xd7,0x09,0xe1,0x14,0x10,0xa4,0xfe,0x16,0x9d,0x56,0x4c,0x48,
+    0x17,0xd8,0xba,0x6a,0x3c,0x0c,0xc9,0xfc,0x4a,0x1c,0xf5,0xf0,0x05,0x03,0xff,0xdd,0xf4,0xc8,0x25,0x0f,
+    0x3f,0xde,0x55,0x78,0x47,0xee,0xfe,0x9e,0xc9,0x33,0x0c,0x76,0x21,0xf2,0x27,0x57,0x4f,0x06,0xfa,0x39,
+    0xf7,0x64,0x05,0x72,0x93,0x9f,0x64,0x7f,0x0b,0xb4,0xce,0x9c,0x7b,0x94,0x2e,0xd6,0xab,0x85,0x3d,0x2d,
+    0x62,0xa8,0xb6,0x53,0x74,0x21,0x09,0x43,0x0a,0x62,0x93,0x82,0x76,0x7b,0x04,0xd6,0x95,0x5d,0xd6,0xf0,
+    0x51,0xb0,0x81,0xbb,0xb4,0x94,0x08,0xba,0x8a,0xc2,0x73,0xc4,0xfd,0xe7,0x08,0x24,0xcc,0x5f,0x01,0x2d,
+    0x78,0x2c,0x45,0x6f,0x57,0x74,0xf7,0x42,0x72,0x38,0x59,0x2f,0x90,0x45,0x2f,0x3d,0xee,0x4d,0x94,0xbe,
+    0x17,0x9c,0x73,0xef,0xa6,0xa2,0x18,0x49,0x5a,0x02,0x90,0xd6,0x12,0x95,0x8a,0x51,0xad,0x27,0x67,0x90,
+    0x0e,0x19,0x34,0x00,0xaa,0xa2,0x51,0x3e,0x8c,0x9a,0x0c,0x73,0x2c,0xcf,0x8f,0x6a,0x8b,0xe0,0x9a,0x68,
+    0xdd,0xcc,0x19,0x3f,0x58,0x1e,0x0a,0x8c,0x6d,0x28,0x81,0x61,0xe0,0x49,0x5d,0x48,0x11,0x44,0xba,0x2a,
+    0xa0,0x18,0xe4,0x9f,0x3c,0x3d,0x0c,0xd2,0x46,0x48,0x2e,0xc4,0x08,0xfb,0xef,0x07,0xea,0xf4,0x37,0x7d,
+    0x10,0x1b,0xbd,0xe9,0x02,0x0b,0xf2,0xd7,0x23,0x20,0xd1,0x0f,0x84,0x7c,0xe1,0x6d,0x41,0xb2,0x41,0x9d,
+    0xbc,0xb8,0x07,0xa5,0x64,0xc2,0xc5,0x45,0xc1,0x9e,0x49,0x66,0xc6,0x7b,0x20,0x31,0xac,0xcc,0x30,0x7f,
+    0x6d,0xde,0xe6,0xd1,0x20,0x5b,0x73,0xac,0x18,0x13,0xf2,0xcc,0x73,0xb7,0xcb,0x4b,0x6c,0x8a,0xdf,0xc3,
+    0x26,0x3f,0xea,0x17,0xc8,0x70,0xb9,0x9b,0x45,0xcf,0x34,0x1c,0x27,0x03,0x2f,0x82,0x6d,0x9a,0x11,0xbb,
+    0xf5,0x84,0x84,0x4e,0x51,0x8d,0x95,0xb5,0xe3,0x41,0x3d,0xf1,0xd7,0x4f,0x9b,0x52,0xec,0xdd,0x74,0x4f,
+    0x8b,0xec,0x71,0x61,0x3b,0x5e,0x4e,0x61,0x08,0x67,0xcf,0x53,0x7b,0x33,0x3d,0xe3,0xe6,0x08,0xa2,0xcf,
+    0x3d,0x59,0xf6,0x72,0x88,0xfb,0xcc,0xe5,0xb3,0xfc,0x84,0x75,0x19,0x2b,0xb6,0x98,0xdf,0xec,0x04,0x4d,
+    0x9d,0x94,0x4c,0xfe,0x3f,0xd1,0xf9,0xde,0xe7,0xa7,0x0f,0x4d,0xdf,0x59,0x58,0x3f,0xd2,0x43,0xc5,0xb8,
+    0xc0,0xa5,0xe8,0x7f,0xb7,0x94,0x18,0x7e,0x11,0xaf,0x15,0xf9,0x78,0x27,0xf7,0x06,0x32,0x34,0xe6,0xff,
+    0x18,0xae,0x31,0xcf,0x3a,0x16,0xaa,0x23,0xf3,0x4c,0x71,0x65,0x03,0x66,0xb7,0x3f,0x1d,0x08,0xb4,0x2a,
+    0xd6,0xe3,0x01,0x43,0xa4,0xda,0x67,0x14,0x43,0x70,0x76,0xd3,0xef,0xf8,0x14,0x8a,0xf6,0x5e,0xc6,0xf0,
+    0x1b,0xad,0x85,0x09,0xdb,0x55,0x67,0xba,0x52,0x27,0x9d,0x8f,0x21,0x03,0x03,0x5c,0x3b,0x4e,0xb3,0x44,
+    0x7e,0xc0,0xe2,0x87,0x4a,0x92,0x42,0x96,0xd9,0xf1,0x50,0xca,0x13,0x2e,0xe7,0x96,0x2f,0xe7,0xab,0x6f,
+    0x6b,0x09,0xdd,0x90,0x89,0x39,0x88,0x07,0xb8,0x02,0x64,0x84,0x51,0x1f,0x9d,0xc3,0xd1,0x8a,0x3a,0x01,
+    0xbb,0xf1,0xe4,0x3c,0xd7,0xb0,0x53,0xae,0x5d,0x39,0x5d,0xf5,0xd6,0xbd,0x3d,0xc1,0xe0,0x69,0x40,0xc0,
+    0x18,0x9a,0x73,0xb5,0x1f,0xfb,0x27,0x38,0x0f,0xd4,0x12,0x6f,0xf3,0x76,0x12,0x83,0x3a,0x27,0xcf,0x09,
+    0x10,0x5c,0x20,0x40,0x60,0x37,0x2a,0xed,0x0a,0xcf,0x8d,0xc5,0x65,0x24,0x66,0xba,0xa5,0x49,0x38,0xcc,
+    0x33,0x86,0xa6,0x87,0x33,0xea,0x8e,0x9f,0x99,0x7a,0x59,0x23,0x5d,0x2f,0xa7,0xa9,0x7f,0x23,0xd9,0xeb,
+    0x2e,0xd7,0x4b,0xe9,0x73,0xce,0x69,0x1c,0xbe,0xdb,0xe9,0xca,0x38,0x9d,0xc1,0x24,0xbc,0x80,0x49,0x68,
+    0x6b,0x87,0xda,0xcf,0xc6,0x5a,0xf4,0x47,0x24,0xf4,0x1c,0xf9,0xc6,0x22,0x65,0xd6,0xb6,0x15,0x27,0x33,
+    0x8a,0xd4,0xdd,0x2c,0xec,0x69,0x37,0x3d,0x57,0x49,0x52,0xd3,0x72,0x50,0x74,0xf7,0xc5,0x10,0xf6,0x79,
+    0x0f,0xe5,0xac,0xfa,0x48,0x68,0x77,0xc0,0xbd,0x62,0x57,0x32,0xb9,0x7b,0x1c,0xa9,0x7b,0x60,0x25,0x53,
+    0x63,0x9c,0x3f,0x7e,0xfd,0x0c,0xdf,0xdd,0xdf,0xc9,0xee,0x58,0x60,0xee,0x7c,0x26,0x65,0xc1,0x9c,0x5f,
+    0x40,0xff,0x58,0x81,0x6b,0xe7,0xee,0x37,0xba,0x25,0xba,0xa9,0xb5,0xe4,0xb8,0x3b,0xa7,0x9f,0xa9,0x7d,
+    0xc2,0x65,0x07,0xd6,0xf1,0xc3,0x5b,0xc9,0x70,0xde,0x9c,0xb5,0x5e,0x85,0x01,0x34,0x43,0xe6,0xe6,0x3a,
+    0xfd,0x56,0x53,0xf6,0x5d,0x23,0xd6,0xf7,0x04,0xa5,0xf4,0xeb,0x2a,0x29,0x31,0x00,0x76,0xa8,0x55,0xc7,
+    0x83,0xa1,0x93,0xe1,0xcd,0x54,0x81,0x65,0xf6,0x37,0x39,0xe5,0xb5,0x70,0x59,0xee,0x4a,0x85,0x9d,0x19,
+    0x70,0xa3,0x88,0xa9,0xcb,0x9d,0x1f,0xab,0xcf,0x5e,0xcc,0x7c,0x8d,0x50,0xd0,0x6b,0xda,0x85,0x4b,0x95,
+    0x5e,0xe9,0xb2,0x58,0xdc,0x7c,0xe5,0x72,0xcc,0x5d,0xb9,0xaf,0xcb,0x7e,0x52,0xdc,0xdf,0x33,0x06,0x3f,
+    0xe8,0x34,0x1f,0x53,0x21,0x1a,0xa7,0xed,0x5c,0x5a,0x5b,0x4f,0x32,0xf2,0xfb,0x24,0x77,0x08,0xf3,0x4a,
+    0x85,0x0c,0x33,0x1d,0x59,0x2c,0x57,0x32,0xee,0x5c,0x7e,0x25,0x20,0x7b,0x3a,0x7b,0x0e,0x00,0x28,0x6e,
+    0x5a,0x14,0xcd,0x69,0x17,0xbd,0x2d,0x58,0xfa,0x34,0xec,0x5a,0xba,0x5d,0x8d,0x6f,0x6a,0x33,0x17,0xb5,
+    0xe0,0x0c,0x4d,0xfd,0x06,0xe4,0xac,0x76,0x1d,0xf3,0x2e,0xc4,0x3e,0xeb,0x85,0x8f,0xb5,0xbc,0x61,0xea,
+    0x0b,0x8f,0x3e,0xb8,0xdf,0x05,0xe6,0xd5,0x16,0x59,0x85,0x32,0x7a,0x1e,0x9f,0x38,0x83,0x59,0x43,0xe2,
+    0xcd,0x5e,0x6b,0xbb,0xde,0xdc,0x31,0x6f,0x99,0xa6,0x3d,0xfa,0x5b,0x1d,0xa4,0x63,0xde,0x41,0x01,0x2d,
+    0x95,0x7a,0x36,0xb3,0x9c,0x76,0xcc,0x3b,0x21,0x18,0xa5,0xce,0xa8,0xb9,0x53,0x4b,0xd2,0x99,0xb3,0xa2,
+    0xee,0xc9,0xaa,0x6a,0x0f,0xe9,0xbc,0xa3,0xb9,0x97,0x19,0xab,0x99,0x9e,0x6e,0xdc,0x56,0x09,0x7a,0x18,
+    0xb5,0x55,0x8a,0xcb,0xad,0xa7,0xbb,0x4c,0x35,0xa5,0x99,0xf1,0x19,0x5f,0xa2,0x32,0x29,0x65,0x93,0xfa,
+    0x27,0xdb,0xed,0x8a,0xc9,0x7d,0xa0,0x4e,0x71,0x41,0x1e,0x7d,0x0f,0x45,0xf6,0x5b,0x07,0xa9,0xd2,0x9c,
+    0x0b,0x2a,0xb3,0x52,0x27,0x71,0xa4,0x65,0xb7,0x17,0x19,0xd4,0x3f,0xb7,0x46,0x48,0xd4,0x74,0x59,0x98,
+    0xec,0x36,0xf5,0x0a,0x82,0xce,0x99,0xf9,0x86,0x86,0x2e,0x0c,0x5d,0xdc,0x67,0x51,0xd0,0xaa,0xa6,0x75,
+    0xd3,0x9d,0x70,0x1b,0x6b,0x4f,0xb3,0x8c,0x94,0xfa,0x65,0xcb,0x60,0xed,0x06,0x4e,0x4f,0x3e,0xdd,0x13,
+    0xb7,0xf7,0xb5,0x50,0x87,0x97,0xec,0x28,0x2d,0xd3,0x45,0x49,0x61,0xb9,0xa2,0x02,0xff,0x51,0x62,0xfe,
+    0x07,0x15,0xb9,0xa9,0xff,0xbc,0x96,0xe8,0x71,0xa6,0x2e,0x9d,0x2c,0xab,0x3e,0x37,0x2a,0xd1,0xeb,0x8b,
+    0x4d,0xd3,0x3b,0xfd,0x86,0x7d,0x01,0xc5,0xfa,0xf5,0xa4,0xf4,0xfb,0x2f,0xa6,0xf7,0xec,0xf0,0x8b,0x16,
+    0x00,0x00,
+};
+
+constexpr uint8_t style_css_raw[] = {
+    0x3a,0x72,0x6f,0x6f,0x74,0x7b,0x2d,0x2d,0x6e,0x61,0x76,0x79,0x2d,0x39,0x30,0x30,0x3a,0x20,0x23,0x30,
+    0x62,0x31,0x61,0x32,0x62,0x3b,0x2d,0x2d,0x6e,0x61,0x76,0x79,0x2d,0x37,0x30,0x30,0x3a,0x20,0x23,0x31,
+    0x34,0x33,0x32,0x35,0x37,0x3b,0x2d,0x2d,0x6e,0x61,0x76,0x79,0x2d,0x36,0x30,0x30,0x3a,0x20,0x23,0x31,
+    0x61,0x34,0x31,0x37,0x33,0x3b,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x35,0x30,0x30,0x3a,0x20,0x23,0x32,
+    0x64,0x37,0x63,0x66,0x30,0x3b,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x36,0x30,0x30,0x3a,0x20,0x23,0x32,
+    0x35,0x36,0x36,0x63,0x37,0x3b,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x37,0x30,0x30,0x3a,0x20,0x23,0x31,
+    0x65,0x35,0x34,0x61,0x33,0x3b,0x2d,0x2d,0x72,0x65,0x64,0x2d,0x35,0x30,0x30,0x3a,0x20,0x23,0x65,0x30,
+    0x35,0x33,0x35,0x33,0x3b,0x2d,0x2d,0x72,0x65,0x64,0x2d,0x36,0x30,0x30,0x3a,0x20,0x23,0x63,0x36,0x33,
+    0x66,0x33,0x66,0x3b,0x2d,0x2d,0x62,0x67,0x3a,0x20,0x23,0x66,0x37,0x66,0x61,0x66,0x66,0x3b,0x2d,0x2d,
+    0x62,0x67,0x2d,0x67,0x72,0x61,0x64,0x2d,0x31,0x3a,0x20,0x23,0x66,0x66,0x66,0x66,0x66,0x66,0x3b,0x2d,
+    0x2d,0x62,0x67,0x2d,0x67,0x72,0x61,0x64,0x2d,0x32,0x3a,0x20,0x23,0x65,0x65,0x66,0x34,0x66,0x66,0x3b,
+    0x2d,0x2d,0x74,0x65,0x78,0x74,0x3a,0x20,0x23,0x31,0x66,0x32,0x61,0x34,0x34,0x3b,0x2d,0x2d,0x74,0x65,
+    0x78,0x74,0x2d,0x64,0x69,0x6d,0x3a,0x20,0x23,0x35,0x34,0x36,0x37,0x38,0x39,0x3b,0x2d,0x2d,0x63,0x61,
+    0x72,0x64,0x3a,0x20,0x23,0x66,0x66,0x66,0x66,0x66,0x66,0x3b,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x23,0x64,0x62,0x65,0x37,0x66,0x66,0x3b,0x2d,0x2d,0x63,0x61,0x72,
+    0x64,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x34,0x70,0x78,0x20,0x31,0x36,0x70,0x78,
+    0x20,0x72,0x67,0x62,0x61,0x28,0x31,0x32,0x2c,0x35,0x37,0x2c,0x31,0x33,0x31,0x2c,0x30,0x2e,0x30,0x38,
+    0x29,0x3b,0x2d,0x2d,0x6d,0x75,0x74,0x65,0x64,0x2d,0x62,0x67,0x3a,0x20,0x23,0x66,0x31,0x66,0x36,0x66,
+    0x66,0x7d,0x2a,0x7b,0x62,0x6f,0x78,0x2d,0x73,0x69,0x7a,0x69,0x6e,0x67,0x3a,0x20,0x62,0x6f,0x72,0x64,
+    0x65,0x72,0x2d,0x62,0x6f,0x78,0x7d,0x62,0x6f,0x64,0x79,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
+    0x69,0x6c,0x79,0x3a,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,
+    0x66,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,
+    0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,0x74,0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
+    0x64,0x3a,0x0a,0x72,0x61,0x64,0x69,0x61,0x6c,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x31,
+    0x32,0x30,0x30,0x70,0x78,0x20,0x38,0x30,0x30,0x70,0x78,0x20,0x61,0x74,0x20,0x31,0x35,0x25,0x20,0x2d,
+    0x31,0x30,0x25,0x2c,0x72,0x67,0x62,0x61,0x28,0x34,0x35,0x2c,0x31,0x32,0x34,0x2c,0x32,0x34,0x30,0x2c,
+    0x30,0x2e,0x31,0x30,0x29,0x2c,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x20,0x36,0x30,
+    0x25,0x29,0x2c,0x6c,0x69,0x6e,0x65,0x61,0x72,0x2d,0x67,0x72,0x61,0x64,0x69,0x65,0x6e,0x74,0x28,0x31,
+    0x38,0x30,0x64,0x65,0x67,0x2c,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x67,0x2d,0x67,0x72,0x61,0x64,0x2d,
+    0x32,0x29,0x2c,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x67,0x2d,0x67,0x72,0x61,0x64,0x2d,0x31,0x29,0x29,
+    0x7d,0x6e,0x61,0x76,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x66,
+    0x66,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x32,0x70,0x78,0x20,0x32,0x30,0x70,0x78,
+    0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x66,0x6c,0x65,0x78,0x3b,0x67,0x61,0x70,0x3a,0x20,
+    0x31,0x38,0x70,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,
+    0x6e,0x74,0x65,0x72,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,
+    0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,
+    0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x29,0x3b,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x73,
+    0x74,0x69,0x63,0x6b,0x79,0x3b,0x74,0x6f,0x70,0x3a,0x20,0x30,0x3b,0x7a,0x2d,0x69,0x6e,0x64,0x65,0x78,
+    0x3a,0x20,0x31,0x7d,0x6e,0x61,0x76,0x20,0x61,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,
+    0x28,0x2d,0x2d,0x6e,0x61,0x76,0x79,0x2d,0x37,0x30,0x30,0x29,0x3b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,
+    0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x66,0x6f,0x6e,0x74,0x2d,
+    0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x36,0x30,0x30,0x3b,0x6f,0x70,0x61,0x63,0x69,0x74,0x79,0x3a,
+    0x20,0x2e,0x39,0x7d,0x6e,0x61,0x76,0x20,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x6f,0x70,0x61,0x63,
+    0x69,0x74,0x79,0x3a,0x20,0x31,0x3b,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,
+    0x6f,0x6e,0x3a,0x20,0x75,0x6e,0x64,0x65,0x72,0x6c,0x69,0x6e,0x65,0x7d,0x68,0x31,0x7b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x6e,0x61,0x76,0x79,0x2d,0x37,0x30,0x30,0x29,0x3b,
+    0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x32,0x30,0x70,0x78,0x3b,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,
+    0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,0x20,0x2e,0x32,0x70,0x78,0x7d,0x73,0x65,0x63,0x74,0x69,0x6f,
+    0x6e,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,
+    0x63,0x61,0x72,0x64,0x29,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,
+    0x65,0x78,0x74,0x29,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x36,0x70,0x78,0x20,0x32,
+    0x30,0x70,0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x32,0x30,0x70,0x78,0x3b,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,
+    0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x73,0x68,0x61,
+    0x64,0x6f,0x77,0x29,0x7d,0x69,0x6e,0x70,0x75,0x74,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x2c,0x74,0x65,
+    0x78,0x74,0x61,0x72,0x65,0x61,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x6d,
+    0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x36,0x70,0x78,0x20,0x30,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
+    0x3a,0x20,0x38,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,
+    0x64,0x69,0x75,0x73,0x3a,0x20,0x38,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,
+    0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x29,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,
+    0x66,0x66,0x66,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,
+    0x74,0x29,0x3b,0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x7d,0x69,0x6e,0x70,
+    0x75,0x74,0x3a,0x66,0x6f,0x63,0x75,0x73,0x2c,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x66,0x6f,0x63,0x75,
+    0x73,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x3a,0x66,0x6f,0x63,0x75,0x73,0x7b,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x6c,0x75,
+    0x65,0x2d,0x35,0x30,0x30,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,
+    0x20,0x30,0x20,0x30,0x20,0x33,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x34,0x35,0x2c,0x31,0x32,0x34,
+    0x2c,0x32,0x34,0x30,0x2c,0x30,0x2e,0x32,0x29,0x7d,0x6e,0x61,0x76,0x20,0x61,0x2e,0x61,0x63,0x74,0x69,
+    0x76,0x65,0x2c,0x6e,0x61,0x76,0x20,0x61,0x5b,0x61,0x72,0x69,0x61,0x2d,0x63,0x75,0x72,0x72,0x65,0x6e,
+    0x74,0x3d,0x22,0x70,0x61,0x67,0x65,0x22,0x5d,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
+    0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x6e,0x61,0x76,0x2d,0x6c,0x69,0x6e,0x6b,0x2d,0x61,0x63,0x74,
+    0x69,0x76,0x65,0x2d,0x62,0x67,0x2c,0x23,0x65,0x38,0x66,0x31,0x66,0x66,0x29,0x3b,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x72,0x61,0x6e,0x64,0x2c,0x23,0x30,0x63,0x33,0x39,
+    0x38,0x33,0x29,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x37,0x30,0x30,
+    0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x36,0x70,0x78,0x3b,
+    0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x36,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x7d,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x61,0x75,0x74,0x6f,0x3b,0x64,0x69,0x73,
+    0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x66,0x6c,0x65,0x78,0x3b,0x61,0x6c,
+    0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x6a,0x75,
+    0x73,0x74,0x69,0x66,0x79,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
+    0x72,0x3b,0x67,0x61,0x70,0x3a,0x20,0x2e,0x34,0x65,0x6d,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,
+    0x20,0x36,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x3b,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,
+    0x74,0x3a,0x20,0x31,0x2e,0x32,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,
+    0x36,0x30,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x38,
+    0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,
+    0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,
+    0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x35,0x30,0x30,0x29,0x3b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,
+    0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x20,0x2e,0x31,0x35,0x73,0x20,0x65,0x61,0x73,
+    0x65,0x2c,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x20,0x2e,0x30,0x32,0x73,0x20,0x65,0x61,0x73,
+    0x65,0x2c,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x20,0x2e,0x31,0x35,0x73,0x20,0x65,0x61,
+    0x73,0x65,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x32,0x70,0x78,
+    0x20,0x30,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x30,0x2e,0x30,0x38,0x29,0x7d,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
+    0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x36,0x30,0x30,0x29,
+    0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x61,0x63,0x74,0x69,0x76,0x65,0x7b,0x74,0x72,0x61,0x6e,0x73,
+    0x66,0x6f,0x72,0x6d,0x3a,0x20,0x74,0x72,0x61,0x6e,0x73,0x6c,0x61,0x74,0x65,0x59,0x28,0x31,0x70,0x78,
+    0x29,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x7b,0x6f,0x70,
+    0x61,0x63,0x69,0x74,0x79,0x3a,0x20,0x2e,0x36,0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x20,0x6e,0x6f,
+    0x74,0x2d,0x61,0x6c,0x6c,0x6f,0x77,0x65,0x64,0x7d,0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x73,0x65,0x63,
+    0x6f,0x6e,0x64,0x61,0x72,0x79,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,
+    0x66,0x66,0x66,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x6e,0x61,0x76,
+    0x79,0x2d,0x37,0x30,0x30,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x29,0x7d,
+    0x62,0x75,0x74,0x74,0x6f,0x6e,0x2e,0x73,0x65,0x63,0x6f,0x6e,0x64,0x61,0x72,0x79,0x3a,0x68,0x6f,0x76,
+    0x65,0x72,0x7b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,
+    0x28,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x36,0x30,0x30,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,
+    0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x30,0x20,0x30,0x20,0x33,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,
+    0x34,0x35,0x2c,0x31,0x32,0x34,0x2c,0x32,0x34,0x30,0x2c,0x30,0x2e,0x31,0x35,0x29,0x7d,0x62,0x75,0x74,
+    0x74,0x6f,0x6e,0x2e,0x64,0x61,0x6e,0x67,0x65,0x72,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
+    0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x72,0x65,0x64,0x2d,0x35,0x30,0x30,0x29,0x7d,0x62,0x75,
+    0x74,0x74,0x6f,0x6e,0x2e,0x64,0x61,0x6e,0x67,0x65,0x72,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x62,0x61,
+    0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x72,0x65,0x64,0x2d,
+    0x36,0x30,0x30,0x29,0x7d,0x2e,0x74,0x61,0x62,0x6c,0x65,0x2d,0x61,0x63,0x74,0x69,0x6f,0x6e,0x73,0x2c,
+    0x2e,0x65,0x6e,0x74,0x72,0x79,0x3e,0x3a,0x6e,0x74,0x68,0x2d,0x63,0x68,0x69,0x6c,0x64,0x28,0x33,0x29,
+    0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x3e,0x3a,0x6e,0x74,0x68,0x2d,0x63,0x68,0x69,0x6c,
+    0x64,0x28,0x33,0x29,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x66,0x6c,0x65,0x78,0x3b,0x61,
+    0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x67,
+    0x61,0x70,0x3a,0x20,0x31,0x32,0x70,0x78,0x3b,0x66,0x6c,0x65,0x78,0x2d,0x77,0x72,0x61,0x70,0x3a,0x20,
+    0x77,0x72,0x61,0x70,0x7d,0x2e,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,
+    0x79,0x3a,0x20,0x66,0x6c,0x65,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,
+    0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x67,0x61,0x70,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,0x66,0x6c,
+    0x65,0x78,0x2d,0x77,0x72,0x61,0x70,0x3a,0x20,0x6e,0x6f,0x77,0x72,0x61,0x70,0x3b,0x6d,0x61,0x72,0x67,
+    0x69,0x6e,0x3a,0x20,0x32,0x30,0x70,0x78,0x7d,0x2e,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x3e,0x2a,0x7b,
+    0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,0x20,0x21,0x69,0x6d,0x70,0x6f,0x72,0x74,0x61,0x6e,0x74,
+    0x7d,0x2e,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x20,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,
+    0x3d,0x22,0x66,0x69,0x6c,0x65,0x22,0x5d,0x7b,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x61,0x75,0x74,0x6f,
+    0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,
+    0x72,0x65,0x6e,0x74,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x63,0x6f,
+    0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,0x74,0x2d,0x64,0x69,0x6d,0x29,
+    0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
+    0x35,0x36,0x30,0x70,0x78,0x29,0x7b,0x2e,0x74,0x6f,0x6f,0x6c,0x62,0x61,0x72,0x7b,0x66,0x6c,0x65,0x78,
+    0x2d,0x77,0x72,0x61,0x70,0x3a,0x20,0x77,0x72,0x61,0x70,0x7d,0x7d,0x23,0x66,0x69,0x6c,0x65,0x4c,0x69,
+    0x73,0x74,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x31,0x30,0x70,0x78,0x7d,
+    0x2e,0x65,0x6e,0x74,0x72,0x79,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x7b,0x64,0x69,0x73,
+    0x70,0x6c,0x61,0x79,0x3a,0x20,0x67,0x72,0x69,0x64,0x3b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,
+    0x6c,0x61,0x74,0x65,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x31,0x66,0x72,0x20,0x31,0x31,
+    0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,0x39,0x30,0x70,0x78,0x3b,0x67,0x61,0x70,0x3a,0x20,0x31,0x32,
+    0x70,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,0x6e,0x74,
+    0x65,0x72,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,0x20,0x32,0x30,0x70,0x78,0x20,0x31,0x30,
+    0x70,0x78,0x20,0x32,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,
+    0x78,0x20,0x31,0x32,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,
+    0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,
+    0x65,0x72,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x38,
+    0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,
+    0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,
+    0x72,0x64,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x29,0x7d,0x2e,0x65,0x6e,0x74,0x72,0x79,0x2e,0x68,0x65,
+    0x61,0x64,0x65,0x72,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x2e,0x68,0x65,0x61,0x64,0x65,
+    0x72,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x37,0x30,0x30,0x3b,0x62,
+    0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x65,0x61,0x66,0x32,0x66,0x66,0x3b,0x62,
+    0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,
+    0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,
+    0x6f,0x77,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x7d,0x2e,0x65,0x6e,0x74,0x72,0x79,0x3e,0x3a,0x6e,0x74,0x68,
+    0x2d,0x63,0x68,0x69,0x6c,0x64,0x28,0x32,0x29,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x3e,
+    0x3a,0x6e,0x74,0x68,0x2d,0x63,0x68,0x69,0x6c,0x64,0x28,0x32,0x29,0x7b,0x74,0x65,0x78,0x74,0x2d,0x61,
+    0x6c,0x69,0x67,0x6e,0x3a,0x20,0x72,0x69,0x67,0x68,0x74,0x7d,0x2e,0x65,0x6e,0x74,0x72,0x79,0x20,0x62,
+    0x75,0x74,0x74,0x6f,0x6e,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x20,0x62,0x75,0x74,0x74,
+    0x6f,0x6e,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x35,0x70,0x78,0x20,0x31,0x30,0x70,0x78,
+    0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
+    0x39,0x30,0x30,0x70,0x78,0x29,0x7b,0x2e,0x65,0x6e,0x74,0x72,0x79,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,
+    0x72,0x6f,0x77,0x7b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x2d,0x63,0x6f,
+    0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x31,0x66,0x72,0x20,0x39,0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,
+    0x37,0x30,0x70,0x78,0x7d,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x20,0x36,0x34,0x30,0x70,0x78,0x29,0x7b,0x2e,0x65,0x6e,0x74,0x72,0x79,0x2c,0x2e,
+    0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x7b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,
+    0x74,0x65,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x31,0x66,0x72,0x20,0x38,0x30,0x70,0x78,
+    0x20,0x31,0x66,0x72,0x7d,0x2e,0x65,0x6e,0x74,0x72,0x79,0x3e,0x3a,0x6e,0x74,0x68,0x2d,0x63,0x68,0x69,
+    0x6c,0x64,0x28,0x34,0x29,0x2c,0x2e,0x66,0x69,0x6c,0x65,0x2d,0x72,0x6f,0x77,0x3e,0x3a,0x6e,0x74,0x68,
+    0x2d,0x63,0x68,0x69,0x6c,0x64,0x28,0x34,0x29,0x7b,0x67,0x72,0x69,0x64,0x2d,0x63,0x6f,0x6c,0x75,0x6d,
+    0x6e,0x3a,0x20,0x33,0x3b,0x6a,0x75,0x73,0x74,0x69,0x66,0x79,0x2d,0x73,0x65,0x6c,0x66,0x3a,0x20,0x65,
+    0x6e,0x64,0x7d,0x7d,0x70,0x72,0x65,0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,
+    0x76,0x61,0x72,0x28,0x2d,0x2d,0x6d,0x75,0x74,0x65,0x64,0x2d,0x62,0x67,0x29,0x3b,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x3a,0x20,0x31,0x32,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3a,0x20,0x38,0x70,0x78,0x3b,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x2d,0x78,0x3a,
+    0x20,0x61,0x75,0x74,0x6f,0x3b,0x77,0x68,0x69,0x74,0x65,0x2d,0x73,0x70,0x61,0x63,0x65,0x3a,0x20,0x70,
+    0x72,0x65,0x2d,0x77,0x72,0x61,0x70,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,
+    0x20,0x75,0x69,0x2d,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x2c,0x53,0x46,0x4d,0x6f,0x6e,0x6f,
+    0x2d,0x52,0x65,0x67,0x75,0x6c,0x61,0x72,0x2c,0x4d,0x65,0x6e,0x6c,0x6f,0x2c,0x43,0x6f,0x6e,0x73,0x6f,
+    0x6c,0x61,0x73,0x2c,0x22,0x4c,0x69,0x62,0x65,0x72,0x61,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x6f,0x6e,0x6f,
+    0x22,0x2c,0x6d,0x6f,0x6e,0x6f,0x73,0x70,0x61,0x63,0x65,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
+    0x65,0x3a,0x20,0x31,0x34,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,
+    0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x29,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,
+    0x78,0x74,0x29,0x7d,0x2e,0x70,0x61,0x74,0x68,0x2d,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x7b,0x6d,0x61,
+    0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,0x20,0x32,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x32,0x30,
+    0x70,0x78,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x38,0x70,0x78,0x20,0x31,0x32,0x70,0x78,
+    0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x38,0x70,0x78,0x3b,
+    0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,
+    0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,
+    0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x29,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,0x74,0x2d,0x64,0x69,0x6d,0x29,0x3b,0x62,0x6f,0x78,
+    0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,
+    0x73,0x68,0x61,0x64,0x6f,0x77,0x29,0x7d,0x2e,0x61,0x6c,0x61,0x72,0x6d,0x73,0x2d,0x63,0x6f,0x6e,0x74,
+    0x61,0x69,0x6e,0x65,0x72,0x7b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x32,0x30,0x70,0x78,0x7d,0x2e,
+    0x67,0x72,0x69,0x64,0x3a,0x66,0x69,0x72,0x73,0x74,0x2d,0x6f,0x66,0x2d,0x74,0x79,0x70,0x65,0x7b,0x6d,
+    0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x32,0x30,0x70,0x78,0x7d,0x2e,0x67,0x72,0x69,0x64,0x7b,0x64,0x69,
+    0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x67,0x72,0x69,0x64,0x3b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,
+    0x70,0x6c,0x61,0x74,0x65,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,
+    0x20,0x31,0x36,0x30,0x70,0x78,0x20,0x31,0x31,0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,0x31,0x32,0x30,
+    0x70,0x78,0x20,0x31,0x32,0x30,0x70,0x78,0x3b,0x67,0x61,0x70,0x3a,0x20,0x38,0x70,0x78,0x3b,0x61,0x6c,
+    0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x67,
+    0x72,0x69,0x64,0x2e,0x68,0x65,0x61,0x64,0x65,0x72,0x7b,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,
+    0x68,0x74,0x3a,0x20,0x37,0x30,0x30,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,
+    0x6d,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,
+    0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x2c,0x23,0x64,0x62,0x65,0x37,0x66,0x66,0x29,0x3b,
+    0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x36,0x70,0x78,0x3b,
+    0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,
+    0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x65,0x61,0x66,0x32,0x66,0x66,0x3b,
+    0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x38,0x70,0x78,0x3b,0x70,
+    0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x7d,0x2e,0x72,
+    0x6f,0x77,0x7b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x31,0x32,0x70,
+    0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,
+    0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x2c,0x23,0x64,
+    0x62,0x65,0x37,0x66,0x66,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,
+    0x3a,0x20,0x38,0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,
+    0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2c,0x23,0x66,0x66,0x66,0x29,0x3b,0x62,0x6f,0x78,0x2d,0x73,
+    0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x73,0x68,
+    0x61,0x64,0x6f,0x77,0x2c,0x30,0x20,0x34,0x70,0x78,0x20,0x31,0x36,0x70,0x78,0x20,0x72,0x67,0x62,0x61,
+    0x28,0x31,0x32,0x2c,0x35,0x37,0x2c,0x31,0x33,0x31,0x2c,0x2e,0x30,0x38,0x29,0x29,0x3b,0x6d,0x61,0x72,
+    0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x31,0x30,0x70,0x78,0x7d,0x2e,0x70,0x69,
+    0x6c,0x6c,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,
+    0x6c,0x6f,0x63,0x6b,0x3b,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x34,0x70,0x78,0x20,0x38,0x70,
+    0x78,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x32,0x70,0x78,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x20,0x31,0x32,0x70,0x78,0x3b,0x62,0x61,0x63,0x6b,0x67,0x72,
+    0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x65,0x65,0x66,0x34,0x66,0x66,0x3b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,0x74,0x2c,0x23,0x31,0x66,0x32,0x61,0x34,0x34,0x29,
+    0x3b,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x75,0x73,0x65,
+    0x72,0x2d,0x73,0x65,0x6c,0x65,0x63,0x74,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x62,0x6f,0x72,0x64,0x65,
+    0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,
+    0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,0x2c,0x23,0x64,0x62,0x65,0x37,0x66,0x66,0x29,0x3b,
+    0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
+    0x6e,0x64,0x20,0x2e,0x31,0x35,0x73,0x20,0x65,0x61,0x73,0x65,0x2c,0x63,0x6f,0x6c,0x6f,0x72,0x20,0x2e,
+    0x31,0x35,0x73,0x20,0x65,0x61,0x73,0x65,0x2c,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,
+    0x72,0x20,0x2e,0x31,0x35,0x73,0x20,0x65,0x61,0x73,0x65,0x7d,0x2e,0x70,0x69,0x6c,0x6c,0x2e,0x6f,0x6e,
+    0x7b,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,
+    0x6c,0x75,0x65,0x2d,0x35,0x30,0x30,0x2c,0x23,0x32,0x64,0x37,0x63,0x66,0x30,0x29,0x3b,0x63,0x6f,0x6c,
+    0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6f,
+    0x72,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x62,0x6c,0x75,0x65,0x2d,0x36,0x30,0x30,0x2c,0x23,0x32,
+    0x35,0x36,0x36,0x63,0x37,0x29,0x7d,0x2e,0x6d,0x75,0x74,0x65,0x64,0x7b,0x63,0x6f,0x6c,0x6f,0x72,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x74,0x65,0x78,0x74,0x2d,0x64,0x69,0x6d,0x2c,0x23,0x35,0x34,0x36,
+    0x37,0x38,0x39,0x29,0x7d,0x2e,0x72,0x69,0x67,0x68,0x74,0x7b,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,
+    0x67,0x6e,0x3a,0x20,0x72,0x69,0x67,0x68,0x74,0x7d,0x2e,0x63,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x73,0x7b,
+    0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x20,0x31,0x36,0x70,0x78,0x20,
+    0x30,0x3b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x66,0x6c,0x65,0x78,0x3b,0x67,0x61,0x70,0x3a,
+    0x20,0x38,0x70,0x78,0x3b,0x66,0x6c,0x65,0x78,0x2d,0x77,0x72,0x61,0x70,0x3a,0x20,0x77,0x72,0x61,0x70,
+    0x7d,0x69,0x6e,0x70,0x75,0x74,0x5b,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x69,0x6d,0x65,0x22,0x5d,0x7b,
+    0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x7d,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,
+    0x2d,0x77,0x72,0x61,0x70,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x66,0x6c,0x65,0x78,0x3b,
+    0x67,0x61,0x70,0x3a,0x20,0x36,0x70,0x78,0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,
+    0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x7d,0x2e,0x65,0x6e,0x61,0x62,0x6c,0x65,0x54,0x6f,0x67,0x67,
+    0x6c,0x65,0x7b,0x74,0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x20,0x73,0x63,0x61,0x6c,0x65,0x28,
+    0x31,0x2e,0x30,0x35,0x29,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,
+    0x64,0x74,0x68,0x3a,0x20,0x39,0x30,0x30,0x70,0x78,0x29,0x7b,0x2e,0x67,0x72,0x69,0x64,0x7b,0x67,0x72,
+    0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,
+    0x20,0x38,0x35,0x70,0x78,0x20,0x31,0x35,0x30,0x70,0x78,0x20,0x31,0x30,0x30,0x70,0x78,0x20,0x31,0x66,
+    0x72,0x20,0x31,0x30,0x30,0x70,0x78,0x20,0x31,0x30,0x30,0x70,0x78,0x7d,0x7d,0x2e,0x67,0x72,0x69,0x64,
+    0x2e,0x67,0x72,0x69,0x64,0x2d,0x72,0x61,0x64,0x69,0x6f,0x7b,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
+    0x20,0x67,0x72,0x69,0x64,0x3b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x2d,
+    0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x32,0x32,0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,0x32,
+    0x32,0x30,0x70,0x78,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x67,0x61,0x70,0x3a,0x20,0x31,0x30,0x70,0x78,
+    0x3b,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x69,0x74,0x65,0x6d,0x73,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,
+    0x7d,0x2e,0x65,0x6c,0x6c,0x69,0x70,0x73,0x69,0x73,0x7b,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x3a,
+    0x20,0x68,0x69,0x64,0x64,0x65,0x6e,0x3b,0x74,0x65,0x78,0x74,0x2d,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,
+    0x77,0x3a,0x20,0x65,0x6c,0x6c,0x69,0x70,0x73,0x69,0x73,0x3b,0x77,0x68,0x69,0x74,0x65,0x2d,0x73,0x70,
+    0x61,0x63,0x65,0x3a,0x20,0x6e,0x6f,0x77,0x72,0x61,0x70,0x7d,0x23,0x73,0x74,0x61,0x74,0x69,0x6f,0x6e,
+    0x4c,0x69,0x73,0x74,0x20,0x2e,0x65,0x6e,0x74,0x72,0x79,0x2e,0x72,0x6f,0x77,0x7b,0x62,0x61,0x63,0x6b,
+    0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2c,0x23,
+    0x66,0x66,0x66,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,
+    0x69,0x64,0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x62,0x6f,0x72,0x64,0x65,0x72,
+    0x2c,0x23,0x64,0x62,0x65,0x37,0x66,0x66,0x29,0x3b,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,
+    0x69,0x75,0x73,0x3a,0x20,0x38,0x70,0x78,0x3b,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,
+    0x20,0x76,0x61,0x72,0x28,0x2d,0x2d,0x63,0x61,0x72,0x64,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x2c,0x30,
+    0x20,0x34,0x70,0x78,0x20,0x31,0x36,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x31,0x32,0x2c,0x35,0x37,
+    0x2c,0x31,0x33,0x31,0x2c,0x2e,0x30,0x38,0x29,0x29,0x3b,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,
+    0x20,0x32,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x32,0x30,0x70,0x78,0x3b,0x70,0x61,0x64,0x64,
+    0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x31,0x32,0x70,0x78,0x7d,0x40,0x6d,0x65,0x64,0x69,
+    0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x39,0x30,0x30,0x70,0x78,0x29,
+    0x7b,0x2e,0x67,0x72,0x69,0x64,0x2e,0x67,0x72,0x69,0x64,0x2d,0x72,0x61,0x64,0x69,0x6f,0x7b,0x67,0x72,
+    0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x2d,0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,
+    0x20,0x31,0x38,0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,0x32,0x30,0x30,0x70,0x78,0x20,0x39,0x30,0x70,
+    0x78,0x7d,0x7d,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,
+    0x3a,0x20,0x36,0x30,0x30,0x70,0x78,0x29,0x7b,0x2e,0x67,0x72,0x69,0x64,0x2e,0x67,0x72,0x69,0x64,0x2d,
+    0x72,0x61,0x64,0x69,0x6f,0x7b,0x67,0x72,0x69,0x64,0x2d,0x74,0x65,0x6d,0x70,0x6c,0x61,0x74,0x65,0x2d,
+    0x63,0x6f,0x6c,0x75,0x6d,0x6e,0x73,0x3a,0x20,0x31,0x34,0x30,0x70,0x78,0x20,0x31,0x66,0x72,0x20,0x31,
+    0x36,0x30,0x70,0x78,0x20,0x38,0x30,0x70,0x78,0x7d,0x7d,
+};
+
+extern const WebBundleAsset webBundle[] = {
+    { "/alarms.html", "text/html", "\"fw-a9810bb41b1a\"", "\"fw-a9810bb41b1a-gz\"", alarms_html_gz, sizeof(alarms_html_gz), alarms_html_raw, sizeof(alarms_html_raw) },
+    { "/file_explorer.html", "text/html", "\"fw-5795159e2e66\"", "\"fw-5795159e2e66-gz\"", file_explorer_html_gz, sizeof(file_explorer_html_gz), file_explorer_html_raw, sizeof(file_explorer_html_raw) },
+    { "/index.html", "text/html", "\"fw-4c4ec9adc3d7\"", "\"fw-4c4ec9adc3d7-gz\"", index_html_gz, sizeof(index_html_gz), index_html_raw, sizeof(index_html_raw) },
+    { "/internet_radio.html", "text/html", "\"fw-fc6c85935abe\"", "\"fw-fc6c85935abe-gz\"", internet_radio_html_gz, sizeof(internet_radio_html_gz), internet_radio_html_raw, sizeof(internet_radio_html_raw) },
+    { "/style.css", "text/css", "\"fw-7c51f6a20334\"", "\"fw-7c51f6a20334-gz\"", style_css_gz, sizeof(style_css_gz), style_css_raw, sizeof(style_css_raw) },
+};
+extern const size_t webBundleCount = 5;
@@ -0,0 +1,31 @@
+#ifndef WEB_BUNDLE_H
+#define WEB_BUNDLE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+  Web UI built into the firmware
+
+  tools/embed_web.py runs before every build, minifies and gzips the files
+  in sdcard/ and writes them to WebBundle.cpp as constant arrays. They live
+  in flash (memory mapped), so a response hands the pointer straight to the
+  HTTP server without a copy or an SD access. WebAssets serves them when
+  the card has no file of the same name under /html.
+*/
+
+struct WebBundleAsset {
+    const char*    path;            // URL path, e.g. "/index.html"
+    const char*    contentType;
+    const char*    etag;            // Quoted, for the plain variant
+    const char*    etagGzip;        // Quoted, for the gzip variant
+    const uint8_t* gz;
+    uint32_t       gzLen;
+    const uint8_t* raw;             // Minified, for clients without gzip
+    uint32_t       rawLen;
+};
+
+extern const WebBundleAsset webBundle[];
+extern const size_t webBundleCount;
+
+#endif
@@ -4,6 +4,7 @@
 #include <WiFi.h>
 #include <Wire.h>
 #include <time.h>
+#include <sys/time.h>
 #include "lvgl.h"
 #include "LVGL_ST77916.h"
 #include "RTC_PCF85063.h"
@@ -15,6 +16,21 @@
 #include "HttpServer.h"
 #include "SD_Card.h"
 #include "AIAssistant.h"
+#include "AudioMixer.h"
+#include "TTSCache.h"
+#include "StreamMonitor.h"
+#include "Settings.h"
+#include "AlarmScheduler.h"
+#include "AudioUplink.h"
+#include "AudioDownlink.h"
+#include "FileUploader.h"
+#include "RequestSpool.h"
+#include "LatencyTrace.h"
+#include "DirCache.h"
+#include "WebAssets.h"
+#include "SdWriter.h"
+#include "MicStream.h"
+#include "EventStream.h"
 #include "esp_heap_caps.h"
 #include "esp_psram.h"
 #include "esp_partition.h"
@@ -32,12 +48,8 @@ TaskHandle_t guiTaskHandle = NULL;
 // guiTaskStackSize = 8 * 1024
 const uint32_t guiTaskStackSize = 16 * 1024;
 
-TaskHandle_t httpTaskHandle = NULL;
-// httpTaskStackSize = 8 * 1024
-const uint32_t httpTaskStackSize = 8 * 1024;
 
 static bool backlightAlreadyOff = false;
-static String last_triggered_time = "";
 
 struct tm rtcTime;  
 portMUX_TYPE rtcMux = portMUX_INITIALIZER_UNLOCKED;
@@ -68,23 +80,6 @@ void PrintAllPartitions() {
   esp_partition_iterator_release(it);
 }
 
-// Check if the alarm is due based on current time and alarm settings
-bool IsAlarmDue(const struct tm& rtcTime, const Alarm& alarm) {
-    if (!alarm.enabled) return false;
-
-    int weekday = rtcTime.tm_wday;  // 0 = Sunday
-    if (!alarm.weekdays[weekday]) return false;
-
-    char buf[6];
-    strftime(buf, sizeof(buf), "%H:%M", &rtcTime);
-    Serial.printf("Current time: %s\n", buf);
-
-    char time_now[6];
-    snprintf(time_now, sizeof(time_now), "%02d:%02d", rtcTime.tm_hour, rtcTime.tm_min);
-    Serial.printf("Checking alarm: %s vs now %s\n", alarm.time.c_str(), time_now);
-    return alarm.time == String(time_now);
-}
-
 // Set the RTC time safely across tasks
 void GetSafeRTC(struct tm* out) {
     portENTER_CRITICAL(&rtcMux);
@@ -92,51 +87,17 @@ void GetSafeRTC(struct tm* out) {
     portEXIT_CRITICAL(&rtcMux);
 }
 
-// Check all alarms and trigger if any are due
-// This function is called periodically
-void CheckAlarms() {
-    struct tm now;
-    GetSafeRTC(&now);
-    for (const Alarm& alarm : alarm_list) {
-        if (IsAlarmDue(now, alarm)) {
-            String current_time = alarm.time;
-
-            if (last_triggered_time != current_time) {
-                Serial.printf("Triggering alarm: %s\n", current_time.c_str());
-                last_triggered_time = current_time;
-
-                alarm_active = true;
-                alarm_started_ms = millis();
-
-                MIC_SR_Stop();   
-                vTaskDelay(pdMS_TO_TICKS(5));
-
-                if (audio_ptr && alarm.action_type == "mp3") {
-                    // Action: Play MP3
-                    if (!audio_ptr->connecttoFS(SD_MMC, alarm.action_path.c_str())) 
-                        Serial.println("Failed to play alarm audio");            
-                } else if (audio_ptr && alarm.action_type == "sound") {
-                    // Action: Play sound
-                    if (!audio_ptr->connecttoFS(SD_MMC, alarm.action_path.c_str())) 
-                        Serial.println("Failed to play alarm sound");                
-                } else if (audio_ptr && alarm.action_type == "radio") {
-                    // Action: Play radio stream
-                    if (!audio_ptr->connecttohost(alarm.action_path.c_str())) 
-                        Serial.println("Failed to connect to radio stream");                
-                }
-
-                // Optional: Play default tone
-                // audio_ptr->tone(1000, 3000);  // 3 sec
-
-                // Turn on LED
-                LCD_SetBacklight(true);
-
-                // Show alarm screen
-                GUI_SwitchToScreen(GUI_CreateAlarmActiveScreen, &alarm_screen);
-                break;
-            }
-        }
-    }
+// Called by the alarm scheduler once the alarm audio has been started
+static void OnAlarmStarted(const Alarm& alarm) {
+    alarm_active = true;
+    alarm_started_ms = millis();
+    EventStream_SetAlarmRinging(true);
+
+    // Turn on LED
+    LCD_SetBacklight(true);
+
+    // Show alarm screen
+    GUI_SwitchToScreen(GUI_CreateAlarmActiveScreen, &alarm_screen);
 }
 
 //**************** Thread GUI + Get RTC time *****************************************
@@ -169,6 +130,7 @@ void GUITask(void *parameter) {
         // Hard stop strictly after ALARM_AUTO_TIMEOUT_MS
         if (millis() - alarm_started_ms > ALARM_AUTO_TIMEOUT_MS) {
             alarm_active = false;
+            EventStream_SetAlarmRinging(false);
             if (audio_ptr) audio_ptr->stopSong();
 
             LCD_SetBacklight(false);
@@ -185,11 +147,6 @@ void GUITask(void *parameter) {
             Serial.printf("[GUI Task] Total stack size: %u bytes, Min free stack: %u words (%u bytes)\n",
                           guiTaskStackSize, watermark, watermark * sizeof(StackType_t));
         }
-        if (httpTaskHandle) {
-            UBaseType_t watermark_http = uxTaskGetStackHighWaterMark(httpTaskHandle);
-            Serial.printf("[HTTP Task] Total stack size: %u bytes, Min free stack: %u words (%u bytes)\n",
-                          httpTaskStackSize, watermark_http, watermark_http * sizeof(StackType_t));
-        }
     }
 
     lv_timer_handler(); // Call LVGL timer handler - execution context
@@ -198,14 +155,6 @@ void GUITask(void *parameter) {
   }
 }
 
-//**************** Thread HTTP *****************************************
-void HttpTask(void*) {
-  for (;;) {
-     HttpServer_Loop();  // Process HTTP requests
-    vTaskDelay(pdMS_TO_TICKS(2)); // yield a bit
-  }
-}
-
 void sr_setup()
 {
   srmodel_list_t *models = esp_srmodel_init("model");
@@ -233,22 +182,40 @@ static inline void enqueue_gui_msg(const char* s) {
 
 // Single callback for all audio events (v3.4.2+)
 static void my_audio_info(Audio::msg_t m) {
+  // The voice decoder mixed over music reports here too: its title, info and
+  // end of file must not touch the now-playing text, the stream monitor or the alarm
+  if (AudioMixer_IsVoiceCall()) {
+    Serial.printf("voice: ............ %s\n", m.msg ? m.msg : "");
+    return;
+  }
   switch (m.e) {
     //Show on the GUI (scroll when long, center when short)
     case Audio::evt_id3data:        // ID3/metadata
+      if (m.msg && strncmp(m.msg, "Title: ", 7) == 0) EventStream_SetTitle(m.msg + 7);
+      enqueue_gui_msg(m.msg);
+      break;
     case Audio::evt_name:           // station name / icy-name
+      EventStream_SetStation(m.msg);
+      enqueue_gui_msg(m.msg);
+      break;
     case Audio::evt_streamtitle:    // stream title (current song)
+      EventStream_SetTitle(m.msg);
       enqueue_gui_msg(m.msg);
       break;
 
     // Everything else -> just log
     case Audio::evt_info:
-      Serial.printf("info: ............. %s\n", m.msg); break;
+      Serial.printf("info: ............. %s\n", m.msg);
+      StreamMonitor_OnAudioInfo(m.msg);
+      break;
     case Audio::evt_eof:
       Serial.printf("end of file: ...... %s\n", m.msg);
+      EventStream_SetStation(nullptr);
+      EventStream_SetTitle(nullptr);
 
       // Clear alarm state 
       alarm_active = false;
+      EventStream_SetAlarmRinging(false);
       break;
     case Audio::evt_bitrate:
       Serial.printf("bitrate: .......... %s\n", m.msg); break;
@@ -284,6 +251,9 @@ void setup() {
 
   pinMode(BUTTON_PIN, INPUT_PULLUP);
 
+  // Persistent settings (NVS), needed before audio restores the volume
+  Settings_Init();
+
   // Initialize LCD
   Lvgl_Init();
 
@@ -325,6 +295,12 @@ void setup() {
     gfx->println(timeStr);
   } else {
     Serial.println("NTP Failed, using RTC");
+    // Seed the system clock from the RTC, the alarm scheduler runs on it
+    struct tm rtc;
+    if (RTC_GetTime(&rtc)) {
+      struct timeval tv = { mktime(&rtc), 0 };
+      settimeofday(&tv, nullptr);
+    }
     gfx->setCursor(75, 130+40);
     gfx->println("NTP Failed!");
   }
@@ -332,10 +308,16 @@ void setup() {
   // Initialize sd card
   Serial.println("Setup SD card");
   SD_Init();
+  DirCache_Init();
+  WebAssets_Init();
+  SdWriter_Init();
 
   // Load alarms from SD card
   LoadAlarms();
 
+  // TTS cache index lives on the SD card
+  TTSCache_Init();
+
   // Write srmodels.bin to partition if needed
   write_srmodels_bin_to_partition_if_needed();
 
@@ -361,6 +343,9 @@ void setup() {
   GUI_Init(audio);
   // GUI_MessageQueueInit();
 
+  // Alarms are pre-warmed and fired on the exact second
+  AlarmScheduler_Init(audio, OnAlarmStarted);
+
   Serial.println("Setup Http Server");
   HttpServer_Begin(audio);
   gfx->setCursor(75, 190+40);
@@ -374,17 +359,6 @@ void setup() {
   delay(100); // Wait before starting threads
   Serial.println("Setup new threads");
 
-  // Create Task for HTTP Server
-  xTaskCreatePinnedToCore(
-    HttpTask, 
-    "HttpTask",
-    httpTaskStackSize,    // 8kB stack size
-    nullptr,              // task parameters
-    1,                    // lower priority than GUI
-    &httpTaskHandle,      // task handle
-    0                     // core 0
-  );
-
   // Create Task for GUI Updates
   xTaskCreatePinnedToCore(
     GUITask,             // Task function
@@ -415,9 +389,24 @@ void loop() {
         last = millis();
         Serial.printf("[FreeHeap] %u bytes, Min Ever: %u\n", ESP.getFreeHeap(), ESP.getMinFreeHeap());
         Serial.printf("[PSRAM] Used: %d, Free: %d, Total: %d\n",ESP.getPsramSize()-ESP.getFreePsram(), ESP.getFreePsram(), ESP.getPsramSize());
-
-        // Check alarms every minute
-        CheckAlarms();
+        AudioMixer_PrintStats();
+        TTSCache_PrintStats();
+        StreamMonitor_PrintStats();
+        Serial.printf("[Settings] Flash writes: %u, coalesced: %u\n", Settings_GetFlashWrites(), Settings_GetCoalescedWrites());
+        AlarmScheduler_PrintStats();
+        AIAssistant_PrintLinkStats();
+        AudioUplink_PrintStats();
+        AudioDownlink_PrintStats();
+        FileUploader_PrintStats();
+        RequestSpool_PrintStats();
+        LatencyTrace_PrintStats();
+        HttpServer_PrintStats();
+        DirCache_PrintStats();
+        WebAssets_PrintStats();
+        SdWriter_PrintStats();
+        MicStream_PrintStats();
+        EventStream_PrintStats();
+        AIAssistant_SendTelemetry();
     }
 
     // Check if the backlight should be turned off
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Packs the web UI from sdcard/ into the firmware (src/WebBundle.cpp).
+
+Every *.html, *.css and *.js file in sdcard/ is minified, gzipped and
+written as constexpr byte arrays together with its content type and an
+ETag (hash of the minified content), so the server can send it straight
+out of flash. Both the gzip and the plain minified form are kept, for the
+rare client without gzip. Files on the SD card under /html still take
+precedence, see src/WebAssets.h.
+
+Runs before every build as a PlatformIO extra script (platformio.ini:
+extra_scripts = pre:tools/embed_web.py) and only rewrites the output when
+its content changes, so an unchanged UI does not trigger a recompile. It
+also runs on its own:
+
+    python3 tools/embed_web.py
+
+Standard library only.
+"""
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+SOURCE_DIR = os.path.join(PROJECT_DIR, "sdcard")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "WebBundle.cpp")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+KEEP_BLOCKS = re.compile(r"(<(pre|textarea)\b.*?</\2>)", re.IGNORECASE | re.DOTALL)
+
+
+def strip_lines(text):
+    """Trims every line and drops empty ones; line breaks stay, so inline scripts keep working."""
+    return "\n".join(line.strip() for line in text.splitlines() if line.strip())
+
+
+def minify_html(text):
+    text = re.sub(r"<!--(?!\[if).*?-->", "", text, flags=re.DOTALL)
+    # <pre> and <textarea> content is whitespace sensitive
+    parts = KEEP_BLOCKS.split(text)
+    out = []
+    i = 0
+    while i < len(parts):
+        if i % 3 == 0:
+            out.append(strip_lines(parts[i]))
+        else:
+            out.append(parts[i])
+            i += 1      # Skip the tag name group
+        i += 1
+    return "\n".join(part for part in out if part)
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.DOTALL)
+    text = strip_lines(text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    return text.replace(";}", "}")
+
+
+def minify(name, text):
+    if name.endswith(".html"):
+        return minify_html(text)
+    if name.endswith(".css"):
+        return minify_css(text)
+    return strip_lines(text)
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 20):
+        lines.append("    " + ",".join(f"0x{b:02x}" for b in data[i:i + 20]) + ",")
+    return f"constexpr uint8_t {name}[] = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+def generate():
+    names = sorted(n for n in os.listdir(SOURCE_DIR) if os.path.splitext(n)[1] in CONTENT_TYPES)
+    arrays, rows = [], []
+    total_plain = total_raw = total_gz = 0
+    for name in names:
+        with open(os.path.join(SOURCE_DIR, name), encoding="utf-8") as f:
+            source = f.read()
+        plain = minify(name, source).encode("utf-8")
+        packed = gzip.compress(plain, compresslevel=9, mtime=0)
+        etag = "fw-" + hashlib.sha1(plain).hexdigest()[:12]
+        ident = re.sub(r"\W", "_", name)
+        arrays.append(c_array(f"{ident}_gz", packed))
+        arrays.append(c_array(f"{ident}_raw", plain))
+        ctype = CONTENT_TYPES[os.path.splitext(name)[1]]
+        rows.append(f'    {{ "/{name}", "{ctype}", "\\"{etag}\\"", "\\"{etag}-gz\\"", '
+                    f"{ident}_gz, sizeof({ident}_gz), {ident}_raw, sizeof({ident}_raw) }},")
+        total_plain += len(source.encode("utf-8"))
+        total_raw += len(plain)
+        total_gz += len(packed)
+
+    body = (
+        "// WebBundle.cpp - Generated by tools/embed_web.py from sdcard/, do not edit\n"
+        "#include \"WebBundle.h\"\n\n"
+        + "\n".join(arrays)
+        + "\nextern const WebBundleAsset webBundle[] = {\n"
+        + "\n".join(rows)
+        + "\n};\n"
+        + f"extern const size_t webBundleCount = {len(rows)};\n"
+    )
+    return body, (len(rows), total_plain, total_raw, total_gz)
+
+
+def main():
+    body, (count, plain, raw, packed) = generate()
+    try:
+        with open(OUTPUT, encoding="utf-8") as f:
+            if f.read() == body:
+                return
+    except FileNotFoundError:
+        pass
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(body)
+    print(f"embed_web: {count} files, {plain} bytes -> {raw} minified -> {packed} gzip in {os.path.relpath(OUTPUT, PROJECT_DIR)}")
+
+
+main()
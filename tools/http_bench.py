@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+"""Concurrency / requests-per-second benchmark for the device web server.
+
+Runs N client threads against one route for a fixed time, each on its own
+keep-alive connection, and reports requests/s and latency percentiles per
+concurrency level. With --background a long request (the microphone
+/stream, a large /download) is kept running meanwhile, which is the case
+the old single-threaded server could not handle: every other route waited
+until the transfer was done.
+
+    python3 tools/http_bench.py 192.168.0.32
+    python3 tools/http_bench.py 192.168.0.32 --path /status -c 1,2,4,6
+    python3 tools/http_bench.py 192.168.0.32 --background /stream
+    python3 tools/http_bench.py 192.168.0.32 --background "/download?path=/music/big.mp3"
+
+With --page it instead loads a page the way a browser does (the HTML, then
+every local script, stylesheet and image it references, over one keep-alive
+connection) and reports page load time for a cold load and for a reload
+that revalidates with If-None-Match:
+
+    python3 tools/http_bench.py 192.168.0.32 --page / -n 10
+
+With --range it measures what Range requests buy on a large file: the full
+download, seeks to random offsets (64 KB from each, as a player does)
+compared with reading up to the offset, and resuming a download cut off
+halfway:
+
+    python3 tools/http_bench.py 192.168.0.32 --range "/download?path=/music/big.mp3"
+
+Standard library only.
+"""
+import argparse
+import gzip
+import http.client
+import random
+import re
+import statistics
+import threading
+import time
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    k = min(len(values) - 1, int(round(p / 100.0 * (len(values) - 1))))
+    return values[k]
+
+
+class Background(threading.Thread):
+    """Reads a long response until stopped, counting bytes."""
+
+    def __init__(self, host, port, path):
+        super().__init__(daemon=True)
+        self.host, self.port, self.path = host, port, path
+        self.bytes = 0
+        self.status = None
+        self.error = None
+        self.stop = threading.Event()
+
+    def run(self):
+        try:
+            conn = http.client.HTTPConnection(self.host, self.port, timeout=10)
+            conn.request("GET", self.path)
+            resp = conn.getresponse()
+            self.status = resp.status
+            while not self.stop.is_set():
+                chunk = resp.read(4096)
+                if not chunk:
+                    break
+                self.bytes += len(chunk)
+            conn.close()
+        except Exception as e:  # noqa: BLE001 - reported in the summary
+            self.error = str(e)
+
+
+def worker(host, port, path, deadline, latencies, counters, lock):
+    conn = None
+    while time.monotonic() < deadline:
+        if conn is None:
+            conn = http.client.HTTPConnection(host, port, timeout=10)
+        start = time.monotonic()
+        try:
+            conn.request("GET", path)
+            resp = conn.getresponse()
+            resp.read()
+            elapsed = (time.monotonic() - start) * 1000.0
+            with lock:
+                if resp.status == 200:
+                    latencies.append(elapsed)
+                elif resp.status == 503:
+                    counters["busy"] += 1
+                else:
+                    counters["errors"] += 1
+            if resp.getheader("Connection", "").lower() == "close":
+                conn.close()
+                conn = None
+        except (OSError, http.client.HTTPException):
+            with lock:
+                counters["errors"] += 1
+            conn.close()
+            conn = None
+    if conn:
+        conn.close()
+
+
+ASSET_RE = re.compile(r'(?:src|href)\s*=\s*["\']([^"\'#?]+)', re.IGNORECASE)
+
+
+def page_assets(html, page_path):
+    """Local URLs referenced by a page, resolved against its directory."""
+    base = page_path.rsplit("/", 1)[0] + "/"
+    assets = []
+    for ref in ASSET_RE.findall(html):
+        if "://" in ref or ref.startswith(("//", "data:", "mailto:", "javascript:")):
+            continue
+        url = ref if ref.startswith("/") else base + ref
+        if url not in assets and url != page_path:
+            assets.append(url)
+    return assets
+
+
+def load_page(host, port, path, etags):
+    """Fetches a page and its assets; returns (ms, bytes, requests, 304s). Fills/uses 'etags'."""
+    conn = http.client.HTTPConnection(host, port, timeout=10)
+    start = time.monotonic()
+    total_bytes = requests = not_modified = 0
+    queue = [path]
+    i = 0
+    while i < len(queue):
+        url = queue[i]
+        i += 1
+        headers = {"Accept-Encoding": "gzip"}
+        if url in etags:
+            headers["If-None-Match"] = etags[url]
+        conn.request("GET", url, headers=headers)
+        resp = conn.getresponse()
+        body = resp.read()
+        requests += 1
+        total_bytes += len(body)
+        if resp.status == 304:
+            not_modified += 1
+        elif resp.status == 200:
+            if resp.getheader("ETag"):
+                etags[url] = resp.getheader("ETag")
+            if i == 1 and "html" in resp.getheader("Content-Type", ""):
+                if resp.getheader("Content-Encoding", "") == "gzip":
+                    body = gzip.decompress(body)
+                queue += page_assets(body.decode("utf-8", "replace"), "/index.html" if url == "/" else url)
+        if url == path and resp.status == 304:
+            # Page unchanged: a browser revalidates the assets it already knows
+            queue += [u for u in etags if u != path and u not in queue]
+    conn.close()
+    return (time.monotonic() - start) * 1000.0, total_bytes, requests, not_modified
+
+
+def run_page(host, port, path, count):
+    print(f"page load {path} on {host}:{port}, {count} loads each")
+    print(f"{'mode':>6} {'reqs':>5} {'304':>5} {'KB':>8} {'p50 ms':>8} {'p95 ms':>8} {'max ms':>8}")
+    for mode in ("cold", "warm"):
+        times = []
+        shared = {}
+        if mode == "warm":
+            load_page(host, port, path, shared)  # Prime the ETags like a browser cache
+        for _ in range(count):
+            etags = dict(shared) if mode == "warm" else {}
+            ms, nbytes, reqs, nm = load_page(host, port, path, etags)
+            times.append(ms)
+        print(f"{mode:>6} {reqs:>5} {nm:>5} {nbytes / 1024:>8.1f} "
+              f"{percentile(times, 50):>8.1f} {percentile(times, 95):>8.1f} {max(times):>8.1f}")
+
+
+def timed_get(host, port, path, headers=None, stop_after=None):
+    """GET; returns (status, headers, bytes read, ms). Stops reading after 'stop_after' bytes."""
+    conn = http.client.HTTPConnection(host, port, timeout=30)
+    start = time.monotonic()
+    conn.request("GET", path, headers=headers or {})
+    resp = conn.getresponse()
+    got = 0
+    while stop_after is None or got < stop_after:
+        chunk = resp.read(16384)
+        if not chunk:
+            break
+        got += len(chunk)
+    ms = (time.monotonic() - start) * 1000.0
+    conn.close()
+    return resp.status, resp, got, ms
+
+
+def run_range(host, port, path, seeks):
+    status, resp, size, full_ms = timed_get(host, port, path)
+    if status != 200:
+        print(f"GET {path}: HTTP {status}")
+        return
+    rate = size / full_ms if full_ms else 0.0      # bytes per ms
+    etag = resp.getheader("ETag")
+    print(f"{path}: {size} bytes in {full_ms:.0f} ms ({rate / 1000:.2f} MB/s), "
+          f"Accept-Ranges: {resp.getheader('Accept-Ranges')}, ETag: {etag}")
+
+    span = 65536
+    times, skipped = [], []
+    for _ in range(seeks):
+        offset = random.randrange(0, max(1, size - span))
+        status, _, got, ms = timed_get(host, port, path, {"Range": f"bytes={offset}-{offset + span - 1}"})
+        if status != 206:
+            print(f"seek to {offset}: HTTP {status}, Range not honoured")
+            return
+        times.append(ms)
+        skipped.append((offset + got) / rate if rate else 0.0)
+    print(f"seek + 64 KB: p50 {percentile(times, 50):.0f} ms, max {max(times):.0f} ms; "
+          f"reading up to the offset instead: avg {statistics.mean(skipped):.0f} ms")
+
+    half = size // 2
+    _, _, first, first_ms = timed_get(host, port, path, stop_after=half)
+    headers = {"Range": f"bytes={first}-"}
+    if etag:
+        headers["If-Range"] = etag
+    status, resp, rest, rest_ms = timed_get(host, port, path, headers)
+    ok = status == 206 and first + rest == size
+    print(f"resume at {first}: HTTP {status}, {resp.getheader('Content-Range')}, "
+          f"{first_ms + rest_ms:.0f} ms total vs {full_ms + first_ms:.0f} ms restarting"
+          + ("" if ok else " (size mismatch!)"))
+
+    status, resp, got, _ = timed_get(host, port, path, {"Range": "bytes=0-99,-100"})
+    print(f"two ranges: HTTP {status}, {resp.getheader('Content-Type')}, {got} bytes")
+
+
+def run_level(host, port, path, concurrency, duration):
+    latencies = []
+    counters = {"errors": 0, "busy": 0}
+    lock = threading.Lock()
+    deadline = time.monotonic() + duration
+    threads = [threading.Thread(target=worker, args=(host, port, path, deadline, latencies, counters, lock))
+               for _ in range(concurrency)]
+    started = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    wall = time.monotonic() - started
+    return {
+        "concurrency": concurrency,
+        "ok": len(latencies),
+        "rps": len(latencies) / wall if wall else 0.0,
+        "p50": percentile(latencies, 50),
+        "p95": percentile(latencies, 95),
+        "p99": percentile(latencies, 99),
+        "max": max(latencies) if latencies else 0.0,
+        "mean": statistics.mean(latencies) if latencies else 0.0,
+        **counters,
+    }
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    ap.add_argument("host", help="device IP or host name")
+    ap.add_argument("--port", type=int, default=80)
+    ap.add_argument("--path", default="/volume", help="route to hammer (default: /volume)")
+    ap.add_argument("-c", "--concurrency", default="1,2,4", help="comma separated client counts")
+    ap.add_argument("-d", "--duration", type=float, default=10.0, help="seconds per level")
+    ap.add_argument("--background", help="long request kept running during the test, e.g. /stream")
+    ap.add_argument("--page", help="measure page load time of this page and its assets instead, e.g. /")
+    ap.add_argument("-n", "--loads", type=int, default=10, help="page loads per mode with --page")
+    ap.add_argument("--range", help="measure seeking/resuming on this large file instead")
+    ap.add_argument("--seeks", type=int, default=10, help="random seeks with --range")
+    args = ap.parse_args()
+
+    if args.range:
+        run_range(args.host, args.port, args.range, args.seeks)
+        return
+
+    if args.page:
+        run_page(args.host, args.port, args.page, args.loads)
+        return
+
+    bg = None
+    if args.background:
+        bg = Background(args.host, args.port, args.background)
+        bg.start()
+        time.sleep(1.0)  # Let it get going before measuring
+        if bg.error or (bg.status is not None and bg.status != 200):
+            print(f"background request failed: {bg.error or bg.status}")
+
+    print(f"GET {args.path} on {args.host}:{args.port}, {args.duration:.0f} s per level"
+          + (f", background {args.background}" if bg else ""))
+    print(f"{'clients':>7} {'req/s':>8} {'ok':>6} {'503':>5} {'err':>5} "
+          f"{'p50 ms':>8} {'p95 ms':>8} {'p99 ms':>8} {'max ms':>8}")
+    bg_start_bytes, bg_start = (bg.bytes, time.monotonic()) if bg else (0, 0)
+    for level in [int(x) for x in args.concurrency.split(",") if x.strip()]:
+        r = run_level(args.host, args.port, args.path, level, args.duration)
+        print(f"{r['concurrency']:>7} {r['rps']:>8.1f} {r['ok']:>6} {r['busy']:>5} {r['errors']:>5} "
+              f"{r['p50']:>8.1f} {r['p95']:>8.1f} {r['p99']:>8.1f} {r['max']:>8.1f}")
+
+    if bg:
+        elapsed = time.monotonic() - bg_start
+        alive = bg.is_alive()
+        bg.stop.set()
+        rate = (bg.bytes - bg_start_bytes) / elapsed / 1024 if elapsed else 0.0
+        print(f"background {args.background}: {bg.bytes} bytes, {rate:.1f} KB/s during the test"
+              + ("" if alive else " (ended early)"))
+
+
+if __name__ == "__main__":
+    main()
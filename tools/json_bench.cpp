@@ -0,0 +1,124 @@
+// json_bench.cpp - Host benchmark: assistant WebSocket message parsing, old ArduinoJson path vs AssistantMessage
+//
+//   g++ -O2 -std=c++17 -Isrc -I<path to ArduinoJson>/src tools/json_bench.cpp src/AssistantMessage.cpp -o json_bench
+//   ./json_bench
+//
+// Without ArduinoJson on the include path only the new parser is measured.
+// Both paths start from the bytes as the WebSocket library delivers them and
+// include the one copy each makes (String for the old path, the in-place
+// parser's scratch buffer standing in for the library's receive buffer).
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+#include "AssistantMessage.h"
+
+#if __has_include(<ArduinoJson.h>)
+#include <ArduinoJson.h>
+#define HAVE_ARDUINOJSON 1
+#endif
+
+// Heap allocations per parse
+static size_t allocCount = 0;
+void* operator new(size_t n) {
+    allocCount++;
+    if (void* p = malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+struct Result {
+    bool ok;
+    size_t contentLen;
+    uint32_t rid;
+    int64_t tx;
+};
+
+#ifdef HAVE_ARDUINOJSON
+// What onMessageCallback did before: String copy, prefix check, StaticJsonDocument
+static Result parseOld(const std::string& wire) {
+    Result r = {};
+    const std::string msg = wire;
+    if (msg.rfind("{", 0) != 0) return r;
+    StaticJsonDocument<1024> doc;
+    if (deserializeJson(doc, msg)) return r;
+    const char* type = doc["type"] | "unknown";
+    const char* content = doc["content"] | "";
+    (void)type;
+    JsonVariant trace = doc["trace"];
+    r.ok = true;
+    r.contentLen = strlen(content);
+    r.rid = doc["rid"] | 0UL;
+    r.tx = trace["tx"] | 0LL;
+    return r;
+}
+#endif
+
+static Result parseNew(const std::string& wire, char* scratch) {
+    Result r = {};
+    memcpy(scratch, wire.data(), wire.size());
+    AssistantMessage m;
+    if (AssistantMessage_Parse(scratch, wire.size(), &m)) return r;
+    r.ok = true;
+    r.contentLen = m.content_len;
+    r.rid = m.rid;
+    r.tx = m.trace_tx;
+    return r;
+}
+
+static std::string reply(size_t contentChars) {
+    // GPT style text: sentences, newlines and some non-ASCII escapes as Python's json.dumps writes them
+    static const char* words[] = { "The", "alarm", "is", "set", "for", "seven", "o'clock,", "caf\\u00e9", "\\u00fcber", "weather" };
+    std::string content;
+    for (size_t i = 0; content.size() < contentChars; ++i) {
+        content += words[i % 10];
+        content += (i % 17 == 16) ? ".\\n" : " ";
+    }
+    return "{\"sender\": \"140298811212368\", \"type\": \"ASSISTANT_TEXT_RESPONSE\", \"content\": \"" + content +
+           "\", \"language\": \"en\", \"mode\": \"chat\", \"audio\": \"stream\", \"rid\": 2147549185, "
+           "\"trace\": {\"rx\": 1760870000123, \"stt_start\": 1760870000125, \"stt_end\": 1760870000900, "
+           "\"llm_end\": 1760870002100, \"tx\": 1760870002101}, \"history\": [\"user\", \"assistant\"]}";
+}
+
+template <typename F>
+static void run(const char* label, const std::string& wire, int iterations, F parse) {
+    Result r = parse(wire);
+    const size_t allocs0 = allocCount;
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) r = parse(wire);
+    const auto t1 = std::chrono::steady_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+    printf("  %-6s %9.0f ns/msg  %5.2f allocs/msg  %s", label, ns, (double)(allocCount - allocs0) / iterations,
+           r.ok ? "ok" : "FAILED");
+    if (r.ok) printf(", content %zu bytes, rid %u, trace.tx %lld", r.contentLen, r.rid, (long long)r.tx);
+    printf("\n");
+}
+
+int main() {
+    const std::vector<std::pair<const char*, std::string>> messages = {
+        { "HELLO", "{\"type\": \"HELLO\", \"sender\": \"140298811212368\"}" },
+        { "AUDIO_STREAM_START", "{\"type\": \"AUDIO_STREAM_START\", \"stream_id\": 17, \"codec\": \"pcm16\", \"sample_rate\": 24000}" },
+        { "reply 200 B", reply(200) },
+        { "reply 900 B", reply(900) },
+        { "reply 4 kB", reply(4096) },
+        { "reply 16 kB", reply(16384) },
+    };
+
+    std::vector<char> scratch(64 * 1024);
+    for (const auto& m : messages) {
+        const int iterations = m.second.size() > 4096 ? 20000 : 200000;
+        printf("%s (%zu bytes on the wire)\n", m.first, m.second.size());
+#ifdef HAVE_ARDUINOJSON
+        run("old", m.second, iterations, [](const std::string& w) { return parseOld(w); });
+#endif
+        run("new", m.second, iterations, [&](const std::string& w) { return parseNew(w, scratch.data()); });
+    }
+#ifndef HAVE_ARDUINOJSON
+    printf("\nArduinoJson not on the include path, old path not measured\n");
+#endif
+    return 0;
+}